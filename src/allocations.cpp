@@ -0,0 +1,35 @@
+#include <allocations.h>
+
+volatile uint32_t AllocationCount = 0;
+static TaskHandle_t AllocationTask = NULL;
+
+void AllocationCountTask(TaskHandle_t task) {
+  AllocationTask = task;
+}
+
+#if ALLOCATION_COUNTER
+static inline void AllocationCounted() {
+  if (AllocationTask && xTaskGetCurrentTaskHandle() == AllocationTask) { AllocationCount++; }
+}
+
+extern "C" {
+  void *__real_malloc(size_t size);
+  void *__real_calloc(size_t count, size_t size);
+  void *__real_realloc(void *pointer, size_t size);
+
+  void *__wrap_malloc(size_t size) {
+    AllocationCounted();
+    return __real_malloc(size);
+  }
+
+  void *__wrap_calloc(size_t count, size_t size) {
+    AllocationCounted();
+    return __real_calloc(count, size);
+  }
+
+  void *__wrap_realloc(void *pointer, size_t size) {
+    AllocationCounted();
+    return __real_realloc(pointer, size);
+  }
+}
+#endif
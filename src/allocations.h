@@ -0,0 +1,18 @@
+// Heap allocation counter
+// With ALLOCATION_COUNTER (build flag, link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc)
+// every malloc/calloc/realloc made by one task - the render task, set with
+// AllocationCountTask() - is counted. The display statistics compare it before and after
+// each frame: the render path is expected to allocate nothing.
+
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef ALLOCATION_COUNTER
+#define ALLOCATION_COUNTER 0
+#endif
+
+extern volatile uint32_t AllocationCount;
+
+// Only allocations made by this task are counted, NULL stops counting
+void AllocationCountTask(TaskHandle_t task);
@@ -0,0 +1,247 @@
+// Table driven CAN signal decoder
+// Every signal the firmware reads from the bus is described by one row in CanSignalTable.
+// The frame table, the required DLC per frame and a specialised extractor per signal are
+// generated from it at compile time. Decoding does no allocations and has no per-ID switch.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <utility>
+
+enum CanSignal : uint8_t {
+  // 0x580 Main Battery Voltage and Current
+  SignalCurrent,
+  SignalVolt,
+  SignalSoC,
+  // 0x581 Electronic control Unit (ECU)
+  SignalODO,
+  SignalSpeed,
+  // 0x582 Onboard Charger
+  SignalOBCRemainingMinutes,
+  // 0x593 12V Battery
+  SignalBattery,
+  // 0x594 Main Battery Temperature
+  SignalTemp1,
+  SignalTemp2,
+  // 0x713 Display
+  SignalGear,
+  SignalRemainingDistance,
+  SignalReady,
+  // 0x714 Handbrake
+  SignalHandbrake,
+
+  SignalCount
+};
+static_assert(SignalCount <= 32, "Signal bitmasks are 32 bit");
+
+enum CanInvalidPolicy : uint8_t {
+  InvalidKeep,        // raw value outside valid range: keep previous value, signal not updated
+  InvalidSubstitute,  // raw value outside valid range: report invalidValue
+};
+
+enum CanGear : int8_t { GearR = 0, GearN = 1, GearD = 2, GearNone = 3, GearUnknown = 4 }; // GearUnknown: nothing received yet
+
+struct CanSignalDesc {
+  CanSignal signal;
+  uint16_t id;
+  uint8_t startBit;         // Intel: position of the LSB, Motorola: position of the MSB (DBC numbering)
+  uint8_t length;           // bits, max 25
+  bool bigEndian;           // false = Intel byte order, true = Motorola byte order
+  bool isSigned;            // two's complement
+  float scale;              // physical = raw * scale + offset
+  float offset;
+  int32_t rawMin;           // valid raw range (inclusive), checked before scaling
+  int32_t rawMax;
+  CanInvalidPolicy onInvalid;
+  float invalidValue;
+  const int8_t *valueMap;   // optional lookup for enumerations, 2^length entries, replaces scale/offset
+};
+
+// Enumeration lookups
+constexpr int8_t CanReadyMap[8] = { -1, -1, -1, 0, -1, 1, -1, -1 }; // 0b101 = Ready, 0b011 = Not ready, else unknown
+
+constexpr CanSignalDesc CanSignalTable[] = {
+  //  signal                     id     start len  big    signed scale        offset rawMin  rawMax    policy             invalid  map
+  { SignalCurrent,             0x580,   0,  16, false, true,  0.1f,         0.0f, -32768,  32767,   InvalidKeep,       0.0f,   nullptr },
+  { SignalVolt,                0x580,  16,  16, false, false, 0.01f,        0.0f,   4201,   6499,   InvalidKeep,       0.0f,   nullptr },
+  { SignalSoC,                 0x580,  40,   8, false, false, 1.0f,         0.0f,      0,    255,   InvalidKeep,       0.0f,   nullptr },
+  { SignalODO,                 0x581,  32,  24, false, false, 1.0f,         0.0f,      0, 0xFFFFFF, InvalidKeep,       0.0f,   nullptr },
+  { SignalSpeed,               0x581,  56,   8, false, false, 1.0f,         0.0f,      0,    255,   InvalidKeep,       0.0f,   nullptr },
+  { SignalOBCRemainingMinutes, 0x582,   0,  16, false, false, 1.0f / 60.0f, 0.0f,      0,  36059,   InvalidSubstitute, -1.0f,  nullptr }, // > 600 min = not charging
+  { SignalBattery,             0x593,   0,  16, false, false, 0.01f,        0.0f,      0,  65535,   InvalidKeep,       0.0f,   nullptr },
+  { SignalTemp1,               0x594,   0,   8, false, true,  1.0f,         0.0f,   -128,    127,   InvalidKeep,       0.0f,   nullptr },
+  { SignalTemp2,               0x594,  24,   8, false, true,  1.0f,         0.0f,   -128,    127,   InvalidKeep,       0.0f,   nullptr },
+  { SignalGear,                0x713,   7,   2, false, false, 1.0f,         0.0f,      0,      3,   InvalidKeep,       0.0f,   nullptr }, // CanGear
+  { SignalRemainingDistance,   0x713,   0,   6, false, false, 1.0f,         0.0f,      0,     63,   InvalidKeep,       0.0f,   nullptr },
+  { SignalReady,               0x713,  16,   3, false, false, 1.0f,         0.0f,      0,      7,   InvalidKeep,       0.0f,   CanReadyMap },
+  { SignalHandbrake,           0x714,   0,   8, false, false, 1.0f,         0.0f,      0,      1,   InvalidSubstitute, -1.0f,  nullptr }, // 1=On, 0=Off, -1=Unknown
+};
+
+// Table checks ========================================================================================
+
+constexpr bool CanSignalTableIsValid() {
+  if (sizeof(CanSignalTable) / sizeof(CanSignalTable[0]) != SignalCount) { return false; }
+  for (size_t i = 0; i < SignalCount; i++) {
+    const CanSignalDesc &d = CanSignalTable[i];
+    if (d.signal != i) { return false; }                                    // rows in enum order
+    if (d.length == 0 || d.length > 25) { return false; }                   // fits into 4 bytes
+    if (i > 0 && CanSignalTable[i - 1].id > d.id) { return false; }         // grouped by ascending ID
+    if (d.id > 0x7FF) { return false; }                                     // standard IDs only
+  }
+  return true;
+}
+static_assert(CanSignalTableIsValid(), "CanSignalTable: rows must follow CanSignal order, be grouped by ascending ID and hold standard IDs with 1..25 bits");
+
+// Bit geometry ========================================================================================
+
+constexpr uint8_t CanSignalFirstByte(const CanSignalDesc &d) { return d.startBit / 8; }
+constexpr uint8_t CanSignalLastByte(const CanSignalDesc &d) {
+  return d.bigEndian ? (uint8_t)(d.startBit / 8 + (d.length - (d.startBit % 8) - 1 + 7) / 8)
+                     : (uint8_t)((d.startBit + d.length - 1) / 8);
+}
+constexpr uint8_t CanSignalBytes(const CanSignalDesc &d) { return CanSignalLastByte(d) - CanSignalFirstByte(d) + 1; }
+
+// Frame table =========================================================================================
+
+struct CanFrameDesc {
+  uint16_t id;
+  uint8_t dlc;            // minimum DLC to carry all signals of the frame
+  uint8_t firstSignal;
+  uint8_t signalCount;
+};
+
+constexpr size_t CanFrameCountFromTable() {
+  size_t count = 0;
+  for (size_t i = 0; i < SignalCount; i++) {
+    if (i == 0 || CanSignalTable[i].id != CanSignalTable[i - 1].id) { count++; }
+  }
+  return count;
+}
+constexpr size_t CanFrameCount = CanFrameCountFromTable();
+
+struct CanFrameTableT { CanFrameDesc frames[CanFrameCount]; };
+
+constexpr CanFrameTableT CanFrameTableFromSignals() {
+  CanFrameTableT table = {};
+  size_t f = 0;
+  for (size_t i = 0; i < SignalCount; i++) {
+    const CanSignalDesc &d = CanSignalTable[i];
+    if (i > 0 && d.id != CanSignalTable[i - 1].id) { f++; }
+    CanFrameDesc &frame = table.frames[f];
+    if (frame.signalCount == 0) {
+      frame.id = d.id;
+      frame.firstSignal = i;
+    }
+    frame.signalCount++;
+    if (CanSignalLastByte(d) + 1 > frame.dlc) { frame.dlc = CanSignalLastByte(d) + 1; }
+  }
+  return table;
+}
+constexpr CanFrameTableT CanFrameTable = CanFrameTableFromSignals();
+
+// Standard ID -> index into CanFrameTable, 0xFF if not decoded (2 KB in flash)
+struct CanFrameLookupT { uint8_t index[0x800]; };
+
+constexpr CanFrameLookupT CanFrameLookupFromTable() {
+  CanFrameLookupT lookup = {};
+  for (size_t id = 0; id < 0x800; id++) { lookup.index[id] = 0xFF; }
+  for (size_t f = 0; f < CanFrameCount; f++) { lookup.index[CanFrameTable.frames[f].id] = f; }
+  return lookup;
+}
+constexpr CanFrameLookupT CanFrameLookup = CanFrameLookupFromTable();
+
+// Index into CanFrameTable or -1 if the ID is not decoded
+constexpr int CanFrameIndex(uint32_t id) {
+  return (id < 0x800 && CanFrameLookup.index[id] != 0xFF) ? CanFrameLookup.index[id] : -1;
+}
+
+// Extractors ==========================================================================================
+
+// Raw (unscaled) value of signal S, specialised at compile time: only the bytes carrying the signal are read
+template <CanSignal S>
+inline int32_t CanExtractRaw(const uint8_t *data) {
+  constexpr CanSignalDesc d = CanSignalTable[S];
+  constexpr uint8_t first = CanSignalFirstByte(d);
+  constexpr uint8_t bytes = CanSignalBytes(d);
+  static_assert(bytes <= 4, "Signal spans more than 4 bytes");
+  constexpr uint32_t mask = (d.length == 32) ? 0xFFFFFFFFu : ((1u << d.length) - 1);
+
+  uint32_t word = 0;
+  uint32_t value;
+  if constexpr (d.bigEndian) {
+    for (uint8_t i = 0; i < bytes; i++) { word = (word << 8) | data[first + i]; }
+    constexpr uint8_t msb = (d.startBit % 8) + 8 * (bytes - 1);
+    value = (word >> (msb + 1 - d.length)) & mask;
+  }
+  else {
+    for (uint8_t i = 0; i < bytes; i++) { word |= (uint32_t)data[first + i] << (8 * i); }
+    value = (word >> (d.startBit % 8)) & mask;
+  }
+
+  if constexpr (d.isSigned) {
+    constexpr uint32_t signBit = 1u << (d.length - 1);
+    return (int32_t)(value ^ signBit) - (int32_t)signBit; // sign extension without branch
+  }
+  return (int32_t)value;
+}
+
+// Physical value of signal S. Returns true if value was written (valid or substituted).
+template <CanSignal S>
+inline bool CanDecodeSignal(const uint8_t *data, float *values) {
+  constexpr CanSignalDesc d = CanSignalTable[S];
+  int32_t raw = CanExtractRaw<S>(data);
+  bool valid = (raw >= d.rawMin) & (raw <= d.rawMax);
+  float physical = (d.valueMap != nullptr) ? (float)d.valueMap[raw & ((1 << d.length) - 1)] : (float)raw * d.scale + d.offset;
+  if constexpr (d.onInvalid == InvalidSubstitute) {
+    values[S] = valid ? physical : d.invalidValue;
+    return true;
+  }
+  values[S] = valid ? physical : values[S];
+  return valid;
+}
+
+template <size_t FIRST, size_t... I>
+inline uint32_t CanDecodeSignals(const uint8_t *data, float *values, std::index_sequence<I...>) {
+  uint32_t updated = 0;
+  ((updated |= (uint32_t)CanDecodeSignal<(CanSignal)(FIRST + I)>(data, values) << (FIRST + I)), ...);
+  return updated;
+}
+
+// Decoder for one frame of CanFrameTable, all signals unrolled
+template <size_t F>
+inline uint32_t CanDecodeFrameAt(const uint8_t *data, float *values) {
+  constexpr CanFrameDesc frame = CanFrameTable.frames[F];
+  return CanDecodeSignals<frame.firstSignal>(data, values, std::make_index_sequence<frame.signalCount>{});
+}
+
+typedef uint32_t (*CanFrameDecoder)(const uint8_t *data, float *values);
+
+template <size_t... F>
+constexpr auto CanFrameDecodersFor(std::index_sequence<F...>) {
+  struct Decoders { CanFrameDecoder decode[sizeof...(F)]; };
+  return Decoders{ { &CanDecodeFrameAt<F>... } };
+}
+constexpr auto CanFrameDecoders = CanFrameDecodersFor(std::make_index_sequence<CanFrameCount>{});
+
+// Decoding ============================================================================================
+
+enum CanDecodeStatus : uint8_t {
+  DecodeOK,
+  DecodeUnknownId,
+  DecodeBadLength,
+};
+
+// Decodes one frame into values[SignalCount]. Returns the status, updated holds a bit per written signal.
+inline CanDecodeStatus CanDecodeFrame(uint32_t id, uint8_t len, const uint8_t *data, float *values, uint32_t &updated) {
+  updated = 0;
+  int f = CanFrameIndex(id);
+  if (f < 0) { return DecodeUnknownId; }
+  if (len < CanFrameTable.frames[f].dlc) { return DecodeBadLength; }
+  updated = CanFrameDecoders.decode[f](data, values);
+  return DecodeOK;
+}
+
+constexpr uint32_t CanSignalBit(CanSignal s) { return 1u << s; }
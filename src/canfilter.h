@@ -0,0 +1,148 @@
+// MCP2515 acceptance filter plan
+// Computed at compile time from the IDs in CanFrameTable (candecoder.h).
+// The MCP2515 has two receive buffers: RXB0 with mask RXM0 and filters RXF0..1,
+// RXB1 with mask RXM1 and filters RXF2..5. The plan assigns every decoded ID to
+// one buffer and picks masks/filters that let the fewest other IDs through.
+//
+// No Arduino dependencies
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <utility>
+#include <candecoder.h>
+
+#define CAN_FILTER_MAX_UNWANTED 16 // unwanted IDs listed in the plan report
+#ifndef CAN_FILTER_REPORT
+#define CAN_FILTER_REPORT 0        // 1 = list the unwanted IDs as a compiler warning
+#endif
+
+struct CanFilterPlanT {
+  uint16_t mask[2];                 // RXM0, RXM1
+  uint16_t filter[6];               // RXF0..1 use mask[0], RXF2..5 use mask[1]
+  uint16_t unwantedCount;           // standard IDs passing the filters without being decoded
+  uint16_t unwanted[CAN_FILTER_MAX_UNWANTED];
+};
+
+struct CanFilterGroupT {
+  uint16_t mask;
+  uint8_t filterCount;
+  uint16_t filter[4];
+  uint16_t unwanted;                // accepted IDs not in the group
+  bool possible;
+};
+
+constexpr uint8_t CanFilterDontCareBits(uint16_t mask) {
+  uint8_t bits = 0;
+  for (uint8_t b = 0; b < 11; b++) { if (!(mask & (1 << b))) { bits++; } }
+  return bits;
+}
+
+// Evaluates one mask for the IDs selected by members (bit per CanFrameTable entry)
+constexpr CanFilterGroupT CanFilterGroupWithMask(uint32_t members, uint16_t mask, uint8_t budget) {
+  CanFilterGroupT group = {};
+  group.mask = mask;
+  size_t memberCount = 0;
+  for (size_t i = 0; i < CanFrameCount; i++) {
+    if (!(members & (1u << i))) { continue; }
+    memberCount++;
+    uint16_t value = CanFrameTable.frames[i].id & mask;
+    bool known = false;
+    for (uint8_t f = 0; f < group.filterCount; f++) { if (group.filter[f] == value) { known = true; } }
+    if (known) { continue; }
+    if (group.filterCount == budget) { return group; } // needs more filters than available
+    group.filter[group.filterCount++] = value;
+  }
+  group.unwanted = (group.filterCount << CanFilterDontCareBits(mask)) - memberCount;
+  group.possible = true;
+  return group;
+}
+
+// Best mask for a group: exact match, or ignoring the bits in which one or two ID pairs differ
+constexpr CanFilterGroupT CanFilterBestGroup(uint32_t members, uint8_t budget) {
+  CanFilterGroupT best = CanFilterGroupWithMask(members, 0x7FF, budget);
+  for (size_t a = 0; a < CanFrameCount; a++) {
+    for (size_t b = a + 1; b < CanFrameCount; b++) {
+      if (!(members & (1u << a)) || !(members & (1u << b))) { continue; }
+      uint16_t diff1 = CanFrameTable.frames[a].id ^ CanFrameTable.frames[b].id;
+      for (size_t c = a; c < CanFrameCount; c++) {
+        for (size_t d = c + 1; d < CanFrameCount; d++) {
+          if (!(members & (1u << c)) || !(members & (1u << d))) { continue; }
+          uint16_t diff2 = (c == a && d == b) ? 0 : (CanFrameTable.frames[c].id ^ CanFrameTable.frames[d].id);
+          CanFilterGroupT group = CanFilterGroupWithMask(members, 0x7FF & ~(diff1 | diff2), budget);
+          if (group.possible && (!best.possible || group.unwanted < best.unwanted)) { best = group; }
+        }
+      }
+    }
+  }
+  return best;
+}
+
+constexpr bool CanFilterAccepts(const CanFilterPlanT &plan, uint16_t id) {
+  for (uint8_t f = 0; f < 6; f++) {
+    uint16_t mask = plan.mask[f < 2 ? 0 : 1];
+    if ((id & mask) == (plan.filter[f] & mask)) { return true; }
+  }
+  return false;
+}
+
+constexpr CanFilterPlanT CanFilterPlanFromTable() {
+  static_assert(CanFrameCount > 0 && CanFrameCount <= 24, "CAN filter plan needs 1..24 decoded IDs");
+
+  // Try every split of the decoded IDs between RXB0 (2 filters) and RXB1 (4 filters)
+  const uint32_t all = (1u << CanFrameCount) - 1;
+  CanFilterGroupT best0 = {};
+  CanFilterGroupT best1 = {};
+  bool found = false;
+  for (uint32_t members0 = 0; members0 <= all; members0++) {
+    uint32_t members1 = all & ~members0;
+    CanFilterGroupT group0 = members0 ? CanFilterBestGroup(members0, 2) : CanFilterGroupWithMask(0, 0x7FF, 2);
+    if (!group0.possible) { continue; }
+    CanFilterGroupT group1 = members1 ? CanFilterBestGroup(members1, 4) : CanFilterGroupWithMask(0, 0x7FF, 4);
+    if (!group1.possible) { continue; }
+    if (!found || group0.unwanted + group1.unwanted < best0.unwanted + best1.unwanted) {
+      best0 = group0;
+      best1 = group1;
+      found = true;
+    }
+  }
+
+  // Unused filter slots repeat a used one (an empty buffer repeats a decoded ID with an exact mask)
+  CanFilterPlanT plan = {};
+  const uint16_t fallback = CanFrameTable.frames[0].id;
+  plan.mask[0] = best0.mask;
+  plan.mask[1] = best1.mask;
+  for (uint8_t f = 0; f < 2; f++) { plan.filter[f] = best0.filterCount ? best0.filter[f < best0.filterCount ? f : 0] : fallback; }
+  for (uint8_t f = 0; f < 4; f++) { plan.filter[2 + f] = best1.filterCount ? best1.filter[f < best1.filterCount ? f : 0] : fallback; }
+
+  for (uint16_t id = 0; id < 0x800; id++) {
+    if (CanFilterAccepts(plan, id) && CanFrameIndex(id) < 0) {
+      if (plan.unwantedCount < CAN_FILTER_MAX_UNWANTED) { plan.unwanted[plan.unwantedCount] = id; }
+      plan.unwantedCount++;
+    }
+  }
+  return plan;
+}
+
+constexpr CanFilterPlanT CanFilterPlan = CanFilterPlanFromTable();
+
+// Undecoded IDs passing the filters are counted as CanFramesDiscarded and listed in the boot
+// log. A CanFrameTable change that lets more of them through than the plan can list fails the
+// build; raise CAN_FILTER_MAX_UNWANTED if that is really the best plan.
+static_assert(CanFilterPlan.unwantedCount <= CAN_FILTER_MAX_UNWANTED, "CAN acceptance filters pass more undecoded IDs than CAN_FILTER_MAX_UNWANTED");
+constexpr size_t CanFilterReportCount = CanFilterPlan.unwantedCount < CAN_FILTER_MAX_UNWANTED ? CanFilterPlan.unwantedCount : CAN_FILTER_MAX_UNWANTED;
+
+// Build time report (CAN_FILTER_REPORT): a compiler warning lists the undecoded IDs (decimal)
+#if CAN_FILTER_REPORT
+template <uint16_t... ID>
+[[deprecated("CAN acceptance filters also pass undecoded IDs, they are counted as CanFramesDiscarded")]]
+constexpr int CanFilterUnwantedIDs() { return sizeof...(ID); }
+
+template <size_t... I>
+constexpr int CanFilterReport(std::index_sequence<I...>) {
+  if constexpr (sizeof...(I) > 0) { return CanFilterUnwantedIDs<CanFilterPlan.unwanted[I]...>(); }
+  return 0;
+}
+#endif
+
@@ -0,0 +1,129 @@
+// CAN controller health supervisor
+// Classifies the MCP2515 state from its error counters (TEC/REC), the error flag register
+// (EFLG) and the time since the last frame, and decides when the controller has to be
+// reinitialised. Recovery attempts are spaced with an exponential backoff. The supervisor
+// only decides - register reads and can.begin() are done by the CAN receive task, so
+// neither loop() nor the display wait for SPI or controller resets.
+//
+// No Arduino dependencies
+
+#pragma once
+
+#include <stdint.h>
+
+// MCP2515 EFLG bits
+#define CAN_EFLG_RX1OVR 0x80
+#define CAN_EFLG_RX0OVR 0x40
+#define CAN_EFLG_TXBO   0x20
+#define CAN_EFLG_TXEP   0x10
+#define CAN_EFLG_RXEP   0x08
+#define CAN_EFLG_TXWAR  0x04
+#define CAN_EFLG_RXWAR  0x02
+#define CAN_EFLG_EWARN  0x01
+
+#define CAN_HEALTH_SILENT_MS 10000     // no frame for this long = silent bus
+#define CAN_HEALTH_BACKOFF_MIN_MS 1000
+#define CAN_HEALTH_BACKOFF_MAX_MS 300000
+
+enum CanHealthState : uint8_t {
+  CanHealthDown,          // not initialised or begin() failed
+  CanHealthActive,        // error active, frames arriving
+  CanHealthWarning,       // TEC or REC >= 96
+  CanHealthErrorPassive,  // TEC or REC >= 128
+  CanHealthBusOff,        // TEC > 255
+  CanHealthSilent,        // initialised but no frames
+  CanHealthStateCount
+};
+
+constexpr const char* CanHealthStateNames[CanHealthStateCount] = { "down", "active", "warning", "error passive", "bus off", "silent" };
+
+struct CanHealthMetrics {
+  CanHealthState state = CanHealthDown;
+  uint8_t tec = 0;
+  uint8_t rec = 0;
+  uint8_t eflg = 0;
+  uint32_t warnings = 0;          // entries into each state
+  uint32_t errorPassives = 0;
+  uint32_t busOffs = 0;
+  uint32_t silents = 0;
+  uint32_t rxOverflows = 0;       // EFLG RX0OVR/RX1OVR seen
+  uint32_t initFailures = 0;
+  uint32_t recoveryAttempts = 0;  // reinitialisations requested
+  uint32_t recoveries = 0;        // frames received again after a reinitialisation
+  uint32_t backoffMs = CAN_HEALTH_BACKOFF_MIN_MS;
+};
+
+class CanSupervisor {
+  public:
+    // Evaluates the latest register values, returns true if the controller should be
+    // reinitialised now. Call periodically (e.g. once per second).
+    bool update(uint32_t now, uint8_t tec, uint8_t rec, uint8_t eflg, uint32_t lastFrameMs) {
+      mMetrics.tec = tec;
+      mMetrics.rec = rec;
+      mMetrics.eflg = eflg;
+
+      CanHealthState state;
+      if (!mInitialised) { state = CanHealthDown; }
+      else if (eflg & CAN_EFLG_TXBO) { state = CanHealthBusOff; }
+      else if ((eflg & (CAN_EFLG_TXEP | CAN_EFLG_RXEP)) || tec >= 128 || rec >= 128) { state = CanHealthErrorPassive; }
+      else if (now - lastFrameMs > CAN_HEALTH_SILENT_MS) { state = CanHealthSilent; }
+      else if ((eflg & CAN_EFLG_EWARN) || tec >= 96 || rec >= 96) { state = CanHealthWarning; }
+      else { state = CanHealthActive; }
+
+      if (mInitialised && (eflg & (CAN_EFLG_RX0OVR | CAN_EFLG_RX1OVR)) && !(mLastEflg & (CAN_EFLG_RX0OVR | CAN_EFLG_RX1OVR))) { mMetrics.rxOverflows++; }
+      mLastEflg = eflg;
+
+      if (state != mMetrics.state) {
+        switch (state) {
+          case CanHealthWarning: mMetrics.warnings++; break;
+          case CanHealthErrorPassive: mMetrics.errorPassives++; break;
+          case CanHealthBusOff: mMetrics.busOffs++; break;
+          case CanHealthSilent: mMetrics.silents++; break;
+          default: break;
+        }
+        mMetrics.state = state;
+      }
+
+      // Frames are arriving after a reinitialisation: recovered, start over with the short backoff
+      if (state == CanHealthActive || state == CanHealthWarning) {
+        if (mRecovering) {
+          mRecovering = false;
+          mMetrics.recoveries++;
+        }
+        mMetrics.backoffMs = CAN_HEALTH_BACKOFF_MIN_MS;
+        return false;
+      }
+
+      // Error passive recovers on its own while frames are received correctly
+      if (state == CanHealthErrorPassive || mPending || (int32_t)(now - mNextAttempt) < 0) { return false; }
+
+      mPending = true;
+      mRecovering = true;
+      mMetrics.recoveryAttempts++;
+      return true;
+    }
+
+    // Result of a (re)initialisation, schedules the next attempt with the current backoff
+    void initDone(uint32_t now, bool ok) {
+      mPending = false;
+      mInitialised = ok;
+      if (!ok) { mMetrics.initFailures++; }
+      mNextAttempt = now + mMetrics.backoffMs;
+      mMetrics.backoffMs = (mMetrics.backoffMs >= CAN_HEALTH_BACKOFF_MAX_MS / 2) ? CAN_HEALTH_BACKOFF_MAX_MS : mMetrics.backoffMs * 2;
+    }
+
+    const CanHealthMetrics &metrics() const { return mMetrics; }
+    CanHealthState state() const { return mMetrics.state; }
+    bool initialised() const { return mInitialised; }
+    bool faulted() const { return mMetrics.state == CanHealthDown || mMetrics.state == CanHealthErrorPassive || mMetrics.state == CanHealthBusOff; }
+    bool pending() const { return mPending; }
+    uint32_t nextAttempt() const { return mNextAttempt; }
+
+  private:
+    CanHealthMetrics mMetrics;
+    bool mInitialised = false;
+    bool mPending = false;      // reinitialisation requested, initDone() not yet called
+    bool mRecovering = false;
+    uint8_t mLastEflg = 0;
+    uint32_t mNextAttempt = 0;
+};
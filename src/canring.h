@@ -0,0 +1,64 @@
+// Timestamped CAN frame ring
+// Single producer (CAN receive task) / single consumer (loop) ring buffer without locks.
+// Head is only written by the producer, tail only by the consumer.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+struct CanFrame {
+  int64_t timestamp;  // esp_timer_get_time() in microseconds when drained from the MCP2515 driver
+  uint32_t id;
+  uint8_t len;
+  bool rtr;
+  uint8_t data[8];
+};
+
+template <size_t SIZE>
+class CanFrameRing {
+  static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "CanFrameRing size must be a power of two");
+
+  public:
+    // Producer side. Returns false (and counts an overflow) if the ring is full, the frame is dropped.
+    bool push(const CanFrame &frame) {
+      uint32_t head = mHead.load(std::memory_order_relaxed);
+      uint32_t used = head - mTail.load(std::memory_order_acquire);
+      if (used >= SIZE) {
+        mOverflows.store(mOverflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+      }
+      mFrames[head & (SIZE - 1)] = frame;
+      mHead.store(head + 1, std::memory_order_release);
+
+      used++;
+      if (used > mHighWater.load(std::memory_order_relaxed)) { mHighWater.store(used, std::memory_order_relaxed); }
+      return true;
+    }
+
+    // Consumer side. Returns false if the ring is empty.
+    bool pop(CanFrame &frame) {
+      uint32_t tail = mTail.load(std::memory_order_relaxed);
+      if (tail == mHead.load(std::memory_order_acquire)) { return false; }
+      frame = mFrames[tail & (SIZE - 1)];
+      mTail.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool available() const { return count() > 0; }
+    uint32_t count() const { return mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire); }
+    static constexpr uint32_t size() { return SIZE; }
+
+    // Metrics
+    uint32_t overflowCount() const { return mOverflows.load(std::memory_order_relaxed); }
+    uint32_t highWater() const { return mHighWater.load(std::memory_order_relaxed); }
+    uint32_t framesPushed() const { return mHead.load(std::memory_order_relaxed); }
+
+  private:
+    CanFrame mFrames[SIZE];
+    std::atomic<uint32_t> mHead{0};
+    std::atomic<uint32_t> mTail{0};
+    std::atomic<uint32_t> mOverflows{0};
+    std::atomic<uint32_t> mHighWater{0};
+};
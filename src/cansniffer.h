@@ -0,0 +1,87 @@
+// CAN sniffer
+// Per ID statistics for discovering unknown signals: DLCs seen, frame count and rate,
+// and per byte the bits that changed and the min/max value. Fixed memory: a 2 KB index
+// from 11 bit ID to slot plus SLOTS slots, record() is O(1) so it keeps up with a fully
+// loaded 500 kbit/s bus. IDs beyond SLOTS are only counted.
+//
+// No Arduino dependencies
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+struct CanSnifferSlot {
+  uint16_t id;
+  uint16_t dlcMask;       // bit n = DLC n seen
+  uint32_t frames;
+  int64_t firstTimestamp; // us
+  int64_t lastTimestamp;
+  uint8_t last[8];
+  uint8_t changed[8];     // bits that toggled at least once
+  uint8_t min[8];
+  uint8_t max[8];
+
+  // Frames per second x10 over the whole recording
+  uint32_t rateX10() const {
+    int64_t span = lastTimestamp - firstTimestamp;
+    return (frames > 1 && span > 0) ? (uint32_t)((int64_t)(frames - 1) * 10000000 / span) : 0;
+  }
+};
+
+template <size_t SLOTS>
+class CanSniffer {
+  static_assert(SLOTS > 0 && SLOTS < 0xFF, "CanSniffer slot index is 8 bit");
+
+  public:
+    CanSniffer() { reset(); }
+
+    // Producer side (CAN receive task)
+    void record(uint32_t id, uint8_t len, const uint8_t *data, int64_t timestamp) {
+      if (id > 0x7FF) { mOtherFrames++; return; }
+      uint8_t index = mIndex[id];
+      if (index == Unused) {
+        if (mUsed >= SLOTS) { mOtherFrames++; return; }
+        index = mUsed;
+        CanSnifferSlot &slot = mSlots[index];
+        memset(&slot, 0, sizeof(slot));
+        slot.id = id;
+        slot.firstTimestamp = timestamp;
+        memset(slot.min, 0xFF, sizeof(slot.min));
+        mIndex[id] = index;
+        mUsed = index + 1; // publish after the slot is initialised
+      }
+
+      CanSnifferSlot &slot = mSlots[index];
+      if (len > 8) { len = 8; }
+      slot.dlcMask |= 1 << len;
+      for (uint8_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        if (slot.frames) { slot.changed[i] |= slot.last[i] ^ b; }
+        slot.last[i] = b;
+        if (b < slot.min[i]) { slot.min[i] = b; }
+        if (b > slot.max[i]) { slot.max[i] = b; }
+      }
+      slot.lastTimestamp = timestamp;
+      slot.frames++;
+    }
+
+    // Only call while record() is not running (e.g. from the producer)
+    void reset() {
+      memset(mIndex, Unused, sizeof(mIndex));
+      mUsed = 0;
+      mOtherFrames = 0;
+    }
+
+    size_t count() const { return mUsed; }
+    const CanSnifferSlot &slot(size_t i) const { return mSlots[i]; }
+    uint32_t otherFrames() const { return mOtherFrames; } // IDs that did not fit into a slot
+
+  private:
+    static constexpr uint8_t Unused = 0xFF;
+    uint8_t mIndex[0x800];
+    CanSnifferSlot mSlots[SLOTS];
+    volatile size_t mUsed;
+    uint32_t mOtherFrames;
+};
@@ -0,0 +1,96 @@
+// CAN traffic statistics
+// Per decoded ID (plus one slot for everything else): frame counter, inter-arrival
+// min/mean/max, jitter and gap detection. Bus load is estimated from the DLC of the
+// received frames over one second windows. All storage is fixed, record() is O(1).
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <candecoder.h>
+
+#define CAN_STATS_GAP_FACTOR 3        // interval > 3x mean interval counts as gap
+#define CAN_STATS_GAP_MIN_INTERVALS 8 // intervals needed before gaps are detected
+#define CAN_STATS_WINDOW_US 1000000   // bus load window
+#define CAN_STATS_BITRATE 500000
+
+struct CanIdStats {
+  uint32_t frames;
+  uint32_t gaps;              // intervals longer than CAN_STATS_GAP_FACTOR x mean
+  uint32_t intervals;
+  uint32_t intervalMin;       // us
+  uint32_t intervalMax;       // us
+  uint64_t intervalSum;       // us
+  uint32_t jitter;            // smoothed |interval - mean| in us, x16 (RFC 3550 style)
+  uint32_t lastGap;           // us, length of the last detected gap
+  int64_t lastTimestamp;      // us
+
+  uint32_t intervalMean() const { return intervals ? intervalSum / intervals : 0; }
+  uint32_t jitterUs() const { return jitter >> 4; }
+};
+
+class CanStatistics {
+  public:
+    static constexpr size_t SlotCount = CanFrameCount + 1;
+    static constexpr size_t OtherSlot = CanFrameCount; // IDs which are not decoded
+
+    // Bits on the wire for a standard data frame incl. interframe space, worst case bit stuffing
+    static constexpr uint32_t frameBits(uint8_t dlc) { return 47 + 8 * dlc + (34 + 8 * dlc - 1) / 4; }
+
+    void record(uint32_t id, uint8_t dlc, int64_t timestamp) {
+      int frameIndex = CanFrameIndex(id);
+      CanIdStats &s = mSlots[frameIndex < 0 ? OtherSlot : frameIndex];
+
+      if (s.frames > 0) {
+        uint32_t interval = timestamp - s.lastTimestamp;
+        uint32_t mean = s.intervalMean();
+        if (s.intervals >= CAN_STATS_GAP_MIN_INTERVALS && interval > mean * CAN_STATS_GAP_FACTOR) {
+          s.gaps++;
+          s.lastGap = interval;
+        }
+        else {
+          // Gaps are kept out of mean and jitter
+          int32_t deviation = (int32_t)interval - (int32_t)mean;
+          if (deviation < 0) { deviation = -deviation; }
+          s.jitter += deviation - (s.jitter >> 4);
+          s.intervalSum += interval;
+          s.intervals++;
+        }
+        if (s.intervals == 1 || interval < s.intervalMin) { s.intervalMin = interval; }
+        if (interval > s.intervalMax) { s.intervalMax = interval; }
+      }
+      s.frames++;
+      s.lastTimestamp = timestamp;
+
+      // Bus load window
+      if (mWindowStart == 0) { mWindowStart = timestamp; }
+      if (timestamp - mWindowStart >= CAN_STATS_WINDOW_US) {
+        mLoadPermille = (uint64_t)mWindowBits * 1000 * 1000000 / CAN_STATS_BITRATE / (timestamp - mWindowStart);
+        if (mLoadPermille > mLoadPeakPermille) { mLoadPeakPermille = mLoadPermille; }
+        mWindowStart = timestamp;
+        mWindowBits = 0;
+      }
+      mWindowBits += frameBits(dlc);
+      mTotalBits += frameBits(dlc);
+    }
+
+    const CanIdStats &slot(size_t index) const { return mSlots[index]; }
+    uint16_t slotId(size_t index) const { return index < CanFrameCount ? CanFrameTable.frames[index].id : 0; }
+
+    // Estimated bus load of the received frames in 1/1000 of the bitrate
+    uint32_t loadPermille() const { return mLoadPermille; }
+    uint32_t loadPeakPermille() const { return mLoadPeakPermille; }
+    uint64_t totalBits() const { return mTotalBits; }
+
+    void reset() { *this = CanStatistics(); }
+
+  private:
+    CanIdStats mSlots[SlotCount] = {};
+    int64_t mWindowStart = 0;
+    uint32_t mWindowBits = 0;
+    uint32_t mLoadPermille = 0;
+    uint32_t mLoadPeakPermille = 0;
+    uint64_t mTotalBits = 0;
+};
@@ -0,0 +1,155 @@
+// Binary CAN trace format
+// A trace is a header followed by variable length records:
+//   varint  timestamp delta to the previous record in us (LEB128, 1..5 bytes)
+//   uint16  little endian: bits 0..10 ID, bits 11..14 DLC, bit 15 RTR
+//   DLC bytes payload
+// A typical 8 byte frame with < 16 ms delta takes 12 bytes.
+// On the device records are written into a RAM ring by the CAN receive task and
+// flushed to the "cantrace" flash partition from loop().
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+
+#define CAN_TRACE_MAGIC 0x31525443UL // "CTR1"
+#define CAN_TRACE_RECORD_MAX 15      // 5 byte delta + 2 byte ID/DLC + 8 byte payload
+
+struct CanTraceHeader {
+  uint32_t magic;
+  uint32_t length;   // bytes of record data following the header
+  uint32_t records;
+  uint32_t dropped;  // records lost because the RAM ring was full
+};
+
+struct CanTraceRecord {
+  uint64_t timestamp; // us since trace start
+  uint16_t id;
+  uint8_t len;
+  bool rtr;
+  uint8_t data[8];
+};
+
+// Encodes one record into out (CAN_TRACE_RECORD_MAX bytes), returns the record size
+inline size_t CanTraceEncode(uint8_t *out, uint32_t delta, uint32_t id, uint8_t len, bool rtr, const uint8_t *data) {
+  size_t n = 0;
+  do {
+    uint8_t b = delta & 0x7F;
+    delta >>= 7;
+    out[n++] = delta ? (b | 0x80) : b;
+  } while (delta);
+  if (len > 8) { len = 8; }
+  uint16_t idDlc = (id & 0x7FF) | (len << 11) | (rtr ? 0x8000 : 0);
+  out[n++] = idDlc & 0xFF;
+  out[n++] = idDlc >> 8;
+  memcpy(out + n, data, len);
+  return n + len;
+}
+
+// Sequential reader for record data (without header). Stops at the end of data or at
+// erased flash (DLC > 8), which allows reading traces whose header was never written.
+class CanTraceReader {
+  public:
+    CanTraceReader(const uint8_t *data, size_t length) : mData(data), mLength(length) {}
+
+    bool next(CanTraceRecord &record) {
+      uint32_t delta = 0;
+      uint8_t shift = 0;
+      for (;;) {
+        if (mPos >= mLength || shift > 28) { return false; }
+        uint8_t b = mData[mPos++];
+        delta |= (uint32_t)(b & 0x7F) << shift;
+        shift += 7;
+        if (!(b & 0x80)) { break; }
+      }
+      if (mPos + 2 > mLength) { return false; }
+      uint16_t idDlc = mData[mPos] | (mData[mPos + 1] << 8);
+      uint8_t len = (idDlc >> 11) & 0x0F;
+      if (len > 8 || mPos + 2 + len > mLength) { return false; }
+      mPos += 2;
+
+      mTimestamp += delta;
+      record.timestamp = mTimestamp;
+      record.id = idDlc & 0x7FF;
+      record.len = len;
+      record.rtr = idDlc & 0x8000;
+      memset(record.data, 0, sizeof(record.data));
+      memcpy(record.data, mData + mPos, len);
+      mPos += len;
+      return true;
+    }
+
+    size_t position() const { return mPos; }
+
+  private:
+    const uint8_t *mData;
+    size_t mLength;
+    size_t mPos = 0;
+    uint64_t mTimestamp = 0;
+};
+
+// Single producer / single consumer byte ring, records are written completely or not at all
+template <size_t SIZE>
+class CanTraceBuffer {
+  static_assert(SIZE >= 64 && (SIZE & (SIZE - 1)) == 0, "CanTraceBuffer size must be a power of two");
+
+  public:
+    // Producer side (CAN receive task)
+    void record(int64_t timestamp, uint32_t id, uint8_t len, bool rtr, const uint8_t *data) {
+      if (!mActive.load(std::memory_order_acquire)) { return; }
+      if (mLastTimestamp == 0) { mLastTimestamp = timestamp; }
+      int64_t delta = timestamp - mLastTimestamp;
+      if (delta < 0) { delta = 0; }
+      if (delta > 0xFFFFFFFF) { delta = 0xFFFFFFFF; }
+
+      uint8_t buffer[CAN_TRACE_RECORD_MAX];
+      size_t n = CanTraceEncode(buffer, delta, id, len, rtr, data);
+      uint32_t head = mHead.load(std::memory_order_relaxed);
+      if (SIZE - (head - mTail.load(std::memory_order_acquire)) < n) {
+        mDropped.store(mDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+      }
+      for (size_t i = 0; i < n; i++) { mBytes[(head + i) & (SIZE - 1)] = buffer[i]; }
+      mHead.store(head + n, std::memory_order_release);
+      mLastTimestamp = timestamp;
+      mRecords.store(mRecords.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Consumer side (flush), returns the number of bytes copied
+    size_t read(uint8_t *out, size_t max) {
+      uint32_t tail = mTail.load(std::memory_order_relaxed);
+      size_t n = mHead.load(std::memory_order_acquire) - tail;
+      if (n > max) { n = max; }
+      for (size_t i = 0; i < n; i++) { out[i] = mBytes[(tail + i) & (SIZE - 1)]; }
+      mTail.store(tail + n, std::memory_order_release);
+      return n;
+    }
+
+    // Start/stop are called by the consumer; the producer only records while active
+    void start() {
+      mTail.store(mHead.load(std::memory_order_acquire), std::memory_order_release);
+      mLastTimestamp = 0;
+      mRecords.store(0, std::memory_order_relaxed);
+      mDropped.store(0, std::memory_order_relaxed);
+      mActive.store(true, std::memory_order_release);
+    }
+    void stop() { mActive.store(false, std::memory_order_release); }
+
+    bool active() const { return mActive.load(std::memory_order_acquire); }
+    size_t pending() const { return mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire); }
+    uint32_t records() const { return mRecords.load(std::memory_order_relaxed); }
+    uint32_t dropped() const { return mDropped.load(std::memory_order_relaxed); }
+
+  private:
+    uint8_t mBytes[SIZE];
+    std::atomic<uint32_t> mHead{0};
+    std::atomic<uint32_t> mTail{0};
+    std::atomic<uint32_t> mRecords{0};
+    std::atomic<uint32_t> mDropped{0};
+    std::atomic<bool> mActive{false};
+    int64_t mLastTimestamp = 0;   // producer only
+};
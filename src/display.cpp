@@ -0,0 +1,563 @@
+#include <display.h>
+#include <widgets.h>
+#include <framebuffer.h>
+#include <textformat.h>
+#include <glyphatlas.h>
+#include <img.h>
+
+// Drive screen widgets (DisplayMainUI)
+ArcGauge GaugeConsumption(120, 120, 121, 120, 105, 120, 240, TFT_DARKGREY, COLOR_BACKGROUND);
+ArcGauge GaugeTemperature(120, 120, 121, 121, 110, 45, 90, COLOR_GREY, COLOR_BACKGROUND);
+ArcGauge GaugeRight(120, 120, 121, 121, 110, 270, 315, COLOR_GREY, COLOR_BACKGROUND); // 12V battery or trip consumption
+ValueLabel LabelConsumption(40, 65, 160, 60, 10, COLOR_ALMOSTBLACK, COLOR_BACKGROUND, 185, 85, AlignRight, GlyphsLarge);
+ValueLabel LabelTemperature(24, 142, 45, 20, 0, COLOR_BACKGROUND, COLOR_BACKGROUND, 25, 143, AlignLeft, 2, 1);
+ValueLabel LabelRight(172, 142, 50, 18, 0, COLOR_BACKGROUND, COLOR_BACKGROUND, 220, 143, AlignRight, 2, 1);
+ValueLabel LabelVolt(85, 130, 70, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND, 120, 143, AlignCentre, GlyphsMedium);
+ValueLabel LabelSoC(90, 39, 70, 20, 0, COLOR_BACKGROUND, COLOR_BACKGROUND, 120, 40, AlignCentre, GlyphsMedium);
+ValueLabel LabelSavedTrips(208, 88, 30, 18, 0, COLOR_BACKGROUND, COLOR_BACKGROUND, 210, 90, AlignLeft, 1, 2); // DEBUG only
+HistoryChart ChartHistory(70, 172, { COLOR_BACKGROUND, COLOR_ALMOSTBLACK, TFT_YELLOW, COLOR_LIGHTRED, TFT_GREEN, COLOR_TOPOLINO });
+IndicatorPill PillStatus(63, 188, 55, 20, 8, "Status", 73, 195, PillFilled, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+IndicatorPill PillWIFI(122, 188, 55, 20, 8, "WIFI", 139, 195, PillOutline, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+IndicatorPill PillBT(76, 213, 25, 20, 8, "BT", 83, 219, PillOutlineHighlight, COLOR_ALMOSTBLACK, COLOR_BACKGROUND, TFT_YELLOW);
+IndicatorPill PillCAN(105, 213, 30, 20, 8, "CAN", 111, 219, PillOutline, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+IndicatorPill PillTx(139, 213, 25, 20, 8, "Tx", 146, 219, PillOutline, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+
+PanelStatistics DisplayPanelStats;
+static uint32_t DisplayWokeMs = 0;
+
+#if DISPLAY_BENCHMARK
+RenderBench DisplayBench;
+#endif
+
+// Benchmark mark: the section drawn since the previous mark ends here
+static inline void DisplayLap(BenchSection section) {
+#if DISPLAY_BENCHMARK
+  DisplayBench.lap(section, ESP.getCycleCount());
+#else
+  (void)section;
+#endif
+}
+
+void DisplayBegin() {
+  tft.init();
+#if DISPLAY_BACKLIGHT_PIN >= 0
+  ledcSetup(DISPLAY_BACKLIGHT_CHANNEL, DISPLAY_BACKLIGHT_FREQUENCY, 8);
+  ledcAttachPin(DISPLAY_BACKLIGHT_PIN, DISPLAY_BACKLIGHT_CHANNEL);
+  ledcWrite(DISPLAY_BACKLIGHT_CHANNEL, DisplayPanelStats.brightness);
+#endif
+  FrameBufferBegin(tft);
+  GaugeConsumption.setMarker(61, 24, 6, COLOR_TOPOLINO); // zero marker while there is no consumption
+}
+
+static void DisplayBacklight(uint8_t brightness) {
+  if (brightness == DisplayPanelStats.brightness) { return; }
+#if DISPLAY_BACKLIGHT_PIN >= 0
+  ledcWrite(DISPLAY_BACKLIGHT_CHANNEL, brightness);
+#endif
+  DisplayPanelStats.brightness = brightness;
+}
+
+// Display off and controller asleep, the memory keeps the last frame
+static void DisplaySleep() {
+  FrameBufferSync(tft);
+  DisplayBacklight(0);
+  uint32_t awake = millis() - DisplayWokeMs;
+  if (DisplayPanelStats.wakes && awake < DISPLAY_SLEEP_MS) { delay(DISPLAY_SLEEP_MS - awake); }
+  tft.writecommand(GC9A01_DISPOFF);
+  tft.writecommand(GC9A01_SLPIN);
+  DisplayPanelStats.mode = PanelAsleep;
+  DisplayPanelStats.sleeps++;
+}
+
+// Display on again after the first frame was drawn into the sleeping panel
+static void DisplayWake(const DisplayModel &m) {
+  FrameBufferSync(tft);
+  tft.writecommand(GC9A01_DISPON);
+  DisplayBacklight(DisplayPowerConfigTable[m.power].brightness);
+  DisplayPanelStats.mode = PanelOn;
+  DisplayPanelStats.wakes++;
+  if (m.wakeUs) {
+    DisplayPanelStats.wakeUsLast = micros() - m.wakeUs;
+    if (DisplayPanelStats.wakeUsLast > DisplayPanelStats.wakeUsMax) { DisplayPanelStats.wakeUsMax = DisplayPanelStats.wakeUsLast; }
+  }
+}
+
+static Screen DisplayRendered = ScreenBoot;
+
+bool DisplayAnimating() {
+  uint32_t now = millis();
+  return DisplayRendered == ScreenDrive && DisplayPanelStats.mode == PanelOn &&
+         (GaugeConsumption.animating(now) || GaugeTemperature.animating(now) || GaugeRight.animating(now));
+}
+
+void DisplayRender(const DisplayModel &m) {
+  ChartHistory.add(m.history, m.historySamples); // also collected while other screens are shown or the panel sleeps
+
+  // Panel power: asleep (or about to lose power) draws nothing, waking draws the frame before the display goes on
+  const DisplayPowerConfig &power = DisplayPowerConfigTable[m.power];
+  if (power.panel != PanelOn) {
+    if (DisplayPanelStats.mode == PanelOn) { DisplaySleep(); }
+    return;
+  }
+  bool waking = DisplayPanelStats.mode != PanelOn;
+  if (waking) {
+    tft.writecommand(GC9A01_SLPOUT);
+    delay(DISPLAY_WAKE_MS);
+    DisplayWokeMs = millis();
+  }
+  else {
+    DisplayBacklight(power.brightness);
+  }
+
+#if DISPLAY_BENCHMARK
+  uint64_t sent = FrameBufferStats.bytesPushed + DisplayClipStats.sentBytes;
+  DisplayBench.frameBegin(ESP.getCycleCount());
+#endif
+  DisplayRendered = m.screen;
+  static uint32_t entered = 0;
+  if (m.screenEntry != entered) {
+    entered = m.screenEntry;
+    DisplayEnter(m);
+  }
+  switch (m.screen) {
+    case ScreenDrive: DisplayMainUI(m); break;
+    case ScreenCharging: DisplayCharging(m); break;
+    case ScreenSleeping: DisplaySleeping(m); break;
+    default: break;
+  }
+#if DISPLAY_BENCHMARK
+  uint32_t spiBytes = FrameBufferStats.bytesPushed + DisplayClipStats.sentBytes - sent;
+  if (m.screen == ScreenDrive && FrameBufferStats.bpp == 0) { spiBytes += WidgetPixels * 2; } // direct drawing: widget estimate
+  DisplayBench.frameEnd(ESP.getCycleCount(), spiBytes);
+#endif
+  if (waking) { DisplayWake(m); }
+}
+
+// Clears the screen once and draws what doesn't change
+void DisplayEnter(const DisplayModel &m) {
+  switch (m.screen) {
+    case ScreenBoot:
+    case ScreenSleeping:
+      DisplayClear(tft, TFT_BLACK);
+      break;
+    case ScreenDrive:
+    case ScreenCharging:
+      DisplayClear(tft, COLOR_BACKGROUND); // widgets redraw completely after a clear
+      break;
+    case ScreenTripResult:
+      DisplayClear(tft, COLOR_BACKGROUND);
+      DisplayTripResults(m);
+      break;
+    case ScreenChargeResult:
+      DisplayClear(tft, COLOR_BACKGROUND);
+      DisplayChargingResult(m);
+      break;
+    case ScreenBTConnecting:
+      DisplayClear(tft, COLOR_BACKGROUND);
+      DisplayBTConnecting(m);
+      break;
+    default:
+      break;
+  }
+  DisplayLap(BenchEnter);
+}
+
+void DisplayBoot() {
+  DisplayImage(tft, 0, 0, img1);
+  delay(500);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(3);
+  tft.drawCentreString("Topolino",120, 32, 1);
+  tft.setTextColor(TFT_BLACK, COLOR_TOPOLINO, true);
+  delay(500);
+  tft.drawString("Info",40,100);
+  delay(500);
+  tft.drawString("Display",70,130);
+  delay(500);
+  tft.setTextSize(2);
+  tft.setTextColor(COLOR_ALMOSTBLACK);
+  tft.drawCentreString(TextBuffer<24>().add("Version: ").add(VERSION).c_str(), 120, 185, 1);
+  #ifdef DEBUG
+    tft.drawCentreString("DEBUG", 120, 220, 1);
+  #endif
+}
+
+void DisplayMainUI(const DisplayModel &m) {
+  // Only widgets whose quantized value changed are sent to the panel
+  const CANValues &v = m.values;
+  int valuecolor;
+  uint32_t now = millis(); // gauge tweens run on render time, frames in between repeat the model
+  TFT_eSPI &gfx = DisplayFrameBegin(tft); // framebuffer or panel
+  WidgetFrameBegin();
+
+  //Consumption Arc
+  if (v.Current < -2) {
+    //Consumption negative = driving
+    int arcLenght = map(v.Current, -150, 0, 240, 150);
+    if (arcLenght > 240) {arcLenght = 240;}
+    if (arcLenght < 151) {arcLenght = 151;}
+    if (v.Current < -75) {valuecolor = COLOR_LIGHTRED;} else {valuecolor = TFT_YELLOW;}
+    GaugeConsumption.animate(gfx, 150, arcLenght, valuecolor, now);
+  }
+  else if (v.Current >02) {
+    //Consumption positive  = charging
+    int arcLenght = map(v.Current, 0, 75, 0, 30);
+    if (arcLenght > 30) {arcLenght = 30;}
+    if (arcLenght < 1) {arcLenght = 1;}
+    GaugeConsumption.animate(gfx, 150 - arcLenght, 150, TFT_GREEN, now);
+  }
+  else {
+    // No Consumption (Dead zone 0 bis -2): marker spot
+    GaugeConsumption.animate(gfx, 0, 0, 0, now);
+  }
+  DisplayLap(BenchConsumptionGauge);
+  
+  // Consumption value  
+  TextBuffer<WIDGET_TEXT_MAX> text;
+  if (ShowConsumptionAsKW) {
+    text.number(v.Current * v.Volt / 1000 * -1, 2).add(" kW");         // -#.##
+  }
+  else {
+    text.number(v.Current * -1, 1).add(" A");
+  }
+  LabelConsumption.draw(gfx, text.c_str(), TFT_WHITE);
+  DisplayLap(BenchConsumptionLabel);
+
+  // Battery Temperature
+  float tempAverage = (v.Temp1 + v.Temp2) / 2.0;
+  int arcLenght = map(tempAverage, -10, 50, 45, 90);
+  if (arcLenght < 46) { arcLenght = 46;}
+  if (arcLenght > 90) { arcLenght = 90;}
+  if (tempAverage > 40) { valuecolor = COLOR_LIGHTRED; }
+  else if (tempAverage > 25) { valuecolor = TFT_ORANGE; }
+  else if (tempAverage < 5) { valuecolor = TFT_BLUE; }
+  else if (tempAverage < 10) { valuecolor = TFT_CYAN; }
+  else if (tempAverage < 20) { valuecolor = TFT_YELLOW; }
+  else { valuecolor = 0x2520; }
+  GaugeTemperature.animate(gfx, 45, arcLenght, valuecolor, now);
+  DisplayLap(BenchTemperatureGauge);
+  LabelTemperature.draw(gfx, TextBuffer<WIDGET_TEXT_MAX>().fixed((v.Temp1 + v.Temp2) * 5, 1).add('C').c_str(), COLOR_GREY); // average, 1 decimal
+  DisplayLap(BenchTemperatureLabel);
+
+  // Right Arc (12V Battery or Trip avg Consumption)
+  text.clear();
+  if ( m.tripActive ) {
+    // consumption per 100km
+    text.number(m.avgkWh, 1).add("kW");
+    arcLenght = map(m.avgkWh, 6, 15, 0, 45);
+    if ( m.avgkWh > 13) { valuecolor = COLOR_LIGHTRED; }
+    else if ( m.avgkWh > 11) { valuecolor = TFT_ORANGE; }
+    else if ( m.avgkWh > 9) { valuecolor = TFT_YELLOW; }
+    else if ( m.avgkWh < 7.5) { valuecolor = TFT_CYAN; }
+    else { valuecolor = 0x2520; }
+  }
+  else {
+  // 12Volt Battery
+    text.number(v.Battery, 1).add('V');
+    arcLenght = map(v.Battery, 11.5, 14.5, 0, 45); 
+    if (v.Battery < 11.5) { valuecolor = COLOR_LIGHTRED; }
+    else if (v.Battery < 12.0) { valuecolor = TFT_YELLOW; }
+    else { valuecolor = 0x2520; }
+  }
+  if (arcLenght < 1) {arcLenght = 1;}
+  if (arcLenght > 45) {arcLenght = 45;}
+  GaugeRight.animate(gfx, 315 - arcLenght, 315, valuecolor, now);
+  DisplayLap(BenchRightGauge);
+  LabelRight.draw(gfx, text.c_str(), COLOR_GREY);
+  DisplayLap(BenchRightLabel);
+
+  //Akku Voltage
+  if (v.Volt < 51.2 || v.Volt > 58) { valuecolor = TFT_ORANGE; } 
+  else { valuecolor = TFT_WHITE; }
+  LabelVolt.draw(gfx, TextBuffer<WIDGET_TEXT_MAX>().number(v.Volt, 1).add('V').c_str(), valuecolor);
+  DisplayLap(BenchVoltLabel);
+
+  // SoC
+  if (v.SoC < 15) { valuecolor = COLOR_LIGHTRED; }
+  else if (v.SoC < 30) { valuecolor = TFT_YELLOW; }
+  else if (v.SoC > 90) { valuecolor = TFT_DARKCYAN; }
+  else { valuecolor = COLOR_GREY; }
+  LabelSoC.draw(gfx, TextBuffer<WIDGET_TEXT_MAX>().integer(v.SoC).add('%').c_str(), valuecolor);
+  DisplayLap(BenchSoCLabel);
+
+  // Power and speed history: one new column per sample
+  ChartHistory.draw(gfx);
+  DisplayLap(BenchHistoryChart);
+
+  // Indicators
+  PillStatus.draw(gfx, m.statusColor);
+  PillWIFI.draw(gfx, m.wifiColor);
+  PillBT.draw(gfx, m.btColor);
+  PillCAN.draw(gfx, m.canColor);
+  PillTx.draw(gfx, m.txColor);
+
+#ifdef DEBUG
+  // Debug
+  //Gear (for testing)
+  /*
+  tft.setTextColor(COLOR_ALMOSTBLACK, COLOR_BACKGROUND, true);
+  tft.setTextSize(2);
+  tft.drawString(GearNames[v.Gear], 210, 90);
+  */
+
+  // Saved trips counter (for testing)
+  LabelSavedTrips.draw(gfx, TextBuffer<WIDGET_TEXT_MAX>().integer(m.savedTrips).add('T').c_str(), COLOR_ALMOSTBLACK);
+#endif
+  DisplayLap(BenchIndicators);
+
+  WidgetFrameEnd();
+  DisplayFrameEnd(tft, WidgetRowFirst, WidgetRowLast);
+  DisplayLap(BenchPush);
+  
+}
+
+void DisplayTripResults(const DisplayModel &m) {
+  const trip &t = m.lastTrip;
+  float drivenKM = (t.endKM - t.startKM) / 10;
+  int drivenMin = (t.endTime - t.startTime) / 1000 / 60;
+  int drivenSoC = t.startSoC - t.endSoC;
+  float drivenKWh = (t.consumedWh - t.recuperatedWh) / 1000.0;
+
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(2);
+  tft.drawString("Diese Fahrt:",50, 23, 2);
+  int positionX = 25;
+  int positionY = 55;
+  // Dauer: Min / KM
+  tft.fillSmoothRoundRect(positionX, positionY, 190, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(1);
+  tft.drawString("Dauer", positionX +10 , positionY +2, 2);
+  tft.setTextColor(TFT_WHITE);
+  tft.setTextSize(2);
+  TextBuffer<24> text;
+  if (drivenMin < 10) { text.add(' '); }
+  tft.drawString(text.integer(drivenMin).add(" Min | ").number(drivenKM, 1).add("km").c_str(), positionX +10, positionY +19);
+  // Geschiwndigkeit: Durchschnitt / Max
+  positionY += 43;
+  tft.fillSmoothRoundRect(positionX, positionY, 190, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(1);
+  tft.drawString("km/h", positionX +10 , positionY +1, 2);
+  tft.setTextColor(TFT_WHITE);
+  tft.setTextSize(2);
+  tft.drawString(text.clear().number((drivenKM / drivenMin) * 60, 1).add("   | ").integer(t.maxSpeed).c_str(), positionX +10, positionY +19);
+  tft.drawSmoothCircle(positionX +75, positionY +25, 7, TFT_WHITE, COLOR_BACKGROUND);
+  tft.drawLine(positionX +67, positionY +32, positionX +83, positionY +18, TFT_WHITE);
+  tft.fillTriangle(positionX +155, positionY +33, positionX +175, positionY +33, positionX +175, positionY +22, TFT_WHITE);
+  // Energieverbrauch: Gesammt / je 100 km
+  positionY += 43;
+  tft.fillSmoothRoundRect(positionX, positionY, 190, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(1);
+  tft.drawString("kWh", positionX +10 , positionY +0, 2);
+  tft.setTextColor(TFT_WHITE);
+  tft.setTextSize(2);
+  tft.drawString(text.clear().add("  ").number(drivenKWh, 1).add("  | ").number(drivenKWh / drivenKM * 100, 1).c_str(), positionX +10, positionY +19);
+  tft.drawSmoothCircle(positionX +175, positionY +25, 7, TFT_WHITE, COLOR_BACKGROUND);
+  tft.drawLine(positionX +167, positionY +33, positionX +183, positionY +18, TFT_WHITE);
+  // Akkuverbrauch
+  positionY += 43;
+  tft.fillSmoothRoundRect(60, positionY, 120, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+  tft.setTextSize(2);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.drawString("Akku:", 67, positionY +13);
+  tft.setTextColor(TFT_WHITE);
+  tft.drawString(TextBuffer<8>().integer(drivenSoC * -1).add('%').c_str(), 127, positionY +13);
+
+  }
+
+void DisplayCharging(const DisplayModel &m) {
+  const CANValues &v = m.values;
+  TFT_eSPI &gfx = DisplayFrameBegin(tft); // framebuffer or panel
+  gfx.setTextColor(COLOR_TOPOLINO, COLOR_BACKGROUND, true);
+  gfx.setTextSize(2);
+  gfx.drawString("Ladevorgang:", 42, 50, 2);
+  DisplayLap(BenchChargingText);
+  // Ladestrom
+  TextBuffer<16> text;
+  if (ShowChargeAsKW) {
+    text.number(v.Current * v.Volt / 1000 * -1, 2).add(" kW");         // -#.##
+  }
+  else {
+    text.number(v.Current * -1, 1).add(" A");
+  }
+  DisplayText(gfx, GlyphsLarge, text.c_str(), 70, 90, 50, 160, COLOR_TOPOLINO, COLOR_BACKGROUND);
+  // SoC
+  text.clear().integer(v.SoC).add('%');
+  DisplayText(gfx, GlyphsHuge, text.c_str(), DisplayTextX(GlyphsHuge, text.c_str(), 224, AlignRight), 125, 122, 102, TFT_WHITE, COLOR_BACKGROUND);
+  DisplayLap(BenchChargingReadouts);
+  gfx.setTextSize(3);
+  gfx.setTextColor(COLOR_GREY, COLOR_BACKGROUND, true);
+  gfx.drawString(TextBuffer<16>().integer(m.charge.startSoC).add("% >").c_str(), 30, 130);  
+  // Ladedauer
+  gfx.setTextSize(3);
+  gfx.setTextColor(COLOR_TOPOLINO, COLOR_BACKGROUND, true);
+  gfx.drawString(TextBuffer<16>().integer((m.timeMs - m.charge.startTime) / 1000 / 60).add(" Min.").c_str(), 60, 165);
+  
+  // Temperatur Akku
+  gfx.setTextSize(2);
+  gfx.setTextColor(COLOR_GREY, COLOR_BACKGROUND, true);
+  gfx.drawString(TextBuffer<16>().fixed((v.Temp1 + v.Temp2) * 5, 1).add(" C").c_str(), 90, 200); // average, 1 decimal
+  DisplayLap(BenchChargingText);
+
+  // Animation
+  DisplayArc(gfx, 120, 120, 121, 105, 0, 360, COLOR_BACKGROUND, COLOR_BACKGROUND);
+  int arcLenght = 45;
+  int arcStart = (m.timeMs / 250 * 5) % 360; // 5 degrees per 250 ms, however often frames are drawn
+  int arcEnd = arcStart + arcLenght;
+  if (arcEnd > 360) {arcEnd = arcEnd - 360;}
+  DisplayArc(gfx, 120, 120, 121, 105, arcStart, arcEnd, COLOR_TOPOLINO, COLOR_BACKGROUND, true);
+  DisplayLap(BenchChargingAnimation);
+  DisplayFrameEnd(tft, 0, gfx.height() - 1);
+  DisplayLap(BenchPush);
+}
+
+void DisplayChargingResult(const DisplayModel &m) {
+  const Charge &c = m.charge;
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(2);
+  tft.drawString("Ladevorgang:", 42, 50, 2);
+  // Lademenge
+  tft.setTextSize(3);
+  tft.drawString(TextBuffer<16>().number(c.chargedWh / 1000.0f, 1).add(" kWh").c_str(), 70, 90);
+  // SoC
+  tft.setTextSize(4);
+  tft.setTextColor(TFT_WHITE);
+  tft.drawString(TextBuffer<16>().integer(c.endSoC).add('%').c_str(), 140, 125);
+  tft.setTextSize(3);
+  tft.setTextColor(COLOR_GREY);
+  tft.drawString(TextBuffer<16>().integer(c.startSoC).add("% >").c_str(), 30, 130);  
+  // Ladedauer
+  tft.setTextSize(3);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.drawString(TextBuffer<16>().integer((c.endTime - c.startTime) / 1000 / 60).add(" Min.").c_str(), 60, 165);
+  // Temperatur Akku
+  tft.setTextSize(2);
+  tft.setTextColor(COLOR_GREY, COLOR_BACKGROUND, true);
+  tft.drawString(TextBuffer<16>().fixed((m.values.Temp1 + m.values.Temp2) * 5, 1).add(" C").c_str(), 90, 200); // average, 1 decimal
+
+
+  // Charge
+  DisplayArc(tft, 120, 120, 121, 105, 0, map(c.endSoC, 0, 100, 1, 360), COLOR_TOPOLINO, COLOR_BACKGROUND, true);
+}
+
+void DisplaySleeping(const DisplayModel &m) {
+  static uint32_t entry = 0;
+  static int drawn = -1; // DisplaySleepPhase drawn since the screen was entered
+  if (m.screenEntry != entry) {
+    entry = m.screenEntry;
+    drawn = -1;
+  }
+  if (m.sleepPhase == SleepSending) {
+    if (drawn != SleepSending) {
+      tft.setTextSize(3);
+      tft.setTextColor(COLOR_TOPOLINO);
+      tft.drawString("Sleeping...", 30, 110);
+      tft.setTextSize(1);
+      tft.setTextColor(TFT_WHITE);
+      tft.drawString("Sending data", 30, 160);
+    }
+
+    // Status Indicator
+    tft.drawRoundRect(63, 190, 55, 20, 8, COLOR_ALMOSTBLACK);
+    tft.setTextColor(m.statusColor);
+    tft.setTextSize(1);
+    tft.drawString("Status", 73, 197);
+
+    // CAN Indicator
+    tft.drawRoundRect(80, 215, 38, 20, 8, COLOR_ALMOSTBLACK);
+    tft.setTextColor(m.canColor);
+    tft.setTextSize(1);
+    tft.drawString("CAN", 90, 222);
+
+    // WIFI Indicator
+    tft.drawRoundRect(122, 190, 55, 20, 8, COLOR_ALMOSTBLACK);
+    tft.setTextColor(m.wifiColor); 
+    tft.setTextSize(1);
+    tft.drawString("WIFI", 138, 197);
+
+    // Tx Indicator
+    tft.drawRoundRect(122, 215, 38, 20, 8, COLOR_ALMOSTBLACK);
+    tft.setTextColor(m.txColor);
+    tft.setTextSize(1);
+    tft.drawString("Tx", 135, 222);
+  }
+  else if (drawn != SleepAsleep) {
+    tft.fillRect(0, 100, tft.width(), tft.height() - 100, TFT_BLACK); // text and indicators of the sending phase
+    tft.setTextSize(3);
+    tft.setTextColor(COLOR_TOPOLINO);
+    tft.drawCentreString("Topolino is", 120, 100, 1);
+    tft.drawCentreString("sleeping...", 120, 125, 1);
+
+    // WIFI Indicator
+    tft.fillRoundRect(122, 188, 55, 20, 8, m.wifiColor);
+    tft.setTextColor(TFT_BLACK); 
+    tft.setTextSize(1);
+    tft.drawString("WIFI", 139, 195);
+
+    // Tx Indicator
+    tft.fillRoundRect(139, 213, 25, 20, 8, m.txColor);
+    tft.setTextColor(TFT_BLACK);
+    tft.setTextSize(1);
+    tft.drawString("Tx", 146, 219);
+  }
+  drawn = m.sleepPhase;
+  DisplayLap(BenchSleeping);
+}
+
+void DisplayBTConnecting(const DisplayModel &m) {
+  tft.fillSmoothRoundRect(20, 100, 200, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+  tft.setTextColor(COLOR_TOPOLINO);
+  tft.setTextSize(2);
+  tft.drawCentreString("BT Connecting...", 120, 112, 1);
+  #ifdef DEBUGBT
+    tft.setTextSize(2);
+    tft.drawCentreString(TextBuffer<16>().integer(m.btTimeout).add("sek.").c_str(), 120, 140, 1);
+  #else
+    (void)m;
+  #endif
+}
+
+
+// Gauge rings: drawSmoothArc vs. coverage tables, readouts: scaled GLCD font vs. glyph atlas.
+// Drawn directly on the panel, the caller enters the screen again afterwards.
+void DisplayBenchmark() {
+  const int16_t rings[][2] = { {121, 105}, {121, 110}, {120, 105} };
+  const uint16_t segments[][2] = { {120, 240}, {45, 90}, {0, 360} };
+  const int runs = 10;
+  FrameBufferSync(tft);
+  Log("Display benchmark, us per draw (" + String(runs) + " runs) - tables: " + String(WidgetRingBytes()) + " bytes");
+  for (auto &ring : rings) {
+    for (auto &segment : segments) {
+      uint32_t start = micros();
+      for (int i = 0; i < runs; i++) { tft.drawSmoothArc(120, 120, ring[0], ring[1], segment[0], segment[1], COLOR_TOPOLINO, COLOR_BACKGROUND, true); }
+      uint32_t smooth = (micros() - start) / runs;
+      start = micros();
+      for (int i = 0; i < runs; i++) { DisplayArc(tft, 120, 120, ring[0], ring[1], segment[0], segment[1], TFT_YELLOW, COLOR_BACKGROUND, true); }
+      uint32_t table = (micros() - start) / runs;
+      Log(" - " + String(ring[0]) + "/" + String(ring[1]) + " " + String(segment[0]) + ".." + String(segment[1]) + ": drawSmoothArc " + String(smooth) + " table " + String(table));
+    }
+  }
+
+  // Consumption readout (box + size 3 text) and voltage readout (box + size 2 text), per frame
+  const char *consumption = "-12.34 kW", *volt = "54.3V";
+  uint32_t start = micros();
+  for (int i = 0; i < runs; i++) {
+    tft.fillSmoothRoundRect(40, 65, 160, 60, 10, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+    tft.setTextSize(3);
+    tft.setTextColor(TFT_WHITE);
+    tft.drawRightString(consumption, 185, 85, 1);
+    tft.fillSmoothRoundRect(85, 130, 70, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
+    tft.setTextSize(2);
+    tft.drawCentreString(volt, 120, 143, 1);
+  }
+  uint32_t font = (micros() - start) / runs;
+  start = micros();
+  for (int i = 0; i < runs; i++) {
+    DisplayText(tft, GlyphsLarge, consumption, DisplayTextX(GlyphsLarge, consumption, 185, AlignRight), 85, 40, 160, TFT_WHITE, COLOR_ALMOSTBLACK);
+    DisplayText(tft, GlyphsMedium, volt, DisplayTextX(GlyphsMedium, volt, 120, AlignCentre), 143, 85, 70, TFT_WHITE, COLOR_ALMOSTBLACK);
+  }
+  uint32_t atlas = (micros() - start) / runs;
+  Log(" - readouts: drawRightString/drawCentreString " + String(font) + " us (" + String(1000000 / max(font, 1U)) + " fps) glyph atlas " + String(atlas) + " us (" + String(1000000 / max(atlas, 1U)) + " fps)");
+}
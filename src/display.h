@@ -0,0 +1,50 @@
+// Screens
+// Everything drawn on the round display: the drive screen widgets and the screen functions
+// the render task calls with a view model (displaymodel.h). Only talks to the panel through
+// TFT_eSPI, so the same code also runs against the in-memory panel of the host render tool
+// (../tools/render.cpp).
+
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <options.h>
+#include <displaymodel.h>
+#include <renderbench.h>
+
+#define COLOR_ALMOSTBLACK 0x436c
+#define COLOR_BACKGROUND 0x2104
+#define COLOR_BG_GREEN 0x0140
+#define COLOR_BG_RED 0x3000
+#define COLOR_TOPOLINO 0x05f5
+#define COLOR_GREY 0xa554
+#define COLOR_LIGHTRED 0xfa08
+
+extern TFT_eSPI tft; // provided by the application (main.cpp / host tools)
+extern PanelStatistics DisplayPanelStats;
+#if DISPLAY_BENCHMARK
+extern RenderBench DisplayBench; // written by DisplayRender(), see renderbench.h
+#endif
+
+// Initializes the panel and the framebuffer, call once with the display powered
+void DisplayBegin();
+
+// Draws the view model: enters the screen if m.screenEntry changed, then updates it. Applies
+// the panel power of the model first (displaypower.h), nothing is drawn while the panel sleeps.
+void DisplayRender(const DisplayModel &m);
+// True while a drive screen gauge glides to its value (tween.h): draw the last model again
+// after DISPLAY_TWEEN_FRAME_MS
+bool DisplayAnimating();
+// Clears the screen once and draws what doesn't change
+void DisplayEnter(const DisplayModel &m);
+
+void DisplayBoot();
+void DisplayMainUI(const DisplayModel &m);
+void DisplayTripResults(const DisplayModel &m);
+void DisplayCharging(const DisplayModel &m);
+void DisplayChargingResult(const DisplayModel &m);
+void DisplaySleeping(const DisplayModel &m);
+void DisplayBTConnecting(const DisplayModel &m);
+
+// Console "display bench": draws over the current screen, enter it again afterwards
+void DisplayBenchmark();
@@ -0,0 +1,59 @@
+// Display view model
+// Everything a screen draws, copied by value from loop() into the render queue. The render
+// task only reads its copy and never the vehicle state, loop() never touches the display
+// once the render task runs - a slow SPI repaint can't delay CAN handling or the BT relais.
+
+#pragma once
+
+#include <Arduino.h>
+#include <vehicle.h>
+#include <screens.h>
+#include <history.h>
+#include <displaypower.h>
+
+#define RENDER_TASK_CORE 0          // with the CAN receive task, loop() runs on core 1
+#define RENDER_TASK_PRIORITY 2      // below the CAN receive task
+#define RENDER_QUEUE_LENGTH 4
+
+enum DisplaySleepPhase : uint8_t {
+  SleepSending,     // sending the last data before sleeping
+  SleepAsleep
+};
+
+struct DisplayModel {
+  Screen screen = ScreenBoot;
+  uint32_t screenEntry = 0;         // ScreenManager::entries(): a new value clears and enters the screen
+  uint32_t postedUs = 0;
+  unsigned long timeMs = 0;         // millis() when the model was made
+  CANValues values;
+  bool tripActive = false;
+  float avgkWh = 0;
+  HistorySample history;            // newest power/speed sample
+  uint32_t historySamples = 0;      // HistorySampler::count()
+  uint8_t savedTrips = 0;           // DEBUG
+  unsigned long statusColor = 0;    // indicator colors
+  unsigned long wifiColor = 0;
+  unsigned long btColor = 0;
+  unsigned long canColor = 0;
+  unsigned long txColor = 0;
+  trip lastTrip = {};               // trip result
+  Charge charge;                    // charging and charge result
+  DisplaySleepPhase sleepPhase = SleepSending;
+  int btTimeout = 0;                // BT connecting, ms
+  DisplayPowerState power = PowerDriving;
+  uint32_t wakeUs = 0;              // micros() of the CAN frame that ended the last sleep
+};
+static_assert(std::is_trivially_copyable<DisplayModel>::value, "DisplayModel is copied through a FreeRTOS queue");
+
+struct RenderStatistics {
+  uint32_t models = 0;              // posted by loop()
+  uint32_t queueFull = 0;           // posts that replaced the oldest waiting model
+  uint32_t queueDepthMax = 0;       // models waiting when the render task woke up
+  uint32_t coalesced = 0;           // skipped for a newer model
+  uint32_t rendered = 0;
+  uint32_t tweenFrames = 0;         // drawn again from the last model while a gauge glides
+  uint32_t latencyUsLast = 0;       // posted -> handed to the panel
+  uint32_t latencyUsMax = 0;
+  uint32_t renderUsLast = 0;
+  uint32_t renderUsMax = 0;
+};
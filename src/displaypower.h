@@ -0,0 +1,111 @@
+// Display power
+// The panel follows the vehicle state: full brightness while ready or driving, dimmed while
+// charging or parked, asleep (GC9A01 DISPOFF + SLPIN, backlight off) once the sleeping screen
+// has sent the last data, and without power (DISPLAY_POWER_PIN) in deep sleep. loop() picks
+// the state, the render task applies it with the view model: it wakes the panel (SLPOUT),
+// draws the frame and only then switches the display on, so the first frame after a CAN
+// wake-up is already the drive screen. Brightness needs a backlight on a PWM pin
+// (DISPLAY_BACKLIGHT_PIN, build flag); without one the panel runs at full brightness until
+// it sleeps.
+//
+// There is no current sensor on the board: the mA column holds estimates for the whole device
+// on the 3.3 V rail from typical datasheet figures (ESP32 with WiFi/BT 100-130 mA, MCP2515 and
+// transceiver 10 mA, panel logic 5 mA, backlight up to 20 mA, deep sleep: MCP2515 listening).
+// Measure your own hardware and update the table. The `power` command shows the time per
+// state and the resulting charge.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef DISPLAY_BACKLIGHT_PIN
+#define DISPLAY_BACKLIGHT_PIN -1 // -1 = backlight tied to the panel supply, no dimming
+#endif
+#define DISPLAY_BACKLIGHT_CHANNEL 0
+#define DISPLAY_BACKLIGHT_FREQUENCY 5000
+#define DISPLAY_WAKE_MS 5               // GC9A01: SLPOUT -> next command
+#define DISPLAY_SLEEP_MS 120            // GC9A01: SLPOUT -> SLPIN
+
+#define GC9A01_SLPIN 0x10
+#define GC9A01_SLPOUT 0x11
+#define GC9A01_DISPOFF 0x28
+#define GC9A01_DISPON 0x29
+
+enum PanelMode : uint8_t {
+  PanelOn,
+  PanelAsleep,      // controller keeps its memory, wakes in DISPLAY_WAKE_MS
+  PanelOff          // power cut, needs DisplayBegin() (deep sleep only, wakes with a reset)
+};
+
+enum DisplayPowerState : uint8_t {
+  PowerDriving,     // ready or driving
+  PowerCharging,
+  PowerParked,      // not ready, CAN still active
+  PowerSleeping,    // sleeping screen sent its data
+  PowerDeepSleep,
+  PowerStateCount
+};
+
+struct DisplayPowerConfig {
+  DisplayPowerState state;
+  const char *name;
+  PanelMode panel;
+  uint8_t brightness;   // backlight duty 0..255
+  uint16_t deviceMa;    // device current estimate, see above
+};
+
+constexpr DisplayPowerConfig DisplayPowerConfigTable[] = {
+  //  state              name          panel        bright  mA
+  { PowerDriving,        "driving",    PanelOn,     255,    165 },
+  { PowerCharging,       "charging",   PanelOn,     96,     150 },
+  { PowerParked,         "parked",     PanelOn,     48,     145 },
+  { PowerSleeping,       "sleeping",   PanelAsleep, 0,      120 },
+  { PowerDeepSleep,      "deep sleep", PanelOff,    0,      6 },
+};
+static_assert(sizeof(DisplayPowerConfigTable) / sizeof(DisplayPowerConfigTable[0]) == PowerStateCount, "DisplayPowerConfigTable: one row per DisplayPowerState");
+
+// Render task side: what the panel got
+struct PanelStatistics {
+  PanelMode mode = PanelOn;
+  uint8_t brightness = 255;
+  uint32_t sleeps = 0;
+  uint32_t wakes = 0;
+  uint32_t wakeUsLast = 0;      // CAN frame that ended the sleep -> display on with the new frame
+  uint32_t wakeUsMax = 0;
+};
+
+struct DisplayPowerStats {
+  uint32_t entries = 0;
+  uint64_t timeMs = 0;
+
+  // Charge drawn in the state, with the table's current
+  uint32_t mAh(DisplayPowerState state) const { return (uint32_t)(timeMs * DisplayPowerConfigTable[state].deviceMa / 3600000); }
+};
+
+// loop() side: the state and the time spent in each
+class DisplayPower {
+  public:
+    // Returns true if the state changed
+    bool set(DisplayPowerState state, uint32_t nowMs) {
+      mStats[mState].timeMs += nowMs - mSinceMs;
+      mSinceMs = nowMs;
+      if (state == mState) { return false; }
+      mState = state;
+      mStats[state].entries++;
+      return true;
+    }
+
+    DisplayPowerState state() const { return mState; }
+    DisplayPowerStats stats(DisplayPowerState state, uint32_t nowMs) const {
+      DisplayPowerStats stats = mStats[state];
+      if (state == mState) { stats.timeMs += nowMs - mSinceMs; }
+      return stats;
+    }
+
+  private:
+    DisplayPowerState mState = PowerDriving;
+    uint32_t mSinceMs = 0;
+    DisplayPowerStats mStats[PowerStateCount];
+};
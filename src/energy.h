@@ -0,0 +1,81 @@
+// Battery energy integrator
+// Integrates V x I x dt on every 0x580 frame in fixed point, using the frame timestamps of
+// the CAN receive task. Raw units: current 0.1 A, voltage 0.01 V -> power in mW,
+// mW x us = nJ, accumulated in int64 (enough for > 2500 kWh).
+// Energy taken from the battery (driving) and put into it (recuperation, charger) are
+// kept apart, for the whole uptime, the current trip and the current charge session.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <candecoder.h>
+
+#define ENERGY_MAX_GAP_US 1000000 // frames further apart are not integrated across
+#define ENERGY_NJ_PER_WH 3600000000000LL
+
+struct EnergyAccumulator {
+  int64_t consumedNj = 0;     // out of the battery
+  int64_t recuperatedNj = 0;  // into the battery
+
+  int32_t consumedWh() const { return consumedNj / ENERGY_NJ_PER_WH; }
+  int32_t recuperatedWh() const { return recuperatedNj / ENERGY_NJ_PER_WH; }
+  int32_t netWh() const { return (consumedNj - recuperatedNj) / ENERGY_NJ_PER_WH; } // > 0 = consumed
+};
+
+class EnergyIntegrator {
+  public:
+    // One 0x580 frame: raw current (0.1 A, > 0 = charging) and raw voltage (0.01 V)
+    void sample(int64_t timestamp, int32_t currentRaw, int32_t voltRaw) {
+      constexpr CanSignalDesc volt = CanSignalTable[SignalVolt];
+      if (voltRaw < volt.rawMin || voltRaw > volt.rawMax) {
+        if (mVoltRaw == 0) { return; } // no valid voltage yet
+        voltRaw = mVoltRaw;
+      }
+      mVoltRaw = voltRaw;
+
+      // Zero order hold: the previous power applies until this frame
+      int64_t dt = timestamp - mTimestamp;
+      if (mTimestamp != 0 && dt > 0 && dt <= ENERGY_MAX_GAP_US) {
+        int64_t energy = (int64_t)mPowerMw * dt;
+        if (energy < 0) { add(-energy, 0); }
+        else { add(0, energy); }
+      }
+      else if (mTimestamp != 0) {
+        mGaps++;
+      }
+      mTimestamp = timestamp;
+      mPowerMw = currentRaw * voltRaw;
+      mSamples++;
+    }
+
+    // Same, straight from the frame payload
+    void sampleFrame(int64_t timestamp, const uint8_t *data) {
+      sample(timestamp, CanExtractRaw<SignalCurrent>(data), CanExtractRaw<SignalVolt>(data));
+    }
+
+    int32_t powerW() const { return mPowerMw / 1000; } // > 0 = charging
+    uint32_t samples() const { return mSamples; }
+    uint32_t gaps() const { return mGaps; }
+
+    EnergyAccumulator total;
+    EnergyAccumulator trip;     // reset at trip start
+    EnergyAccumulator charge;   // reset at charge start
+
+  private:
+    void add(int64_t consumed, int64_t recuperated) {
+      total.consumedNj += consumed;
+      total.recuperatedNj += recuperated;
+      trip.consumedNj += consumed;
+      trip.recuperatedNj += recuperated;
+      charge.consumedNj += consumed;
+      charge.recuperatedNj += recuperated;
+    }
+
+    int64_t mTimestamp = 0;
+    int32_t mPowerMw = 0;
+    int32_t mVoltRaw = 0;
+    uint32_t mSamples = 0;
+    uint32_t mGaps = 0;
+};
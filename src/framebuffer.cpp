@@ -0,0 +1,234 @@
+#include <framebuffer.h>
+#include <image.h>
+#include <esp_heap_caps.h>
+
+FrameBufferStatistics FrameBufferStats;
+RoundClipStatistics DisplayClipStats;
+
+static TFT_eSprite *FrameBufferSprite = NULL;             // NULL = direct drawing
+static TFT_eSprite *FrameBufferCanvas = NULL;
+static uint16_t *FrameBufferBands[2] = { NULL, NULL };    // RGB565 DMA buffers
+static uint16_t FrameBufferPalette[256];                  // 8 bpp: RGB332 -> RGB565, byte swapped for the panel
+static bool FrameBufferDmaOpen = false;                   // DMA started, transaction not yet ended
+static uint32_t FrameBufferFrameStart = 0;
+
+static bool FrameBufferAllocate(TFT_eSPI &tft, uint8_t bpp) {
+  uint32_t bytes = (uint32_t)tft.width() * tft.height() * bpp / 8;
+  uint32_t bandBytes = (uint32_t)tft.width() * FRAMEBUFFER_BAND_LINES * 2;
+  if (heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) < bytes
+   || heap_caps_get_free_size(MALLOC_CAP_8BIT) < bytes + 2 * bandBytes + FRAMEBUFFER_HEAP_RESERVE) { return false; }
+
+  if (FrameBufferCanvas == NULL) { FrameBufferCanvas = new TFT_eSprite(&tft); }
+  FrameBufferCanvas->setColorDepth(bpp);
+  if (FrameBufferCanvas->createSprite(tft.width(), tft.height()) == NULL) { return false; }
+  FrameBufferBands[0] = (uint16_t*)heap_caps_malloc(bandBytes, MALLOC_CAP_DMA);
+  FrameBufferBands[1] = (uint16_t*)heap_caps_malloc(bandBytes, MALLOC_CAP_DMA);
+  if (FrameBufferBands[0] == NULL || FrameBufferBands[1] == NULL) {
+    heap_caps_free(FrameBufferBands[0]);
+    heap_caps_free(FrameBufferBands[1]);
+    FrameBufferBands[0] = FrameBufferBands[1] = NULL;
+    FrameBufferCanvas->deleteSprite();
+    return false;
+  }
+  if (bpp == 8) {
+    for (int c = 0; c < 256; c++) {
+      // RRRGGGBB -> RRRRRGGGGGGBBBBB, low bits repeat the high bits so white stays white
+      uint16_t r = (c >> 5) & 0x07, g = (c >> 2) & 0x07, b = c & 0x03;
+      uint16_t color = ((r << 2 | r >> 1) << 11) | ((g << 3 | g) << 5) | (b << 3 | b << 1 | b >> 1);
+      FrameBufferPalette[c] = (color >> 8) | (color << 8);
+    }
+  }
+  FrameBufferStats.bytes = bytes + 2 * bandBytes;
+  FrameBufferSprite = FrameBufferCanvas;
+  return true;
+}
+
+uint8_t FrameBufferBegin(TFT_eSPI &tft) {
+  FrameBufferStats.heapFreeBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  FrameBufferStats.dma = tft.initDMA();
+  uint8_t bpp = FrameBufferStats.dma ? DISPLAY_FRAMEBUFFER_BPP : 0;
+  if (bpp == 16 && !FrameBufferAllocate(tft, 16)) { bpp = 8; }
+  if (bpp == 8 && !FrameBufferAllocate(tft, 8)) { bpp = 0; }
+  if (bpp == 0) { FrameBufferStats.bytes = 0; }
+  FrameBufferStats.bpp = bpp;
+  FrameBufferStats.heapFreeAfter = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  FrameBufferStats.heapLargestAfter = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  return bpp;
+}
+
+// Columns x .. x + w - 1 of rows y .. y + lines - 1 that have to be sent, false if none
+static bool DisplayClip(int16_t &x, int16_t &w, int16_t y, int16_t lines) {
+#if DISPLAY_ROUND_CLIP
+  return RoundClip(x, w, y, lines);
+#else
+  (void)x;
+  (void)y;
+  return w > 0 && lines > 0;
+#endif
+}
+
+void FrameBufferSync(TFT_eSPI &tft) {
+  if (!FrameBufferDmaOpen) { return; }
+  uint32_t start = micros();
+  tft.dmaWait();
+  tft.endWrite();
+  FrameBufferDmaOpen = false;
+  uint32_t waited = micros() - start;
+  if (waited > FrameBufferStats.syncUsMax) { FrameBufferStats.syncUsMax = waited; }
+}
+
+bool FrameBufferBusy() {
+  return FrameBufferDmaOpen;
+}
+
+void FrameBufferClear(uint32_t color) {
+  if (FrameBufferSprite) { FrameBufferSprite->fillSprite(color); }
+}
+
+void DisplayFill(TFT_eSPI &tft, uint32_t color) {
+  uint32_t sent = 0;
+  tft.startWrite();
+  for (int16_t y = 0; y < tft.height(); y += ROUND_CLIP_BAND) {
+    int16_t x = 0, w = tft.width(), lines = min((int16_t)ROUND_CLIP_BAND, (int16_t)(tft.height() - y));
+    if (!DisplayClip(x, w, y, lines)) { continue; }
+    tft.fillRect(x, y, w, lines, color);
+    sent += (uint32_t)w * lines * 2 + ROUND_CLIP_WINDOW_BYTES;
+  }
+  tft.endWrite();
+  DisplayClipStats.add((uint32_t)tft.width() * tft.height() * 2 + ROUND_CLIP_WINDOW_BYTES, sent);
+}
+
+TFT_eSPI &DisplayFrameBegin(TFT_eSPI &tft) {
+  if (!FrameBufferSprite) {
+    FrameBufferFrameStart = micros();
+    tft.startWrite(); // keeps CS low across the frame, nested TFT_eSPI transactions are merged
+    return tft;
+  }
+  FrameBufferSync(tft);
+  FrameBufferFrameStart = micros();
+  return *FrameBufferSprite;
+}
+
+void DisplayFrameEnd(TFT_eSPI &tft, int16_t firstRow, int16_t lastRow) {
+  uint32_t now = micros();
+  FrameBufferStats.frames++;
+  FrameBufferStats.drawUsLast = now - FrameBufferFrameStart;
+  if (FrameBufferStats.drawUsLast > FrameBufferStats.drawUsMax) { FrameBufferStats.drawUsMax = FrameBufferStats.drawUsLast; }
+
+  if (!FrameBufferSprite) {
+    tft.endWrite();
+    return;
+  }
+
+  if (firstRow < 0) { firstRow = 0; }
+  if (lastRow >= tft.height()) { lastRow = tft.height() - 1; }
+  FrameBufferStats.rowsLast = (lastRow >= firstRow) ? lastRow - firstRow + 1 : 0;
+  if (FrameBufferStats.rowsLast == 0) {
+    FrameBufferStats.pushUsLast = 0;
+    return;
+  }
+
+  int16_t width = tft.width();
+  uint32_t sent = 0;
+  bool swapBytes = tft.getSwapBytes();
+  tft.setSwapBytes(false); // sprite and palette are already in panel byte order
+  tft.startWrite();        // ended by FrameBufferSync() once the last transfer is done
+  uint8_t band = 0;
+  for (int16_t y = firstRow; y <= lastRow; y += FRAMEBUFFER_BAND_LINES) {
+    int16_t lines = min(FRAMEBUFFER_BAND_LINES, lastRow + 1 - y);
+    int16_t x = 0, w = width;
+    if (!DisplayClip(x, w, y, lines)) { continue; }
+    // pushImageDMA() waits for the previous band, so this buffer's last transfer is done
+    uint16_t *out = FrameBufferBands[band];
+    for (int16_t row = y; row < y + lines; row++, out += w) {
+      if (FrameBufferStats.bpp == 16) {
+        memcpy(out, (const uint16_t*)FrameBufferSprite->getPointer() + row * width + x, w * 2);
+      }
+      else {
+        const uint8_t *in = (const uint8_t*)FrameBufferSprite->getPointer() + row * width + x;
+        for (int16_t i = 0; i < w; i++) { out[i] = FrameBufferPalette[in[i]]; }
+      }
+    }
+    tft.pushImageDMA(x, y, w, lines, FrameBufferBands[band]);
+    sent += (uint32_t)w * lines * 2;
+    band ^= 1;
+  }
+  tft.setSwapBytes(swapBytes);
+  FrameBufferDmaOpen = true;
+
+  FrameBufferStats.bytesPushed += sent;
+  FrameBufferStats.bytesClipped += (uint32_t)FrameBufferStats.rowsLast * width * 2 - sent;
+  FrameBufferStats.pushUsLast = micros() - now;
+  if (FrameBufferStats.pushUsLast > FrameBufferStats.pushUsMax) { FrameBufferStats.pushUsMax = FrameBufferStats.pushUsLast; }
+}
+
+void DisplayPushImage(TFT_eSPI &target, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *pixels) {
+  if (FrameBufferSprite && &target == FrameBufferSprite) {
+    // 16 bpp: copied as is, sprite memory is high byte first already. 8 bpp: TFT_eSprite reads
+    // the pixels as RGB565 before quantizing, so they have to be swapped back.
+    bool swapBytes = FrameBufferSprite->getSwapBytes();
+    FrameBufferSprite->setSwapBytes(FrameBufferStats.bpp == 8);
+    FrameBufferSprite->pushImage(x, y, w, h, pixels);
+    FrameBufferSprite->setSwapBytes(swapBytes);
+    return;
+  }
+  bool swapBytes = target.getSwapBytes();
+  target.setSwapBytes(false);
+  target.pushImage(x, y, w, h, pixels);
+  target.setSwapBytes(swapBytes);
+}
+
+void DisplayImage(TFT_eSPI &tft, int16_t x, int16_t y, const uint8_t *image) {
+  uint32_t start = micros();
+  FrameBufferSync(tft);
+  uint16_t width = ImageWidth(image), height = ImageHeight(image);
+  ImageDecoder decoder(image);
+
+  uint32_t bandBytes = (uint32_t)width * IMAGE_BAND_LINES * 2;
+  uint16_t *bands[2] = { NULL, NULL };
+  if (FrameBufferStats.dma) {
+    bands[0] = (uint16_t*)heap_caps_malloc(bandBytes, MALLOC_CAP_DMA);
+    bands[1] = (uint16_t*)heap_caps_malloc(bandBytes, MALLOC_CAP_DMA);
+  }
+
+  bool swapBytes = tft.getSwapBytes();
+  tft.setSwapBytes(false); // decoded in panel byte order
+  tft.startWrite();
+  uint32_t sent = 0;
+  if (bands[0] && bands[1]) {
+    uint8_t band = 0;
+    for (uint16_t row = 0; row < height; row += IMAGE_BAND_LINES) {
+      uint16_t lines = min(IMAGE_BAND_LINES, height - row);
+      // pushImageDMA() waits for the previous band, so this buffer's last transfer is done
+      decoder.decode(bands[band], (uint32_t)lines * width, true);
+      int16_t cx = x, cw = width;
+      if (!DisplayClip(cx, cw, y + row, lines)) { continue; }
+      if (cw != width) {
+        // Visible columns to the front of each line, in place: the target never passes the source
+        for (uint16_t i = 0; i < lines; i++) { memmove(bands[band] + i * cw, bands[band] + i * width + (cx - x), cw * 2); }
+      }
+      tft.pushImageDMA(cx, y + row, cw, lines, bands[band]);
+      sent += (uint32_t)cw * lines * 2 + ROUND_CLIP_WINDOW_BYTES;
+      band ^= 1;
+    }
+    tft.dmaWait();
+  }
+  else {
+    // No DMA or no memory for the bands: line by line from a small buffer
+    uint16_t *line = bands[0] ? bands[0] : bands[1] ? bands[1] : (uint16_t*)malloc(width * 2);
+    for (uint16_t row = 0; line && row < height; row++) {
+      decoder.decode(line, width, true);
+      int16_t cx = x, cw = width;
+      if (!DisplayClip(cx, cw, y + row, 1)) { continue; }
+      tft.pushImage(cx, y + row, cw, 1, line + (cx - x));
+      sent += (uint32_t)cw * 2 + ROUND_CLIP_WINDOW_BYTES;
+    }
+    if (line != bands[0] && line != bands[1]) { free(line); }
+  }
+  tft.endWrite();
+  tft.setSwapBytes(swapBytes);
+  heap_caps_free(bands[0]);
+  heap_caps_free(bands[1]);
+  DisplayClipStats.add((uint32_t)width * height * 2 + ROUND_CLIP_WINDOW_BYTES, sent);
+  FrameBufferStats.imageUsLast = micros() - start;
+}
@@ -0,0 +1,86 @@
+// Full frame framebuffer for the periodically redrawn screens
+// With DISPLAY_FRAMEBUFFER_BPP 16 or 8 (build flag) the drive and charging screens draw into
+// a TFT_eSprite instead of the panel, and only the rows changed in a frame are sent with DMA
+// afterwards - the erase-then-draw steps never reach the panel. loop() goes on while the
+// transfer runs, the next frame waits for it (FrameBufferSync) before drawing.
+//   16 bpp: 115 KB, copied as is.
+//    8 bpp: 57 KB RGB332 (TFT_eSprite's 8 bit format, colors get quantized), converted to
+//           RGB565.
+// Rows are sent in bands through two small DMA buffers: the next band is copied while the
+// previous one is transmitted. On the round panel (DISPLAY_ROUND_CLIP) each band only covers
+// the columns visible through the glass, see roundclip.h.
+// The heap is shared with WiFi and Bluetooth: if the sprite doesn't fit with
+// FRAMEBUFFER_HEAP_RESERVE left, 8 bpp is tried, then the screens draw directly again.
+// Compressed images (image.h) are streamed to the panel the same way, see DisplayImage().
+
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <roundclip.h>
+
+#ifndef DISPLAY_FRAMEBUFFER_BPP
+#define DISPLAY_FRAMEBUFFER_BPP 0 // 0 = draw directly to the panel
+#endif
+#ifndef DISPLAY_ROUND_CLIP
+#ifdef GC9A01_DRIVER
+#define DISPLAY_ROUND_CLIP 1 // skip the invisible corners in full screen operations
+#else
+#define DISPLAY_ROUND_CLIP 0
+#endif
+#endif
+#define FRAMEBUFFER_HEAP_RESERVE 90000 // left for WiFi, Bluetooth and HTTP after the allocation
+#define FRAMEBUFFER_BAND_LINES 10      // lines copied per DMA transfer
+#define IMAGE_BAND_LINES 8             // DisplayImage(): lines decoded per DMA transfer
+
+struct FrameBufferStatistics {
+  uint8_t bpp = 0;              // 0 = direct drawing
+  bool dma = false;             // SPI DMA available
+  uint32_t bytes = 0;           // sprite plus DMA band buffers
+  uint32_t heapFreeBefore = 0;
+  uint32_t heapFreeAfter = 0;
+  uint32_t heapLargestAfter = 0;
+  uint32_t frames = 0;
+  uint32_t drawUsLast = 0;      // DisplayFrameBegin -> DisplayFrameEnd, without the push
+  uint32_t drawUsMax = 0;
+  uint32_t pushUsLast = 0;      // CPU time of the push (until the last band is started)
+  uint32_t pushUsMax = 0;
+  uint32_t syncUsMax = 0;       // waiting for the previous DMA transfer
+  uint32_t rowsLast = 0;        // rows sent with the last frame
+  uint64_t bytesPushed = 0;     // SPI payload sent from the framebuffer
+  uint64_t bytesClipped = 0;    // not sent: outside the round glass
+  uint32_t imageUsLast = 0;     // last DisplayImage()
+};
+
+extern FrameBufferStatistics FrameBufferStats;
+extern RoundClipStatistics DisplayClipStats; // full screen clears and images
+
+// Sets up DMA and allocates the framebuffer (call once after tft.init()), returns the color depth in use
+uint8_t FrameBufferBegin(TFT_eSPI &tft);
+
+// Waits for a running DMA transfer and closes its SPI transaction. Call before drawing
+// to the panel directly.
+void FrameBufferSync(TFT_eSPI &tft);
+
+// True while a DMA transfer's SPI transaction is open (FrameBufferSync() not yet called)
+bool FrameBufferBusy();
+
+// Clears the framebuffer along with the panel (see DisplayClear)
+void FrameBufferClear(uint32_t color);
+
+// fillScreen() that only sends the visible part of the round panel
+void DisplayFill(TFT_eSPI &tft, uint32_t color);
+
+// Frame bracket: returns the target to draw into (framebuffer or panel). DisplayFrameEnd()
+// sends rows firstRow..lastRow (none if lastRow < firstRow) or ends the SPI transaction.
+TFT_eSPI &DisplayFrameBegin(TFT_eSPI &tft);
+void DisplayFrameEnd(TFT_eSPI &tft, int16_t firstRow, int16_t lastRow);
+
+// pushImage() into the framebuffer or to the panel (pushImage is not virtual in TFT_eSPI),
+// pixels high byte first
+void DisplayPushImage(TFT_eSPI &target, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *pixels);
+
+// Draws a compressed image (image.h) at x, y. It is decoded IMAGE_BAND_LINES at a time into
+// two DMA buffers, the next band is decoded while the previous one is sent. Columns outside
+// the round glass are dropped before sending.
+void DisplayImage(TFT_eSPI &tft, int16_t x, int16_t y, const uint8_t *image);
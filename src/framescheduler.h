@@ -0,0 +1,104 @@
+// Display frame scheduler
+// Frames are rendered when something shown on the screen changed (invalidate()), at most
+// every minIntervalMs, plus a keep-alive frame every keepAliveMs for values that aren't
+// signals (trip averages, charging animation). The widgets only send what changed, so a
+// keep-alive frame with static values costs no SPI traffic. Per vehicle state the scheduler
+// counts frames and the latency from the change (CAN frame drained) to the frame's view
+// model being posted to the render task.
+//
+// No Arduino dependencies
+
+#pragma once
+
+#include <stdint.h>
+
+enum FrameState : uint8_t {
+  FrameStateParked,     // not ready
+  FrameStateReady,      // ready, standing
+  FrameStateDriving,
+  FrameStateCharging,
+  FrameStateCount
+};
+
+struct FrameStateConfig {
+  FrameState state;
+  const char *name;
+  uint16_t minIntervalMs;   // max frame rate while values change
+  uint16_t keepAliveMs;     // frame without changes
+};
+
+constexpr FrameStateConfig FrameStateConfigTable[] = {
+  //  state                 name        min   keep-alive
+  { FrameStateParked,       "parked",   30,   10000 },
+  { FrameStateReady,        "ready",    30,   1000 },
+  { FrameStateDriving,      "driving",  30,   1000 },
+  { FrameStateCharging,     "charging", 30,   250 },   // animation step
+};
+static_assert(sizeof(FrameStateConfigTable) / sizeof(FrameStateConfigTable[0]) == FrameStateCount, "FrameStateConfigTable: one row per FrameState");
+
+struct FrameStateStats {
+  uint32_t frames = 0;
+  uint32_t changeFrames = 0;    // rendered for an invalidate()
+  uint32_t latencyUsLast = 0;   // change -> frame posted
+  uint32_t latencyUsMax = 0;
+  uint64_t latencyUsSum = 0;
+  uint64_t timeMs = 0;          // spent in the state
+
+  uint32_t latencyUsMean() const { return changeFrames ? (uint32_t)(latencyUsSum / changeFrames) : 0; }
+  uint32_t framesPerMinute() const { return timeMs ? (uint32_t)((uint64_t)frames * 60000 / timeMs) : 0; }
+};
+
+class FrameScheduler {
+  public:
+    // Something shown changed at nowUs, the first change since the last frame counts
+    void invalidate(uint32_t nowUs) {
+      if (!mPending) {
+        mPending = true;
+        mChangedUs = nowUs;
+      }
+    }
+
+    void setState(FrameState state, uint32_t nowMs) {
+      mStats[mState].timeMs += nowMs - mStateSinceMs;
+      mStateSinceMs = nowMs;
+      mState = state;
+    }
+
+    bool due(uint32_t nowMs) const {
+      const FrameStateConfig &config = FrameStateConfigTable[mState];
+      uint32_t elapsed = nowMs - mLastFrameMs;
+      return (mPending && elapsed >= config.minIntervalMs) || elapsed >= config.keepAliveMs;
+    }
+
+    // Call when the frame was posted
+    void rendered(uint32_t nowMs, uint32_t nowUs) {
+      FrameStateStats &stats = mStats[mState];
+      stats.frames++;
+      if (mPending) {
+        uint32_t latency = nowUs - mChangedUs;
+        stats.changeFrames++;
+        stats.latencyUsLast = latency;
+        if (latency > stats.latencyUsMax) { stats.latencyUsMax = latency; }
+        stats.latencyUsSum += latency;
+        mPending = false;
+      }
+      mLastFrameMs = nowMs;
+    }
+
+    // Includes the time spent in the current state so far
+    FrameStateStats stats(FrameState state, uint32_t nowMs) const {
+      FrameStateStats stats = mStats[state];
+      if (state == mState) { stats.timeMs += nowMs - mStateSinceMs; }
+      return stats;
+    }
+
+    FrameState state() const { return mState; }
+
+  private:
+    FrameStateStats mStats[FrameStateCount];
+    FrameState mState = FrameStateParked;
+    uint32_t mStateSinceMs = 0;
+    uint32_t mLastFrameMs = 0;
+    uint32_t mChangedUs = 0;
+    bool mPending = false;
+};
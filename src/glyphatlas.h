@@ -0,0 +1,1548 @@
+// Generated by tools/glyphpack.cpp from SourceCodePro-Bold.ttf - do not edit
+// Characters: 0123456789.-%VAkWC> 
+
+#pragma once
+
+#include <pgmspace.h>
+#include <glyphs.h>
+
+// GlyphsMedium: digits 14 px, cell height 16 px
+const uint8_t GlyphsMediumBitmap[] PROGMEM = {
+  // '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0xCD, 0xA5, 0x00, 0x00,
+  0x04, 0xEF, 0xFF, 0xFF, 0x90, 0x00,
+  0x1E, 0xFF, 0xA9, 0xEF, 0xF5, 0x00,
+  0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x00,
+  0xBF, 0xF1, 0x00, 0x0B, 0xFF, 0x20,
+  0xEF, 0xD0, 0x68, 0x18, 0xFF, 0x40,
+  0xFF, 0xC4, 0xFF, 0xA7, 0xFF, 0x50,
+  0xFF, 0xC5, 0xFF, 0xA7, 0xFF, 0x60,
+  0xEF, 0xD0, 0x79, 0x27, 0xFF, 0x40,
+  0xCF, 0xF1, 0x00, 0x0A, 0xFF, 0x20,
+  0x8F, 0xF6, 0x00, 0x1E, 0xFD, 0x00,
+  0x2F, 0xFE, 0x65, 0xCF, 0xF7, 0x00,
+  0x06, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x5D, 0xFF, 0xE9, 0x10, 0x00,
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  // '1'
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x99, 0x60, 0x00,
+  0x28, 0xCF, 0xFF, 0x90, 0x00,
+  0x5F, 0xFF, 0xFF, 0x90, 0x00,
+  0x38, 0x8C, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x00, 0x08, 0xFF, 0x90, 0x00,
+  0x99, 0x9C, 0xFF, 0xD9, 0x96,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+  0xDD, 0xDD, 0xDD, 0xDD, 0xD9,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x7B, 0xDC, 0x93, 0x00, 0x00,
+  0x3D, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0xBF, 0xFB, 0x9C, 0xFF, 0xF2, 0x00,
+  0x1A, 0x40, 0x00, 0xAF, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xF6, 0x00,
+  0x00, 0x00, 0x02, 0xEF, 0xE1, 0x00,
+  0x00, 0x00, 0x1C, 0xFF, 0x60, 0x00,
+  0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00,
+  0x00, 0x1B, 0xFF, 0xA0, 0x00, 0x00,
+  0x02, 0xDF, 0xFA, 0x00, 0x00, 0x00,
+  0x3E, 0xFF, 0xEA, 0xBB, 0xBB, 0x40,
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+  0xBD, 0xDD, 0xDD, 0xDD, 0xDD, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6A, 0xDD, 0xB7, 0x10, 0x00,
+  0x3D, 0xFF, 0xFF, 0xFF, 0xD2, 0x00,
+  0x2E, 0xFD, 0x9A, 0xFF, 0xFA, 0x00,
+  0x04, 0x60, 0x00, 0x5F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFD, 0x00,
+  0x00, 0x02, 0x36, 0xEF, 0xF5, 0x00,
+  0x00, 0x0C, 0xFF, 0xFC, 0x40, 0x00,
+  0x00, 0x0C, 0xFF, 0xFF, 0x91, 0x00,
+  0x00, 0x01, 0x25, 0xAF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40,
+  0x07, 0x10, 0x00, 0x0D, 0xFF, 0x50,
+  0x7F, 0xE9, 0x67, 0xCF, 0xFF, 0x20,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x06, 0xCF, 0xFF, 0xFB, 0x40, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  // '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x99, 0x94, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xF7, 0x00,
+  0x00, 0x00, 0xCF, 0xFF, 0xF7, 0x00,
+  0x00, 0x08, 0xFF, 0xAF, 0xF7, 0x00,
+  0x00, 0x3F, 0xF9, 0x7F, 0xF7, 0x00,
+  0x01, 0xDF, 0xD1, 0x8F, 0xF7, 0x00,
+  0x09, 0xFF, 0x40, 0x8F, 0xF7, 0x00,
+  0x4F, 0xF8, 0x00, 0x8F, 0xF7, 0x00,
+  0xEF, 0xFB, 0xAA, 0xDF, 0xFC, 0xA1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2,
+  0xAA, 0xAA, 0xAA, 0xDF, 0xFC, 0xA1,
+  0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x7D, 0xD6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x99, 0x99, 0x99, 0x96, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+  0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+  0x0B, 0xFF, 0x21, 0x11, 0x11, 0x00,
+  0x0C, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xFE, 0x9B, 0xA7, 0x10, 0x00,
+  0x0D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x07, 0xEA, 0x78, 0xDF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x2E, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50,
+  0x07, 0x10, 0x00, 0x1E, 0xFF, 0x30,
+  0x7F, 0xE8, 0x67, 0xDF, 0xFC, 0x00,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00,
+  0x05, 0xCF, 0xFF, 0xEA, 0x20, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  // '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xAD, 0xCA, 0x50, 0x00,
+  0x01, 0xBF, 0xFF, 0xFF, 0xFB, 0x00,
+  0x0A, 0xFF, 0xFB, 0xBE, 0xF7, 0x00,
+  0x4F, 0xFE, 0x20, 0x01, 0x60, 0x00,
+  0x9F, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xF1, 0x27, 0x86, 0x10, 0x00,
+  0xEF, 0xE9, 0xFF, 0xFF, 0xD3, 0x00,
+  0xFF, 0xFF, 0xDA, 0xDF, 0xFD, 0x00,
+  0xEF, 0xF7, 0x00, 0x0C, 0xFF, 0x30,
+  0xCF, 0xF1, 0x00, 0x08, 0xFF, 0x50,
+  0x8F, 0xF7, 0x00, 0x0A, 0xFF, 0x30,
+  0x2E, 0xFE, 0x63, 0x8F, 0xFD, 0x00,
+  0x05, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x4C, 0xFF, 0xFB, 0x30, 0x00,
+  0x00, 0x00, 0x12, 0x10, 0x00, 0x00,
+  // '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10,
+  0x11, 0x11, 0x11, 0x9F, 0xE3, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0x60, 0x00,
+  0x00, 0x00, 0x1D, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0xEF, 0xD0, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x0C, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0x10, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x2D, 0xDC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4A, 0xCD, 0xB6, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x2F, 0xFD, 0x65, 0xCF, 0xF5, 0x00,
+  0x6F, 0xF6, 0x00, 0x1F, 0xF8, 0x00,
+  0x5F, 0xF7, 0x00, 0x1F, 0xF7, 0x00,
+  0x1E, 0xFF, 0x92, 0x8F, 0xE2, 0x00,
+  0x03, 0xEF, 0xFF, 0xFD, 0x30, 0x00,
+  0x04, 0xDF, 0xFF, 0xFF, 0x91, 0x00,
+  0x4F, 0xF6, 0x28, 0xEF, 0xF9, 0x00,
+  0xDF, 0xC0, 0x00, 0x2E, 0xFF, 0x10,
+  0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0x30,
+  0xCF, 0xF7, 0x11, 0x5F, 0xFE, 0x10,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+  0x03, 0xBF, 0xFF, 0xFC, 0x40, 0x00,
+  0x00, 0x00, 0x22, 0x10, 0x00, 0x00,
+  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5A, 0xDC, 0x93, 0x00, 0x00,
+  0x0A, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x7F, 0xFD, 0x89, 0xEF, 0xF3, 0x00,
+  0xDF, 0xF2, 0x00, 0x4F, 0xFB, 0x00,
+  0xFF, 0xD0, 0x00, 0x0D, 0xFF, 0x10,
+  0xEF, 0xE1, 0x00, 0x1D, 0xFF, 0x30,
+  0xAF, 0xFB, 0x67, 0xDF, 0xFF, 0x50,
+  0x2E, 0xFF, 0xFF, 0xEC, 0xFF, 0x40,
+  0x02, 0x8C, 0xC8, 0x2A, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x0E, 0xFE, 0x00,
+  0x01, 0x00, 0x00, 0x7F, 0xFA, 0x00,
+  0x1C, 0xD7, 0x6A, 0xFF, 0xF3, 0x00,
+  0x8F, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x06, 0xDF, 0xFF, 0xC4, 0x00, 0x00,
+  0x00, 0x01, 0x21, 0x00, 0x00, 0x00,
+  // '.'
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00,
+  0x1A, 0xC9, 0x10,
+  0xBF, 0xFF, 0xA0,
+  0xFF, 0xFF, 0xE0,
+  0xDF, 0xFF, 0xC0,
+  0x4E, 0xFE, 0x30,
+  0x00, 0x20, 0x00,
+  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x44, 0x44, 0x44, 0x44, 0x43,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xCD, 0x91, 0x00, 0x00, 0x20,
+  0x4F, 0xFD, 0xFC, 0x00, 0x04, 0xE5,
+  0xBF, 0x70, 0xDF, 0x40, 0x2E, 0xFA,
+  0xDF, 0x40, 0xAF, 0x71, 0xDF, 0x90,
+  0xCF, 0x50, 0xBF, 0x5A, 0xF8, 0x00,
+  0x7F, 0xD8, 0xFE, 0x15, 0x70, 0x00,
+  0x0A, 0xFF, 0xE5, 0x00, 0x00, 0x00,
+  0x00, 0x24, 0x10, 0x2B, 0xFD, 0x60,
+  0x00, 0x08, 0x61, 0xDF, 0xCE, 0xF5,
+  0x00, 0x9F, 0xA5, 0xFC, 0x06, 0xFB,
+  0x0A, 0xFC, 0x17, 0xFA, 0x04, 0xFD,
+  0xAF, 0xE2, 0x05, 0xFC, 0x06, 0xFB,
+  0x4E, 0x40, 0x01, 0xEF, 0xAD, 0xF6,
+  0x01, 0x00, 0x00, 0x4D, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00,
+  // 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCE, 0xE6, 0x00, 0x00, 0x3E, 0xED,
+  0x8F, 0xFA, 0x00, 0x00, 0x7F, 0xFA,
+  0x4F, 0xFE, 0x00, 0x00, 0xBF, 0xF6,
+  0x0E, 0xFF, 0x30, 0x00, 0xEF, 0xF1,
+  0x0A, 0xFF, 0x70, 0x03, 0xFF, 0xC0,
+  0x05, 0xFF, 0xB0, 0x07, 0xFF, 0x70,
+  0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0x30,
+  0x00, 0xBF, 0xF4, 0x0E, 0xFD, 0x00,
+  0x00, 0x7F, 0xF7, 0x3F, 0xF8, 0x00,
+  0x00, 0x2F, 0xFB, 0x7F, 0xF4, 0x00,
+  0x00, 0x0D, 0xFE, 0xBF, 0xE0, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xA0, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0xCD, 0xDD, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCE, 0xEE, 0x30, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xDF, 0xC0, 0x00, 0x00,
+  0x00, 0x0B, 0xFC, 0x8F, 0xF2, 0x00, 0x00,
+  0x00, 0x1F, 0xF9, 0x5F, 0xF7, 0x00, 0x00,
+  0x00, 0x6F, 0xF5, 0x1F, 0xFB, 0x00, 0x00,
+  0x00, 0xAF, 0xF1, 0x0C, 0xFF, 0x10, 0x00,
+  0x01, 0xEF, 0xD0, 0x09, 0xFF, 0x60, 0x00,
+  0x05, 0xFF, 0xEC, 0xCD, 0xFF, 0xA0, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00,
+  0x0E, 0xFF, 0x99, 0x99, 0xDF, 0xF5, 0x00,
+  0x4F, 0xFC, 0x00, 0x00, 0x8F, 0xF9, 0x00,
+  0x8F, 0xF8, 0x00, 0x00, 0x4F, 0xFE, 0x00,
+  0xBD, 0xD4, 0x00, 0x00, 0x1D, 0xDD, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'k'
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF2, 0x00, 0x29, 0x99, 0x20,
+  0xFF, 0xF2, 0x01, 0xDF, 0xF7, 0x00,
+  0xFF, 0xF2, 0x1C, 0xFF, 0x80, 0x00,
+  0xFF, 0xF2, 0xBF, 0xF9, 0x00, 0x00,
+  0xFF, 0xFC, 0xFF, 0xB0, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00,
+  0xFF, 0xFF, 0xDF, 0xFB, 0x00, 0x00,
+  0xFF, 0xFC, 0x1B, 0xFF, 0x70, 0x00,
+  0xFF, 0xF2, 0x02, 0xEF, 0xF3, 0x00,
+  0xFF, 0xF2, 0x00, 0x7F, 0xFC, 0x00,
+  0xDD, 0xD2, 0x00, 0x0B, 0xDD, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xDE, 0xE3, 0x00, 0x00, 0x06, 0xEE, 0x70,
+  0xCF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x60,
+  0xAF, 0xF5, 0x00, 0x00, 0x08, 0xFF, 0x40,
+  0x8F, 0xF6, 0x04, 0x73, 0x09, 0xFF, 0x20,
+  0x6F, 0xF7, 0x0B, 0xF9, 0x0A, 0xFF, 0x00,
+  0x4F, 0xF8, 0x0F, 0xFC, 0x0A, 0xFD, 0x00,
+  0x2F, 0xF9, 0x4F, 0xFF, 0x1B, 0xFC, 0x00,
+  0x0F, 0xF9, 0x7F, 0xCF, 0x5C, 0xFA, 0x00,
+  0x0D, 0xFA, 0xAF, 0x8F, 0x8D, 0xF8, 0x00,
+  0x0B, 0xFA, 0xED, 0x4F, 0xBD, 0xF6, 0x00,
+  0x09, 0xFC, 0xFB, 0x1F, 0xED, 0xF4, 0x00,
+  0x07, 0xFF, 0xF8, 0x0D, 0xFF, 0xF2, 0x00,
+  0x05, 0xFF, 0xF5, 0x0A, 0xFF, 0xF0, 0x00,
+  0x03, 0xDD, 0xD2, 0x07, 0xDD, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'C'
+  0x00, 0x00, 0x02, 0x32, 0x00, 0x00,
+  0x00, 0x07, 0xDF, 0xFF, 0xD5, 0x00,
+  0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0x70,
+  0x0B, 0xFF, 0xFA, 0x89, 0xEC, 0x10,
+  0x4F, 0xFF, 0x50, 0x00, 0x21, 0x00,
+  0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xFF, 0x70, 0x00, 0x36, 0x00,
+  0x0B, 0xFF, 0xFC, 0x9A, 0xFF, 0x60,
+  0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x07, 0xDF, 0xFF, 0xC5, 0x00,
+  0x00, 0x00, 0x01, 0x21, 0x00, 0x00,
+  // '>'
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00,
+  0xF9, 0x10, 0x00, 0x00, 0x00,
+  0xFF, 0xD4, 0x00, 0x00, 0x00,
+  0x9F, 0xFF, 0xA1, 0x00, 0x00,
+  0x03, 0xCF, 0xFE, 0x50, 0x00,
+  0x00, 0x07, 0xEF, 0xFA, 0x10,
+  0x00, 0x00, 0x2B, 0xFF, 0x30,
+  0x00, 0x00, 0x6E, 0xFF, 0x30,
+  0x00, 0x3C, 0xFF, 0xE6, 0x00,
+  0x18, 0xFF, 0xFA, 0x10, 0x00,
+  0xDF, 0xFE, 0x50, 0x00, 0x00,
+  0xFF, 0x91, 0x00, 0x00, 0x00,
+  0xD4, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  // ' '
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+};
+const GlyphInfo GlyphsMediumGlyphs[] PROGMEM = {
+  { '0', 14, 1, 11, 0 },
+  { '1', 14, 2, 10, 96 },
+  { '2', 14, 1, 11, 176 },
+  { '3', 14, 1, 11, 272 },
+  { '4', 14, 1, 12, 368 },
+  { '5', 14, 1, 11, 464 },
+  { '6', 14, 1, 11, 560 },
+  { '7', 14, 1, 11, 656 },
+  { '8', 14, 1, 11, 752 },
+  { '9', 14, 1, 11, 848 },
+  { '.', 7, 1, 5, 944 },
+  { '-', 12, 1, 10, 992 },
+  { '%', 14, 1, 12, 1072 },
+  { 'V', 14, 1, 12, 1168 },
+  { 'A', 15, 1, 13, 1264 },
+  { 'k', 13, 1, 11, 1376 },
+  { 'W', 15, 1, 13, 1472 },
+  { 'C', 13, 1, 11, 1584 },
+  { '>', 11, 1, 9, 1680 },
+  { ' ', 6, 3, 0, 1760 },
+};
+const GlyphAtlas GlyphsMedium = { 16, 20, GlyphsMediumGlyphs, GlyphsMediumBitmap };
+
+// GlyphsLarge: digits 21 px, cell height 23 px
+const uint8_t GlyphsLargeBitmap[] PROGMEM = {
+  // '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x34, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x9E, 0xFF, 0xFF, 0xC5, 0x00, 0x00,
+  0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+  0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x09, 0xFF, 0xFF, 0x96, 0x7D, 0xFF, 0xFF, 0x20,
+  0x1F, 0xFF, 0xF6, 0x00, 0x01, 0xDF, 0xFF, 0x90,
+  0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x5F, 0xFF, 0xE0,
+  0xAF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF3,
+  0xCF, 0xFF, 0x50, 0x15, 0x30, 0x0C, 0xFF, 0xF6,
+  0xEF, 0xFF, 0x32, 0xEF, 0xF9, 0x0A, 0xFF, 0xF7,
+  0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0x19, 0xFF, 0xF8,
+  0xFF, 0xFF, 0x39, 0xFF, 0xFF, 0x29, 0xFF, 0xF8,
+  0xEF, 0xFF, 0x33, 0xFF, 0xFB, 0x0A, 0xFF, 0xF8,
+  0xDF, 0xFF, 0x50, 0x37, 0x60, 0x0B, 0xFF, 0xF6,
+  0xBF, 0xFF, 0x70, 0x00, 0x00, 0x0E, 0xFF, 0xF4,
+  0x7F, 0xFF, 0xB0, 0x00, 0x00, 0x3F, 0xFF, 0xF1,
+  0x3F, 0xFF, 0xF3, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+  0x0C, 0xFF, 0xFD, 0x30, 0x17, 0xFF, 0xFF, 0x50,
+  0x03, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00,
+  0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFB, 0x20, 0x00,
+  0x00, 0x00, 0x16, 0x9A, 0xA8, 0x30, 0x00, 0x00,
+  // '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xCD, 0xDC, 0x00, 0x00, 0x00,
+  0x02, 0x59, 0xEF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x0E, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x0C, 0xDD, 0xDF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x77, 0x77, 0x7D, 0xFF, 0xFE, 0x77, 0x77, 0x30,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x20,
+  // '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x44, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0xEF, 0xFF, 0xFF, 0xA3, 0x00, 0x00,
+  0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x7F, 0xFF, 0xE8, 0x67, 0xCF, 0xFF, 0xFC, 0x00,
+  0x07, 0xF9, 0x10, 0x00, 0x0A, 0xFF, 0xFF, 0x30,
+  0x00, 0x30, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFE, 0x20, 0x00,
+  0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x2D, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x03, 0xDF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x4E, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0xF9, 0x89, 0x99, 0x99, 0x94,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52,
+  // '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x34, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0xDF, 0xFF, 0xFF, 0xE8, 0x20, 0x00,
+  0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20,
+  0x07, 0xFF, 0xFA, 0x76, 0x8E, 0xFF, 0xFF, 0x90,
+  0x00, 0x9B, 0x20, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x3A, 0xBE, 0xFF, 0xFF, 0xE5, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF9, 0x20, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x91, 0x00,
+  0x00, 0x00, 0x2A, 0xBC, 0xFF, 0xFF, 0xFE, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 0xFF, 0xE1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
+  0x04, 0xC2, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8,
+  0x1E, 0xFF, 0x94, 0x21, 0x38, 0xFF, 0xFF, 0xF4,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20,
+  0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x91, 0x00,
+  0x00, 0x02, 0x69, 0xAB, 0xA8, 0x51, 0x00, 0x00,
+  // '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xDD, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFA, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0xD3, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x01, 0xEF, 0xFF, 0x43, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x0A, 0xFF, 0xF9, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x6F, 0xFF, 0xD1, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x02, 0xEF, 0xFF, 0x30, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x0B, 0xFF, 0xF8, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x7F, 0xFF, 0xC1, 0x11, 0x14, 0xFF, 0xFF, 0x31, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+  0x88, 0x88, 0x88, 0x88, 0x89, 0xFF, 0xFF, 0x88, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x10, 0x00,
+  // '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x70,
+  0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x01, 0xFF, 0xFF, 0x31, 0x11, 0x11, 0x11, 0x10,
+  0x02, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFE, 0x58, 0x99, 0x62, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00,
+  0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20,
+  0x03, 0xDF, 0xFD, 0xAA, 0xDF, 0xFF, 0xFF, 0xB0,
+  0x00, 0x17, 0x40, 0x00, 0x04, 0xEF, 0xFF, 0xF3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF7,
+  0x05, 0xB2, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4,
+  0x1E, 0xFE, 0x93, 0x12, 0x4B, 0xFF, 0xFF, 0xD0,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50,
+  0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x02, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD, 0x40, 0x00,
+  0x00, 0x01, 0x69, 0xAB, 0xA8, 0x40, 0x00, 0x00,
+  // '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x44, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x29, 0xEF, 0xFF, 0xFE, 0x82, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60,
+  0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
+  0x03, 0xFF, 0xFF, 0xFC, 0x88, 0xBF, 0xFD, 0x20,
+  0x0B, 0xFF, 0xFF, 0x50, 0x00, 0x02, 0xB3, 0x00,
+  0x2F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xA0, 0x01, 0x45, 0x30, 0x00, 0x00,
+  0xDF, 0xFF, 0x72, 0x9F, 0xFF, 0xFE, 0x91, 0x00,
+  0xEF, 0xFF, 0xAE, 0xFF, 0xFF, 0xFF, 0xFD, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+  0xFF, 0xFF, 0xFD, 0x61, 0x03, 0xCF, 0xFF, 0xF2,
+  0xEF, 0xFF, 0xC1, 0x00, 0x00, 0x1F, 0xFF, 0xF5,
+  0xBF, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xF7,
+  0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0xFF, 0xF6,
+  0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
+  0x0B, 0xFF, 0xFE, 0x30, 0x02, 0xCF, 0xFF, 0xE1,
+  0x03, 0xFF, 0xFF, 0xFD, 0xCF, 0xFF, 0xFF, 0x70,
+  0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+  0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFE, 0x70, 0x00,
+  0x00, 0x00, 0x04, 0x8A, 0xA9, 0x61, 0x00, 0x00,
+  // '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD2,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+  0x11, 0x11, 0x11, 0x11, 0x14, 0xFF, 0xFD, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xE3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0xFF, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x45, 0x55, 0x40, 0x00, 0x00, 0x00,
+  // '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x34, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xD7, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00,
+  0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+  0x0C, 0xFF, 0xFB, 0x30, 0x17, 0xFF, 0xFF, 0x20,
+  0x1F, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFF, 0x50,
+  0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x8F, 0xFF, 0x50,
+  0x0F, 0xFF, 0xF5, 0x00, 0x00, 0x9F, 0xFF, 0x30,
+  0x09, 0xFF, 0xFF, 0x81, 0x02, 0xEF, 0xFB, 0x00,
+  0x01, 0xDF, 0xFF, 0xFE, 0x9D, 0xFF, 0xD1, 0x00,
+  0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00,
+  0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00,
+  0x04, 0xEF, 0xFC, 0x9E, 0xFF, 0xFF, 0xFC, 0x10,
+  0x3E, 0xFF, 0xC1, 0x01, 0x6D, 0xFF, 0xFF, 0x90,
+  0xAF, 0xFF, 0x40, 0x00, 0x00, 0xAF, 0xFF, 0xF1,
+  0xEF, 0xFF, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xF3,
+  0xFF, 0xFF, 0x30, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
+  0xCF, 0xFF, 0xC1, 0x00, 0x00, 0x9F, 0xFF, 0xF1,
+  0x6F, 0xFF, 0xFE, 0xA8, 0x9D, 0xFF, 0xFF, 0xA0,
+  0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10,
+  0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00,
+  0x00, 0x01, 0x58, 0xAB, 0xA9, 0x61, 0x00, 0x00,
+  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x44, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xCF, 0xFF, 0xFE, 0x92, 0x00, 0x00,
+  0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00,
+  0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+  0x5F, 0xFF, 0xFC, 0x54, 0x7E, 0xFF, 0xFE, 0x10,
+  0xBF, 0xFF, 0xC0, 0x00, 0x02, 0xEF, 0xFF, 0x70,
+  0xEF, 0xFF, 0x60, 0x00, 0x00, 0x8F, 0xFF, 0xD0,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF2,
+  0xEF, 0xFF, 0x60, 0x00, 0x00, 0x2F, 0xFF, 0xF5,
+  0xBF, 0xFF, 0xC1, 0x00, 0x03, 0xDF, 0xFF, 0xF6,
+  0x6F, 0xFF, 0xFE, 0xA9, 0xBF, 0xFF, 0xFF, 0xF7,
+  0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xF7,
+  0x01, 0xBF, 0xFF, 0xFF, 0xFB, 0x2E, 0xFF, 0xF6,
+  0x00, 0x04, 0x8B, 0xB9, 0x40, 0x1F, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
+  0x00, 0x31, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60,
+  0x03, 0xEE, 0x72, 0x13, 0x9F, 0xFF, 0xFD, 0x00,
+  0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+  0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00,
+  0x00, 0x03, 0x7A, 0xAA, 0x84, 0x00, 0x00, 0x00,
+  // '.'
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+  0x02, 0x9B, 0xA5, 0x00,
+  0x3E, 0xFF, 0xFF, 0x80,
+  0xBF, 0xFF, 0xFF, 0xF2,
+  0xEF, 0xFF, 0xFF, 0xF5,
+  0xEF, 0xFF, 0xFF, 0xF5,
+  0xBF, 0xFF, 0xFF, 0xF2,
+  0x2E, 0xFF, 0xFF, 0x70,
+  0x02, 0x8A, 0x94, 0x00,
+  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xAF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x0B, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xA0,
+  0x5F, 0xFE, 0x56, 0xFF, 0xF3, 0x00, 0x02, 0xEF, 0xFA,
+  0x9F, 0xF9, 0x00, 0xAF, 0xF8, 0x00, 0x1C, 0xFF, 0xE5,
+  0xBF, 0xF7, 0x00, 0x8F, 0xF9, 0x00, 0xAF, 0xFE, 0x40,
+  0xBF, 0xF7, 0x00, 0x8F, 0xF9, 0x07, 0xFF, 0xE3, 0x00,
+  0x9F, 0xF9, 0x00, 0xAF, 0xF7, 0x4F, 0xFD, 0x30, 0x00,
+  0x5F, 0xFE, 0x45, 0xFF, 0xF3, 0x1B, 0xD2, 0x00, 0x00,
+  0x0B, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x10, 0x00, 0x00,
+  0x01, 0xAF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x55, 0x20, 0x00, 0x4B, 0xEF, 0xC5, 0x00,
+  0x00, 0x00, 0x02, 0x10, 0x05, 0xFF, 0xFF, 0xFF, 0x70,
+  0x00, 0x00, 0x2D, 0xC1, 0x1E, 0xFF, 0xBA, 0xFF, 0xF3,
+  0x00, 0x03, 0xEF, 0xF4, 0x6F, 0xFC, 0x00, 0xAF, 0xF8,
+  0x00, 0x4E, 0xFF, 0x60, 0x9F, 0xF9, 0x00, 0x7F, 0xFB,
+  0x04, 0xEF, 0xF9, 0x00, 0x9F, 0xF8, 0x00, 0x6F, 0xFB,
+  0x5F, 0xFF, 0xB0, 0x00, 0x8F, 0xF9, 0x00, 0x7F, 0xFA,
+  0x9F, 0xFD, 0x10, 0x00, 0x5F, 0xFE, 0x11, 0xCF, 0xF7,
+  0x09, 0xE3, 0x00, 0x00, 0x0D, 0xFF, 0xEE, 0xFF, 0xE1,
+  0x00, 0x30, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFE, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xAA, 0x71, 0x00,
+  // 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x77, 0x70, 0x00, 0x00, 0x00, 0x04, 0x77, 0x77, 0x10,
+  0xBF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00,
+  0x6F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
+  0x2F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x00,
+  0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE0, 0x00,
+  0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xFF, 0xA0, 0x00,
+  0x03, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x06, 0xFF, 0xFF, 0x10, 0x00,
+  0x00, 0x9F, 0xFF, 0xF1, 0x00, 0x09, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xF4, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+  0x00, 0x1E, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0x10, 0xAF, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x40, 0xDF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xB6, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFA, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x45, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+  // 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0x77, 0x77, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFB, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xC6, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0x50, 0xEF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x01, 0xEF, 0xFF, 0x10, 0xAF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x0E, 0xFF, 0xF5, 0x00, 0x0E, 0xFF, 0xF7, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xF5, 0x44, 0x4C, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x07, 0xFF, 0xFF, 0x66, 0x66, 0x66, 0xBF, 0xFF, 0xF1, 0x00,
+  0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00,
+  0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00,
+  0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x00,
+  0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40,
+  0x45, 0x55, 0x40, 0x00, 0x00, 0x00, 0x02, 0x55, 0x55, 0x20,
+  // 'k'
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x47, 0x77, 0x73,
+  0xFF, 0xFF, 0xA0, 0x00, 0x04, 0xFF, 0xFF, 0xC1,
+  0xFF, 0xFF, 0xA0, 0x00, 0x3E, 0xFF, 0xFD, 0x10,
+  0xFF, 0xFF, 0xA0, 0x02, 0xEF, 0xFF, 0xD2, 0x00,
+  0xFF, 0xFF, 0xA0, 0x2D, 0xFF, 0xFE, 0x20, 0x00,
+  0xFF, 0xFF, 0xA1, 0xDF, 0xFF, 0xE3, 0x00, 0x00,
+  0xFF, 0xFF, 0xBC, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x79, 0xFF, 0xFF, 0x30, 0x00,
+  0xFF, 0xFF, 0xF7, 0x01, 0xDF, 0xFF, 0xC0, 0x00,
+  0xFF, 0xFF, 0xB0, 0x00, 0x5F, 0xFF, 0xF8, 0x00,
+  0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xA0, 0x00, 0x01, 0xEF, 0xFF, 0xD1,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x6F, 0xFF, 0xFA,
+  0x55, 0x55, 0x30, 0x00, 0x00, 0x04, 0x55, 0x55,
+  // 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x77, 0x50, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x60,
+  0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0,
+  0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x90,
+  0x9F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
+  0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x60,
+  0x5F, 0xFF, 0xF1, 0x00, 0x22, 0x20, 0x00, 0xDF, 0xFF, 0x40,
+  0x3F, 0xFF, 0xF2, 0x00, 0xEF, 0xF3, 0x00, 0xEF, 0xFF, 0x20,
+  0x1F, 0xFF, 0xF3, 0x03, 0xFF, 0xF7, 0x00, 0xFF, 0xFF, 0x00,
+  0x0E, 0xFF, 0xF4, 0x07, 0xFF, 0xFA, 0x00, 0xFF, 0xFD, 0x00,
+  0x0C, 0xFF, 0xF5, 0x0A, 0xFF, 0xFE, 0x01, 0xFF, 0xFB, 0x00,
+  0x0A, 0xFF, 0xF6, 0x0E, 0xFF, 0xFF, 0x22, 0xFF, 0xF9, 0x00,
+  0x08, 0xFF, 0xF7, 0x3F, 0xFC, 0xFF, 0x63, 0xFF, 0xF8, 0x00,
+  0x06, 0xFF, 0xF7, 0x6F, 0xF8, 0xFF, 0x94, 0xFF, 0xF6, 0x00,
+  0x04, 0xFF, 0xF8, 0x9F, 0xF3, 0xFF, 0xC4, 0xFF, 0xF4, 0x00,
+  0x02, 0xFF, 0xF8, 0xCF, 0xD0, 0xFF, 0xF5, 0xFF, 0xF2, 0x00,
+  0x00, 0xFF, 0xF9, 0xFF, 0xA0, 0xCF, 0xF8, 0xFF, 0xF0, 0x00,
+  0x00, 0xDF, 0xFC, 0xFF, 0x80, 0x9F, 0xFC, 0xFF, 0xD0, 0x00,
+  0x00, 0xBF, 0xFF, 0xFF, 0x50, 0x6F, 0xFF, 0xFF, 0xB0, 0x00,
+  0x00, 0x9F, 0xFF, 0xFF, 0x20, 0x3F, 0xFF, 0xFF, 0x90, 0x00,
+  0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x0C, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0x15, 0x55, 0x53, 0x00, 0x03, 0x55, 0x55, 0x10, 0x00,
+  // 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x48, 0xBC, 0xCA, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x04, 0xFF, 0xFF, 0xFD, 0x74, 0x48, 0xEF, 0x80, 0x00,
+  0x0C, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x17, 0x00, 0x00,
+  0x4F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x2C, 0x60, 0x00,
+  0x05, 0xFF, 0xFF, 0xFE, 0x96, 0x59, 0xEF, 0xF5, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x37, 0xAA, 0xA8, 0x50, 0x00, 0x00,
+  // '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00,
+  0x05, 0xEF, 0xFF, 0xFE, 0x50, 0x00, 0x00,
+  0x00, 0x19, 0xFF, 0xFF, 0xFA, 0x10, 0x00,
+  0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xE6, 0x00,
+  0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x50,
+  0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFD, 0x20,
+  0x00, 0x02, 0xBF, 0xFF, 0xFF, 0x81, 0x00,
+  0x00, 0x7E, 0xFF, 0xFF, 0xC3, 0x00, 0x00,
+  0x3C, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // ' '
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+};
+const GlyphInfo GlyphsLargeGlyphs[] PROGMEM = {
+  { '0', 20, 2, 16, 0 },
+  { '1', 20, 2, 15, 184 },
+  { '2', 20, 2, 16, 368 },
+  { '3', 20, 2, 16, 552 },
+  { '4', 20, 1, 17, 736 },
+  { '5', 20, 2, 16, 943 },
+  { '6', 20, 2, 16, 1127 },
+  { '7', 20, 2, 16, 1311 },
+  { '8', 20, 2, 16, 1495 },
+  { '9', 20, 2, 16, 1679 },
+  { '.', 11, 1, 8, 1863 },
+  { '-', 18, 1, 15, 1955 },
+  { '%', 21, 1, 18, 2139 },
+  { 'V', 22, 1, 19, 2346 },
+  { 'A', 22, 1, 19, 2576 },
+  { 'k', 19, 1, 16, 2806 },
+  { 'W', 22, 1, 19, 2990 },
+  { 'C', 20, 1, 17, 3220 },
+  { '>', 16, 1, 13, 3427 },
+  { ' ', 10, 5, 0, 3588 },
+};
+const GlyphAtlas GlyphsLarge = { 23, 20, GlyphsLargeGlyphs, GlyphsLargeBitmap };
+
+// GlyphsHuge: digits 28 px, cell height 31 px
+const uint8_t GlyphsHugeBitmap[] PROGMEM = {
+  // '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x8A, 0xAA, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xEF, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0x94, 0x24, 0xBF, 0xFF, 0xFF, 0xE1, 0x00,
+  0x0A, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF6, 0x00,
+  0x1F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFC, 0x00,
+  0x5F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x10,
+  0x9F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x50,
+  0xBF, 0xFF, 0xFC, 0x00, 0x01, 0x20, 0x00, 0x1F, 0xFF, 0xFF, 0x70,
+  0xDF, 0xFF, 0xFA, 0x00, 0x8F, 0xFE, 0x50, 0x0E, 0xFF, 0xFF, 0x90,
+  0xEF, 0xFF, 0xF9, 0x07, 0xFF, 0xFF, 0xF3, 0x0D, 0xFF, 0xFF, 0xA0,
+  0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x0C, 0xFF, 0xFF, 0xB0,
+  0xFF, 0xFF, 0xF8, 0x0C, 0xFF, 0xFF, 0xF8, 0x0C, 0xFF, 0xFF, 0xB0,
+  0xFF, 0xFF, 0xF9, 0x08, 0xFF, 0xFF, 0xF4, 0x0D, 0xFF, 0xFF, 0xA0,
+  0xEF, 0xFF, 0xFA, 0x01, 0xBF, 0xFF, 0x80, 0x0E, 0xFF, 0xFF, 0xA0,
+  0xCF, 0xFF, 0xFB, 0x00, 0x03, 0x52, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
+  0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x60,
+  0x7F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x30,
+  0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFE, 0x00,
+  0x0D, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF9, 0x00,
+  0x07, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x3E, 0xFF, 0xFF, 0xF3, 0x00,
+  0x01, 0xDF, 0xFF, 0xFF, 0xEA, 0x8B, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+  0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00,
+  0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x53, 0x10, 0x00, 0x00, 0x00, 0x00,
+  // '1'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x33, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x7C, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x07, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x01, 0x22, 0x22, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x44, 0x44, 0x44, 0x4F, 0xFF, 0xFF, 0xF6, 0x44, 0x44, 0x41,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x58, 0xAA, 0xA9, 0x62, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00,
+  0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+  0x3E, 0xFF, 0xFF, 0xA5, 0x33, 0x6C, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x03, 0xEF, 0xD4, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xD0, 0x00,
+  0x00, 0x3A, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xFF, 0xFC, 0x45, 0x67, 0x88, 0x88, 0x88, 0x40,
+  0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x8C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0x9A, 0xAA, 0x85, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x30, 0x00, 0x00,
+  0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+  0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+  0x00, 0xBF, 0xFF, 0xD8, 0x43, 0x47, 0xDF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x1D, 0xE7, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xE2, 0x00,
+  0x00, 0x00, 0x00, 0x24, 0x57, 0xAE, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x23, 0x45, 0x7B, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFE, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0,
+  0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0,
+  0x00, 0xCD, 0x50, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xA0,
+  0x08, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0x70,
+  0x4F, 0xFF, 0xFF, 0xFE, 0xCB, 0xCE, 0xFF, 0xFF, 0xFF, 0xFE, 0x10,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+  0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+  0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
+  0x00, 0x01, 0x6B, 0xEF, 0xFF, 0xFF, 0xFE, 0xA5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x34, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00,
+  // '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x33, 0x33, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xEF, 0xFF, 0xF8, 0x0E, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x0E, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0x30, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x1D, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x9F, 0xFF, 0xFF, 0x97, 0x77, 0x77, 0x7F, 0xFF, 0xFF, 0xD7, 0x77, 0x20,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xD5, 0x55, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xCC, 0xCC, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '5'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x6F, 0xFF, 0xFF, 0x41, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0xFF, 0xFD, 0x15, 0x78, 0x75, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00,
+  0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00,
+  0x00, 0x9F, 0xFF, 0xFF, 0xED, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x05, 0xDD, 0x71, 0x00, 0x02, 0x9F, 0xFF, 0xFF, 0xFF, 0x10,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x90,
+  0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x80,
+  0x00, 0xCD, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x40,
+  0x09, 0xFF, 0xFA, 0x30, 0x00, 0x02, 0x8F, 0xFF, 0xFF, 0xFE, 0x00,
+  0x4F, 0xFF, 0xFF, 0xFE, 0xCB, 0xDF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00,
+  0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x6B, 0xEF, 0xFF, 0xFF, 0xFC, 0x71, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x34, 0x43, 0x10, 0x00, 0x00, 0x00, 0x00,
+  // '6'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0xAA, 0xA9, 0x63, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00,
+  0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00,
+  0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10,
+  0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+  0x00, 0xAF, 0xFF, 0xFF, 0xFE, 0x96, 0x68, 0xCF, 0xFF, 0x70, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x04, 0xD9, 0x00, 0x00,
+  0x0A, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xFF, 0x00, 0x28, 0xDF, 0xFF, 0xD9, 0x30, 0x00, 0x00,
+  0xDF, 0xFF, 0xFD, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+  0xEF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x56, 0x8E, 0xFF, 0xFF, 0xFE, 0x00,
+  0xEF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0x40,
+  0xDF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x70,
+  0xBF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x90,
+  0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90,
+  0x4F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
+  0x0D, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x50,
+  0x06, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x10,
+  0x00, 0xDF, 0xFF, 0xFF, 0xE9, 0x67, 0xBF, 0xFF, 0xFF, 0xF9, 0x00,
+  0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00,
+  0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+  0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00,
+  // '7'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1C, 0xFF, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFC, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xCC, 0xCC, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '8'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x26, 0x9A, 0xAA, 0x85, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+  0x02, 0xFF, 0xFF, 0xFF, 0xEA, 0xAC, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+  0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xD0, 0x00,
+  0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF1, 0x00,
+  0x0D, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0x00,
+  0x0C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0x00,
+  0x09, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
+  0x04, 0xFF, 0xFF, 0xFE, 0x71, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0xAF, 0xFF, 0xFF, 0xFE, 0x72, 0x7F, 0xFF, 0xFA, 0x00, 0x00,
+  0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00,
+  0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00,
+  0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+  0x03, 0xEF, 0xFF, 0xF5, 0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00,
+  0x1D, 0xFF, 0xFF, 0x60, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xF9, 0x00,
+  0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x10,
+  0xDF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x50,
+  0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x50,
+  0xCF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0x20,
+  0x7F, 0xFF, 0xFF, 0xFA, 0x41, 0x12, 0x6D, 0xFF, 0xFF, 0xFC, 0x00,
+  0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0xEF, 0xFF, 0xFF, 0xFE, 0xB6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x34, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00,
+  // '9'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x47, 0xAA, 0xA8, 0x51, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00,
+  0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00,
+  0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00,
+  0x3F, 0xFF, 0xFF, 0xF9, 0x20, 0x15, 0xDF, 0xFF, 0xFF, 0xB0, 0x00,
+  0x8F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xF4, 0x00,
+  0xCF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFA, 0x00,
+  0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFE, 0x00,
+  0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x30,
+  0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x60,
+  0xCF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0x80,
+  0x8F, 0xFF, 0xFF, 0xD3, 0x00, 0x01, 0x8F, 0xFF, 0xFF, 0xFF, 0x90,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+  0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x90,
+  0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFF, 0x80,
+  0x00, 0x07, 0xEF, 0xFF, 0xFF, 0xFE, 0x70, 0x4F, 0xFF, 0xFF, 0x70,
+  0x00, 0x00, 0x04, 0x8A, 0xA8, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x06, 0x20, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF2, 0x00,
+  0x00, 0x5F, 0xE8, 0x10, 0x00, 0x28, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+  0x04, 0xFF, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+  0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+  0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '.'
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0xAA, 0x71, 0x00,
+  0x06, 0xFF, 0xFF, 0xFE, 0x40,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xE2,
+  0xAF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xF6,
+  0x1D, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x02, 0xBF, 0xFF, 0xFA, 0x10,
+  0x00, 0x02, 0x44, 0x10, 0x00,
+  // '-'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // '%'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x6A, 0xBA, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4E, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00,
+  0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xEE, 0x30,
+  0x0D, 0xFF, 0xFE, 0xAD, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x1D, 0xFF, 0xE3,
+  0x4F, 0xFF, 0xF2, 0x01, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0xBF, 0xFF, 0xFB,
+  0x8F, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x09, 0xFF, 0xFF, 0xC1,
+  0xAF, 0xFF, 0x90, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xFB, 0x10,
+  0xAF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xA0, 0x00,
+  0x9F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xC0, 0x2E, 0xFF, 0xF9, 0x00, 0x00,
+  0x7F, 0xFF, 0xC0, 0x00, 0x9F, 0xFF, 0x90, 0xBF, 0xFF, 0x80, 0x00, 0x00,
+  0x2F, 0xFF, 0xF5, 0x03, 0xEF, 0xFF, 0x50, 0x4E, 0xF8, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0xFF, 0xDF, 0xFF, 0xFD, 0x00, 0x03, 0x60, 0x00, 0x00, 0x00,
+  0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x37, 0x87, 0x40, 0x00, 0x00, 0x4A, 0xEF, 0xDA, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x50, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x8F, 0xF6, 0x02, 0xFF, 0xFF, 0xA6, 0xCF, 0xFF, 0xE1,
+  0x00, 0x00, 0x09, 0xFF, 0xFB, 0x08, 0xFF, 0xFC, 0x00, 0x1E, 0xFF, 0xF5,
+  0x00, 0x00, 0xAF, 0xFF, 0xD1, 0x0B, 0xFF, 0xF7, 0x00, 0x0A, 0xFF, 0xF9,
+  0x00, 0x1B, 0xFF, 0xFE, 0x30, 0x0D, 0xFF, 0xF6, 0x00, 0x08, 0xFF, 0xFA,
+  0x01, 0xCF, 0xFF, 0xF5, 0x00, 0x0D, 0xFF, 0xF6, 0x00, 0x08, 0xFF, 0xFA,
+  0x2C, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF7, 0x00, 0x09, 0xFF, 0xF9,
+  0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x0D, 0xFF, 0xF6,
+  0x2D, 0xFF, 0xD1, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x61, 0x8F, 0xFF, 0xF1,
+  0x02, 0xCE, 0x20, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFE, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x30, 0x00, 0x00,
+  // 'V'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCE, 0xEE, 0xEE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEE, 0xEE, 0xEE, 0x10,
+  0x9F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFC, 0x00,
+  0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF7, 0x00,
+  0x0E, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00,
+  0x0A, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xD0, 0x00,
+  0x05, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x90, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+  0x00, 0x0D, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x10, 0x00, 0x8F, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x50, 0x00, 0xCF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x05, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF1, 0x08, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF5, 0x0C, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9C, 0xCC, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'A'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7E, 0xEE, 0xEE, 0xEE, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xEF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x4F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xEF, 0xFF, 0xF4, 0x0C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF1, 0x08, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x04, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x50, 0x00, 0xCF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x10, 0x00, 0x8F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0xDF, 0xFF, 0xFC, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAE, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+  0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x8F, 0xFF, 0xFF, 0xC0, 0x00,
+  0x05, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF1, 0x00,
+  0x0A, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF6, 0x00,
+  0x0E, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00,
+  0x4F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x10,
+  0x9F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x50,
+  0xBC, 0xCC, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xCC, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'k'
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x40,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x5F, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xEF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x3E, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x42, 0xDF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0xCF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x08, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xA0, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF5, 0x00,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x20,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xB0,
+  0xCC, 0xCC, 0xCC, 0x30, 0x00, 0x00, 0x00, 0x5C, 0xCC, 0xCC, 0xC4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'W'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xDE, 0xEE, 0xEE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEE, 0xEE, 0xE1,
+  0xCF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF0,
+  0xAF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xD0,
+  0x8F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xB0,
+  0x6F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90,
+  0x4F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x70,
+  0x2F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x50,
+  0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2D, 0xDD, 0xB0, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
+  0x0D, 0xFF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xF1, 0x00, 0x4F, 0xFF, 0xFF, 0x20,
+  0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x9F, 0xFF, 0xF5, 0x00, 0x5F, 0xFF, 0xFF, 0x00,
+  0x09, 0xFF, 0xFF, 0xF0, 0x00, 0xDF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0xFD, 0x00,
+  0x07, 0xFF, 0xFF, 0xF1, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+  0x05, 0xFF, 0xFF, 0xF2, 0x06, 0xFF, 0xFF, 0xFF, 0x10, 0x7F, 0xFF, 0xF9, 0x00,
+  0x03, 0xFF, 0xFF, 0xF3, 0x09, 0xFF, 0xEF, 0xFF, 0x40, 0x8F, 0xFF, 0xF7, 0x00,
+  0x01, 0xFF, 0xFF, 0xF4, 0x0D, 0xFF, 0xBF, 0xFF, 0x70, 0x9F, 0xFF, 0xF5, 0x00,
+  0x00, 0xEF, 0xFF, 0xF4, 0x1F, 0xFF, 0x7F, 0xFF, 0xB0, 0x9F, 0xFF, 0xF4, 0x00,
+  0x00, 0xCF, 0xFF, 0xF5, 0x4F, 0xFF, 0x3F, 0xFF, 0xE0, 0xAF, 0xFF, 0xF2, 0x00,
+  0x00, 0xAF, 0xFF, 0xF5, 0x8F, 0xFF, 0x1D, 0xFF, 0xF2, 0xAF, 0xFF, 0xF0, 0x00,
+  0x00, 0x8F, 0xFF, 0xF6, 0xBF, 0xFD, 0x0A, 0xFF, 0xF5, 0xAF, 0xFF, 0xD0, 0x00,
+  0x00, 0x6F, 0xFF, 0xF6, 0xEF, 0xFA, 0x07, 0xFF, 0xF8, 0xBF, 0xFF, 0xB0, 0x00,
+  0x00, 0x4F, 0xFF, 0xF8, 0xFF, 0xF7, 0x04, 0xFF, 0xFB, 0xBF, 0xFF, 0x90, 0x00,
+  0x00, 0x2F, 0xFF, 0xFC, 0xFF, 0xF5, 0x01, 0xFF, 0xFE, 0xCF, 0xFF, 0x70, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+  0x00, 0x04, 0xCC, 0xCC, 0xCC, 0x20, 0x00, 0x0B, 0xCC, 0xCC, 0xC9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // 'C'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x67, 0x53, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00,
+  0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00,
+  0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1,
+  0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2,
+  0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30,
+  0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x16, 0xDF, 0xF4, 0x00,
+  0x05, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x09, 0x60, 0x00,
+  0x0C, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x06, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x1A, 0xF6, 0x00,
+  0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xB6, 0x32, 0x37, 0xEF, 0xFF, 0x40,
+  0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
+  0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x44, 0x31, 0x00, 0x00, 0x00,
+  // '>'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xB2, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFE, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xE6, 0x00,
+  0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00,
+  0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00,
+  0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // ' '
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+};
+const GlyphInfo GlyphsHugeGlyphs[] PROGMEM = {
+  { '0', 27, 3, 21, 0 },
+  { '1', 27, 3, 20, 341 },
+  { '2', 27, 3, 21, 651 },
+  { '3', 27, 3, 21, 992 },
+  { '4', 27, 2, 23, 1333 },
+  { '5', 27, 3, 21, 1705 },
+  { '6', 27, 3, 21, 2046 },
+  { '7', 27, 3, 21, 2387 },
+  { '8', 27, 3, 21, 2728 },
+  { '9', 27, 3, 21, 3069 },
+  { '.', 14, 2, 10, 3410 },
+  { '-', 24, 2, 20, 3565 },
+  { '%', 28, 2, 24, 3875 },
+  { 'V', 29, 2, 25, 4247 },
+  { 'A', 29, 2, 25, 4650 },
+  { 'k', 26, 2, 22, 5053 },
+  { 'W', 30, 2, 26, 5394 },
+  { 'C', 26, 2, 22, 5797 },
+  { '>', 21, 2, 17, 6138 },
+  { ' ', 13, 6, 0, 6417 },
+};
+const GlyphAtlas GlyphsHuge = { 31, 20, GlyphsHugeGlyphs, GlyphsHugeBitmap };
@@ -0,0 +1,73 @@
+// Anti-aliased glyph atlases for the numeric readouts
+// Pre-rendered glyphs (4 bit coverage) of the few characters and sizes the readouts use,
+// generated into glyphatlas.h by ../tools/glyphpack.cpp. Text is rendered a row at a time
+// into a line buffer that already holds the background, through a 16 entry fg/bg color
+// ramp - no per pixel blending and no scaled font pixels.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+struct GlyphInfo {
+  char code;
+  uint8_t advance;    // pixels to the next glyph
+  uint8_t left;       // ink columns within the advance: left .. left + width - 1
+  uint8_t width;
+  uint16_t offset;    // into the bitmap: rows of (width + 1) / 2 bytes, high nibble first
+};
+
+struct GlyphAtlas {
+  uint8_t height;     // rows of every glyph, baseline at the bottom
+  uint8_t count;
+  const GlyphInfo *glyphs;
+  const uint8_t *bitmap;
+};
+
+inline const GlyphInfo *GlyphFind(const GlyphAtlas &atlas, char code) {
+  for (uint8_t i = 0; i < atlas.count; i++) {
+    if (atlas.glyphs[i].code == code) { return &atlas.glyphs[i]; }
+  }
+  return nullptr;
+}
+
+// Characters without a glyph advance like a space (a third of the height)
+inline uint16_t GlyphAdvance(const GlyphAtlas &atlas, const GlyphInfo *glyph) {
+  return glyph ? glyph->advance : atlas.height / 3;
+}
+
+inline uint16_t GlyphTextWidth(const GlyphAtlas &atlas, const char *text) {
+  uint16_t width = 0;
+  for (; *text; text++) { width += GlyphAdvance(atlas, GlyphFind(atlas, *text)); }
+  return width;
+}
+
+// fg over bg for coverage 0..15, high byte first (panel / sprite memory order)
+inline void GlyphRamp(uint16_t fg, uint16_t bg, uint16_t ramp[16]) {
+  for (int a = 0; a < 16; a++) {
+    uint16_t r = ((bg >> 11) * (15 - a) + (fg >> 11) * a + 7) / 15;
+    uint16_t g = (((bg >> 5) & 0x3F) * (15 - a) + ((fg >> 5) & 0x3F) * a + 7) / 15;
+    uint16_t b = ((bg & 0x1F) * (15 - a) + (fg & 0x1F) * a + 7) / 15;
+    uint16_t color = r << 11 | g << 5 | b;
+    ramp[a] = color >> 8 | color << 8;
+  }
+}
+
+// Row 0..height-1 of text starting at screen column x into line, which covers the screen
+// columns lineX .. lineX + lineWidth - 1 and holds ramp[0] where there is no ink.
+inline void GlyphRenderRow(const GlyphAtlas &atlas, const char *text, int16_t x, uint8_t row, const uint16_t ramp[16],
+                           uint16_t *line, int16_t lineX, int16_t lineWidth) {
+  for (; *text; text++) {
+    const GlyphInfo *glyph = GlyphFind(atlas, *text);
+    if (glyph && glyph->width) {
+      const uint8_t *bits = atlas.bitmap + glyph->offset + row * ((glyph->width + 1) / 2);
+      int16_t column = x + glyph->left - lineX;
+      for (uint8_t i = 0; i < glyph->width; i++, column++) {
+        uint8_t alpha = (i & 1) ? bits[i / 2] & 0x0F : bits[i / 2] >> 4;
+        if (alpha && column >= 0 && column < lineWidth) { line[column] = ramp[alpha]; }
+      }
+    }
+    x += GlyphAdvance(atlas, glyph);
+  }
+}
@@ -0,0 +1,91 @@
+// Power and speed history
+// loop() averages the power and speed readings over HISTORY_SAMPLE_MS while the vehicle is
+// ready (HistorySampler) and hands the newest sample with its sequence number to the render
+// task in the view model. The drive screen chart keeps the last HISTORY_SAMPLES of them in a
+// HistoryRing, one chart column each, and only draws the columns that are new (widgets.h).
+// Samples missed because the render task skipped a view model are shown as gaps.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+#define HISTORY_SAMPLES 100       // chart columns: 5 minutes
+#define HISTORY_SAMPLE_MS 3000
+#define HISTORY_POWER_MAX 8000    // W, top of the chart
+#define HISTORY_POWER_HIGH 4000   // W, drawn in the warning color above
+#define HISTORY_REGEN_MAX 2000    // W recuperated, bottom of the chart
+#define HISTORY_SPEED_MAX 50      // km/h
+
+struct HistorySample {
+  int16_t power = 0;    // W, positive = consumption (driving), negative = recuperation
+  uint8_t speed = 0;    // km/h
+  bool gap = false;     // missed, nothing known
+};
+
+class HistorySampler {
+  public:
+    // A reading, call as often as the values change
+    void add(int32_t power, uint8_t speed) {
+      mPowerSum += power;
+      mSpeedSum += speed;
+      mReadings++;
+    }
+
+    bool due(uint32_t nowMs) const { return nowMs - mSampleMs >= HISTORY_SAMPLE_MS; }
+
+    // Closes the interval: mean of the readings, the previous sample without readings
+    const HistorySample &sample(uint32_t nowMs) {
+      if (mReadings) {
+        int32_t power = (int32_t)(mPowerSum / mReadings);
+        mSample.power = power > INT16_MAX ? INT16_MAX : power < INT16_MIN ? INT16_MIN : (int16_t)power;
+        mSample.speed = (uint8_t)(mSpeedSum / mReadings);
+      }
+      mPowerSum = 0;
+      mSpeedSum = 0;
+      mReadings = 0;
+      mSampleMs = nowMs;
+      mCount++;
+      return mSample;
+    }
+
+    // Restarts the interval without a sample (vehicle not ready)
+    void pause(uint32_t nowMs) {
+      mPowerSum = 0;
+      mSpeedSum = 0;
+      mReadings = 0;
+      mSampleMs = nowMs;
+    }
+
+    const HistorySample &last() const { return mSample; }
+    uint32_t count() const { return mCount; }
+
+  private:
+    int64_t mPowerSum = 0;
+    uint32_t mSpeedSum = 0;
+    uint32_t mReadings = 0;
+    uint32_t mSampleMs = 0;
+    uint32_t mCount = 0;
+    HistorySample mSample;
+};
+
+template <uint16_t SIZE>
+class HistoryRing {
+  public:
+    void push(const HistorySample &sample) {
+      mSamples[mHead] = sample;
+      mHead = (mHead + 1) % SIZE;
+      if (mCount < SIZE) { mCount++; }
+    }
+
+    // age 0 = newest, up to count() - 1
+    const HistorySample &recent(uint16_t age) const { return mSamples[(mHead + SIZE - 1 - age) % SIZE]; }
+    uint16_t count() const { return mCount; }
+    static constexpr uint16_t size() { return SIZE; }
+
+  private:
+    HistorySample mSamples[SIZE];
+    uint16_t mHead = 0;
+    uint16_t mCount = 0;
+};
@@ -0,0 +1,96 @@
+// Compressed RGB565 images
+// QOI style format on 16 bit pixels, produced by ../tools/imgpack.cpp. It is lossless and
+// typically 4-5x smaller than the raw array. The decoder streams: decode() continues where
+// the last call stopped, so a screen is filled a few lines at a time from a small buffer.
+//
+// Stream: width, height (uint16 LE), then ops. Channels are r5 g6 b5 and differences wrap.
+//   00iiiiii           index: pixel from the 64 entry table of recently seen colors
+//   01rrggbb           diff: r, g, b change by -2..1 (stored +2)
+//   10gggggg rrrrbbbb  luma: g changes by -32..31, r and b by that/2 + -8..7 (stored +32 / +8)
+//   11rrrrrr           run: previous pixel 1..62 times (stored -1)
+//   11111110 hi lo     literal RGB565
+// The index is updated with every pixel that is not a run, hash (r*3 + g*5 + b*7) % 64.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+#define IMAGE_HEADER_SIZE 4
+#define IMAGE_OP_INDEX 0x00
+#define IMAGE_OP_DIFF 0x40
+#define IMAGE_OP_LUMA 0x80
+#define IMAGE_OP_RUN 0xC0
+#define IMAGE_OP_LITERAL 0xFE
+#define IMAGE_OP_MASK 0xC0
+#define IMAGE_RUN_MAX 62
+
+inline uint8_t ImageHash(uint16_t color) {
+  return (((color >> 11) & 0x1F) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) & 63;
+}
+
+// Channels of b added to a, each wrapping in its own width
+inline uint16_t ImageAdd(uint16_t a, int8_t dr, int8_t dg, int8_t db) {
+  return (((((a >> 11) + dr) & 0x1F) << 11) | ((((a >> 5) + dg) & 0x3F) << 5) | ((a + db) & 0x1F));
+}
+
+inline uint16_t ImageWidth(const uint8_t *image) { return image[0] | image[1] << 8; }
+inline uint16_t ImageHeight(const uint8_t *image) { return image[2] | image[3] << 8; }
+
+class ImageDecoder {
+  public:
+    explicit ImageDecoder(const uint8_t *image) : mData(image + IMAGE_HEADER_SIZE) {
+      for (uint16_t &color : mIndex) { color = 0; }
+    }
+
+    // Next count pixels; swap = high byte first in memory, as the panel expects them from DMA
+    void decode(uint16_t *out, uint32_t count, bool swap) {
+      while (count) {
+        if (mRun == 0) { next(); }
+        uint16_t color = swap ? (uint16_t)(mPixel >> 8 | mPixel << 8) : mPixel;
+        uint32_t n = mRun < count ? mRun : count;
+        mRun -= n;
+        count -= n;
+        while (n--) { *out++ = color; }
+      }
+    }
+
+    uint32_t bytesRead(const uint8_t *image) const { return mData - image; }
+
+  private:
+    // Reads one op, sets mPixel and mRun (1 for single pixels)
+    void next() {
+      uint8_t op = *mData++;
+      mRun = 1;
+      if (op == IMAGE_OP_LITERAL) {
+        mPixel = mData[0] << 8 | mData[1];
+        mData += 2;
+      }
+      else {
+        switch (op & IMAGE_OP_MASK) {
+          case IMAGE_OP_INDEX:
+            mPixel = mIndex[op];
+            return;
+          case IMAGE_OP_DIFF:
+            mPixel = ImageAdd(mPixel, ((op >> 4) & 3) - 2, ((op >> 2) & 3) - 2, (op & 3) - 2);
+            break;
+          case IMAGE_OP_LUMA: {
+            int8_t dg = (op & 0x3F) - 32;
+            uint8_t rb = *mData++;
+            mPixel = ImageAdd(mPixel, dg / 2 + (rb >> 4) - 8, dg, dg / 2 + (rb & 0x0F) - 8);
+            break;
+          }
+          default: // run
+            mRun = (op & 0x3F) + 1;
+            return;
+        }
+      }
+      mIndex[ImageHash(mPixel)] = mPixel;
+    }
+
+    const uint8_t *mData;
+    uint16_t mIndex[64];
+    uint16_t mPixel = 0;
+    uint32_t mRun = 0;
+};
@@ -1,3611 +1,932 @@
-// https://github.com/bi3qwq/ConvertImageToColor565
-// Width x Height: 240x240 pixels
-// Size: 115.200 Bytes
+// Generated by tools/imgpack.cpp from img.h - do not edit
+// Width x Height: 240x240 pixels, RGB565 compressed 115200 -> 22105 bytes (format: image.h)
 
 #include <pgmspace.h>
 
 const int img1_width=240;
 const int img1_height=240;
 
-const unsigned short img1[] PROGMEM = {
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xEF7E, 0xE75D, 0xDF1D, 0xD6DC, 0xCE9B, 0xC67A, 0xBE3A, 0xBE19, 0xB5F9, 
-0xADD8, 0xADB8, 0xAD98, 0xA597, 0xA577, 0xA557, 0xA557, 0x9D37, 0x9D36, 0x9D36, 0x9D16, 0x9D36, 0x9D16, 0x9D16, 0x9D36, 0x9D36, 
-0x9D37, 0x9D37, 0xA577, 0xA577, 0xAD98, 0xADD8, 0xB5F9, 0xBE1A, 0xBE59, 0xCE7A, 0xCE9B, 0xD6DC, 0xE73D, 0xE73D, 0xE75D, 0xEF5D, 
-0xEF7E, 0xEF9E, 0xEF9E, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xF7BF, 0xEF7E, 0xE73D, 0xDEFD, 0xD6BC, 0xCE7B, 0xC63A, 0xBDF9, 0xB5D9, 0xADB8, 0xAD98, 0xA577, 0xA557, 0x9D37, 0x9D37, 0x9D16, 
-0x9D16, 0x9D16, 0x9516, 0x94F6, 0x9D16, 0x9D16, 0x9D16, 0x9D16, 0x9516, 0x94F6, 0x94D5, 0x8CB5, 0x8C94, 0x8C94, 0x8CB4, 0x8CB4, 
-0x8CB4, 0x8494, 0x8C94, 0x8C94, 0x8CB4, 0x8CD5, 0x8C94, 0x8453, 0x8473, 0x8473, 0x8453, 0x8453, 0x8473, 0x8452, 0x8473, 0x8C73, 
-0x8C94, 0x94B4, 0x94D4, 0x94D5, 0x9D15, 0xA536, 0xAD97, 0xC619, 0xBE39, 0xBDF8, 0xC619, 0xCE7A, 0xD6BB, 0xDF1C, 0xE75D, 0xEF7E, 
-0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF9E, 0xE73D, 0xDEDC, 0xCE9B, 
-0xC65A, 0xBE19, 0xB5D8, 0xAD98, 0xA577, 0xA557, 0x9D37, 0x9D37, 0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D16, 0x9516, 
-0x9516, 0x9D37, 0x9D37, 0x9D37, 0x9D37, 0x9D16, 0x9516, 0x9D16, 0x9D36, 0x94F6, 0x8CB5, 0x8C94, 0x8C94, 0x8C94, 0x8C94, 0x8C94, 
-0x8CB4, 0x8CB4, 0x8C94, 0x8CB4, 0x8CB4, 0x7C32, 0x6390, 0x6390, 0x5B2F, 0x426B, 0x31C8, 0x2146, 0x1925, 0x1905, 0x10E4, 0x18E4, 
-0x10E4, 0x10C4, 0x18E4, 0x1904, 0x2125, 0x2146, 0x1925, 0x2145, 0x31C8, 0x424A, 0x4A8A, 0x5AEC, 0x634E, 0x6BAF, 0x7C11, 0x8472, 
-0x94D4, 0xA535, 0xB5F7, 0xCE7A, 0xD6DB, 0xDEDC, 0xDEFC, 0xEF7D, 0xF7BF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xE75D, 0xDEFC, 0xCE9A, 0xC63A, 0xB5F9, 0xADB8, 0xA577, 
-0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D37, 0x9D37, 0x9D57, 0x9D36, 0x9D36, 0x9D36, 0x9D36, 0x9D37, 0xA557, 0xA557, 
-0xA557, 0xA557, 0xA557, 0xA557, 0xA557, 0x9D36, 0x9D16, 0x94F6, 0x94F5, 0x8CB4, 0x8CB4, 0x8CB4, 0x94D5, 0x94F5, 0x9D16, 0x9D16, 
-0x9D16, 0x9D36, 0x9D36, 0xA536, 0x8CB4, 0x6BB1, 0x634F, 0x5B4F, 0x3A29, 0x1905, 0x0862, 0x0841, 0x0021, 0x0021, 0x0020, 0x0000, 
-0x0000, 0x0000, 0x0881, 0x18A1, 0x18A2, 0x10C3, 0x0883, 0x0000, 0x0021, 0x1905, 0x10E5, 0x08A4, 0x0883, 0x0862, 0x10C3, 0x2125, 
-0x2126, 0x2167, 0x29A7, 0x31C8, 0x424A, 0x6B4E, 0x8431, 0x8CB3, 0x9D15, 0xAD97, 0xC639, 0xD6BB, 0xDEFC, 0xE73D, 0xF79E, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xEF7D, 0xE73D, 0xDEFC, 0xC65A, 0xBDF9, 0xAD98, 0xA577, 0xA577, 0xA557, 0x9D57, 0x9D37, 
-0x9D37, 0x9D16, 0x9D36, 0x9D57, 0x9D57, 0x9D37, 0xA557, 0xA577, 0xAD98, 0xAD98, 0xAD98, 0xAD98, 0xA578, 0xA577, 0xA557, 0x9D36, 
-0x9D15, 0x94F5, 0x94B4, 0x8CB4, 0x8C73, 0x8432, 0x73F1, 0x6B8F, 0x5B2E, 0x634E, 0x6BB0, 0x73F1, 0x8432, 0x8C73, 0x94B4, 0x94B4, 
-0x8CB4, 0x8CB4, 0x94D4, 0x94D4, 0x73D1, 0x6B8F, 0x73D1, 0x4ACC, 0x2166, 0x0862, 0x0821, 0x0820, 0x0020, 0x0020, 0x0820, 0x0840, 
-0x0841, 0x0041, 0x08A3, 0x1904, 0x2104, 0x2124, 0x18E3, 0x0021, 0x0020, 0x1905, 0x1967, 0x1127, 0x00A4, 0x0000, 0x0820, 0x18A1, 
-0x2146, 0x2146, 0x1925, 0x08A3, 0x0001, 0x0862, 0x18C3, 0x10C3, 0x2105, 0x2966, 0x4209, 0x52AB, 0x6B8F, 0x8C72, 0xA535, 0xBDF8, 
-0xD6DB, 0xE73D, 0xEF9E, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7DF, 0xEF7E, 0xE71D, 0xCE9B, 0xBE3A, 0xB5D9, 0xAD98, 0xA578, 0xA557, 0xA557, 0xA557, 0xA557, 0x9D57, 0x9D57, 0x9D57, 
-0xA557, 0xA537, 0xA557, 0xA557, 0xA557, 0xA557, 0xA557, 0xA557, 0x9D36, 0x9D16, 0x9CF5, 0x94D5, 0x8CB4, 0x8473, 0x7C32, 0x73F1, 
-0x6B8F, 0x636F, 0x5B2E, 0x5B0D, 0x52CC, 0x52AC, 0x52AC, 0x4A8B, 0x3A09, 0x424A, 0x52CC, 0x52ED, 0x5B0D, 0x5B2E, 0x5B2E, 0x5B2D, 
-0x5B2E, 0x5B2D, 0x634E, 0x634E, 0x52AC, 0x634E, 0x73F1, 0x3A0A, 0x18E5, 0x0862, 0x0841, 0x0020, 0x0840, 0x0861, 0x0861, 0x1081, 
-0x08A2, 0x10C2, 0x10E3, 0x1167, 0x1987, 0x2165, 0x2965, 0x2144, 0x18A2, 0x18C3, 0x2987, 0x29E9, 0x19A9, 0x0906, 0x0883, 0x10A2, 
-0x2125, 0x2986, 0x31C8, 0x2145, 0x0061, 0x0840, 0x1081, 0x0841, 0x0020, 0x0021, 0x0841, 0x0862, 0x10A3, 0x18E4, 0x2125, 0x31A7, 
-0x4A6A, 0x6B8E, 0x94B3, 0xB5B7, 0xD69B, 0xEF5D, 0xF7BF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 
-0xEF7E, 0xD6DB, 0xBE39, 0xB5D8, 0xAD98, 0xAD98, 0xAD98, 0xAD98, 0xAD98, 0xAD98, 0xAD98, 0xA598, 0xA577, 0xA557, 0xA557, 0xA557, 
-0xA557, 0xA557, 0xA536, 0x9D16, 0x9CF5, 0x8CB4, 0x8453, 0x7C11, 0x6BAF, 0x6B8F, 0x634E, 0x5B2D, 0x5B0D, 0x5B0D, 0x5B0D, 0x5B0D, 
-0x5B0D, 0x5B0D, 0x632E, 0x634E, 0x634E, 0x6B6F, 0x6BB0, 0x6BB0, 0x5B0D, 0x5B0D, 0x636F, 0x6B8F, 0x638F, 0x636F, 0x636F, 0x636E, 
-0x634E, 0x634E, 0x5B0D, 0x52ED, 0x4AAB, 0x632E, 0x6BB0, 0x3A0A, 0x10E4, 0x0862, 0x0040, 0x0840, 0x0861, 0x0882, 0x0881, 0x0881, 
-0x08A2, 0x10A2, 0x10E2, 0x1166, 0x222A, 0x2A6B, 0x3269, 0x3269, 0x3A27, 0x29C5, 0x31C6, 0x3A49, 0x42AB, 0x3A8C, 0x21C9, 0x1146, 
-0x1104, 0x1925, 0x29C7, 0x3A28, 0x29C6, 0x1924, 0x10C2, 0x1082, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x10A2, 
-0x1082, 0x1082, 0x18E4, 0x3187, 0x4A8A, 0x6B8E, 0x94D3, 0xBDF8, 0xE71C, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xDEDB, 0xC638, 
-0xC65B, 0xB5D9, 0xAD98, 0xAD98, 0xAD98, 0xAD98, 0xADB8, 0xADD8, 0xADD9, 0xADB8, 0xAD77, 0xA557, 0x9CF5, 0x8CB4, 0x8432, 0x7BF1, 
-0x6BB0, 0x638F, 0x634E, 0x5B2E, 0x5B0D, 0x5B0D, 0x5AED, 0x52ED, 0x5B0D, 0x5B0E, 0x634E, 0x636F, 0x636F, 0x636F, 0x636F, 0x636F, 
-0x6B8F, 0x6BB0, 0x6BB0, 0x73D0, 0x73D1, 0x73F1, 0x7C12, 0x7BF1, 0x636F, 0x634E, 0x73F1, 0x8473, 0x8493, 0x8473, 0x7C52, 0x7C52, 
-0x7C52, 0x7411, 0x6BD0, 0x634E, 0x52ED, 0x5B2E, 0x636F, 0x4A8C, 0x1905, 0x0862, 0x0020, 0x0841, 0x0862, 0x0882, 0x0882, 0x0881, 
-0x1062, 0x0861, 0x0860, 0x0881, 0x1167, 0x1A4D, 0x22AD, 0x32CB, 0x3AEB, 0x430B, 0x3A88, 0x3A27, 0x3A27, 0x3A49, 0x3A8A, 0x2A2A, 
-0x1967, 0x1946, 0x21A7, 0x3228, 0x3A8A, 0x3249, 0x29C7, 0x2965, 0x1903, 0x1082, 0x0861, 0x0861, 0x0841, 0x0820, 0x0841, 0x1062, 
-0x10A2, 0x0840, 0x0000, 0x0000, 0x0041, 0x0882, 0x2124, 0x39E8, 0x630C, 0x8C72, 0xB5B7, 0xD6BB, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0xBE3A, 0xADB8, 0xB5F9, 
-0xB5FA, 0xADD9, 0xADB9, 0xADB8, 0xA598, 0xA557, 0x9D16, 0x8CD4, 0x8472, 0x7C11, 0x6BAF, 0x636E, 0x5B2D, 0x5AED, 0x52EC, 0x52EC, 
-0x52CC, 0x52CC, 0x5AED, 0x5AED, 0x5B0D, 0x5B0D, 0x632E, 0x634E, 0x6B8F, 0x6BB0, 0x73D0, 0x73F1, 0x73D1, 0x73D1, 0x73D0, 0x73D0, 
-0x73B0, 0x73B0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BB0, 0x73D0, 0x6BB0, 0x632E, 0x5B2E, 0x7411, 0x8CF4, 0x8CF4, 0x84D4, 0x8CF4, 0x8CF4, 
-0x8CF5, 0x8CF4, 0x8493, 0x6BD0, 0x5B2E, 0x5B0E, 0x636F, 0x52ED, 0x2146, 0x0862, 0x0020, 0x0840, 0x0861, 0x0861, 0x0862, 0x0861, 
-0x0861, 0x0861, 0x0820, 0x0820, 0x0861, 0x0947, 0x1A2B, 0x1A6C, 0x226C, 0x2AAB, 0x3ACA, 0x3AAA, 0x3248, 0x29C6, 0x2185, 0x2186, 
-0x29A7, 0x2A08, 0x29E8, 0x29E7, 0x2A08, 0x2A29, 0x3248, 0x3A48, 0x39E6, 0x2985, 0x1103, 0x08A2, 0x0041, 0x0021, 0x0041, 0x08A2, 
-0x18E3, 0x1904, 0x10A2, 0x0020, 0x0000, 0x0020, 0x0841, 0x0862, 0x0861, 0x18C3, 0x31A7, 0x630D, 0x9492, 0xBDF8, 0xE73C, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xD6BB, 0xBE19, 0xB5D8, 0xB5D9, 0xA577, 
-0x9CF5, 0x8CB4, 0x8453, 0x7C32, 0x73F1, 0x6BAF, 0x634E, 0x5B0D, 0x52ED, 0x52EC, 0x52CC, 0x52CC, 0x52EC, 0x52ED, 0x5B2D, 0x634E, 
-0x638F, 0x6BAF, 0x6BD0, 0x73D0, 0x73D0, 0x73D0, 0x73D0, 0x73D0, 0x73D0, 0x73D0, 0x73D0, 0x73B0, 0x6BB0, 0x6B8F, 0x6B6F, 0x636F, 
-0x636F, 0x636F, 0x636F, 0x636F, 0x6B8F, 0x6BB0, 0x6BB0, 0x6B8F, 0x632E, 0x5B0E, 0x73F1, 0x8CD4, 0x8CF4, 0x84D4, 0x84D4, 0x84D4, 
-0x84D4, 0x8CF5, 0x8CF5, 0x7C52, 0x636F, 0x52ED, 0x634F, 0x634E, 0x29A7, 0x0882, 0x0841, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0840, 0x0861, 0x0841, 0x0841, 0x0020, 0x08A2, 0x0967, 0x120B, 0x120C, 0x1A2B, 0x2A8B, 0x32CC, 0x3ACB, 0x3268, 0x2185, 0x10E3, 
-0x2105, 0x3186, 0x3A08, 0x3208, 0x1966, 0x1945, 0x31E7, 0x4A48, 0x4A88, 0x4247, 0x2164, 0x0081, 0x0021, 0x0041, 0x0042, 0x0882, 
-0x10E3, 0x2165, 0x29C6, 0x2965, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0021, 0x10A2, 0x2104, 0x39E8, 0x7BCF, 0xCE59, 
-0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xC659, 0xAD97, 0xAD78, 0x9D16, 0x8452, 0x6BAF, 
-0x636E, 0x5B2D, 0x52EC, 0x52CC, 0x52AB, 0x52AC, 0x52CC, 0x5AEC, 0x5B2E, 0x634F, 0x6B90, 0x6BB0, 0x73B0, 0x73D1, 0x73D1, 0x73D1, 
-0x6BD0, 0x73D1, 0x73D1, 0x6BB0, 0x6BB0, 0x6B90, 0x6B90, 0x6B90, 0x6B90, 0x6B8F, 0x6B8F, 0x6B8F, 0x6B8F, 0x6B8F, 0x6B8F, 0x6B8F, 
-0x6B8F, 0x6BB0, 0x6BD0, 0x6BD0, 0x6BB0, 0x6B8F, 0x6B90, 0x6B8F, 0x632E, 0x5B2E, 0x73F1, 0x8CD4, 0x84D4, 0x84B3, 0x84B3, 0x8493, 
-0x84B4, 0x84D4, 0x84D4, 0x7C93, 0x6BB0, 0x52ED, 0x634E, 0x6B8F, 0x39E9, 0x10A3, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 
-0x0841, 0x0861, 0x0862, 0x0862, 0x0841, 0x0840, 0x08A2, 0x0967, 0x11EA, 0x11EB, 0x1A2C, 0x226C, 0x2AAC, 0x3ACB, 0x3249, 0x2186, 
-0x2105, 0x18C3, 0x2104, 0x2986, 0x2165, 0x2144, 0x39C5, 0x4227, 0x4A47, 0x3A06, 0x29A6, 0x2145, 0x10E4, 0x0063, 0x0022, 0x0042, 
-0x0062, 0x08C3, 0x2166, 0x31E8, 0x31C7, 0x2124, 0x0861, 0x0020, 0x0000, 0x0020, 0x0020, 0x1082, 0x2124, 0x2104, 0x18E3, 0x4A69, 
-0xA534, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xB5D7, 0x9D35, 0x94D5, 0x8453, 0x636F, 0x4A8B, 0x4AAB, 
-0x52ED, 0x5B2D, 0x636F, 0x6B8F, 0x6BB0, 0x73D0, 0x73D0, 0x6BB0, 0x6B90, 0x6B90, 0x6B90, 0x6B90, 0x6B90, 0x6B90, 0x6B90, 0x6B90, 
-0x6B8F, 0x6B8F, 0x6B90, 0x6B90, 0x6B6F, 0x6B90, 0x6B90, 0x6BB0, 0x6BB0, 0x6BD0, 0x6BD0, 0x73F1, 0x73F1, 0x7411, 0x7432, 0x7C32, 
-0x7C72, 0x8473, 0x8493, 0x8493, 0x7C32, 0x6BB0, 0x6B8F, 0x6B6F, 0x632E, 0x5B2D, 0x73F1, 0x8CD4, 0x84D4, 0x84B3, 0x8493, 0x7C93, 
-0x7C93, 0x7C93, 0x7C93, 0x7C73, 0x6BB0, 0x52CC, 0x5B2E, 0x6BB0, 0x424A, 0x18E4, 0x0841, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0040, 0x10C3, 0x19A7, 0x19C9, 0x11CA, 0x11CA, 0x120A, 0x224B, 0x2A6A, 0x2228, 
-0x1985, 0x1103, 0x0862, 0x1082, 0x2124, 0x39C6, 0x3A06, 0x3A06, 0x31A5, 0x2123, 0x31C7, 0x52EC, 0x42AB, 0x2187, 0x08C4, 0x0042, 
-0x0002, 0x0022, 0x0063, 0x0905, 0x29E8, 0x3A69, 0x31C7, 0x18E3, 0x0020, 0x0000, 0x0000, 0x10A2, 0x3185, 0x39C6, 0x3165, 0x18C2, 
-0x2965, 0x8C51, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73D, 0xAD76, 0x8472, 0x7C32, 0x6BD1, 0x636F, 0x5B0E, 0x5B0D, 0x6BAF, 
-0x73F1, 0x73D1, 0x73D1, 0x73D0, 0x73D1, 0x73F1, 0x73F1, 0x73D1, 0x6BB0, 0x6B8F, 0x6B8F, 0x6B8F, 0x6B8F, 0x638F, 0x638F, 0x638F, 
-0x6B8F, 0x6B90, 0x6BB0, 0x73D0, 0x73F1, 0x7411, 0x7C32, 0x7C52, 0x7C72, 0x7C73, 0x8493, 0x8493, 0x84B3, 0x84B3, 0x84D4, 0x84D4, 
-0x84D4, 0x84D4, 0x8CF4, 0x8D15, 0x84B3, 0x6BD0, 0x638F, 0x636F, 0x5B2E, 0x5B2D, 0x7411, 0x8CD4, 0x84D4, 0x84B3, 0x8493, 0x7C93, 
-0x7C73, 0x7C93, 0x7C73, 0x7C73, 0x6BB0, 0x4ACC, 0x5AED, 0x6B8F, 0x4AAC, 0x1925, 0x0861, 0x0040, 0x0041, 0x0861, 0x0861, 0x0841, 
-0x0861, 0x0861, 0x0861, 0x0840, 0x0861, 0x0861, 0x0840, 0x18A1, 0x2985, 0x31C6, 0x29C7, 0x21A7, 0x19C8, 0x19C9, 0x2209, 0x1A07, 
-0x19A4, 0x1164, 0x08E3, 0x10A2, 0x2944, 0x39E6, 0x4207, 0x39E6, 0x18C2, 0x0020, 0x18E4, 0x428A, 0x5B2D, 0x530D, 0x3A4A, 0x1946, 
-0x0084, 0x0043, 0x0043, 0x0063, 0x08E5, 0x29E8, 0x428A, 0x4269, 0x2125, 0x0020, 0x0000, 0x0860, 0x31A5, 0x4A68, 0x4227, 0x2964, 
-0x0841, 0x2104, 0x8430, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73D, 0x94B3, 0x634E, 0x6BB0, 0x6BF1, 0x6BF1, 0x638F, 0x5B0D, 0x634E, 0x73F1, 
-0x73F1, 0x73D0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BB0, 0x6BD0, 0x6BF0, 0x73F0, 0x7411, 0x7411, 0x7C31, 
-0x7C52, 0x7C52, 0x7C72, 0x7C72, 0x7C93, 0x7C93, 0x84B3, 0x84B3, 0x84B3, 0x84B3, 0x84B4, 0x84B4, 0x84B4, 0x84B4, 0x84D4, 0x84B3, 
-0x84B3, 0x84B3, 0x84D4, 0x8CF4, 0x8493, 0x6BD0, 0x638F, 0x636F, 0x5B2E, 0x5B2D, 0x7411, 0x8CD4, 0x84D4, 0x7C93, 0x8493, 0x7C93, 
-0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x6BF0, 0x52ED, 0x52CC, 0x634E, 0x52CC, 0x2166, 0x0862, 0x0021, 0x0021, 0x0041, 0x0841, 0x0841, 
-0x0840, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0041, 0x1081, 0x2923, 0x31A5, 0x31C5, 0x31C5, 0x31C6, 0x31C7, 0x29C7, 0x21C6, 
-0x21A5, 0x1164, 0x1124, 0x2965, 0x39E5, 0x4206, 0x4207, 0x3185, 0x0861, 0x0000, 0x0021, 0x18E4, 0x3A49, 0x5B4D, 0x5B4D, 0x42AB, 
-0x19C8, 0x08E5, 0x0044, 0x0064, 0x0064, 0x00C5, 0x2188, 0x426B, 0x4AAB, 0x31E8, 0x10C3, 0x0000, 0x18C2, 0x39E6, 0x52A9, 0x31A5, 
-0x10A2, 0x0840, 0x2124, 0x9CD3, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7E, 0xADB7, 0x636F, 0x638F, 0x7412, 0x84B4, 0x84B4, 0x6BD0, 0x52ED, 0x636F, 0x6BD0, 
-0x6B8F, 0x6B8F, 0x6BB0, 0x6BD0, 0x73D0, 0x73F0, 0x7411, 0x7C31, 0x7C52, 0x7C52, 0x7C73, 0x8493, 0x84B3, 0x84B3, 0x84B4, 0x84B4, 
-0x84B3, 0x84B3, 0x84B3, 0x84B3, 0x84B3, 0x7CB3, 0x7CB3, 0x7CB3, 0x84B3, 0x7C93, 0x7C93, 0x7C93, 0x7C93, 0x7C93, 0x7C93, 0x7C93, 
-0x7C93, 0x7C93, 0x84B3, 0x84B4, 0x7C73, 0x6BD0, 0x638F, 0x634F, 0x5B0D, 0x5B0D, 0x7411, 0x8CD4, 0x84B4, 0x7C93, 0x7C93, 0x7C73, 
-0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7411, 0x5B2E, 0x52AC, 0x5B0D, 0x5B0D, 0x29A8, 0x0882, 0x0041, 0x0020, 0x0041, 0x0041, 0x0041, 
-0x0841, 0x0041, 0x0041, 0x0841, 0x0841, 0x0841, 0x0020, 0x0041, 0x1061, 0x2103, 0x2943, 0x3164, 0x39A5, 0x39C6, 0x39E6, 0x39C6, 
-0x31C5, 0x29A5, 0x2185, 0x29A5, 0x39E6, 0x4226, 0x4207, 0x2103, 0x0020, 0x0000, 0x0000, 0x0020, 0x1904, 0x3A29, 0x530C, 0x5B4D, 
-0x4B0C, 0x3229, 0x08E5, 0x0064, 0x0084, 0x0064, 0x0084, 0x1127, 0x42CC, 0x63AF, 0x4AAB, 0x0882, 0x0000, 0x2103, 0x3A06, 0x39C6, 
-0x18E3, 0x0840, 0x0861, 0x39E7, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xC65A, 0x7C11, 0x73F1, 0x8493, 0x8D16, 0x9557, 0x84D5, 0x6370, 0x52ED, 0x6B8F, 0x6BAF, 
-0x6BD0, 0x7411, 0x7C32, 0x7C52, 0x7C72, 0x7C93, 0x8493, 0x84B3, 0x84D4, 0x84D4, 0x84D4, 0x84D4, 0x84D4, 0x84D4, 0x84D4, 0x7CB3, 
-0x7CB3, 0x7CB3, 0x7C93, 0x7C93, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C93, 0x7C93, 0x7C73, 0x7C73, 0x7C93, 0x7C93, 0x7C93, 
-0x8493, 0x7C93, 0x7C93, 0x84B3, 0x7C73, 0x6BB0, 0x636F, 0x6B4F, 0x5AED, 0x5B0D, 0x7411, 0x8CD4, 0x84B3, 0x7C93, 0x7C73, 0x7C73, 
-0x7C72, 0x7452, 0x7452, 0x7452, 0x7411, 0x5B4E, 0x4AAB, 0x52CC, 0x5B4E, 0x31E9, 0x10C3, 0x0861, 0x0041, 0x0041, 0x0061, 0x0061, 
-0x0061, 0x0841, 0x0841, 0x0041, 0x0021, 0x0020, 0x0021, 0x0021, 0x0041, 0x0882, 0x0882, 0x10A3, 0x18C3, 0x2102, 0x3164, 0x39A6, 
-0x39E6, 0x39C6, 0x31A5, 0x31A5, 0x3A06, 0x4205, 0x39E6, 0x1103, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x1104, 0x3A69, 0x530D, 
-0x632D, 0x530D, 0x2A2A, 0x0906, 0x0084, 0x0085, 0x0085, 0x00A5, 0x11A8, 0x430D, 0x63AF, 0x4A8A, 0x18C2, 0x2103, 0x39C6, 0x39E6, 
-0x2123, 0x0881, 0x0861, 0x1082, 0x6B6D, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xCEBB, 0x8C74, 0x6BB1, 0x84D4, 0x9556, 0x9556, 0x9557, 0x7432, 0x5B0D, 0x632E, 0x6B8F, 0x6BD0, 
-0x7C52, 0x84B3, 0x84B4, 0x84B4, 0x84B4, 0x84B3, 0x84D3, 0x84D4, 0x84B4, 0x84B3, 0x7C93, 0x7C93, 0x7C93, 0x7C93, 0x7C93, 0x7C72, 
-0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C72, 0x7C72, 0x7C72, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C93, 0x7C93, 0x8493, 
-0x8493, 0x7C93, 0x8493, 0x84B4, 0x7C73, 0x6BD0, 0x6B6F, 0x636F, 0x5B0D, 0x52ED, 0x6BD0, 0x84B3, 0x84B3, 0x7C72, 0x7C73, 0x7C72, 
-0x7C72, 0x7452, 0x7452, 0x7432, 0x6C12, 0x5B6F, 0x4A8B, 0x52AB, 0x634E, 0x3A2A, 0x1905, 0x0862, 0x0020, 0x0841, 0x0862, 0x0882, 
-0x0061, 0x0061, 0x0861, 0x0041, 0x0042, 0x0041, 0x0021, 0x0041, 0x00A3, 0x00C4, 0x00C4, 0x00A4, 0x0083, 0x0062, 0x0861, 0x18E2, 
-0x2164, 0x39A6, 0x39A6, 0x39C5, 0x39E5, 0x3A06, 0x39C6, 0x1904, 0x0063, 0x0062, 0x0020, 0x0820, 0x0000, 0x0021, 0x1925, 0x428B, 
-0x5B2D, 0x534D, 0x5B0D, 0x3A2A, 0x0906, 0x00A4, 0x00A5, 0x00C6, 0x00E7, 0x1168, 0x328B, 0x63CF, 0x73EE, 0x63AC, 0x63CC, 0x6BCC, 
-0x5B8B, 0x31C5, 0x1080, 0x0840, 0x2965, 0xAD75, 0xFFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xDF1C, 0x9D36, 0x6BB0, 0x7432, 0x8D16, 0x8D36, 0x8D36, 0x8CF5, 0x63B0, 0x52CC, 0x634E, 0x6BAF, 0x7411, 
-0x84B3, 0x84D4, 0x84B4, 0x7C93, 0x7CB3, 0x84B4, 0x84B4, 0x7C93, 0x7C93, 0x7C73, 0x7C73, 0x7C72, 0x7C72, 0x7C73, 0x7C72, 0x7C72, 
-0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C73, 0x7C93, 
-0x7C93, 0x8493, 0x8493, 0x84B3, 0x7C73, 0x6BD0, 0x6B6F, 0x636F, 0x5AED, 0x52CC, 0x6BD0, 0x7C93, 0x7C73, 0x7452, 0x7C52, 0x7C72, 
-0x7C72, 0x7452, 0x7431, 0x6C31, 0x6C11, 0x638F, 0x4A8B, 0x4A8B, 0x634E, 0x426B, 0x1926, 0x0862, 0x0020, 0x0841, 0x0862, 0x0882, 
-0x08A3, 0x0883, 0x0862, 0x0862, 0x0862, 0x0042, 0x0041, 0x0062, 0x08E5, 0x0926, 0x0926, 0x0127, 0x0947, 0x00E6, 0x0042, 0x0000, 
-0x0881, 0x18E3, 0x2985, 0x31C5, 0x39E6, 0x4226, 0x39C5, 0x1104, 0x00C5, 0x00A4, 0x0062, 0x0861, 0x0020, 0x0000, 0x0081, 0x29C7, 
-0x4ACB, 0x530C, 0x5B0D, 0x52AC, 0x21A8, 0x0085, 0x0085, 0x0107, 0x00E7, 0x00C6, 0x0927, 0x42CC, 0x9554, 0xBE97, 0xAE14, 0xA5D3, 
-0xA5D3, 0x742E, 0x2123, 0x0020, 0x0841, 0x630C, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xE75D, 0xB5D8, 0x7BF1, 0x6BB0, 0x84D5, 0x8D36, 0x84F5, 0x84F5, 0x7453, 0x530E, 0x52CD, 0x636F, 0x6BB0, 0x7C52, 
-0x7C93, 0x7472, 0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7C72, 0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 
-0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C92, 0x7C92, 0x7C73, 0x7C73, 0x7C93, 
-0x7C73, 0x7C93, 0x7C93, 0x84B3, 0x7C73, 0x6BB0, 0x636F, 0x636F, 0x5B0D, 0x52CC, 0x63B0, 0x7452, 0x7452, 0x7432, 0x7432, 0x7432, 
-0x7452, 0x7452, 0x7432, 0x6C11, 0x6C32, 0x63B0, 0x52CC, 0x4A8B, 0x5B2D, 0x4AAC, 0x2167, 0x0882, 0x0020, 0x0841, 0x0861, 0x0882, 
-0x00A3, 0x08A3, 0x08A3, 0x0883, 0x0882, 0x0061, 0x0041, 0x0083, 0x08E5, 0x0926, 0x0126, 0x0146, 0x0188, 0x0188, 0x00E5, 0x0041, 
-0x0000, 0x0020, 0x08C2, 0x2144, 0x39C6, 0x4226, 0x39E5, 0x10E3, 0x0085, 0x00A6, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882, 
-0x3186, 0x426A, 0x4A8A, 0x52CB, 0x3A4A, 0x1947, 0x00A5, 0x00C6, 0x00C7, 0x00E7, 0x00E7, 0x1168, 0x5BAE, 0xAE56, 0xB696, 0xAE14, 
-0xA5F4, 0x9552, 0x4AE9, 0x10A1, 0x0000, 0x2124, 0x94B2, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xEF9E, 0xC65A, 0x8C53, 0x636F, 0x7452, 0x8D36, 0x8D16, 0x9556, 0x9D77, 0x6BF1, 0x4AAC, 0x5AED, 0x6B6F, 0x6BD0, 0x7C73, 
-0x7C93, 0x7452, 0x7432, 0x7432, 0x7411, 0x6C11, 0x6C11, 0x7412, 0x7432, 0x7452, 0x7452, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 
-0x7C52, 0x7C52, 0x7C52, 0x7C52, 0x7C52, 0x7C52, 0x7C52, 0x7C73, 0x7C52, 0x7C73, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 
-0x7C93, 0x7C73, 0x7C73, 0x7C93, 0x7C52, 0x6BB0, 0x634E, 0x5B0D, 0x52AC, 0x52ED, 0x63B0, 0x7452, 0x7432, 0x7431, 0x7431, 0x7431, 
-0x7432, 0x7432, 0x7431, 0x6C11, 0x6C11, 0x63D0, 0x52ED, 0x4A8B, 0x52ED, 0x52ED, 0x29A8, 0x10A2, 0x0020, 0x0020, 0x0841, 0x0881, 
-0x0882, 0x08A3, 0x00C4, 0x00C3, 0x08A2, 0x0882, 0x0062, 0x0083, 0x08E5, 0x0926, 0x0925, 0x0905, 0x0926, 0x0988, 0x0988, 0x00C4, 
-0x0020, 0x0000, 0x0000, 0x0861, 0x2104, 0x39C5, 0x41E6, 0x10C3, 0x0024, 0x0085, 0x0063, 0x0841, 0x0000, 0x0000, 0x0000, 0x0061, 
-0x1987, 0x3AAB, 0x4B2D, 0x538E, 0x5C10, 0x4B6F, 0x1188, 0x00A5, 0x00C6, 0x0106, 0x00E6, 0x00C6, 0x11A8, 0x8513, 0xBEB8, 0xAE35, 
-0x9DB2, 0x9DD3, 0x7CB0, 0x2164, 0x0020, 0x0840, 0x4A49, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xCEBB, 0xA556, 0x6B70, 0x636F, 0x84D4, 0x8D35, 0x9D77, 0xBEBA, 0xBE7A, 0x6BD0, 0x426B, 0x5B0D, 0x636F, 0x6BF1, 0x7432, 
-0x84B3, 0xA5B7, 0xAE19, 0xA5D7, 0x9D76, 0x9535, 0x84D4, 0x84B3, 0x7CB3, 0x7C93, 0x7473, 0x7C72, 0x7452, 0x7452, 0x7452, 0x7452, 
-0x7C52, 0x7C52, 0x7C52, 0x7452, 0x7C52, 0x7C52, 0x7452, 0x7C52, 0x7452, 0x7C53, 0x7C52, 0x7C52, 0x7C52, 0x7C72, 0x7C72, 0x7C72, 
-0x7472, 0x7C72, 0x7C73, 0x8493, 0x7C73, 0x73D0, 0x52AB, 0x2987, 0x422A, 0x5B0D, 0x6BD0, 0x7452, 0x7432, 0x6C11, 0x6C11, 0x7431, 
-0x7431, 0x7431, 0x7431, 0x6C11, 0x6C11, 0x63D0, 0x530D, 0x426B, 0x52CC, 0x5B0E, 0x39E9, 0x10A3, 0x0041, 0x0020, 0x0841, 0x0881, 
-0x0881, 0x08C3, 0x00C4, 0x00C4, 0x08C4, 0x08A3, 0x0083, 0x0083, 0x08E5, 0x0106, 0x00E6, 0x08C5, 0x00A4, 0x0106, 0x0148, 0x0107, 
-0x0062, 0x0000, 0x0000, 0x0000, 0x0062, 0x2103, 0x3164, 0x2144, 0x19C8, 0x2A8C, 0x32CC, 0x430B, 0x4B2B, 0x4B4C, 0x4B4C, 0x3B4D, 
-0x3BD1, 0x54B4, 0x6D56, 0x7597, 0x7DF9, 0x7597, 0x332F, 0x00C7, 0x0086, 0x0127, 0x00E6, 0x00C7, 0x0107, 0x4B4E, 0xAE37, 0xBE97, 
-0xA5D3, 0x9DD3, 0x9592, 0x5B4A, 0x10C2, 0x0040, 0x10A2, 0x94B2, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xEF7D, 0xB5F8, 0x8452, 0x5B0E, 0x7412, 0x8D15, 0x84F5, 0xB63A, 0xE7DF, 0xBE79, 0x5B2E, 0x426B, 0x632E, 0x638F, 0x6BF1, 0x7412, 
-0x8D15, 0xC6DB, 0xD77E, 0xC6FB, 0xB69A, 0xAE59, 0xA5F8, 0x9DB7, 0x9555, 0x8D15, 0x84D4, 0x7C93, 0x7C73, 0x7C72, 0x7C72, 0x7C72, 
-0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7452, 0x7432, 0x7432, 0x7432, 0x7432, 0x7432, 0x7432, 0x7452, 0x7452, 0x7452, 0x7C72, 
-0x7472, 0x7C73, 0x7C73, 0x7C93, 0x7C52, 0x634E, 0x2987, 0x0862, 0x31C8, 0x5B0D, 0x6BD0, 0x7C72, 0x7432, 0x6BF1, 0x6C11, 0x6C11, 
-0x7431, 0x7431, 0x7431, 0x7432, 0x6C32, 0x6BF1, 0x5B4E, 0x428B, 0x4A8B, 0x5B2E, 0x424A, 0x10E4, 0x0041, 0x0020, 0x0841, 0x0861, 
-0x1061, 0x08A2, 0x08C4, 0x00C4, 0x00C4, 0x00A3, 0x0083, 0x0083, 0x00A4, 0x00C5, 0x00E5, 0x0905, 0x0904, 0x0926, 0x11A9, 0x1A0A, 
-0x21E8, 0x2144, 0x2142, 0x10E2, 0x08A3, 0x08E4, 0x10C3, 0x21C6, 0x5C50, 0x7DB7, 0x7DB6, 0x7DB6, 0x8DF6, 0x9637, 0x8617, 0x6575, 
-0x4537, 0x5D98, 0x763A, 0x7E3B, 0x7E3A, 0x7E7A, 0x5CD4, 0x0989, 0x0086, 0x00E7, 0x00E6, 0x00E7, 0x0108, 0x19C9, 0x8D13, 0xBEB7, 
-0xADF4, 0x9DD3, 0xA5D3, 0x8CF1, 0x31E5, 0x0040, 0x0840, 0x4208, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 
-0xCE9B, 0x9D15, 0x636F, 0x636F, 0x84B4, 0x8CF5, 0x9556, 0xCF3D, 0xEFDF, 0x9535, 0x4AAC, 0x52AC, 0x634E, 0x638F, 0x6C11, 0x7431, 
-0x84F4, 0xA618, 0xAE59, 0xA618, 0xA618, 0x9DD7, 0x9DB7, 0x9576, 0x9535, 0x8D15, 0x84D4, 0x84B3, 0x7C93, 0x7C93, 0x7C93, 0x7C92, 
-0x7C72, 0x7452, 0x7452, 0x7C72, 0x7C92, 0x7C92, 0x7C72, 0x7C92, 0x7C91, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 0x7C72, 
-0x7C93, 0x7C73, 0x7C93, 0x7C72, 0x6BD0, 0x4249, 0x1083, 0x0020, 0x31A8, 0x5B0D, 0x6BD0, 0x7C72, 0x7432, 0x6C11, 0x6C11, 0x6BF0, 
-0x6C11, 0x7411, 0x7411, 0x7431, 0x6C11, 0x7411, 0x63AF, 0x4AAB, 0x4A6B, 0x5B0E, 0x4A8B, 0x1925, 0x0041, 0x0020, 0x0020, 0x0840, 
-0x0861, 0x0861, 0x08A3, 0x08E4, 0x08E4, 0x00E4, 0x0905, 0x1145, 0x1166, 0x1186, 0x19A7, 0x21E7, 0x2228, 0x2A69, 0x32CB, 0x432C, 
-0x434D, 0x4B0B, 0x42A7, 0x2183, 0x08C4, 0x1126, 0x0904, 0x2228, 0x7533, 0x9EBA, 0x9679, 0x8E39, 0x9658, 0x9E57, 0x8E17, 0x5D76, 
-0x34F6, 0x4D36, 0x6598, 0x75D9, 0x75D9, 0x7E3A, 0x7DD7, 0x3AEC, 0x00C6, 0x00A6, 0x00E7, 0x00E7, 0x0107, 0x0148, 0x5C10, 0xAE56, 
-0xAE14, 0xA5D3, 0xADF4, 0x9DD3, 0x5B8B, 0x10C1, 0x0840, 0x1062, 0x8C51, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 
-0xADD8, 0x8452, 0x52ED, 0x7411, 0x8D16, 0x8CF5, 0xADD8, 0xD77D, 0xC6BB, 0x6BD0, 0x4AAC, 0x632E, 0x636F, 0x6BD0, 0x7431, 0x7432, 
-0x7CB3, 0x8D15, 0x8D14, 0x84F4, 0x84F4, 0x84D3, 0x84F4, 0x84F4, 0x84F4, 0x84D3, 0x7CB3, 0x7C93, 0x7C93, 0x84B3, 0x84B3, 0x84B3, 
-0x7CB3, 0x7C93, 0x84B3, 0x84F3, 0x8D14, 0x8D34, 0x8D34, 0x9534, 0x9553, 0x8D33, 0x84F3, 0x84B3, 0x7C73, 0x7452, 0x7431, 0x6C11, 
-0x6BF1, 0x6BD0, 0x6BD0, 0x5B6F, 0x426A, 0x1905, 0x0000, 0x0020, 0x3187, 0x52ED, 0x6BD0, 0x7C52, 0x6C11, 0x6C11, 0x6BF1, 0x6C11, 
-0x6BF0, 0x6BF1, 0x6C11, 0x6BF1, 0x6BF1, 0x7432, 0x6BF1, 0x52ED, 0x4A6B, 0x5B0D, 0x4A8C, 0x2166, 0x0882, 0x0020, 0x0000, 0x0040, 
-0x0840, 0x0040, 0x08A2, 0x2165, 0x21C7, 0x21E7, 0x2A28, 0x3269, 0x32AA, 0x3A8A, 0x3A6A, 0x3AAA, 0x42EB, 0x432C, 0x4B2C, 0x432A, 
-0x4B4C, 0x538D, 0x4309, 0x2184, 0x0862, 0x0905, 0x1187, 0x32AB, 0x6D13, 0x9659, 0x8E18, 0x85F8, 0x8E18, 0xA637, 0x9617, 0x5D56, 
-0x3CB5, 0x44D6, 0x5557, 0x65B8, 0x75F9, 0x7E1A, 0x8619, 0x6C51, 0x1987, 0x00A5, 0x00C6, 0x0107, 0x00E7, 0x0107, 0x32CC, 0x8D53, 
-0xAE35, 0xADD4, 0xADF4, 0xA5F3, 0x84D0, 0x31E5, 0x0000, 0x0821, 0x4228, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xCE9B, 
-0x94F5, 0x632E, 0x5B4E, 0x84D4, 0x8D36, 0x9536, 0xA5F9, 0xAE9A, 0x8CF5, 0x4AEC, 0x52CC, 0x634E, 0x636F, 0x6BF1, 0x6C32, 0x7452, 
-0x7C72, 0x84B3, 0x84D3, 0x84D3, 0x84F3, 0x84D3, 0x84D3, 0x84F3, 0x8CF3, 0x8CF3, 0x84B3, 0x7C93, 0x84B3, 0x84B3, 0x84B3, 0x84B3, 
-0x7C92, 0x84D2, 0x8513, 0x8D13, 0x84F4, 0x84D4, 0x84D3, 0x84F2, 0x84D2, 0x7451, 0x73F0, 0x6BAF, 0x636E, 0x5B2E, 0x52CC, 0x4AAB, 
-0x4A8B, 0x4A8B, 0x4A8B, 0x428A, 0x29C7, 0x1082, 0x0000, 0x1082, 0x39E8, 0x52ED, 0x6BD0, 0x7452, 0x6C11, 0x6BF0, 0x6BF1, 0x6BF1, 
-0x6BF1, 0x6BF0, 0x6C10, 0x63D0, 0x63B0, 0x6C31, 0x7452, 0x5B2D, 0x4A6B, 0x52AC, 0x52AC, 0x29C8, 0x08A2, 0x0041, 0x0020, 0x0020, 
-0x0041, 0x0820, 0x18C2, 0x3206, 0x3AA8, 0x3289, 0x32AA, 0x3ACA, 0x430B, 0x3ACA, 0x3289, 0x3AAA, 0x42EB, 0x430C, 0x432B, 0x42EA, 
-0x434C, 0x53EE, 0x536D, 0x29A5, 0x0020, 0x0041, 0x1146, 0x3B0C, 0x7534, 0x9638, 0x8DF7, 0x85F7, 0x8E18, 0x9E38, 0x9638, 0x6D75, 
-0x34B5, 0x3CD6, 0x4516, 0x5D77, 0x75D9, 0x7E1A, 0x8E39, 0x8D74, 0x428A, 0x00E6, 0x00C7, 0x00E7, 0x00E6, 0x00E7, 0x11A9, 0x6C70, 
-0xAE14, 0xAE14, 0xADF4, 0xADF4, 0x9DB2, 0x5B4A, 0x10A2, 0x0820, 0x10C2, 0x8450, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0xB5D8, 
-0x7BF1, 0x4AAC, 0x6BD0, 0x8D36, 0x8D36, 0x8D15, 0x9577, 0x8D76, 0x6BD0, 0x4AAC, 0x4229, 0x4229, 0x530D, 0x7432, 0x7473, 0x6C32, 
-0x7492, 0x7C93, 0x7CB3, 0x84D4, 0x8D15, 0x9535, 0x9514, 0x8D14, 0x8D34, 0x84F4, 0x84B3, 0x7C92, 0x7C92, 0x7C72, 0x7C52, 0x7431, 
-0x7411, 0x6BEF, 0x63AE, 0x5B6D, 0x5B2D, 0x52EC, 0x52AB, 0x4AAA, 0x42A9, 0x4269, 0x4269, 0x4269, 0x3A4A, 0x3A6A, 0x4AAA, 0x4AEB, 
-0x532C, 0x5B4D, 0x638F, 0x63AF, 0x4AAB, 0x18E4, 0x0821, 0x18E4, 0x422A, 0x52ED, 0x63D0, 0x7452, 0x6C11, 0x6BF0, 0x6BF1, 0x6BF1, 
-0x6BF1, 0x6BF0, 0x6BF0, 0x63D0, 0x63B0, 0x6C31, 0x7C72, 0x636E, 0x426B, 0x4A8B, 0x52AC, 0x3209, 0x10C3, 0x0841, 0x0020, 0x0020, 
-0x0020, 0x0841, 0x1902, 0x31E5, 0x3A88, 0x32AA, 0x328A, 0x3AAA, 0x3AEA, 0x3ACA, 0x3AAA, 0x328A, 0x3AAA, 0x430B, 0x432C, 0x432B, 
-0x4B4B, 0x53CE, 0x5BCF, 0x3228, 0x0061, 0x0000, 0x0082, 0x32AA, 0x7555, 0x9679, 0x8E18, 0x8617, 0x8E18, 0x9638, 0x9638, 0x75B6, 
-0x3CB5, 0x3CD5, 0x4516, 0x5556, 0x6598, 0x75F9, 0x8E59, 0x95F6, 0x63AE, 0x1147, 0x00A6, 0x00C6, 0x00E6, 0x00C6, 0x0107, 0x538D, 
-0xA5F4, 0xAE34, 0xB614, 0xAE14, 0xAE14, 0x7CAF, 0x3206, 0x0840, 0x0020, 0x4208, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xD6BB, 0x9D15, 
-0x5B2E, 0x4AAC, 0x7C73, 0x9536, 0x8D36, 0x8D15, 0x9536, 0x7CB4, 0x5B4F, 0x52CC, 0x2987, 0x10C4, 0x4AAB, 0x7C93, 0x7CB3, 0x7472, 
-0x7452, 0x7452, 0x7432, 0x7C52, 0x7C93, 0x8492, 0x7C52, 0x7411, 0x6BF0, 0x638F, 0x5B4E, 0x530D, 0x52CC, 0x4AAB, 0x426B, 0x3A2A, 
-0x39E9, 0x39E8, 0x3208, 0x3207, 0x3A28, 0x4269, 0x42AA, 0x4AEB, 0x532B, 0x532C, 0x534C, 0x534D, 0x536D, 0x5B8E, 0x640F, 0x7490, 
-0x7CB1, 0x7471, 0x7C72, 0x7452, 0x52EC, 0x18C4, 0x0000, 0x2945, 0x4A4A, 0x52EC, 0x63B0, 0x7432, 0x6BF1, 0x63D0, 0x6BD0, 0x63D0, 
-0x63D0, 0x6BF0, 0x6BF0, 0x63B0, 0x63B0, 0x6C30, 0x7CB2, 0x6BEF, 0x4A8B, 0x424A, 0x52AC, 0x424A, 0x1905, 0x0862, 0x0020, 0x0020, 
-0x0821, 0x0861, 0x1923, 0x29A4, 0x3206, 0x3A89, 0x32AA, 0x32AA, 0x3ACA, 0x3ACA, 0x3ACA, 0x32AA, 0x32AA, 0x430C, 0x4B4C, 0x432C, 
-0x42C9, 0x3AEA, 0x4B6D, 0x328A, 0x08E4, 0x0000, 0x0000, 0x2A08, 0x7554, 0x9E79, 0x8E18, 0x8E18, 0x8E18, 0x9638, 0x9658, 0x7DD8, 
-0x4CF5, 0x44D5, 0x4516, 0x4D36, 0x5D58, 0x6DD9, 0x8639, 0x9E38, 0x7C70, 0x3209, 0x0906, 0x00C6, 0x00E6, 0x00C6, 0x00A6, 0x3ACB, 
-0x9D73, 0xB634, 0xB614, 0xAE14, 0xAE55, 0xA5D3, 0x63AC, 0x10C2, 0x0000, 0x1082, 0x8410, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73D, 0xBE19, 0x7C32, 
-0x4AAC, 0x638F, 0x8CF5, 0x8D16, 0x8D36, 0x9556, 0x8D35, 0x7C73, 0x5B0D, 0x4249, 0x18C3, 0x0021, 0x3A49, 0x73F1, 0x6BF0, 0x638F, 
-0x5B4E, 0x5B2E, 0x52EC, 0x4ACC, 0x4A8B, 0x4A8B, 0x4A8B, 0x426A, 0x4229, 0x4229, 0x3A09, 0x3A09, 0x3A09, 0x3A29, 0x4229, 0x4229, 
-0x3A69, 0x42AA, 0x4B0B, 0x534B, 0x536C, 0x5B8E, 0x63EF, 0x6C30, 0x7491, 0x7491, 0x7491, 0x84F2, 0x9595, 0x9D96, 0x9555, 0x7CF2, 
-0x7CD2, 0x7472, 0x7452, 0x6C31, 0x5B2D, 0x2946, 0x10A3, 0x31A6, 0x4A4A, 0x52CC, 0x63B0, 0x7452, 0x6BF1, 0x63B0, 0x63D0, 0x63D0, 
-0x63D0, 0x63D0, 0x6BD0, 0x63B0, 0x63AF, 0x6C50, 0x84F2, 0x7470, 0x4ACC, 0x3A09, 0x52AC, 0x4A8B, 0x2166, 0x0882, 0x0020, 0x0020, 
-0x0820, 0x0861, 0x1923, 0x29A4, 0x29C4, 0x3248, 0x3ACA, 0x3AEB, 0x3AEB, 0x3ACB, 0x3AEA, 0x3ACA, 0x3ACB, 0x3ACB, 0x3AAA, 0x328A, 
-0x2A07, 0x21C6, 0x2A49, 0x2A8B, 0x1187, 0x0042, 0x0000, 0x21A6, 0x7513, 0xA6BA, 0x9658, 0x8E17, 0x8E18, 0x9618, 0x9638, 0x7DD8, 
-0x5D57, 0x4D16, 0x4516, 0x4D17, 0x5537, 0x6DB8, 0x8E39, 0xAE58, 0x8D12, 0x52EB, 0x2188, 0x00C6, 0x00A6, 0x00C6, 0x0086, 0x2229, 
-0x8CF1, 0xB675, 0xB634, 0xAE35, 0xB676, 0xB695, 0x8CF0, 0x3A26, 0x0840, 0x0000, 0x39E7, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xD69B, 0x9D15, 0x634E, 
-0x4ACC, 0x8494, 0x9536, 0x8CF6, 0x8D36, 0x8D35, 0x8CF5, 0x6BF1, 0x3A09, 0x2104, 0x0020, 0x0020, 0x29A6, 0x4AAB, 0x4AAB, 0x424A, 
-0x3A49, 0x424A, 0x3A29, 0x3A29, 0x3A29, 0x428A, 0x4AEB, 0x52EB, 0x5B2C, 0x5B4D, 0x532D, 0x5B4E, 0x63AE, 0x6C0F, 0x7450, 0x7450, 
-0x6C70, 0x74B1, 0x7CD1, 0x74B1, 0x7472, 0x7452, 0x7451, 0x7471, 0x7491, 0x7491, 0x9555, 0xC699, 0xE77D, 0xDF1D, 0xADD9, 0x7C53, 
-0x5B8F, 0x63D0, 0x7452, 0x7452, 0x63AF, 0x424A, 0x3187, 0x3A09, 0x4A4A, 0x52CC, 0x63B0, 0x7432, 0x6BF1, 0x63B0, 0x63B0, 0x63D0, 
-0x63D0, 0x63D0, 0x63B0, 0x6390, 0x63CF, 0x7490, 0x8532, 0x7490, 0x52EC, 0x3A09, 0x4A8B, 0x4AAC, 0x29A8, 0x10A3, 0x0020, 0x0000, 
-0x0000, 0x0020, 0x18E3, 0x31E6, 0x3226, 0x3A87, 0x42EA, 0x434D, 0x432C, 0x42EC, 0x3AEB, 0x3AEB, 0x42EB, 0x3289, 0x21E7, 0x21C7, 
-0x2187, 0x1965, 0x21C7, 0x222A, 0x11C9, 0x00C4, 0x0041, 0x1964, 0x6CD2, 0xA6BA, 0x9E79, 0x8E18, 0x8E39, 0x9659, 0x9638, 0x75B8, 
-0x5D98, 0x5D77, 0x5D36, 0x5D35, 0x6D55, 0x7D95, 0x9E16, 0xBE76, 0x9D73, 0x5B8D, 0x3A29, 0x1147, 0x00C5, 0x00A6, 0x00A6, 0x1187, 
-0x7C6F, 0xBE95, 0xBE96, 0xB636, 0xB635, 0xA5B3, 0x84D0, 0x4AC9, 0x0881, 0x0000, 0x10A2, 0x8C51, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0xBE19, 0x7C11, 0x4A8C, 
-0x636F, 0x9536, 0x9536, 0x84F5, 0x84F5, 0x8D15, 0x84B4, 0x5B4E, 0x2966, 0x1082, 0x0020, 0x10C3, 0x3A29, 0x4AAB, 0x4ACC, 0x52CC, 
-0x52EC, 0x532C, 0x5B2D, 0x5B4D, 0x5B8E, 0x7430, 0x84D2, 0x8D13, 0x8CF3, 0x84D3, 0x7C92, 0x7492, 0x7CD2, 0x8512, 0x8512, 0x7CF1, 
-0x7CD2, 0x7CF2, 0x7CF2, 0x7491, 0x6C11, 0x6BF1, 0x6C11, 0x6C30, 0x6C50, 0x9534, 0xD6FB, 0xFFFF, 0xFFFF, 0xEF5F, 0xBDFA, 0x7C33, 
-0x4AAC, 0x4AED, 0x6C11, 0x7C72, 0x63AF, 0x4A6B, 0x3A09, 0x424A, 0x4A6A, 0x52CC, 0x63D0, 0x7432, 0x63F1, 0x63B0, 0x63B0, 0x63D0, 
-0x63D0, 0x63D0, 0x63B0, 0x5B8F, 0x6BF0, 0x74D0, 0x8532, 0x74B0, 0x532D, 0x3A29, 0x424A, 0x4AAC, 0x3A09, 0x10C4, 0x0021, 0x0000, 
-0x0020, 0x0040, 0x10C2, 0x29E6, 0x3A67, 0x3A46, 0x3A88, 0x42EC, 0x430C, 0x42EC, 0x32AA, 0x328A, 0x3A8A, 0x2A08, 0x2186, 0x1986, 
-0x1947, 0x2187, 0x29E8, 0x19C8, 0x0988, 0x0106, 0x0082, 0x19A5, 0x64B1, 0x9EB9, 0x9E99, 0x9658, 0x9659, 0x9659, 0x8E38, 0x7DB7, 
-0x75B7, 0x85D7, 0x85B5, 0x8D93, 0x95B3, 0x95B3, 0xA634, 0xBED7, 0xAE16, 0x63CE, 0x428A, 0x3229, 0x0906, 0x0065, 0x00A6, 0x1146, 
-0x63AC, 0xADF3, 0xADD3, 0x9531, 0x84AF, 0x6BCB, 0x5B6B, 0x3A87, 0x10A2, 0x0040, 0x0020, 0x39E7, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE9B, 0x9D35, 0x52ED, 0x426B, 
-0x7C53, 0x9556, 0x8D36, 0x84F5, 0x84D5, 0x8CF5, 0x7452, 0x4A8B, 0x31A7, 0x18E4, 0x0841, 0x29A7, 0x63AF, 0x6C11, 0x6BF0, 0x6BF0, 
-0x6C10, 0x6C10, 0x6C10, 0x6BF0, 0x6BF0, 0x7471, 0x84F3, 0x8D34, 0x8D13, 0x84D3, 0x7CB2, 0x7CB2, 0x7CD1, 0x7CF1, 0x7CF1, 0x74B1, 
-0x7C91, 0x7C91, 0x7CB1, 0x7471, 0x6C30, 0x7451, 0x6C71, 0x6C70, 0x7470, 0xADD7, 0xE75E, 0xE71D, 0xC65A, 0xC63A, 0xAD98, 0x7C11, 
-0x424A, 0x31E8, 0x5B4E, 0x7C72, 0x638F, 0x424A, 0x4229, 0x4A6A, 0x4A6A, 0x52CC, 0x6BD0, 0x7452, 0x6BF1, 0x63B0, 0x63B0, 0x63B0, 
-0x63D0, 0x63B0, 0x63B0, 0x5B8F, 0x6C10, 0x74D0, 0x7CF1, 0x7CB1, 0x5B8E, 0x426A, 0x422A, 0x4AAC, 0x424A, 0x1905, 0x0862, 0x0841, 
-0x0881, 0x10C1, 0x1902, 0x2984, 0x29A5, 0x29A4, 0x2184, 0x29C6, 0x3249, 0x326A, 0x2A29, 0x2208, 0x2A08, 0x21C7, 0x1966, 0x1126, 
-0x0926, 0x19A7, 0x2A08, 0x1166, 0x0105, 0x00E5, 0x00C3, 0x21E7, 0x7512, 0xA6B9, 0xA6DA, 0xA6B9, 0x9E79, 0x9E77, 0x9E57, 0x9617, 
-0x9E36, 0xAE56, 0xAE35, 0xA5F4, 0xA5B3, 0x9DB3, 0x9DF4, 0xAE76, 0xB636, 0x7430, 0x4ACB, 0x428B, 0x21A8, 0x00A5, 0x0085, 0x1945, 
-0x4AA8, 0x73CC, 0x6BCB, 0x636A, 0x5309, 0x4267, 0x4AC9, 0x4AE9, 0x2143, 0x0040, 0x0040, 0x10A2, 0x8C51, 0xF79E, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xB5F8, 0x8452, 0x424A, 0x52CC, 
-0x9516, 0x9556, 0x8D35, 0x84D4, 0x84F5, 0x8515, 0x6BF1, 0x3A09, 0x39C7, 0x2125, 0x1082, 0x3A49, 0x7411, 0x7452, 0x6C31, 0x6C11, 
-0x6C10, 0x6C11, 0x6C11, 0x6BF1, 0x6BF0, 0x6C11, 0x7452, 0x7492, 0x7CB2, 0x7C92, 0x7CB2, 0x7CB1, 0x7CB0, 0x7CD0, 0x7CD1, 0x7CB1, 
-0x74B0, 0x74B0, 0x74B1, 0x7490, 0x7490, 0x7CD0, 0x7CF1, 0x74B0, 0x7491, 0x8CF4, 0xA536, 0x8452, 0x73D0, 0x7C32, 0x7C11, 0x6B2C, 
-0x39E7, 0x2125, 0x530D, 0x7C72, 0x5B4E, 0x4209, 0x4A4A, 0x52AB, 0x422A, 0x4A8B, 0x6BD0, 0x7472, 0x6BF1, 0x63B0, 0x63D0, 0x63D0, 
-0x6BD0, 0x63D0, 0x63B0, 0x638F, 0x6C0F, 0x74B0, 0x7CD0, 0x7CB1, 0x6BCF, 0x4AAB, 0x4229, 0x4AAB, 0x4A8B, 0x2146, 0x10A3, 0x10A2, 
-0x2104, 0x2964, 0x31A5, 0x31A5, 0x31C6, 0x31C6, 0x2143, 0x18C1, 0x1986, 0x29E8, 0x21E8, 0x21E8, 0x21E8, 0x29E8, 0x21A7, 0x1126, 
-0x0926, 0x19C8, 0x2A49, 0x19A6, 0x0125, 0x0967, 0x21E8, 0x4B6D, 0x8D94, 0xA6B8, 0xA677, 0xAE78, 0x9E36, 0x9E15, 0x9DF4, 0x95D4, 
-0x8DB4, 0x9DB3, 0x9DB3, 0x8D31, 0x7C6F, 0x6C0D, 0x63CC, 0x63CD, 0x742F, 0x5B4D, 0x42AA, 0x52EC, 0x428B, 0x0907, 0x0065, 0x1945, 
-0x39E6, 0x4A67, 0x52C8, 0x52E8, 0x4AA7, 0x3A47, 0x530B, 0x6C0E, 0x4247, 0x10A1, 0x0040, 0x0040, 0x4208, 0xC618, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x9D57, 0x634E, 0x424A, 0x6BD1, 
-0x9556, 0x9556, 0x9535, 0x84F5, 0x84F5, 0x84B4, 0x5B2E, 0x31A7, 0x39E8, 0x31C7, 0x31E8, 0x5B2D, 0x6BF0, 0x6C11, 0x6BF0, 0x6BF0, 
-0x6BF0, 0x6BF0, 0x6BF0, 0x6BF0, 0x6BD0, 0x63D0, 0x6BF0, 0x6C10, 0x6C10, 0x6C11, 0x6C11, 0x6C31, 0x7471, 0x7CD2, 0x8533, 0x8512, 
-0x8512, 0x8533, 0x7CF2, 0x7CD2, 0x7CF1, 0x84F1, 0x7CF1, 0x74D0, 0x6C50, 0x636D, 0x62EB, 0x52AA, 0x52CA, 0x630C, 0x6B6D, 0x5B0B, 
-0x39C6, 0x2966, 0x52EC, 0x6BAF, 0x424A, 0x2125, 0x2966, 0x39E9, 0x3187, 0x29A8, 0x4B0D, 0x63D0, 0x5B6F, 0x5B6F, 0x5B8F, 0x63B0, 
-0x63D0, 0x6BD0, 0x63B0, 0x63D0, 0x6C31, 0x7471, 0x7CB1, 0x84F1, 0x7450, 0x530C, 0x422A, 0x528C, 0x52CB, 0x29A7, 0x08A3, 0x18A2, 
-0x2103, 0x2965, 0x31C6, 0x31C5, 0x31E5, 0x3A06, 0x39A5, 0x2943, 0x2964, 0x29E7, 0x2229, 0x2A09, 0x2A09, 0x2A48, 0x2A49, 0x29C8, 
-0x1987, 0x2208, 0x3ACB, 0x3AEB, 0x3B0A, 0x4B6C, 0x5BEE, 0x6470, 0x74D1, 0x7CAF, 0x6C0D, 0x63ED, 0x53EE, 0x43AE, 0x3B2C, 0x3ACB, 
-0x328B, 0x326A, 0x3AAA, 0x4289, 0x31E6, 0x2164, 0x2164, 0x2185, 0x3A48, 0x4AEB, 0x42AB, 0x4AEC, 0x4B0C, 0x29E8, 0x0084, 0x1906, 
-0x39E6, 0x4206, 0x52C7, 0x5AC8, 0x5268, 0x3206, 0x4B2B, 0x7471, 0x5BAD, 0x2144, 0x0840, 0x0020, 0x10A2, 0x8430, 0xF79E, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xC639, 0x8C93, 0x4A8B, 0x52CC, 0x84D4, 
-0x9536, 0x9D76, 0x9D76, 0x8D35, 0x84F5, 0x7432, 0x428B, 0x2966, 0x4209, 0x4A6A, 0x530C, 0x63CF, 0x6BF0, 0x6C10, 0x6BF0, 0x6BF0, 
-0x6BF0, 0x6BF0, 0x6BF0, 0x63D0, 0x63D0, 0x63F0, 0x6C10, 0x6C31, 0x7431, 0x6C30, 0x6C10, 0x63F0, 0x6BF0, 0x7431, 0x7C72, 0x7451, 
-0x7CB2, 0x84F3, 0x7CD3, 0x7CD3, 0x7CF2, 0x84F3, 0x7CD2, 0x74B2, 0x63CF, 0x52CB, 0x5269, 0x62EA, 0x6B2C, 0x736D, 0x73EE, 0x63AD, 
-0x3A07, 0x1904, 0x3A08, 0x31E8, 0x10C3, 0x0841, 0x0862, 0x18C4, 0x1905, 0x1904, 0x2186, 0x31E8, 0x29A7, 0x29C7, 0x3208, 0x3A29, 
-0x3A6A, 0x428B, 0x4ACC, 0x534D, 0x63F0, 0x7451, 0x7491, 0x84D2, 0x7C71, 0x5B4E, 0x4A4B, 0x528B, 0x52CC, 0x31E9, 0x10C4, 0x1062, 
-0x10A2, 0x2103, 0x4247, 0x5309, 0x5309, 0x5309, 0x5329, 0x5309, 0x52C9, 0x52EA, 0x4AEB, 0x3AEB, 0x32AB, 0x32AB, 0x328B, 0x2A2A, 
-0x11E8, 0x11A7, 0x19E8, 0x222A, 0x2A2A, 0x2A4A, 0x3249, 0x2A08, 0x2A08, 0x31E7, 0x2165, 0x2165, 0x2A08, 0x328A, 0x2A4A, 0x2A09, 
-0x2A69, 0x328A, 0x430C, 0x5B8D, 0x5B8C, 0x532B, 0x532B, 0x5B8D, 0x6C2F, 0x742F, 0x5B2D, 0x4AAB, 0x52EC, 0x3A8B, 0x1146, 0x1125, 
-0x39C5, 0x4226, 0x52C8, 0x52C7, 0x4206, 0x2164, 0x3269, 0x6C30, 0x6C2F, 0x3A68, 0x0861, 0x0000, 0x0861, 0x4228, 0xCE59, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0xA576, 0x6B8F, 0x424A, 0x6BB0, 0x9556, 
-0x9556, 0x9577, 0x9D97, 0x8D36, 0x84D4, 0x63B0, 0x31E8, 0x2986, 0x39E8, 0x4A6B, 0x5B4D, 0x6BF0, 0x6BF0, 0x6BF0, 0x6BF0, 0x6BF0, 
-0x6BF0, 0x6BF0, 0x63D0, 0x63D0, 0x63CF, 0x63D0, 0x6C11, 0x7451, 0x7C71, 0x7471, 0x7431, 0x6BF0, 0x636E, 0x52AC, 0x426B, 0x52CC, 
-0x63AF, 0x7411, 0x7451, 0x7492, 0x7CB2, 0x7CB2, 0x7C92, 0x7472, 0x6C11, 0x532D, 0x5ACA, 0x734C, 0x7BAD, 0x7BCE, 0x740F, 0x63CE, 
-0x4289, 0x31C7, 0x3A29, 0x2145, 0x0021, 0x0000, 0x0020, 0x0862, 0x08A2, 0x10A3, 0x10C3, 0x18C3, 0x1061, 0x0821, 0x0841, 0x0881, 
-0x0882, 0x10A3, 0x18E4, 0x2986, 0x3A29, 0x428A, 0x4ACB, 0x530C, 0x4ACB, 0x426A, 0x3A29, 0x424A, 0x52CC, 0x3A2A, 0x1905, 0x1062, 
-0x1062, 0x2124, 0x5B2B, 0x7C6F, 0x6C2D, 0x5BAC, 0x5B8B, 0x5B4B, 0x5B2A, 0x52E9, 0x42A9, 0x3A89, 0x2A6A, 0x222A, 0x11E9, 0x19E8, 
-0x19E8, 0x2229, 0x2209, 0x2229, 0x2A29, 0x21E8, 0x2A07, 0x2A07, 0x3A8A, 0x42EA, 0x4B0A, 0x4B0A, 0x538C, 0x6C50, 0x74B1, 0x74D1, 
-0x74F2, 0x7D32, 0x8D94, 0x9E15, 0xA656, 0xA635, 0x9DF4, 0xA614, 0xAE76, 0x95B4, 0x63AE, 0x426A, 0x52EC, 0x4B0D, 0x3209, 0x2985, 
-0x3184, 0x4206, 0x636A, 0x740C, 0x5B29, 0x3228, 0x3ACB, 0x6C2F, 0x7C91, 0x5B6C, 0x1903, 0x0000, 0x0841, 0x10C2, 0x8C51, 0xF7BE, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCEBB, 0x8C93, 0x4A6A, 0x4A6B, 0x7C73, 0x9556, 
-0x9535, 0x8D35, 0x8D35, 0x84F5, 0x84B4, 0x5B4E, 0x2966, 0x3166, 0x39C8, 0x424A, 0x5B2D, 0x6BD0, 0x6BF0, 0x6C10, 0x6BF0, 0x6BD0, 
-0x6BD0, 0x6BD0, 0x6BD0, 0x6BD0, 0x63AF, 0x63AF, 0x63CF, 0x6BF0, 0x6C10, 0x6C10, 0x6C10, 0x63AF, 0x52CC, 0x31A7, 0x2946, 0x4249, 
-0x5B2E, 0x63CF, 0x6C30, 0x7491, 0x7491, 0x7471, 0x7471, 0x7492, 0x7C93, 0x7450, 0x63CD, 0x6B6C, 0x6B8C, 0x6BAD, 0x6C0F, 0x5C0F, 
-0x63AE, 0x638E, 0x5B2D, 0x31C7, 0x0882, 0x0000, 0x0000, 0x0020, 0x0862, 0x0861, 0x0021, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 
-0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0041, 0x0041, 0x0861, 0x0862, 0x0882, 0x10A2, 0x2966, 0x4AAB, 0x4AAC, 0x2146, 0x0882, 
-0x1041, 0x2123, 0x5B4B, 0x8D12, 0x8512, 0x7470, 0x6BEF, 0x63AE, 0x5B6C, 0x4B0A, 0x3A47, 0x31A6, 0x2966, 0x21A7, 0x19E9, 0x224A, 
-0x430C, 0x6C71, 0x7CF2, 0x7CD1, 0x7CF1, 0x7D11, 0x8532, 0x8D52, 0x8D73, 0x9593, 0x9DD4, 0x95B3, 0x8D51, 0x95B3, 0x9E15, 0x9E36, 
-0x9E15, 0x95F5, 0x95D5, 0x95F5, 0x9E15, 0xA615, 0xA614, 0x9DD3, 0xA5F3, 0x9593, 0x5B8C, 0x3A4A, 0x4AEC, 0x532D, 0x4AAB, 0x39E7, 
-0x2983, 0x3A06, 0x740D, 0xB613, 0xA5B2, 0x7CB1, 0x74D2, 0x9594, 0xA5D5, 0x9553, 0x532B, 0x1903, 0x0000, 0x0000, 0x3A08, 0xCE79, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xB5F8, 0x6BD0, 0x31C7, 0x5B0D, 0x8D16, 0x9556, 
-0x8D15, 0x8D15, 0x84F4, 0x84D4, 0x7C73, 0x4AAB, 0x2125, 0x3186, 0x39C8, 0x4A6A, 0x636E, 0x6C10, 0x6C10, 0x6C10, 0x6BF0, 0x6BD0, 
-0x6BD0, 0x63D0, 0x63D0, 0x63CF, 0x63AF, 0x5B8E, 0x5B8E, 0x5B8F, 0x5B8F, 0x63CF, 0x63CF, 0x5B6E, 0x52AB, 0x39E8, 0x39C7, 0x4A6A, 
-0x5B4E, 0x63EF, 0x6C50, 0x6C90, 0x6C90, 0x6C90, 0x7470, 0x7CB2, 0x84D2, 0x84F2, 0x7CB0, 0x6BCD, 0x5B4C, 0x5B6C, 0x63EE, 0x642F, 
-0x6BF0, 0x5B4E, 0x422A, 0x2986, 0x2104, 0x1082, 0x0000, 0x0020, 0x0841, 0x0021, 0x0021, 0x0841, 0x0020, 0x0040, 0x0020, 0x0020, 
-0x0020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A3, 0x4209, 0x4A6B, 0x2167, 0x0862, 
-0x0800, 0x1061, 0x3207, 0x6BEE, 0x84F2, 0x7CF2, 0x8513, 0x8D75, 0x9595, 0x8512, 0x6C0E, 0x5B0A, 0x5268, 0x5B0B, 0x6C30, 0x6CD2, 
-0x7D33, 0x95F6, 0xAE78, 0xA697, 0x9E56, 0x9E16, 0x9E15, 0x9E15, 0xA615, 0x9E15, 0x9E15, 0x9DF4, 0x9571, 0x9591, 0x9E14, 0x9E16, 
-0x9E15, 0x95D4, 0x95B4, 0x95D5, 0x95D4, 0x9DF5, 0xA615, 0x9DF4, 0xA5F3, 0x9592, 0x4B0A, 0x21A7, 0x4AAB, 0x532D, 0x4AAA, 0x39E6, 
-0x2984, 0x31A5, 0x636B, 0xBE55, 0xC6F7, 0xA655, 0xA657, 0xB6B9, 0xCEF9, 0xC6F9, 0x9DB4, 0x4A88, 0x0820, 0x0000, 0x1082, 0x8451, 
-0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1C, 0x94F5, 0x52EC, 0x31A7, 0x6BF0, 0x9556, 0x8D36, 
-0x8D15, 0x8D15, 0x84F5, 0x8D15, 0x7432, 0x3A29, 0x2105, 0x31A6, 0x39E8, 0x426A, 0x5B6E, 0x6C10, 0x6C31, 0x6C11, 0x6C10, 0x6BF0, 
-0x6BF0, 0x63F0, 0x63D0, 0x63CF, 0x63AF, 0x5BAF, 0x63AF, 0x63AF, 0x63AF, 0x63AF, 0x63AF, 0x530D, 0x4A6B, 0x422A, 0x4229, 0x424A, 
-0x52EC, 0x5B4D, 0x5B8D, 0x5BAD, 0x5BAD, 0x63AE, 0x63AE, 0x63AE, 0x63AE, 0x63CE, 0x63CE, 0x5B4D, 0x4ACB, 0x4ACC, 0x530C, 0x5B2D, 
-0x4AAB, 0x31C8, 0x2966, 0x39E8, 0x4A6A, 0x31C7, 0x10E4, 0x10E3, 0x10E4, 0x1904, 0x2145, 0x31A7, 0x31E8, 0x3A28, 0x4249, 0x4249, 
-0x4269, 0x426A, 0x4A8A, 0x4A8A, 0x4AAA, 0x4AAB, 0x52CB, 0x52AB, 0x52CB, 0x4ACB, 0x4269, 0x3A08, 0x3A09, 0x3A2A, 0x31C9, 0x1925, 
-0x10C3, 0x1082, 0x10A2, 0x2144, 0x3A27, 0x4289, 0x4B2B, 0x5BCE, 0x6C70, 0x7471, 0x744F, 0x63CC, 0x52A8, 0x5267, 0x73EE, 0x8D74, 
-0x8573, 0x8532, 0x8D94, 0x9E37, 0xA678, 0x9E37, 0x9616, 0x9616, 0x9E36, 0xA677, 0xA678, 0x9E36, 0x95D3, 0x95B2, 0x9E14, 0xA636, 
-0xA677, 0x9E56, 0x9E15, 0x95F5, 0x95D5, 0x95F5, 0x9E15, 0xA635, 0xA655, 0xA634, 0x534B, 0x0882, 0x2146, 0x426A, 0x3A08, 0x3164, 
-0x3164, 0x2943, 0x4A48, 0x8CF1, 0xA5F4, 0x9E15, 0x9E57, 0x9DF7, 0xA5D5, 0xA636, 0x9DD4, 0x5B4B, 0x10A2, 0x0000, 0x0001, 0x3A29, 
-0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xC65A, 0x7C11, 0x4229, 0x428B, 0x84B3, 0x9556, 0x8D16, 
-0x9556, 0x9556, 0x9556, 0x9556, 0x73F1, 0x31C8, 0x2945, 0x39A7, 0x39E8, 0x3A09, 0x4AAB, 0x5B4E, 0x63CF, 0x6BF0, 0x6C10, 0x6BF0, 
-0x6BF0, 0x6BF0, 0x63D0, 0x63AF, 0x638F, 0x5B6E, 0x5B6E, 0x5B6E, 0x5B4E, 0x5B2D, 0x5B0D, 0x4AAB, 0x424A, 0x424A, 0x424A, 0x424A, 
-0x4A6A, 0x426A, 0x4249, 0x3A28, 0x3A09, 0x4229, 0x426A, 0x4A8A, 0x4AAB, 0x4AAB, 0x4AEC, 0x5B2D, 0x634E, 0x638F, 0x6BD0, 0x73F0, 
-0x73CF, 0x7BF0, 0x8C92, 0x9D34, 0x9D55, 0x84D3, 0x63CF, 0x538E, 0x6430, 0x8D34, 0xA5D6, 0xB618, 0xBE58, 0xBE59, 0xBE79, 0xC69A, 
-0xC6BA, 0xC6BA, 0xC6BA, 0xC6DB, 0xC6DB, 0xCEFB, 0xCF1C, 0xD71C, 0xD71B, 0xCEFB, 0xC6BA, 0xB638, 0xA596, 0x9D76, 0x9555, 0x84D4, 
-0x7C71, 0x7410, 0x638E, 0x52EB, 0x4269, 0x3A08, 0x29C7, 0x29A7, 0x21A6, 0x2186, 0x2165, 0x2164, 0x1902, 0x1881, 0x2944, 0x4AAA, 
-0x534B, 0x532B, 0x5B6C, 0x6C50, 0x8514, 0x8555, 0x7CF3, 0x6C91, 0x74D2, 0x7D34, 0x8576, 0x8575, 0x7CF3, 0x74B1, 0x7CF2, 0x8553, 
-0x8D95, 0x95B6, 0x9595, 0x8533, 0x7D13, 0x7CF3, 0x74B2, 0x7C91, 0x8D73, 0xA635, 0x744F, 0x1945, 0x08E3, 0x29C6, 0x31A6, 0x2943, 
-0x2143, 0x2102, 0x2984, 0x530B, 0x5BAE, 0x5410, 0x5C51, 0x4B8F, 0x4B4D, 0x640F, 0x7C91, 0x5B8C, 0x2144, 0x0000, 0x0000, 0x10C3, 
-0x9492, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xA576, 0x5B0D, 0x31C8, 0x6BAF, 0x9556, 0x9535, 0x8CF5, 
-0x84F4, 0x84D4, 0x84F5, 0x84B4, 0x5B2E, 0x2987, 0x3187, 0x39E8, 0x39C8, 0x31A7, 0x31C8, 0x3A29, 0x4ACC, 0x532D, 0x5B4E, 0x5B4E, 
-0x5B2E, 0x5B2D, 0x530D, 0x52ED, 0x52CC, 0x4AAC, 0x4AAB, 0x4AAB, 0x428B, 0x4AAB, 0x52AB, 0x4A8B, 0x4AAB, 0x52EB, 0x5B0C, 0x5B2C, 
-0x5B4D, 0x5B6D, 0x638E, 0x6BCF, 0x7C11, 0x8452, 0x8493, 0x8CD3, 0x9514, 0xA555, 0xA595, 0xB5D7, 0xBE38, 0xBE59, 0xC6BA, 0xCEDA, 
-0xD71C, 0xE77D, 0xEFBE, 0xE7DE, 0xCF5D, 0xAE79, 0x8DB7, 0x8576, 0xAE79, 0xE7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xF7FF, 0xEFFF, 0xEFFF, 0xF7FF, 0xF7FF, 0xEFFF, 0xDFDF, 0xD7BE, 
-0xD77D, 0xCF5D, 0xC73C, 0xBEDB, 0xAE59, 0xA5F8, 0x9D77, 0x8D15, 0x7C92, 0x6BCF, 0x534D, 0x4AEC, 0x42AB, 0x3A28, 0x31C7, 0x31E7, 
-0x3208, 0x31C7, 0x29A6, 0x29C7, 0x3208, 0x2A08, 0x29C7, 0x2145, 0x1945, 0x1965, 0x21A7, 0x21A7, 0x1946, 0x1925, 0x1945, 0x29A5, 
-0x29E8, 0x3228, 0x3A48, 0x29E7, 0x2A08, 0x29E8, 0x2186, 0x2145, 0x3208, 0x532B, 0x63CD, 0x63CE, 0x63EF, 0x6C4F, 0x6C0E, 0x6B8C, 
-0x634B, 0x5B2B, 0x530A, 0x536C, 0x432D, 0x2AEE, 0x1AAC, 0x09E9, 0x11E9, 0x4B2D, 0x7410, 0x740F, 0x3A28, 0x0081, 0x0000, 0x0020, 
-0x4A69, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF1C, 0x7C31, 0x424A, 0x3A4A, 0x7C73, 0x9516, 0x8494, 0x7452, 
-0x7412, 0x6BD1, 0x6BB0, 0x5B2D, 0x2987, 0x2105, 0x2967, 0x2946, 0x2946, 0x2966, 0x2146, 0x2146, 0x31C8, 0x3A29, 0x3A09, 0x3A08, 
-0x3A29, 0x426A, 0x4AAB, 0x52CB, 0x530C, 0x5B2D, 0x636E, 0x6BAE, 0x73F0, 0x7C51, 0x84B2, 0x8CF3, 0x9555, 0x9D96, 0xA5D7, 0xAE17, 
-0xB658, 0xBE99, 0xCEFB, 0xD73C, 0xDF7D, 0xDF9D, 0xE7BE, 0xEFDE, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xDF9E, 0xB6BA, 0x95D7, 0x8555, 0x8575, 0xBEDA, 0xEFFF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF79E, 0xF79E, 0xF79E, 0xE77E, 0xD6FB, 0xE77D, 0xF7FF, 0xF7FF, 0xF7FF, 0xE7DE, 0xE7BE, 
-0xDF9E, 0xDF9E, 0xDFBE, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBE, 0xD77E, 0xD77D, 0xCF3D, 0xC6FB, 0xB69A, 0xAE59, 0x9DD7, 0x8D75, 
-0x84D3, 0x7C72, 0x6BF0, 0x5B8E, 0x530D, 0x4ACC, 0x426A, 0x3A29, 0x31C7, 0x2986, 0x2145, 0x1904, 0x10C3, 0x0882, 0x0841, 0x0001, 
-0x0000, 0x0000, 0x0000, 0x0862, 0x18E4, 0x1904, 0x10A3, 0x0862, 0x0001, 0x0021, 0x2145, 0x532C, 0x7430, 0x7CD2, 0x8D53, 0x8D52, 
-0x8D11, 0x8D32, 0x8D53, 0x7D33, 0x6CD2, 0x5431, 0x2B2E, 0x122B, 0x0A0A, 0x32CC, 0x640F, 0x84B2, 0x5B8D, 0x1965, 0x0040, 0x0000, 
-0x18E3, 0xA514, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xBE18, 0x634E, 0x424A, 0x5B0D, 0x8473, 0x8432, 0x6B90, 0x634E, 
-0x5B0D, 0x5B0D, 0x5AED, 0x39E8, 0x18E4, 0x3166, 0x4229, 0x4229, 0x4229, 0x4A8B, 0x4AAB, 0x4ACB, 0x5B2D, 0x638E, 0x6BAF, 0x6BCF, 
-0x7451, 0x84D3, 0x9555, 0xA5B6, 0xAE18, 0xBE99, 0xCEFB, 0xD73C, 0xDF7D, 0xE7BE, 0xEFDF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7FF, 0xEFBE, 0xC6BA, 0x9DD7, 0x8555, 0x74F3, 0x8D95, 0xC71B, 0xE7DE, 0xE7BE, 0xEFBE, 0xEFDF, 0xEFDF, 0xEFDF, 0xF7DF, 
-0xF7DF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7DF, 0xF7DF, 0xEF9E, 0xDF1C, 0xE77D, 0xF7FF, 0xF7DF, 0xEFDF, 0xE7BE, 0xE79E, 
-0xDF9E, 0xDF7E, 0xDF7D, 0xD77D, 0xD77D, 0xD77E, 0xD77E, 0xD77E, 0xD79E, 0xD79E, 0xDFBE, 0xDFDF, 0xDFDF, 0xDFFF, 0xDFDF, 0xDFBF, 
-0xD7DF, 0xD79E, 0xCF7D, 0xCF3D, 0xC71C, 0xBEDB, 0xB6BA, 0xAE7A, 0xAE39, 0xA5F8, 0x9596, 0x9555, 0x8514, 0x7CB3, 0x7471, 0x6C10, 
-0x63AE, 0x5B4D, 0x534D, 0x63CF, 0x7471, 0x7C92, 0x7451, 0x6C10, 0x638E, 0x52EC, 0x428A, 0x3AAA, 0x42CB, 0x538D, 0x7491, 0x84F2, 
-0x84D1, 0x7CD1, 0x8533, 0x8DB5, 0x8595, 0x7514, 0x4BF1, 0x228C, 0x01AA, 0x09EA, 0x3B0D, 0x6C31, 0x7450, 0x4289, 0x08A2, 0x0000, 
-0x0041, 0x5AEB, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x9D15, 0x424A, 0x424A, 0x636F, 0x6BD0, 0x636F, 0x5B2E, 0x5B4E, 
-0x636E, 0x6BCF, 0x63AE, 0x532C, 0x5B6D, 0x8492, 0x9D34, 0x9D75, 0xA5B6, 0xADF7, 0xB638, 0xBE79, 0xC6DA, 0xCF1B, 0xD73C, 0xDF5D, 
-0xE79D, 0xE7BE, 0xEFDF, 0xEFFF, 0xEFFF, 0xEFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7DF, 0xF7DF, 0xF7DF, 0xF7DF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFBE, 0xEFBE, 
-0xE79E, 0xE79E, 0xD75C, 0xAE59, 0x95D7, 0x8555, 0x7CF3, 0x9DF7, 0xCF3C, 0xD79D, 0xD75D, 0xD75D, 0xD75D, 0xDF7D, 0xDF7D, 0xDF7D, 
-0xDF7D, 0xDF7D, 0xE79E, 0xE79E, 0xE7BE, 0xE7BE, 0xEFBE, 0xEFBE, 0xE79E, 0xD73C, 0xDF5D, 0xE7BE, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 
-0xDF7E, 0xDF7D, 0xD75D, 0xD75D, 0xCF3C, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xD77D, 0xCF5D, 0xCF7D, 0xCF7D, 0xCF7D, 
-0xD75D, 0xD75D, 0xD77E, 0xD77E, 0xD77E, 0xD77E, 0xD77E, 0xD77E, 0xCF7E, 0xCF7D, 0xCF7D, 0xCF7D, 0xCF5D, 0xCF5D, 0xCF5D, 0xC73C, 
-0xC71C, 0xC6FC, 0xBEFB, 0xBF1C, 0xC73C, 0xC71C, 0xC71C, 0xC73D, 0xCF3D, 0xCF3C, 0xC6DB, 0xB659, 0xA5D7, 0x9596, 0x9596, 0x95B6, 
-0x9595, 0x8D54, 0x8534, 0x8554, 0x8534, 0x7D14, 0x6472, 0x436E, 0x1A2B, 0x0169, 0x0989, 0x328B, 0x5B6E, 0x52CB, 0x18E3, 0x0000, 
-0x0000, 0x1904, 0x9CD3, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x6BAF, 0x3A09, 0x428B, 0x636E, 0x638F, 0x6BD0, 0x84B3, 0x9535, 
-0xBE38, 0xC69A, 0xBE99, 0xC6DA, 0xDF5D, 0xEFBE, 0xEFDF, 0xEFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 
-0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7DF, 0xF7FF, 0xF7DF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFDF, 0xE7DF, 
-0xE7BE, 0xEFDE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE79E, 0xDF9E, 0xDF9D, 0xDF7D, 0xDF7D, 0xD77D, 0xD77D, 0xD75C, 
-0xCF5C, 0xCF3C, 0xC6FB, 0xA618, 0x95D6, 0x8555, 0x7CD3, 0xA618, 0xC71B, 0xCF1B, 0xC6FB, 0xC6FB, 0xC71B, 0xC71B, 0xC6FB, 0xCF1B, 
-0xCF1C, 0xCF1B, 0xCF1C, 0xCF3C, 0xCF3C, 0xD73C, 0xD75C, 0xD75D, 0xD75C, 0xC6FB, 0xC71B, 0xCF5C, 0xD75C, 0xD75C, 0xD75D, 0xD77D, 
-0xDF7D, 0xDF7D, 0xD75D, 0xD75D, 0xCF3C, 0xCF3C, 0xCF3C, 0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC6FB, 0xC6FB, 0xC6FC, 
-0xC6FC, 0xC71C, 0xCF1C, 0xCF1C, 0xC71C, 0xCF3C, 0xC73C, 0xC73C, 0xC71C, 0xC71C, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 
-0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xC73D, 0xC73C, 0xC73D, 0xCF3D, 0xCF3D, 0xCF7D, 0xD79E, 0xDFBE, 0xD79E, 0xCF3D, 0xC71C, 0xC71C, 
-0xC71C, 0xC6FC, 0xBEDB, 0xBEDB, 0xBEBA, 0xB69A, 0xB67A, 0xA618, 0x8515, 0x4B90, 0x222B, 0x2A2A, 0x4ACC, 0x5AEC, 0x31A7, 0x0021, 
-0x0000, 0x0000, 0x528A, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xAD96, 0x4AEB, 0x534D, 0x7C51, 0x9D55, 0xB618, 0xC69A, 0xD71C, 0xEFBE, 
-0xF7FF, 0xE79E, 0xDF7D, 0xEFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xF7FF, 0xEFDF, 0xEFDF, 0xEFDF, 
-0xE7DF, 0xE7DE, 0xE7DE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9D, 0xDF9D, 0xDF7D, 
-0xDF7D, 0xDF7D, 0xDF7D, 0xD77D, 0xD75C, 0xD75C, 0xD75C, 0xD75C, 0xCF3C, 0xCF3C, 0xCF3C, 0xC73C, 0xC73C, 0xC71B, 0xC71B, 0xBEFB, 
-0xBEFB, 0xBEFA, 0xB6BA, 0xA617, 0x95B6, 0x8534, 0x7CF3, 0xA638, 0xBEDA, 0xBEDA, 0xB6BA, 0xB6BA, 0xB6BA, 0xB6BA, 0xB6BA, 0xB6BA, 
-0xB6BA, 0xB6BA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEFB, 0xC6FB, 0xBEFB, 0xB699, 0xB6BA, 0xBEFB, 0xC6FB, 0xC6FB, 0xC71C, 0xCF3C, 
-0xD73C, 0xD73C, 0xD73C, 0xCF3C, 0xCF3C, 0xCF1C, 0xCF1C, 0xC71C, 0xC71C, 0xC71C, 0xC6FB, 0xC6FB, 0xC6FB, 0xC6FB, 0xBEFB, 0xBEFB, 
-0xBEDB, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 
-0xBEDB, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEFB, 0xC6FC, 0xBEFB, 0xBEDB, 0xBEFB, 0xBEDB, 0xC6FC, 0xCF5D, 0xCF7D, 0xCF5D, 0xC71C, 0xBEFB, 
-0xBEFC, 0xC73C, 0xC71C, 0xC73C, 0xC73C, 0xC71C, 0xC73C, 0xC71C, 0xBEFB, 0xAE9A, 0x9DF8, 0x9597, 0x9576, 0x9555, 0x84B3, 0x5B6E, 
-0x3A49, 0x29C7, 0x3A49, 0x9D34, 0xE73C, 0xEF9E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xADB7, 0x9D75, 0xBE58, 0xD71B, 0xE79D, 0xEFFF, 0xF7FF, 0xF7FF, 0xF7FF, 
-0xD77D, 0xBE99, 0xCF1B, 0xE7BE, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 0xDF9E, 0xDF9D, 0xDF9E, 0xDF9E, 0xDF9D, 0xDF9D, 0xDF9D, 0xDF9D, 
-0xD77D, 0xD77D, 0xD77D, 0xD77D, 0xD77D, 0xD77D, 0xD77D, 0xD75D, 0xD75D, 0xCF5D, 0xCF5C, 0xCF3C, 0xCF1C, 0xCF1C, 0xCF1C, 0xCF1C, 
-0xC71B, 0xC71B, 0xC71B, 0xC71B, 0xC71B, 0xC6FB, 0xBEFB, 0xBEFB, 0xBEFA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEBA, 0xB6BA, 0xB699, 
-0xAE99, 0xAE99, 0xAE99, 0xA658, 0x95D6, 0x7D13, 0x7CF3, 0xA617, 0xB6B9, 0xAE99, 0xAE78, 0xAE78, 0xAE78, 0xAE79, 0xAE78, 0xAE79, 
-0xAE79, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xB699, 0xB6B9, 0xB699, 0xAE58, 0xAE58, 0xB699, 0xBEBA, 0xBEBA, 0xBEBA, 0xBEDB, 
-0xC6FB, 0xC6FB, 0xC71C, 0xCF1C, 0xCF1C, 0xC71C, 0xC6FC, 0xC6FB, 0xBEFB, 0xBEFB, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 
-0xB6DB, 0xB6BB, 0xB6BA, 0xB6BA, 0xB6BA, 0xBEBB, 0xB6BA, 0xB69A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 
-0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAEBA, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB6DA, 0xBEFB, 0xB6DB, 0xAE9A, 
-0xA659, 0xA659, 0xA679, 0xA679, 0xAE79, 0xAE79, 0xAE9A, 0xAE9A, 0xB69A, 0xB6DA, 0xBEFB, 0xB6BB, 0xAE7A, 0xB6BA, 0xBEFB, 0xB6BA, 
-0xA618, 0x9DB6, 0x8D55, 0xA5D7, 0xB679, 0xBE79, 0xBE79, 0xC6BA, 0xE77D, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEFBE, 0xE79E, 0xEFDF, 0xF7FF, 0xF7FF, 0xEFFF, 0xE7BE, 0xE7BE, 0xEFFF, 0xE7BE, 
-0xC6DB, 0xBE9A, 0xDF7D, 0xE7BE, 0xD75D, 0xD73C, 0xCF3C, 0xCF5C, 0xCF5C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF1C, 
-0xCF1C, 0xCF1B, 0xC71B, 0xC71B, 0xC71B, 0xC71B, 0xC6FB, 0xBEFB, 0xBEFB, 0xBEFB, 0xBEFA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xB6BA, 
-0xB6BA, 0xB6BA, 0xB6BA, 0xB6BA, 0xB6BA, 0xB6B9, 0xB699, 0xB699, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE79, 0xAE79, 0xAE78, 0xAE78, 
-0xA678, 0xA658, 0xA678, 0xA658, 0x9E17, 0x8554, 0x7D13, 0x9E17, 0xAE79, 0xA658, 0xA658, 0xA658, 0xA658, 0xA638, 0xA637, 0xA658, 
-0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xAE78, 0xAE58, 0xA638, 0xA638, 0xA658, 0xAE99, 0xAE79, 0xB699, 0xB6BA, 
-0xB6BA, 0xB6BA, 0xBEDA, 0xBEFB, 0xC6FB, 0xC6FB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDB, 0xB6BB, 0xB6BA, 0xB6BA, 0xB6BA, 
-0xAEBA, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE79, 0xA659, 0xA659, 0xA659, 0xA659, 0xA659, 0xA659, 0xA659, 0xA659, 
-0xA679, 0xA659, 0xA659, 0xA679, 0xA679, 0xA679, 0xA679, 0xA679, 0xA659, 0xA659, 0xA679, 0xA679, 0xAE79, 0xAE99, 0xAE9A, 0xA679, 
-0x9E38, 0x95F7, 0x9617, 0x9E18, 0x9617, 0x9E18, 0x9E38, 0x9E38, 0x9E18, 0xA618, 0xA659, 0xA639, 0x9E39, 0xA679, 0xB6BA, 0xC73C, 
-0xC75D, 0xC75D, 0xC75D, 0xBEFB, 0xB6BA, 0xB69A, 0xB679, 0xBEBA, 0xC6DB, 0xD71C, 0xE79E, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xEFBE, 0xEFDF, 0xE7BE, 0xDFBE, 0xDF9E, 0xDF7D, 0xE7BE, 0xEFFF, 0xEFFF, 0xF7FF, 0xD73D, 
-0xBE9A, 0xD71C, 0xE79E, 0xDF5D, 0xCF3C, 0xBEFB, 0xBEFA, 0xBEFB, 0xBEDB, 0xBEDB, 0xBEDB, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xB6DA, 
-0xBEDA, 0xB6BA, 0xB6BA, 0xB6DA, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6BA, 0xAEB9, 0xAEB9, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE78, 
-0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA658, 0xA657, 
-0xA658, 0xA658, 0xA657, 0xA658, 0xA658, 0x8DB5, 0x7D33, 0x9DF6, 0xA678, 0x9E37, 0x9E37, 0x9E37, 0xA637, 0xA637, 0xA637, 0x9E57, 
-0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA678, 0xA678, 0xA678, 0xA678, 0xA658, 0x9E38, 0xA658, 0xAE99, 0xAE99, 0xAE99, 0xAEB9, 
-0xB6BA, 0xB6BA, 0xBEDA, 0xBEDB, 0xBEFB, 0xC6FB, 0xC6FB, 0xC71C, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEFB, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEDB, 
-0xB6DB, 0xB6DB, 0xB6DB, 0xB6BA, 0xAE9A, 0xAE9A, 0xAE9A, 0xA679, 0xA659, 0xA659, 0xA659, 0x9E38, 0x9E38, 0x9E38, 0x9E38, 0x9E38, 
-0x9E38, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x9E38, 0x9E38, 0x9E38, 0x9E18, 0x9E18, 0x9E38, 0xA638, 0xA639, 
-0x9E18, 0x95D7, 0x95D6, 0x8DD6, 0x95D7, 0x95D7, 0x8DD6, 0x95D7, 0x8DF6, 0x8DD7, 0x8DD7, 0x95F6, 0x95F7, 0x8DB7, 0x95F8, 0xA679, 
-0xAE9A, 0xAE7A, 0xAE9A, 0xAE9A, 0xAE9A, 0xAE7A, 0xAE9A, 0xAE79, 0xA659, 0xA618, 0xB679, 0xDF3C, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xEF9E, 0xE7BE, 0xDF7D, 0xD75D, 0xCF5C, 0xCF3C, 0xD75C, 0xDF9D, 0xE7BF, 0xD77D, 0xBE79, 0x9DB5, 
-0x9E38, 0xBF1B, 0xBF1B, 0xBEFA, 0xBEDA, 0xB679, 0xB6BA, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE79, 
-0xAE79, 0xAE79, 0xAE78, 0xAE78, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA658, 0xA678, 0xA658, 
-0xA658, 0xA658, 0xA658, 0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA678, 0xA658, 0xA678, 0xA658, 0xA658, 0xA678, 0xA658, 0xA658, 
-0xA657, 0x9E37, 0x9E37, 0x9E57, 0xA658, 0x95D6, 0x7D33, 0x95F6, 0xA658, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E17, 0x9E17, 0x9E17, 
-0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x95F6, 0x9E17, 0x9E37, 0x9E38, 0x9E38, 0x9E58, 
-0xA658, 0xA658, 0xA658, 0xAE79, 0xAE99, 0xB699, 0xB699, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xAE9A, 0xAE9A, 
-0xAE9A, 0xAE9A, 0xAE7A, 0xAE7A, 0xAE79, 0xAE59, 0xA659, 0xA659, 0xA659, 0xA638, 0x9E38, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 
-0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x95F7, 0x95F7, 0x9617, 0x9617, 0x9617, 0x9617, 0x9617, 0x95F7, 0x95F7, 0x95F7, 0x95F7, 0x9617, 
-0x95F8, 0x95D7, 0x8D96, 0x8D96, 0x8D96, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8D96, 0x8595, 0x8DD6, 
-0x95F7, 0x9E18, 0x9E18, 0x9DF8, 0x9E18, 0x9E18, 0x9DF8, 0x9DF8, 0x9DF7, 0x95F7, 0x95F7, 0x9DF7, 0xBEBA, 0xEFBE, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0xE77D, 0xD75D, 0xCF3C, 0xCF1C, 0xC6FB, 0xCEFC, 0xCF5C, 0xCF1C, 0x9DD5, 0x6C2D, 0x538C, 0x64B0, 
-0x9657, 0xAEFA, 0xAE99, 0x9E58, 0xA678, 0xA698, 0x9E78, 0xA678, 0xA678, 0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 
-0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0x9E58, 0xA658, 0xA658, 0xA658, 0xA658, 0x9E58, 
-0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E17, 0x9E16, 0x9E16, 0x95F6, 0x9E16, 
-0x9E16, 0x9616, 0x9E37, 0xA637, 0x9DF7, 0x8D74, 0x74D2, 0x8D95, 0x95D5, 0x8DB5, 0x8D94, 0x8D94, 0x8594, 0x8574, 0x8574, 0x8574, 
-0x8553, 0x8553, 0x8553, 0x7D33, 0x7D33, 0x7D33, 0x7D13, 0x7D12, 0x7D12, 0x7512, 0x74F1, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 
-0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x7CF2, 0x7CF2, 0x7CF2, 0x7CF2, 0x74F2, 0x74D2, 0x74F2, 0x74F2, 0x7D13, 0x7D13, 0x7D13, 
-0x7D13, 0x7D13, 0x7D33, 0x7D34, 0x7D34, 0x7D54, 0x7D54, 0x7D54, 0x7D54, 0x8554, 0x8534, 0x8534, 0x8554, 0x8574, 0x8594, 0x8574, 
-0x8D96, 0x8D96, 0x8DB6, 0x8DB6, 0x8DD6, 0x8DD6, 0x8DD7, 0x8DD7, 0x95D7, 0x95D7, 0x95F7, 0x95F7, 0x95F7, 0x95F7, 0x95F7, 0x95F7, 
-0x95F7, 0x8DF7, 0x8DD6, 0x8DB6, 0x8DB6, 0x85B6, 0x85B6, 0x85B6, 0x8DB6, 0x8DB6, 0x8D95, 0x8595, 0x8DB6, 0x8595, 0x8575, 0x8595, 
-0x8DD6, 0x95D6, 0x95D6, 0x95D6, 0x95D6, 0x8DD6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8596, 0x8596, 0x8D96, 0x95B6, 0xB679, 0xE79E, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xF7DF, 0xE79E, 0xD73C, 0xC6DB, 0xBEFB, 0xBEDA, 0xBEDA, 0xC71B, 0xBF1B, 0x9595, 0x42E9, 0x19A4, 0x22A9, 0x6C90, 
-0xC4D2, 0xC431, 0xB513, 0x9E17, 0x9E58, 0xA678, 0xA657, 0xA658, 0x9E58, 0x9E58, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA678, 
-0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA658, 0x9E58, 0x9E57, 0x9E57, 0x9E37, 0x9E37, 0x9E17, 0x9616, 0x95F6, 0x95F6, 0x95D6, 
-0x8DB5, 0x8DB4, 0x8D94, 0x8574, 0x8573, 0x8553, 0x7D33, 0x7D33, 0x7D12, 0x7D12, 0x74F2, 0x74F2, 0x74F2, 0x74D1, 0x74F1, 0x7D33, 
-0x8DB5, 0x8DD5, 0x9E17, 0xA617, 0xA5F6, 0x8513, 0x5C0F, 0x6CB1, 0x74F2, 0x74F1, 0x74F1, 0x74F1, 0x74F1, 0x74F2, 0x74F2, 0x74F2, 
-0x74F2, 0x74F2, 0x74F2, 0x74F1, 0x74F1, 0x74D1, 0x74D1, 0x6CD1, 0x74D1, 0x6CD0, 0x6CB0, 0x6CB0, 0x6CB0, 0x6CB1, 0x6CB0, 0x6CB0, 
-0x6CB1, 0x6CB1, 0x6490, 0x6490, 0x6490, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 
-0x6470, 0x6450, 0x5C50, 0x5C4F, 0x5C2F, 0x542F, 0x540E, 0x540E, 0x540E, 0x53EE, 0x53CD, 0x53CE, 0x53CE, 0x53CD, 0x53ED, 0x53EE, 
-0x5BEE, 0x5C0E, 0x642F, 0x644F, 0x6C70, 0x6C90, 0x6C91, 0x74B1, 0x74F2, 0x74F3, 0x7D13, 0x7D34, 0x8554, 0x8575, 0x8D75, 0x8D96, 
-0x8DD6, 0x8DD6, 0x8DD6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8595, 0x8575, 
-0x8D95, 0x8DD6, 0x8DB6, 0x8DB6, 0x8DB6, 0x85B6, 0x8595, 0x8595, 0x8575, 0x8575, 0x8555, 0x7D55, 0x7D54, 0x8575, 0xB659, 0xEF9E, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xEF9E, 0xD73C, 0xC6DB, 0xB699, 0xB6BA, 0xB6B9, 0xAE99, 0xBEDA, 0xA678, 0x6C4F, 0x2164, 0x08C2, 0x2268, 0x9B4B, 
-0xD9A7, 0xB8A3, 0xAA29, 0xA534, 0xA679, 0xA658, 0x9E78, 0x9658, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E16, 0x9616, 0x95F6, 0x95D5, 
-0x95B5, 0x8DB5, 0x8D94, 0x8574, 0x8574, 0x8553, 0x8553, 0x7D33, 0x7D32, 0x7D32, 0x7D12, 0x7512, 0x74F2, 0x74F1, 0x74F1, 0x74F1, 
-0x74F1, 0x74D1, 0x74D1, 0x74D1, 0x74D1, 0x74D1, 0x74D1, 0x74D1, 0x74F1, 0x74F2, 0x74F2, 0x7CF2, 0x7CF2, 0x7D12, 0x8533, 0x8D94, 
-0x95F6, 0x95F6, 0x9E37, 0xA637, 0xA637, 0x8533, 0x53AE, 0x6CB1, 0x8574, 0x8573, 0x8594, 0x8D94, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DB5, 
-0x95B5, 0x95B5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D6, 0x95D6, 0x95D6, 0x8DB5, 0x8DB5, 0x95D6, 0x95D6, 0x95D6, 
-0x95D6, 0x95D6, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8D95, 0x8DB5, 0x95B5, 0x95B6, 0x95D6, 0x95B6, 0x95B6, 0x95B6, 
-0x95D6, 0x95B6, 0x95B6, 0x8D95, 0x8D74, 0x8574, 0x7D34, 0x7D33, 0x7512, 0x74F2, 0x6CD2, 0x64B1, 0x6470, 0x5C2F, 0x5BEE, 0x53AD, 
-0x53AC, 0x538C, 0x538C, 0x538C, 0x53AC, 0x53AC, 0x53AC, 0x53AD, 0x53CD, 0x53CD, 0x5BED, 0x5BEE, 0x5C0E, 0x642F, 0x642F, 0x644F, 
-0x6470, 0x6C91, 0x6C91, 0x6C91, 0x74B1, 0x74D2, 0x74F2, 0x7CF2, 0x7D13, 0x7D13, 0x7D33, 0x7D34, 0x7D54, 0x8554, 0x8575, 0x8575, 
-0x8595, 0x8DB6, 0x8DB6, 0x8DB6, 0x8DB6, 0x8596, 0x8596, 0x8596, 0x8595, 0x8575, 0x8555, 0x7D34, 0x7D55, 0x7534, 0x8535, 0xBE7A, 
-0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xEFBE, 0xDF5D, 0xCF1C, 0xBEBA, 0xB69A, 0xB6B9, 0xAE99, 0xAE7A, 0xB6DA, 0x9E37, 0x5BEE, 0x2144, 0x0000, 0x1964, 0xA9A6, 
-0xE820, 0xA800, 0x90A3, 0x9471, 0x8E57, 0x8D95, 0x8594, 0x8554, 0x7D33, 0x7D33, 0x7D32, 0x7D12, 0x7D12, 0x74F2, 0x74F1, 0x74F1, 
-0x74D1, 0x74D1, 0x74D1, 0x74B1, 0x74B1, 0x74D1, 0x74D1, 0x74D1, 0x74D1, 0x74F1, 0x74F2, 0x74F2, 0x7D12, 0x7D12, 0x7D33, 0x7D53, 
-0x8554, 0x8574, 0x8574, 0x8D94, 0x95B5, 0x95D5, 0x95F6, 0x95F6, 0x9E16, 0x9E17, 0xA637, 0xA657, 0xA657, 0xA658, 0xAE98, 0xAE98, 
-0x9E77, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x8553, 0x5BEE, 0x8D54, 0xAE99, 0xAE79, 0xAE99, 0xB699, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 
-0xB6BA, 0xB6BA, 0xB6DA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEFB, 0xBEFB, 0xBEBA, 0xB6BA, 0xC6FB, 0xC71B, 0xC6FB, 
-0xC71B, 0xC71B, 0xC6FB, 0xC6FB, 0xBEFB, 0xBEFB, 0xBEDB, 0xBEDB, 0xBEFB, 0xBEFB, 0xC6FB, 0xC71C, 0xCF3C, 0xCF3C, 0xCF5D, 0xD75D, 
-0xD77D, 0xD77D, 0xD77D, 0xD77D, 0xD77D, 0xD75D, 0xCF5D, 0xCF7D, 0xCF5D, 0xC73C, 0xBEFB, 0xAE9A, 0xA658, 0x9E18, 0x95D6, 0x8554, 
-0x7D13, 0x7CF3, 0x74D2, 0x74D2, 0x6CB1, 0x6C91, 0x6470, 0x6470, 0x644F, 0x644F, 0x5C2E, 0x5C0E, 0x5C0E, 0x5BEE, 0x53ED, 0x53ED, 
-0x53CD, 0x53CD, 0x53CD, 0x53CD, 0x53ED, 0x53ED, 0x53ED, 0x5BED, 0x5C0D, 0x5BED, 0x5C0E, 0x5C2E, 0x5C2E, 0x644F, 0x644F, 0x646F, 
-0x6C70, 0x6C91, 0x74B1, 0x74D2, 0x74F2, 0x74F2, 0x7D13, 0x7D13, 0x7D34, 0x7D34, 0x8555, 0x7D34, 0x7D55, 0x7D55, 0x7D34, 0x8D96, 
-0xCEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xE77D, 0xD73C, 0xBEDA, 0xAE99, 0xAE78, 0xA658, 0x9E37, 0x9E17, 0x9E78, 0x95F6, 0x6450, 0x29E7, 0x0041, 0x19E6, 0x928A, 
-0xC8A2, 0x9800, 0x8165, 0x7C90, 0x75B4, 0x6CF1, 0x6CD0, 0x74B0, 0x74B1, 0x74B1, 0x74B1, 0x74D1, 0x74D1, 0x74F1, 0x7D12, 0x7D12, 
-0x8553, 0x8553, 0x8574, 0x8594, 0x8DB4, 0x8DD5, 0x95D5, 0x95F5, 0x9DF6, 0x9E17, 0x9E37, 0xA637, 0xA658, 0xA658, 0xA678, 0xAE78, 
-0xAE78, 0xAE99, 0xAE99, 0xAE99, 0xAEB9, 0xB6B9, 0xB6B9, 0xB6DA, 0xB6B9, 0xB6B9, 0xB6BA, 0xB6DA, 0xB6DA, 0xBEDA, 0xB6DA, 0xB6B9, 
-0xA658, 0x95F6, 0x9DF6, 0x9616, 0x9637, 0x7D54, 0x6450, 0x9DD6, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEFA, 0xBEFA, 0xBEFB, 0xBEFB, 0xC6FB, 
-0xC71B, 0xC71B, 0xC71B, 0xC71B, 0xCF3C, 0xCF3C, 0xCF5C, 0xCF5C, 0xD75C, 0xD77D, 0xD77D, 0xCF3C, 0xCF3C, 0xDF9D, 0xE7BE, 0xE79E, 
-0xE79E, 0xE79E, 0xDF9D, 0xDF9D, 0xDF7D, 0xDF7D, 0xDF7D, 0xD75D, 0xD77D, 0xD77D, 0xDF7D, 0xDF7D, 0xDF9D, 0xDF9E, 0xE7BE, 0xE7BE, 
-0xEFDF, 0xEFDF, 0xEFDF, 0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF, 0xE79F, 0xCEDC, 0xB639, 0xADF8, 0xA5F8, 0xAE39, 0xA659, 0x9E58, 
-0x9618, 0x95F8, 0x95F7, 0x8DD7, 0x8DD6, 0x8DD6, 0x8DB6, 0x8DB6, 0x8D96, 0x8595, 0x8575, 0x8554, 0x7D54, 0x7D34, 0x7D13, 0x7513, 
-0x74F2, 0x74D2, 0x6CB1, 0x6CB1, 0x6C90, 0x646F, 0x644F, 0x5C2F, 0x5C0E, 0x5BEE, 0x5BED, 0x53ED, 0x53CD, 0x53CD, 0x53AC, 0x4BAC, 
-0x53AC, 0x53AC, 0x53AC, 0x53AC, 0x53CD, 0x5BCD, 0x5BED, 0x5BED, 0x640F, 0x642F, 0x6C50, 0x6C50, 0x6C71, 0x6C91, 0x6CB1, 0x6CB1, 
-0x9DB5, 0xDF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xEFBE, 0xCEFB, 0xB699, 0x9E17, 0x8DB5, 0x8DB5, 0x8574, 0x8574, 0x8573, 0x8573, 0x8D94, 0x8D95, 0x7CF3, 0x63EF, 0x6CD2, 0x9554, 
-0x93ED, 0x7A69, 0x73AD, 0x7532, 0x8574, 0x8D94, 0x95B5, 0x95F5, 0x95F6, 0x95F6, 0x9DF6, 0x9E17, 0x9E17, 0x9E37, 0xA657, 0xA658, 
-0xA678, 0xA678, 0xA678, 0xAE98, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAEB9, 0xAEB9, 0xAEB9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 
-0xB6B9, 0xB6BA, 0xB6BA, 0xB6DA, 0xB6DA, 0xB6BA, 0xB6BA, 0xB6DA, 0xB6DA, 0xB6BA, 0xB6BA, 0xB6DA, 0xB6DA, 0xB6DA, 0xB6DA, 0xB699, 
-0xA678, 0x9E17, 0x9E17, 0x9E37, 0x9E58, 0x8D95, 0x74D2, 0xA637, 0xBEFA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEFA, 0xBEFB, 0xBEFB, 0xC6FB, 
-0xC71B, 0xC71B, 0xCF1C, 0xCF3C, 0xCF3C, 0xD73C, 0xD75D, 0xD75D, 0xDF7D, 0xDF7D, 0xDF9D, 0xD75C, 0xD73C, 0xE79E, 0xEFBE, 0xEFBE, 
-0xEFBE, 0xEFDE, 0xEFBE, 0xEFBE, 0xEFBE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 0xE7BE, 0xE7BE, 
-0xE7BE, 0xEFBE, 0xE7BE, 0xEFDF, 0xEFDF, 0xEFFF, 0xE7BF, 0xCEDB, 0xAD76, 0x8451, 0x6B6E, 0x634D, 0x73AF, 0x8472, 0x8514, 0x8D75, 
-0x8DB6, 0x8DD6, 0x95D7, 0x95D7, 0x95D7, 0x95F7, 0x95F7, 0x95F7, 0x95F8, 0x95F8, 0x95F8, 0x95F8, 0x95F7, 0x95F7, 0x95F7, 0x95F7, 
-0x95D7, 0x8DD7, 0x8DB6, 0x8DB6, 0x8DB6, 0x8595, 0x8575, 0x8575, 0x8555, 0x7D34, 0x7D34, 0x7D13, 0x74F3, 0x74F2, 0x6CD2, 0x6CB2, 
-0x6C90, 0x6C70, 0x6450, 0x644F, 0x5C2E, 0x5BEE, 0x53CD, 0x53CD, 0x53AC, 0x53AC, 0x4B6C, 0x4B6B, 0x4B6C, 0x4B6B, 0x4B6C, 0x4B8C, 
-0x5C0F, 0xA5D6, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xD71B, 0xA5F6, 0x8D53, 0x7D12, 0x74F1, 0x7D32, 0x8553, 0x8594, 0x85B4, 0x8574, 0x8574, 0xA637, 0xCF3C, 0xCF7C, 0xBF1B, 0xA699, 
-0x85D5, 0x8594, 0x7D54, 0x7D73, 0x95F6, 0xAE78, 0xAE99, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xB6DA, 0xB6DA, 0xB6B9, 0xB6B9, 0xAEB9, 
-0xB699, 0xB699, 0xB6BA, 0xB6BA, 0xB6BA, 0xB699, 0xB699, 0xB699, 0xB6B9, 0xB6B9, 0xB699, 0xB699, 0xB6B9, 0xB699, 0xB699, 0xB699, 
-0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB699, 0xB699, 0xB6B9, 
-0xAE99, 0xAE99, 0xAE78, 0xAE78, 0xAE99, 0x95D6, 0x8533, 0xA658, 0xBEDA, 0xB6BA, 0xB6BA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEFA, 0xBEFB, 
-0xC6FB, 0xC71B, 0xC71B, 0xCF1C, 0xCF3C, 0xD73C, 0xD75C, 0xD75D, 0xDF7D, 0xDF7D, 0xDF9E, 0xD75D, 0xD73C, 0xE79E, 0xEFDF, 0xEFDF, 
-0xF7DF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFBF, 0xEFBF, 0xE7BE, 0xE7BE, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 0xE79E, 0xDF9E, 0xDF9E, 0xDF9E, 
-0xE79E, 0xDF9E, 0xDF9D, 0xE7BE, 0xDF9E, 0xDF9E, 0xCEBB, 0x94F5, 0x630C, 0x4228, 0x39C6, 0x39E7, 0x5289, 0x6B6D, 0x7BF0, 0x7C51, 
-0x74F3, 0x7D33, 0x8575, 0x8595, 0x8D96, 0x8DB6, 0x8DB6, 0x95D7, 0x95D7, 0x95D7, 0x95F7, 0x95F7, 0x9E18, 0x9E18, 0x9E18, 0x9E38, 
-0x9E38, 0x9E38, 0x9E38, 0x9E38, 0x9638, 0x9618, 0x9618, 0x9618, 0x9618, 0x9618, 0x8E17, 0x95F7, 0x8DF7, 0x8DF7, 0x8DD6, 0x8DB6, 
-0x85B6, 0x8596, 0x8595, 0x7D75, 0x7D55, 0x7D34, 0x7D14, 0x74F3, 0x6CD2, 0x6CB1, 0x6491, 0x6450, 0x5C2F, 0x5C2F, 0x53EE, 0x5BEE, 
-0x540F, 0x8CF3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xCF1B, 0xAE17, 0x9DF6, 0x95D6, 0x9DF6, 0xA638, 0xAE58, 0xAE79, 0xAE99, 0xA678, 0x95D5, 0x8553, 0x8DB4, 0x9E16, 0x8D94, 0x7CF2, 
-0x7532, 0x7573, 0x7D53, 0x8DB4, 0xA657, 0xB6B9, 0xB6DA, 0xB6BA, 0xB6BA, 0xB6B9, 0xB6B9, 0xB6B9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 
-0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAEB9, 0xAEB9, 0xAEB9, 0xB6B9, 0xB6B9, 0xB6B9, 0xAEB9, 0xAEB9, 0xB699, 0xB699, 0xB699, 0xB699, 0xB699, 0xAE99, 0xAE99, 0xB699, 
-0xB699, 0xAE99, 0xB6B9, 0xB6DA, 0xAEB9, 0x95D6, 0x8554, 0xA658, 0xB6DA, 0xB6BA, 0xB6BA, 0xB6BA, 0xBEDA, 0xBEDA, 0xBEDA, 0xBEFA, 
-0xBEFB, 0xC71B, 0xC71B, 0xCF1C, 0xCF3C, 0xD73C, 0xD75C, 0xD75D, 0xD77D, 0xDF7D, 0xDF9E, 0xD75D, 0xD75C, 0xE79E, 0xEFDF, 0xEFDF, 
-0xF7DF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFBE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE79E, 0xE79E, 0xE79E, 0xDF9E, 0xDF7D, 0xDF7D, 0xDF7D, 
-0xD79D, 0xDF5E, 0xDF5D, 0xCF7C, 0xD77D, 0xCEDD, 0xA535, 0x6B4E, 0x4A69, 0x4208, 0x4229, 0x4A4A, 0x4249, 0x5B0B, 0x7BEE, 0x842F, 
-0x7C30, 0x6C91, 0x6CF2, 0x74F2, 0x7D13, 0x7D54, 0x8554, 0x8575, 0x8D95, 0x8DB6, 0x8DB6, 0x95D7, 0x95F7, 0x95F7, 0x95F7, 0x95F7, 
-0x95F7, 0x95F7, 0x95F7, 0x9E18, 0x9E18, 0x9E18, 0x9E18, 0x9E38, 0x9E18, 0x9658, 0x9638, 0x9618, 0x9638, 0x9E38, 0x9E18, 0x9638, 
-0x9618, 0x9618, 0x9618, 0x9618, 0x95F8, 0x95F8, 0x8DF7, 0x8DB7, 0x8DB6, 0x8596, 0x8575, 0x7D55, 0x7D54, 0x7D34, 0x7D34, 0x8555, 
-0x8575, 0x9596, 0xB659, 0xE77E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xDF7D, 0xCF1B, 0xCF1B, 0xC71B, 0xCF1B, 0xCF3C, 0xCF3C, 0xC71B, 0xC71B, 0xC71B, 0xAE78, 0x8553, 0x6C90, 0x646F, 0x5C2E, 0x5C2E, 
-0x6CD1, 0x7D53, 0x8D94, 0x9E16, 0xAE78, 0xB6B9, 0xB6B9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xAE99, 0xAEB9, 0xAEB9, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xB699, 0xB699, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xAE99, 0xB6B9, 0xAE99, 0x95B6, 0x8554, 0xA658, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6BA, 0xB6BA, 0xBEDA, 0xBEDA, 0xBEFA, 
-0xBEFB, 0xC71B, 0xC71B, 0xCF1B, 0xCF3C, 0xCF3C, 0xD75C, 0xD75D, 0xDF7D, 0xDF7D, 0xDF9E, 0xD75D, 0xD73C, 0xE79E, 0xEFDF, 0xEFDF, 
-0xEFDF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFDF, 0xEFBE, 0xE7BE, 0xE7BE, 0xE79E, 0xE79E, 0xDF9E, 0xDF7D, 0xDF7D, 0xDF7D, 0xD75D, 0xD75C, 
-0xCF5C, 0xD71C, 0xCF3C, 0xC71B, 0xC6DB, 0xB5D8, 0x738F, 0x632D, 0x5B0D, 0x5B0C, 0x7BEF, 0x8C92, 0x6B8F, 0x52AB, 0x6B6D, 0x8C50, 
-0x7C30, 0x640F, 0x6470, 0x6C90, 0x6CB1, 0x74D2, 0x74F2, 0x7D13, 0x7D54, 0x8554, 0x8554, 0x7D33, 0x74F3, 0x74F2, 0x74F2, 0x74D2, 
-0x74D2, 0x74D2, 0x74F2, 0x74F2, 0x7D13, 0x7D13, 0x7D13, 0x7D33, 0x8534, 0x7D54, 0x8574, 0x8575, 0x8575, 0x8D95, 0x8D96, 0x8DB6, 
-0x8DD6, 0x95F7, 0x95F7, 0x95F7, 0x9617, 0x9618, 0x9617, 0x9618, 0x95F7, 0x8DD7, 0x8DB6, 0x8595, 0x8595, 0x8595, 0x8DB6, 0x8DB6, 
-0x95D7, 0x9E18, 0xAE9A, 0xB6BB, 0xBE9A, 0xD6DB, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xE79E, 0xE79E, 0xDF7D, 0xD75D, 0xD77D, 0xD75D, 0xD75C, 0xCF3C, 0xC71B, 0xC71B, 0xBEDA, 0xA657, 0x95D5, 0x8574, 0x7D12, 0x7D12, 
-0x95D6, 0xA637, 0xA658, 0xAE79, 0xAE99, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE79, 0xAE79, 0xAE79, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAE79, 0xAE99, 0xAE99, 0xAEB9, 0xA658, 0x8D95, 0x8D74, 0xA678, 0xB699, 0xAE99, 0xB699, 0xB6B9, 0xB6BA, 0xB6BA, 0xBEDA, 0xBEDA, 
-0xBEDA, 0xBEFB, 0xC71B, 0xC71B, 0xCF1C, 0xCF3C, 0xD75C, 0xD75D, 0xDF7D, 0xDF7D, 0xDF9E, 0xD75D, 0xD75C, 0xE79E, 0xEFBF, 0xEFDF, 
-0xEFDF, 0xEFDF, 0xEFBF, 0xEFBE, 0xEFBE, 0xE7BE, 0xE79E, 0xE79E, 0xE79E, 0xDF7D, 0xDF7D, 0xD75D, 0xD75D, 0xD75C, 0xCF3C, 0xCF3C, 
-0xC71C, 0xC6FB, 0xBEDA, 0xB6BA, 0xAE39, 0x94D4, 0x5AEC, 0x73D0, 0x8C74, 0x8C93, 0xAD96, 0xAD97, 0x8C93, 0x5AEC, 0x5AEC, 0x8C50, 
-0x8C71, 0x6C0E, 0x640E, 0x644F, 0x6490, 0x6CB1, 0x6CB1, 0x74F2, 0x7513, 0x74F2, 0x6CB1, 0x6470, 0x5C2F, 0x5C2E, 0x5C2E, 0x5C0E, 
-0x5C0E, 0x5C0E, 0x5C0E, 0x5C0E, 0x5C0E, 0x5C2E, 0x5C2F, 0x642F, 0x642F, 0x644F, 0x6470, 0x6470, 0x6490, 0x6C91, 0x6CB1, 0x6CD1, 
-0x74D2, 0x74F2, 0x74F2, 0x7513, 0x7D13, 0x7D33, 0x7D34, 0x8574, 0x8D95, 0x8D95, 0x8D96, 0x8595, 0x8575, 0x8555, 0x8555, 0x7D54, 
-0x7D75, 0x8575, 0x8D96, 0x84F4, 0x6BEF, 0x8451, 0xBDD7, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 
-0xE7BE, 0xE7BE, 0xDF7D, 0xD75D, 0xD77D, 0xCF3C, 0xCF3C, 0xCF1C, 0xC71B, 0xBEFB, 0xBEDA, 0xB6BA, 0xB6B9, 0xAEB9, 0x95F6, 0x95D6, 
-0xAE58, 0xB699, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE79, 0xAE79, 0xAE79, 0xAE79, 0xAE79, 0xAE79, 0xAE79, 0xAE79, 
-0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 
-0xAE78, 0xAE78, 0xAE78, 0xAE99, 0x9E37, 0x8574, 0x8D95, 0xAE78, 0xAE99, 0xAE99, 0xAE99, 0xB699, 0xB6B9, 0xB6BA, 0xB6BA, 0xBEDA, 
-0xBEDA, 0xBEFB, 0xC71B, 0xC71B, 0xCF1C, 0xCF3C, 0xCF5C, 0xD75D, 0xD75D, 0xDF7D, 0xDF9E, 0xD75D, 0xD75C, 0xE79E, 0xEFBE, 0xEFBE, 
-0xEFBE, 0xEFBE, 0xEFBE, 0xEFBE, 0xE7BE, 0xE79E, 0xE79E, 0xDF7D, 0xDF7D, 0xDF5D, 0xD75D, 0xD75C, 0xCF3C, 0xCF3C, 0xC71B, 0xC6FB, 
-0xBEBA, 0xB6BA, 0xA678, 0xA658, 0x9D96, 0x8410, 0x5AAB, 0x73D1, 0x9CF6, 0xA557, 0xA535, 0x8451, 0x73F0, 0x634D, 0x5ACA, 0x73AE, 
-0x8C51, 0x73EE, 0x63EE, 0x646F, 0x6C90, 0x6CB1, 0x74D2, 0x7512, 0x74D2, 0x6470, 0x5C2F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 
-0x5C2E, 0x642E, 0x642E, 0x642E, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C4E, 0x644F, 0x644F, 0x644F, 0x644F, 0x5C4F, 0x5C6F, 
-0x642F, 0x5C0E, 0x5C0E, 0x5C0F, 0x5C0E, 0x5C2F, 0x644F, 0x644F, 0x6470, 0x6CB1, 0x74D2, 0x7D13, 0x7D13, 0x7D13, 0x74F3, 0x6CD2, 
-0x64D1, 0x74D3, 0x7C72, 0x5B0D, 0x41E8, 0x5AAA, 0x8C30, 0xC618, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEF9E, 
-0xE79E, 0xDF7D, 0xD75C, 0xCF5C, 0xD75C, 0xCF3C, 0xC71B, 0xC71B, 0xBEFB, 0xBEDA, 0xBEDA, 0xB6DA, 0xB6DA, 0xB6B9, 0x95F6, 0x95D6, 
-0xAE79, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE78, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xAE78, 0xAE78, 0xAE78, 0xAE99, 0xAE99, 0xAE78, 0xAE99, 0xAE99, 0xAE78, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE78, 0xAE78, 0xAE78, 
-0xAE99, 0xAE98, 0xAE98, 0xAE99, 0xAE98, 0xAE98, 0xAE98, 0xA678, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 0xAE78, 
-0xA678, 0xAE78, 0xA678, 0xAE99, 0x9E17, 0x8554, 0x95D6, 0xAE78, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xB6B9, 0xB6B9, 0xB6BA, 0xB6BA, 
-0xBEDA, 0xBEFB, 0xC71B, 0xC71B, 0xCF1C, 0xCF3C, 0xCF5C, 0xD75C, 0xD75D, 0xDF7D, 0xDF9E, 0xD75D, 0xD75C, 0xE79E, 0xEFBE, 0xEFBE, 
-0xEFBE, 0xEFBE, 0xEFBE, 0xE7BE, 0xE79E, 0xE79E, 0xDF7D, 0xDF7D, 0xD75D, 0xD75C, 0xD73C, 0xCF3C, 0xC71B, 0xC6FB, 0xBEDA, 0xB6BA, 
-0xB67A, 0xA658, 0x95F6, 0x8DB5, 0x8CF4, 0x6B6D, 0x528B, 0x6B90, 0x8C55, 0x8412, 0x6B6E, 0x634D, 0x632D, 0x5AEB, 0x528A, 0x5AEB, 
-0x83F0, 0x73CF, 0x63CD, 0x646F, 0x6CB1, 0x74D1, 0x7D12, 0x7D12, 0x6C90, 0x644F, 0x5C2E, 0x644E, 0x642E, 0x642E, 0x642E, 0x642F, 
-0x5C2E, 0x642E, 0x642F, 0x642E, 0x642F, 0x642F, 0x642F, 0x644F, 0x5C4E, 0x53CD, 0x538C, 0x5BCD, 0x5BED, 0x5BED, 0x5BED, 0x5C0E, 
-0x5BED, 0x5C0E, 0x5C0E, 0x5C0E, 0x5BEE, 0x5C0E, 0x5C0E, 0x53ED, 0x53ED, 0x5BED, 0x5C0E, 0x6450, 0x6C91, 0x6CB1, 0x6490, 0x5C4F, 
-0x544F, 0x6C71, 0x6BAF, 0x4A6A, 0x4208, 0x4A68, 0x632B, 0xA514, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEFBE, 0xE79E, 
-0xDF7D, 0xD75D, 0xD75D, 0xCF3C, 0xCF3C, 0xCF1C, 0xC6FB, 0xC6FB, 0xBEDA, 0xBEDA, 0xB6BA, 0xB699, 0xAE99, 0xAE99, 0x95D6, 0x95B5, 
-0xA678, 0xAE99, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xA658, 0xA678, 0xA678, 0xAE99, 0x95F6, 0x8554, 0x95F6, 0xA678, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xB6B9, 0xB6B9, 0xB6BA, 
-0xBEDA, 0xBEFA, 0xC6FB, 0xC71B, 0xCF3C, 0xCF3C, 0xD75C, 0xD75D, 0xDF7D, 0xDF7D, 0xDF9E, 0xD75D, 0xD73C, 0xE79E, 0xEFBE, 0xEFBE, 
-0xE7BE, 0xE7BE, 0xE7BE, 0xE79E, 0xE79E, 0xDF7D, 0xDF7D, 0xD75D, 0xD75C, 0xCF3C, 0xCF1C, 0xC6FB, 0xBEDB, 0xB6BA, 0xB699, 0xAE79, 
-0xA638, 0x95D6, 0x8594, 0x7D13, 0x7C71, 0x632C, 0x52AB, 0x7BF2, 0x8C96, 0x634F, 0x4A8B, 0x632D, 0x6B4E, 0x5AED, 0x4A49, 0x5AEC, 
-0x8C52, 0x8431, 0x63CE, 0x644F, 0x74D2, 0x7CF3, 0x7D13, 0x74D1, 0x644F, 0x642E, 0x5C2E, 0x642E, 0x642F, 0x642E, 0x642F, 0x642F, 
-0x642F, 0x642F, 0x642F, 0x642E, 0x642F, 0x5C4F, 0x644F, 0x646F, 0x5BEE, 0x3A68, 0x29E6, 0x3207, 0x31E7, 0x3A27, 0x3A48, 0x3207, 
-0x432B, 0x5C2E, 0x5C4E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5C0D, 0x5C0D, 0x5C0D, 0x5C0D, 0x53ED, 0x5BEE, 0x5C2E, 0x644F, 0x644F, 0x540E, 
-0x540E, 0x6C50, 0x7BD0, 0x7BAF, 0x8431, 0x7C30, 0x6B8D, 0x7BCF, 0xCE79, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xE77E, 0xDF7D, 
-0xD73C, 0xD73C, 0xD75C, 0xCF3C, 0xCF1C, 0xC6FB, 0xC6FB, 0xBEDA, 0xB6BA, 0xB6B9, 0xB699, 0xAE99, 0xAE99, 0xA678, 0x8DB5, 0x8DB5, 
-0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xA678, 0xA678, 0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 
-0xA658, 0xA658, 0xA658, 0xA678, 0x95F6, 0x8554, 0x9E16, 0xA678, 0xAE78, 0xAE78, 0xAE99, 0xAE99, 0xAE99, 0xB699, 0xB6B9, 0xB6BA, 
-0xBEDA, 0xBEFB, 0xC6FB, 0xCF1C, 0xCF3C, 0xD75C, 0xD75D, 0xDF7D, 0xDF7D, 0xDF7D, 0xDF9E, 0xD75D, 0xD73C, 0xE79E, 0xEFBE, 0xE79E, 
-0xE79E, 0xE79E, 0xE79E, 0xE79D, 0xDF7D, 0xD75D, 0xD75C, 0xD73C, 0xCF3C, 0xCF1C, 0xC6FB, 0xBEDA, 0xB6BA, 0xB699, 0xAE79, 0xA638, 
-0x9DF6, 0x8D95, 0x7D33, 0x6CD1, 0x6C30, 0x632C, 0x528A, 0x7BF2, 0x8CB6, 0x73D1, 0x632D, 0x630C, 0x632D, 0x5B0C, 0x4A8B, 0x73D0, 
-0xAD97, 0x9CF4, 0x63EE, 0x644F, 0x74F2, 0x8533, 0x74F2, 0x646F, 0x644E, 0x642F, 0x642E, 0x642E, 0x642F, 0x644F, 0x642F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x642F, 0x642F, 0x642F, 0x644F, 0x6490, 0x5BEE, 0x3227, 0x31E7, 0x29A6, 0x2103, 0x2144, 0x2165, 0x2144, 
-0x3AC9, 0x642E, 0x644F, 0x5C2E, 0x5C2E, 0x640E, 0x5C0E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5C0E, 0x5C2F, 0x644F, 0x5C2F, 
-0x5C0F, 0x6C0F, 0x94B3, 0xBDB8, 0xBDF8, 0x94F3, 0x73F0, 0x6B4D, 0xAD75, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xDF5D, 0xD73D, 
-0xCF3C, 0xCF3C, 0xCF3C, 0xC73C, 0xC71B, 0xBEDA, 0xBEDA, 0xB6BA, 0xB6BA, 0xB699, 0xAE79, 0xAE79, 0xAE79, 0xA658, 0x8DB5, 0x8DB4, 
-0xA678, 0xA678, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 
-0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 
-0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 
-0xA657, 0x9E37, 0xA658, 0xA678, 0x95D6, 0x8554, 0x9E17, 0xA678, 0xAE78, 0xAE78, 0xAE78, 0xAE79, 0xAE99, 0xB699, 0xB6B9, 0xBEDA, 
-0xBEDA, 0xC71B, 0xCF3C, 0xD75C, 0xD77D, 0xD77D, 0xDF7D, 0xDF7D, 0xDF7D, 0xDF7D, 0xDF9E, 0xD75D, 0xD75C, 0xE79E, 0xEFBE, 0xE79E, 
-0xE79E, 0xE79E, 0xE79D, 0xDF7D, 0xDF5D, 0xD75C, 0xD73C, 0xCF3C, 0xC71C, 0xC6FB, 0xBEDA, 0xB6BA, 0xB69A, 0xAE79, 0xA658, 0x9E17, 
-0x95D6, 0x8575, 0x7512, 0x6CB1, 0x6C2F, 0x6B6C, 0x528A, 0x73D1, 0x9D56, 0xA555, 0x9CF4, 0x8410, 0x6B6D, 0x52EB, 0x5B2D, 0xA557, 
-0xD6FD, 0xAD97, 0x6C0F, 0x646F, 0x7D33, 0x8533, 0x6CB1, 0x644F, 0x642E, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644E, 0x644E, 
-0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x642E, 0x644E, 0x6C6F, 0x5BEE, 0x3268, 0x3A68, 0x29C6, 0x18E3, 0x2165, 0x2185, 0x2165, 
-0x432B, 0x644F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C2E, 0x5C0E, 0x5C2E, 0x644F, 0x5C2F, 
-0x5C0E, 0x63EE, 0x8CB2, 0xAD96, 0x9D35, 0x7C51, 0x73EF, 0x632C, 0x94B2, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBF, 0xDF5D, 0xD75D, 0xCF1C, 
-0xCF1C, 0xCF3C, 0xCF1C, 0xC71B, 0xC6FB, 0xBEDA, 0xBEDA, 0xB699, 0xAE79, 0xAE79, 0xAE78, 0xA678, 0xA678, 0xA658, 0x8D95, 0x8DB5, 
-0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0xA658, 0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E57, 
-0x9E57, 0x9E57, 0x9E57, 0x9E57, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E57, 0x9E57, 0x9E37, 0x9E37, 0x9E37, 0xA657, 0xA657, 
-0xA658, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 
-0x9E37, 0x9E37, 0x9E37, 0xA657, 0x95D6, 0x7D33, 0x9E17, 0xA678, 0xA658, 0xAE78, 0xAE98, 0xAE99, 0xAE99, 0xB6B9, 0xB6BA, 0xBEFA, 
-0xCF1B, 0xCF3C, 0xCF3C, 0xC71B, 0xC71B, 0xC6FB, 0xBEFB, 0xBEFB, 0xBEFA, 0xBEFB, 0xC6FB, 0xBEDA, 0xC6DA, 0xD75C, 0xE79E, 0xEF9E, 
-0xE79E, 0xE79E, 0xDF7D, 0xDF7D, 0xD75C, 0xCF5C, 0xCF3C, 0xCF1B, 0xC6FB, 0xBEFB, 0xBEBA, 0xB6BA, 0xB699, 0xAE79, 0xA658, 0x9E17, 
-0x95D6, 0x8D74, 0x7D33, 0x6CB1, 0x6C6F, 0x6BCE, 0x5AEC, 0x6B6F, 0x94D6, 0xBE3B, 0xD6DD, 0xADF8, 0x8473, 0x4A8B, 0x6B8F, 0xD6FD, 
-0xEFBF, 0xA576, 0x6C2F, 0x74B1, 0x8594, 0x7CF2, 0x6450, 0x5C2E, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x646F, 0x5C0E, 0x3A28, 0x29C6, 0x2144, 0x10C2, 0x1924, 0x1924, 0x2965, 
-0x4B4B, 0x644F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x642E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 
-0x5C0F, 0x63EF, 0x7C31, 0x7C11, 0x6B8E, 0x6BCE, 0x6B8D, 0x630C, 0x8C71, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEF9E, 0xD73C, 0xCF3C, 0xCF3C, 
-0xCF3C, 0xCF5C, 0xCF3C, 0xC71B, 0xC6FB, 0xB6BA, 0xB6B9, 0xAE99, 0xAE79, 0xAE78, 0xA658, 0xA658, 0xA658, 0x9E37, 0x8574, 0x8D95, 
-0xA658, 0xA658, 0xA657, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 
-0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 
-0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 
-0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x8DB5, 0x7D33, 0x9E37, 0xA678, 0xA678, 0xAE78, 0xAE78, 0xAE99, 0xAE99, 0xB6BA, 0xBEDA, 0xC71B, 
-0xC6FB, 0xBEFA, 0xBEDA, 0xB699, 0xAE58, 0xA638, 0xA637, 0xA617, 0xA637, 0xA617, 0xA638, 0x9E17, 0x9E37, 0xB6DA, 0xC71B, 0xD73C, 
-0xDF7D, 0xDF7D, 0xDF5D, 0xD75D, 0xD73C, 0xCF3C, 0xC71B, 0xC6FB, 0xBEFB, 0xBEDB, 0xB6BA, 0xB69A, 0xAE99, 0xAE79, 0xA658, 0x9E17, 
-0x95F6, 0x8D95, 0x7D33, 0x74D2, 0x6C4F, 0x6C0E, 0x6B8D, 0x62EC, 0x634F, 0x94D5, 0xBE1A, 0xA536, 0x6B8F, 0x4A8B, 0x8CB4, 0xF7FF, 
-0xE75E, 0x94D3, 0x7471, 0x8554, 0x8574, 0x6C91, 0x642F, 0x642E, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 0x644F, 0x646F, 0x5C0E, 0x3207, 0x29A5, 0x2124, 0x10A2, 0x10E3, 0x18E3, 0x2144, 
-0x4B2B, 0x644F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x642E, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C4F, 
-0x540E, 0x63EF, 0x7C10, 0x73D0, 0x636D, 0x636C, 0x634C, 0x5B0C, 0x8C51, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xE75D, 0xD73C, 0xCF3C, 0xCF3C, 
-0xCF3C, 0xCF5C, 0xCF3C, 0xC71B, 0xC6FB, 0xBEDA, 0xB699, 0xAE78, 0xAE78, 0xA658, 0xA658, 0xA657, 0x9E57, 0x9E17, 0x8554, 0x8594, 
-0x9E37, 0x9E37, 0x9E37, 0x9E17, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 
-0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 
-0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E17, 0x9E17, 0x9E17, 
-0x9E17, 0x9E16, 0x9E37, 0x9E37, 0x8DB5, 0x7D33, 0x9E37, 0xA678, 0xA678, 0xA658, 0xA678, 0xAE79, 0xB6B9, 0xBEDA, 0xBEDA, 0xBEDA, 
-0xB6B9, 0xAE78, 0xA658, 0xA678, 0xAE99, 0xAE99, 0xAEB9, 0xAEB9, 0xAEB9, 0xAEB9, 0xAE99, 0x9E37, 0x9E17, 0x9E37, 0xA658, 0xB699, 
-0xC6DA, 0xCF1C, 0xD75D, 0xD75D, 0xCF3C, 0xCF1B, 0xC6FB, 0xC6FB, 0xBEDB, 0xBEBA, 0xB6BA, 0xB699, 0xAE99, 0xAE79, 0xA658, 0xA638, 
-0x95F6, 0x8D95, 0x8534, 0x7D12, 0x6C90, 0x640E, 0x6BCD, 0x6B4D, 0x52CD, 0x4ACD, 0x530D, 0x428B, 0x424A, 0x6BF1, 0xC67B, 0xE73F, 
-0xB596, 0x7C51, 0x8514, 0x8DB5, 0x74F2, 0x644F, 0x642E, 0x644E, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644E, 0x644F, 0x646F, 0x5C0E, 0x3248, 0x3227, 0x29C6, 0x1923, 0x2185, 0x2144, 0x2164, 
-0x4B2B, 0x644F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C4F, 0x642E, 0x5C2E, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 
-0x5C2E, 0x63AD, 0x7BCF, 0x8C71, 0x7C30, 0x73CE, 0x73CE, 0x632C, 0x9492, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEF9E, 0xD73C, 0xCEFB, 0xBEBA, 0xB699, 
-0xB699, 0xB699, 0xB6BA, 0xBEDA, 0xBEFA, 0xBEDA, 0xB699, 0xAE78, 0xA658, 0xA637, 0x9E37, 0x9E37, 0x9E37, 0x9616, 0x7D53, 0x8574, 
-0x9E37, 0x9E37, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9E17, 0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x95F6, 
-0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 
-0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x9E16, 0x9E16, 0x9E16, 
-0x9E16, 0x9E16, 0x9E17, 0x9E37, 0x8D94, 0x7D33, 0x9E37, 0xA678, 0xA658, 0xA678, 0xAE78, 0xB699, 0xB6DA, 0xB6DA, 0xB6B9, 0xAE58, 
-0xA638, 0xA658, 0xA678, 0xAE99, 0xAEB9, 0xAED9, 0xB6D9, 0xB6DA, 0xB6DA, 0xB6FA, 0xBEDA, 0xAE99, 0xA658, 0xAE78, 0xA658, 0xA637, 
-0xA637, 0xAE79, 0xBEDA, 0xCF3C, 0xCF3C, 0xCF1C, 0xC6FB, 0xBEDB, 0xBEDA, 0xB6BA, 0xB69A, 0xAE99, 0xAE99, 0xAE79, 0xA658, 0xA638, 
-0x9E17, 0x95D6, 0x8D75, 0x7D13, 0x74D1, 0x646F, 0x5BCD, 0x6B8D, 0x6B6F, 0x52EC, 0x426B, 0x426B, 0x6BB0, 0xADD9, 0xCEBC, 0xA536, 
-0x73EF, 0x7CD2, 0x95F7, 0x8574, 0x6C70, 0x5C2E, 0x5C4E, 0x642F, 0x642F, 0x642F, 0x642F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644E, 0x644F, 0x646F, 0x5BEE, 0x3A88, 0x42A9, 0x29E6, 0x2185, 0x3A07, 0x2985, 0x2185, 
-0x4B4B, 0x644F, 0x644F, 0x642E, 0x642E, 0x5C2E, 0x5C4F, 0x5C2E, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 
-0x5C2E, 0x5B8D, 0x73CE, 0x94D2, 0x9D13, 0x8CB2, 0x8431, 0x73AF, 0xA535, 0xE71D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77D, 0xE79E, 0xC6FB, 0xA638, 0x9E17, 0xA658, 
-0x9E37, 0x9E37, 0x9E37, 0x9E37, 0xA658, 0xAE79, 0xB699, 0xAE79, 0xA658, 0xA657, 0x9E37, 0x9E37, 0x9E37, 0x95F6, 0x7D33, 0x8574, 
-0x9E37, 0x9E17, 0x9616, 0x9616, 0x9616, 0x9616, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 
-0x95F6, 0x95F6, 0x95F6, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 
-0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 
-0x95F6, 0x9E16, 0x9E17, 0x9E16, 0x8D94, 0x8553, 0x9E37, 0xA678, 0xA658, 0xA678, 0xAE79, 0xB6B9, 0xB6BA, 0xAE99, 0xA678, 0xA658, 
-0xA678, 0xAE98, 0xAE78, 0x9DF6, 0x8D54, 0x7491, 0x63EF, 0x63AD, 0x63EF, 0x7470, 0x84F2, 0x95B5, 0xA637, 0xAE99, 0xAEB9, 0xA678, 
-0xA658, 0x9E37, 0xA658, 0xB6BA, 0xBEFB, 0xC71B, 0xC6FB, 0xBEDB, 0xBEDA, 0xB6BA, 0xB699, 0xAE99, 0xAE79, 0xAE79, 0xA658, 0xA638, 
-0xA617, 0x9DF7, 0x95D6, 0x8D75, 0x7D13, 0x6CD1, 0x644F, 0x63EE, 0x638C, 0x6B6D, 0x6B6E, 0x73D0, 0x8C94, 0x94D4, 0x8472, 0x6BCF, 
-0x7450, 0x8D95, 0x8DB5, 0x6CB1, 0x640E, 0x5C2E, 0x644F, 0x642F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x646F, 0x640E, 0x4B0B, 0x4B0A, 0x4289, 0x3A48, 0x4AA9, 0x3A27, 0x3A47, 
-0x53AD, 0x644F, 0x5C4F, 0x642E, 0x642F, 0x5C4E, 0x5C4F, 0x5C2E, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 
-0x642E, 0x5BAD, 0x638D, 0x7BCF, 0x94B3, 0x8472, 0x73D0, 0x8432, 0xAD96, 0xE73D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD71C, 0xCF1B, 0xAE79, 0x9E37, 0x9E58, 0xA698, 
-0xA6B9, 0xA698, 0xA678, 0x9E37, 0x95F6, 0x9E17, 0xA658, 0xAE78, 0xA658, 0xA657, 0x9E17, 0x9E17, 0x9E17, 0x95F6, 0x7D33, 0x8554, 
-0x9E16, 0x9E16, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x8DD5, 0x8DD5, 
-0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x95D5, 0x95D5, 
-0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x95D5, 0x95D5, 0x95F5, 0x95D6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 
-0x95F6, 0x95F6, 0x9E16, 0x9E16, 0x8D94, 0x8554, 0x9E37, 0xA658, 0xA658, 0xAE78, 0xAE99, 0xB6B9, 0xA698, 0x9E37, 0xA678, 0xA678, 
-0xA678, 0x8D95, 0x642F, 0x3AA9, 0x2185, 0x10E3, 0x10A2, 0x1082, 0x0882, 0x18E3, 0x1944, 0x29C6, 0x42CA, 0x7450, 0x9DF6, 0xAEB9, 
-0xAE99, 0xA678, 0x9E17, 0xA637, 0xAE79, 0xBEDA, 0xC6FB, 0xBEDB, 0xBEDA, 0xB6BA, 0xAE99, 0xAE99, 0xAE79, 0xAE79, 0xA658, 0xA658, 
-0xAE58, 0xA638, 0x9E38, 0x95F7, 0x8D75, 0x7D54, 0x7D33, 0x6CB1, 0x5C0E, 0x5BAD, 0x5B4C, 0x5B6C, 0x636D, 0x5B4C, 0x5BAE, 0x74B2, 
-0x8DB5, 0x8594, 0x6C90, 0x5C0E, 0x640E, 0x642E, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x5C4E, 0x63ED, 0x5BED, 0x5BED, 0x5BCD, 0x5BCD, 0x5B8C, 0x538C, 
-0x5C0E, 0x644F, 0x5C4E, 0x642F, 0x642F, 0x5C2E, 0x5C4F, 0x644F, 0x644F, 0x644F, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C2E, 0x5C2E, 0x642E, 
-0x642E, 0x5C0E, 0x536C, 0x52AA, 0x4A6A, 0x4AAC, 0x6BD1, 0x9CF5, 0xA555, 0xDF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9E, 0xCEFB, 0xBEDA, 0xAE58, 0x9E16, 0x9DF6, 0x8D94, 
-0x7D12, 0x7D13, 0x8D94, 0x9E17, 0x9E57, 0x9E17, 0x9616, 0x9E37, 0x9E37, 0x9E37, 0x9E17, 0x9616, 0x9616, 0x8DD5, 0x7512, 0x7D53, 
-0x9E16, 0x9616, 0x95F6, 0x95F6, 0x95F6, 0x95D5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 
-0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 
-0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DD5, 0x8DD5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D6, 0x95F6, 
-0x95F6, 0x95F6, 0x9E16, 0x9616, 0x8D94, 0x8574, 0x9E37, 0xA658, 0xA678, 0xAE78, 0xAE99, 0xA678, 0x9E57, 0xA678, 0xA678, 0x95D5, 
-0x63EE, 0x2A07, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882, 0x3A48, 0x6C30, 
-0x9DD6, 0xAE78, 0xA678, 0x9E37, 0xA637, 0xAE79, 0xB6BA, 0xBEDA, 0xB6BA, 0xB699, 0xB699, 0xAE79, 0xAE79, 0xAE58, 0xAE58, 0xAE79, 
-0xAE79, 0xB699, 0xB69A, 0xAE79, 0xAE79, 0xA638, 0x9617, 0x85B6, 0x7534, 0x6491, 0x5C0E, 0x5BED, 0x5BCD, 0x642F, 0x7512, 0x85B6, 
-0x8594, 0x6CB1, 0x5C0E, 0x5C2E, 0x644F, 0x642F, 0x642F, 0x5C2E, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 0x5C4F, 0x5C4E, 0x646F, 0x646F, 0x648F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x642F, 0x5C4F, 0x5C4E, 0x642F, 0x642E, 0x5C4F, 0x5C4F, 0x5C4F, 0x644F, 0x644F, 0x644F, 0x5C4F, 0x5C4F, 0x642E, 0x642E, 0x642E, 
-0x642E, 0x644F, 0x53AC, 0x42A9, 0x31E7, 0x4AAC, 0x8473, 0x8CB3, 0x84B2, 0xCEDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD73C, 0xC71B, 0xB6DA, 0x9595, 0x640E, 0x42EA, 0x2A07, 
-0x21A6, 0x21A6, 0x2A07, 0x4B4C, 0x7CF3, 0x9E17, 0x9E37, 0x9616, 0x9E17, 0x9E17, 0x9E17, 0x9616, 0x9616, 0x8DD5, 0x7512, 0x7D33, 
-0x9616, 0x95F6, 0x95D5, 0x8DD5, 0x8DD5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8594, 
-0x8D94, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8D94, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 
-0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 
-0x95F6, 0x9E16, 0x9E16, 0x95F6, 0x8D95, 0x8574, 0x9E37, 0xA658, 0xA678, 0xAE78, 0xAE58, 0xA637, 0xA678, 0xA678, 0x7D13, 0x3289, 
-0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882, 
-0x3A89, 0x7CF2, 0xA658, 0xAE99, 0xA658, 0xA637, 0xAE58, 0xB699, 0xB6BA, 0xB699, 0xAE79, 0xAE79, 0xAE58, 0xA658, 0xAE58, 0xAE79, 
-0xAEBA, 0xB6BA, 0xC6FB, 0xC73C, 0xBEFB, 0xA618, 0x8DB6, 0x8DD6, 0x8DB6, 0x85B6, 0x8595, 0x8575, 0x8575, 0x8DB6, 0x8DB6, 0x8554, 
-0x6CF2, 0x6C90, 0x7490, 0x6CB0, 0x6CB0, 0x6CB1, 0x6C70, 0x6C90, 0x6C70, 0x6C70, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644E, 0x642E, 0x644F, 0x644F, 0x644E, 0x644F, 0x5C2E, 0x5C4F, 
-0x642F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C0E, 
-0x5C0E, 0x5C2E, 0x5BED, 0x534B, 0x52EB, 0x634E, 0x73F0, 0x6BCE, 0x6C2F, 0xBE78, 0xF7DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xCF1B, 0xBED9, 0x8D32, 0x42C9, 0x1102, 0x0040, 0x0020, 
-0x0020, 0x0000, 0x0000, 0x0000, 0x2144, 0x63EE, 0x8DB5, 0x9616, 0x9616, 0x95F6, 0x9E17, 0x95F6, 0x9616, 0x95B5, 0x7D12, 0x7D32, 
-0x95F6, 0x95F6, 0x8DD5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8D94, 0x8D94, 0x8594, 0x8594, 0x8574, 0x8574, 0x8574, 0x8574, 
-0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 
-0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 0x95F5, 
-0x95F5, 0x95F6, 0x9E16, 0x95F6, 0x8594, 0x8D95, 0x9E37, 0xA678, 0xA678, 0xA658, 0x9E57, 0x9E77, 0xA678, 0x7470, 0x2165, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x1904, 0x6BCE, 0xA637, 0xA698, 0xA637, 0xA617, 0xA658, 0xB699, 0xB699, 0xAE99, 0xAE79, 0xA658, 0xA658, 0xA658, 0xAE79, 
-0xB699, 0xBEFB, 0xC73C, 0xC6FB, 0x8D54, 0x5B8D, 0x4B0B, 0x640F, 0x7D54, 0x8D95, 0x8D95, 0x8D96, 0x8DB6, 0x8575, 0x8554, 0x7D13, 
-0x7D13, 0x7D13, 0x7D13, 0x7D13, 0x7D13, 0x7D13, 0x7D13, 0x7D13, 0x7512, 0x7D13, 0x7D13, 0x7512, 0x7512, 0x7512, 0x7512, 0x74F2, 
-0x74F2, 0x74F2, 0x74F2, 0x74D1, 0x74D1, 0x6CD1, 0x6CB1, 0x6CB1, 0x6CB0, 0x6CB0, 0x6C90, 0x6C90, 0x6490, 0x6490, 0x6470, 0x6470, 
-0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 
-0x5C0E, 0x5C2E, 0x5C2E, 0x5BED, 0x538C, 0x4B4B, 0x538D, 0x6C50, 0x6CF2, 0x9DD6, 0xE75D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77E, 0xCF1B, 0x7CD2, 0x29C5, 0x0060, 0x0081, 0x0061, 0x0061, 
-0x0041, 0x0020, 0x0000, 0x0000, 0x0020, 0x0081, 0x4B0B, 0x8554, 0x9616, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95D5, 0x74F2, 0x7D33, 
-0x95F6, 0x95D5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8D94, 0x8594, 0x8594, 0x8574, 0x8574, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 
-0x8573, 0x8573, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8573, 0x8553, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8574, 
-0x8573, 0x8573, 0x8573, 0x8593, 0x8574, 0x8594, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 
-0x95F5, 0x95F6, 0x9E17, 0x95F6, 0x8594, 0x8DB5, 0x9E37, 0xA678, 0xA658, 0xA657, 0x9E57, 0xA657, 0x74B1, 0x1944, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x08A2, 0x532C, 0x9DF6, 0xA658, 0x9E37, 0xA637, 0xAE58, 0xAE79, 0xAE79, 0xAE79, 0xA638, 0xA638, 0xA658, 0xA658, 
-0xB699, 0xBEDB, 0xC71B, 0x9D96, 0x52EB, 0x2965, 0x18E3, 0x2985, 0x53AD, 0x74F2, 0x8554, 0x7D34, 0x8554, 0x7D54, 0x7D33, 0x7D13, 
-0x7D13, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D54, 0x8554, 0x8554, 0x8554, 
-0x8554, 0x8554, 0x7D54, 0x7D54, 0x7D54, 0x7D53, 0x7D53, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D13, 0x7D13, 0x7512, 
-0x7512, 0x7512, 0x7512, 0x7512, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74D2, 0x74D1, 0x74D1, 0x74D1, 0x6CB1, 0x6CB1, 
-0x6CB1, 0x6CB1, 0x6CB0, 0x6C90, 0x6C90, 0x6C70, 0x74B1, 0x7D33, 0x8554, 0x8575, 0xC6DB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xE7BE, 0xA5F7, 0x3227, 0x0040, 0x0060, 0x08C2, 0x08C2, 0x08C2, 
-0x10A2, 0x10A2, 0x10C2, 0x0861, 0x0020, 0x0000, 0x0061, 0x4ACA, 0x8574, 0x9616, 0x95D6, 0x95F6, 0x95F6, 0x95F5, 0x74F2, 0x7CF2, 
-0x95D5, 0x8DD5, 0x8DB4, 0x8D94, 0x8D94, 0x8594, 0x8574, 0x8574, 0x8574, 0x8573, 0x8573, 0x8573, 0x8573, 0x8553, 0x8553, 0x8553, 
-0x8553, 0x8553, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x8553, 0x8553, 0x8553, 0x8553, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 
-0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8593, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 
-0x95F5, 0x95F6, 0x9E37, 0x95F6, 0x8574, 0x8DB5, 0xA658, 0xA678, 0xA637, 0x9E37, 0xA698, 0x8533, 0x29C6, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0041, 0x4B0B, 0x9DF6, 0xA698, 0x9E17, 0xA637, 0xA678, 0xAE58, 0xA658, 0xA638, 0x9E17, 0xA637, 0x9E37, 
-0xA658, 0xB6BA, 0xAE79, 0x7430, 0x4228, 0x41E7, 0x3124, 0x1082, 0x2A27, 0x642F, 0x74F2, 0x7D13, 0x7D13, 0x7D33, 0x7D33, 0x7D13, 
-0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D34, 0x7D34, 0x7D34, 0x7D54, 0x7D54, 0x7D54, 
-0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 
-0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x7D54, 0x7D54, 0x7D34, 
-0x7D34, 0x7D33, 0x7533, 0x7513, 0x7D13, 0x7D33, 0x7D54, 0x7D75, 0x8575, 0x8595, 0xA618, 0xDF3C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xC71B, 0x63CE, 0x0061, 0x0020, 0x08A1, 0x08C2, 0x08A2, 0x08A2, 
-0x10A2, 0x0881, 0x10C2, 0x10A2, 0x0861, 0x0000, 0x0000, 0x0041, 0x4B4C, 0x8DB5, 0x95F6, 0x95D5, 0x95F6, 0x8DD5, 0x7512, 0x7D12, 
-0x95D5, 0x8DD5, 0x8D94, 0x8D94, 0x8594, 0x8594, 0x8574, 0x8573, 0x8573, 0x8573, 0x8573, 0x8553, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 
-0x7D53, 0x7D53, 0x7D53, 0x7D52, 0x7D52, 0x7D52, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x8553, 0x8553, 0x8573, 
-0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8593, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB5, 0x8DB5, 0x95D5, 0x95D5, 
-0x95F5, 0x95F6, 0x9E37, 0x95D5, 0x8574, 0x95D6, 0xA657, 0xA657, 0xA637, 0x9E57, 0x8DB5, 0x42A9, 0x0020, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x5BAD, 0x9E37, 0xA658, 0x9E37, 0xA658, 0xA658, 0xA638, 0xA638, 0x9DF7, 0x95F6, 0x95D6, 
-0x95F6, 0x9E17, 0x8D95, 0x63CE, 0x4A69, 0x628B, 0x49E8, 0x1082, 0x21A6, 0x5BEE, 0x6C90, 0x74D1, 0x74D1, 0x74F2, 0x74F2, 0x74F2, 
-0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x7512, 0x7512, 0x7512, 0x7D13, 0x7D13, 0x7D13, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D54, 0x7D54, 
-0x7D54, 0x7D54, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 
-0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8574, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 0x8554, 
-0x8534, 0x7D54, 0x7D34, 0x7D33, 0x7D13, 0x7D14, 0x7D13, 0x7D34, 0x8555, 0x8575, 0x74B2, 0x9D34, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0x9595, 0x2185, 0x0020, 0x0861, 0x08A1, 0x08A2, 0x0061, 0x0041, 
-0x0861, 0x0061, 0x0881, 0x0881, 0x0040, 0x0000, 0x0000, 0x0000, 0x08C2, 0x640E, 0x95F6, 0x95F6, 0x9DF6, 0x95D5, 0x74F2, 0x74F2, 
-0x95D5, 0x8DD5, 0x8D94, 0x8594, 0x8594, 0x8574, 0x8573, 0x8573, 0x8573, 0x8553, 0x8553, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D52, 
-0x7D52, 0x7D52, 0x7D52, 0x7D52, 0x7D32, 0x7D32, 0x7D52, 0x7D52, 0x7D52, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x8553, 0x8553, 
-0x8553, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8593, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB5, 0x8DB5, 0x95D5, 0x95D5, 
-0x95F5, 0x9616, 0x9E37, 0x95D5, 0x8574, 0x95D6, 0xA657, 0x9E37, 0x9E37, 0x9E36, 0x640E, 0x08A2, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18C3, 0x2965, 0x3186, 0x3186, 0x31A7, 0x39E7, 0x39C7, 0x31A6, 0x2945, 0x2104, 
-0x10C3, 0x0861, 0x0000, 0x0000, 0x0000, 0x08C2, 0x7450, 0xA678, 0xA658, 0x9E37, 0xA658, 0xA638, 0x9E17, 0x9DF6, 0x95D6, 0x8D95, 
-0x8574, 0x7D53, 0x7D12, 0x63EE, 0x52AA, 0x5A8B, 0x41E9, 0x18C4, 0x3248, 0x642F, 0x6470, 0x646F, 0x6C70, 0x6C90, 0x6C70, 0x6C90, 
-0x6C90, 0x6C90, 0x6C90, 0x6C90, 0x6CB0, 0x6CB0, 0x6CB1, 0x74B1, 0x6CB1, 0x6CB1, 0x74D1, 0x74D1, 0x74D1, 0x74F2, 0x74F2, 0x74F2, 
-0x74F2, 0x7512, 0x7512, 0x7D13, 0x7D13, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 0x7D33, 
-0x7D54, 0x7D54, 0x7D54, 0x7D54, 0x7D54, 0x8554, 0x8554, 0x8554, 0x8554, 0x7D54, 0x7D54, 0x7D34, 0x7D54, 0x7D33, 0x7D33, 0x7D33, 
-0x7D33, 0x7D33, 0x7D33, 0x7D13, 0x7D13, 0x7CF3, 0x7D13, 0x7D13, 0x7D54, 0x7513, 0x534C, 0x634C, 0xD699, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77D, 0x7470, 0x0881, 0x0020, 0x0881, 0x08C2, 0x08A1, 0x0040, 0x0020, 
-0x0020, 0x0040, 0x0040, 0x0061, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x21C6, 0x7CF2, 0x9616, 0x95D6, 0x95F6, 0x74F2, 0x7512, 
-0x8DD5, 0x8DD5, 0x8D94, 0x8594, 0x8594, 0x8574, 0x8574, 0x8573, 0x8573, 0x8553, 0x8553, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 
-0x7D52, 0x7D52, 0x7D52, 0x7D52, 0x7D52, 0x7D52, 0x7D52, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x8553, 0x8553, 0x8573, 
-0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8594, 0x8594, 0x8D94, 0x8D94, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 
-0x95F6, 0x9E16, 0x9E37, 0x8DB5, 0x8574, 0x95F6, 0x9E37, 0x9E37, 0x9636, 0x8553, 0x3228, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0021, 0x18C3, 0x3186, 0x4228, 0x4A49, 0x4A49, 0x4208, 0x4208, 0x4229, 0x4229, 0x4228, 0x4208, 0x39E8, 
-0x2986, 0x1904, 0x10A2, 0x0861, 0x0000, 0x0000, 0x2186, 0x8554, 0xA678, 0x9E37, 0x9E17, 0x9E37, 0x9DF6, 0x95F6, 0x8DB5, 0x8574, 
-0x8533, 0x74F1, 0x74D1, 0x6C2F, 0x636D, 0x5ACC, 0x4229, 0x3209, 0x538D, 0x6C70, 0x646F, 0x644F, 0x646F, 0x6C6F, 0x646F, 0x6C6F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6490, 0x6C90, 0x6490, 
-0x6C90, 0x6C90, 0x6CB0, 0x6CB0, 0x6CB1, 0x6CB1, 0x6CD1, 0x6CD1, 0x6CB1, 0x6CD1, 0x6CD1, 0x6CD1, 0x74D1, 0x74D1, 0x74D1, 0x74D1, 
-0x74D1, 0x74D1, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 0x74F2, 
-0x74F2, 0x74F2, 0x74F1, 0x74D1, 0x74D2, 0x74D2, 0x74D1, 0x74D1, 0x6CF2, 0x6CB1, 0x4B0B, 0x4A69, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7FF, 0xCEFB, 0x5B6C, 0x0861, 0x0040, 0x08A1, 0x08A2, 0x0861, 0x0020, 0x0000, 
-0x0000, 0x0020, 0x0861, 0x0882, 0x1082, 0x0841, 0x0841, 0x0841, 0x0000, 0x0020, 0x4AEB, 0x8DB5, 0x9616, 0x95F6, 0x74F2, 0x74F2, 
-0x8DB5, 0x8DB5, 0x8D94, 0x8D94, 0x8594, 0x8594, 0x8574, 0x8574, 0x8573, 0x8573, 0x8553, 0x8553, 0x8553, 0x8553, 0x7D53, 0x7D53, 
-0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x7D53, 0x8553, 0x8553, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 
-0x8573, 0x8573, 0x8573, 0x8593, 0x8594, 0x8594, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 
-0x95F6, 0x9E16, 0xA657, 0x8DB5, 0x8574, 0x95F6, 0x9E37, 0x9E37, 0x9616, 0x63EE, 0x10C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x1082, 0x2965, 0x4208, 0x4229, 0x4208, 0x4208, 0x41E8, 0x39C7, 0x39C7, 0x39C7, 0x39A7, 0x31A7, 0x39E8, 0x4209, 
-0x4208, 0x31A7, 0x2145, 0x18C3, 0x1061, 0x0000, 0x0000, 0x4B0B, 0x95F6, 0xA657, 0x9E17, 0x9E17, 0x95F6, 0x95F6, 0x95B5, 0x8D74, 
-0x8533, 0x74F1, 0x6CB0, 0x6C6F, 0x6C2F, 0x5B8D, 0x532C, 0x5BAE, 0x6C6F, 0x646F, 0x644F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C4F, 
-0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x646F, 0x644F, 0x644F, 0x644F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 
-0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x646F, 0x646F, 0x6470, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x644F, 0x644F, 0x646F, 0x644F, 0x644F, 0x5C4F, 0x646F, 0x646F, 0x532B, 0x4A69, 0xADB6, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DE, 0xBE99, 0x42A9, 0x0020, 0x0020, 0x08A1, 0x08A2, 0x0881, 0x0020, 0x0020, 
-0x1082, 0x2104, 0x2965, 0x31A6, 0x31A6, 0x31A6, 0x3165, 0x2104, 0x1061, 0x0000, 0x1924, 0x74B1, 0x9657, 0x9616, 0x74F2, 0x74D1, 
-0x8DB5, 0x8DB5, 0x8D94, 0x8D94, 0x8D94, 0x8594, 0x8594, 0x8594, 0x8574, 0x8574, 0x8574, 0x8573, 0x8573, 0x8573, 0x8573, 0x8553, 
-0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8593, 0x8593, 0x8594, 
-0x8594, 0x8594, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DD5, 0x95D5, 0x95F5, 0x95F5, 0x95F6, 0x95F6, 
-0x9616, 0x9E36, 0xA657, 0x95B5, 0x8D74, 0x95F6, 0x9E37, 0x9E37, 0x8D74, 0x3A89, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x1082, 0x3186, 0x4208, 0x39C8, 0x39C7, 0x39C7, 0x3187, 0x3187, 0x3187, 0x31A7, 0x31A7, 0x31A7, 0x3187, 0x31A7, 0x31A7, 
-0x39C7, 0x4208, 0x31A6, 0x2945, 0x20C3, 0x0862, 0x0000, 0x18E4, 0x74D2, 0x9E37, 0x9E17, 0x9E17, 0x95F6, 0x95D6, 0x8D95, 0x8D74, 
-0x8534, 0x7D13, 0x74D0, 0x6CAF, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C8F, 0x6C6F, 0x646F, 0x6C6F, 0x6C6F, 0x6C6F, 0x646F, 0x646F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6C6F, 0x6C6F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6C6F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6490, 0x6490, 0x6490, 0x646F, 0x646F, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 0x6470, 
-0x6470, 0x6470, 0x6470, 0x6470, 0x646F, 0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x642E, 0x642F, 0x642F, 0x642F, 0x5C2F, 0x5C2F, 0x5C2E, 0x5C2E, 0x5C4F, 0x644F, 0x536C, 0x5B4C, 0xBE38, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDE, 0xADF6, 0x29C6, 0x0000, 0x0020, 0x0861, 0x08A1, 0x0081, 0x0861, 0x18E3, 
-0x3186, 0x4229, 0x4A6A, 0x4A6A, 0x4A4A, 0x4A49, 0x4229, 0x39C7, 0x2945, 0x1082, 0x10C2, 0x532B, 0x9616, 0x9E57, 0x74F2, 0x74F2, 
-0x8DB4, 0x8DB5, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8D94, 0x8D94, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 
-0x8594, 0x8594, 0x8594, 0x8594, 0x8594, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DD5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 0x95F6, 0x95F6, 0x9E16, 
-0x9E16, 0x9E16, 0xA657, 0x8DB5, 0x8D94, 0x9DF6, 0x9E36, 0x9E36, 0x7470, 0x1103, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x10A3, 0x39C7, 0x41E8, 0x3186, 0x2925, 0x2945, 0x2944, 0x2103, 0x2924, 0x2945, 0x2945, 0x2946, 0x2966, 0x31A6, 0x3186, 0x3187, 
-0x3187, 0x3186, 0x39C7, 0x39C7, 0x2945, 0x18C3, 0x0821, 0x0821, 0x4269, 0x95B5, 0x9E57, 0x9DF6, 0x95F6, 0x8DB5, 0x8D75, 0x8574, 
-0x8533, 0x7D33, 0x7CF2, 0x74B1, 0x6C90, 0x7490, 0x7490, 0x748F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6C6F, 0x6C6F, 
-0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x5C4F, 0x644F, 0x5C4F, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C4F, 0x540E, 0x7C70, 0xD6DB, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0x9D74, 0x1944, 0x0000, 0x0000, 0x0020, 0x0061, 0x18E3, 0x2985, 0x31A7, 
-0x31A6, 0x39E7, 0x4208, 0x4209, 0x4A6A, 0x526A, 0x4A49, 0x4208, 0x39C7, 0x2124, 0x10A2, 0x3227, 0x8D94, 0x9E57, 0x74F2, 0x74D1, 
-0x8DB4, 0x95D5, 0x8DB5, 0x8DB5, 0x8DB5, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 
-0x8DB5, 0x8DB5, 0x8DB5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x95D5, 
-0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F6, 0x95F6, 0x9616, 0x9616, 0x9E16, 0x9E16, 
-0x9E37, 0x9E37, 0xA657, 0x8DB5, 0x8D94, 0x95F6, 0x9E36, 0x95F6, 0x532B, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 
-0x39C7, 0x39E7, 0x2945, 0x2104, 0x20E3, 0x18A2, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18E3, 0x2124, 0x2124, 0x2945, 0x2966, 0x2965, 
-0x2945, 0x2945, 0x2966, 0x39E7, 0x31A6, 0x2104, 0x1082, 0x0841, 0x1924, 0x6C70, 0x9E57, 0x9E37, 0x95D6, 0x8D95, 0x8574, 0x8554, 
-0x8533, 0x8533, 0x7D12, 0x74D1, 0x74B1, 0x74B0, 0x7490, 0x6C8F, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x6C6F, 0x6C6F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x5C4F, 0x5C4F, 0x5C4F, 0x5C2E, 0x5C2E, 0x642E, 0x5C2E, 0x5C0E, 0x9533, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0x84D1, 0x10C2, 0x0000, 0x0020, 0x0020, 0x10A2, 0x2965, 0x39C7, 0x2965, 
-0x2104, 0x2103, 0x2925, 0x2965, 0x39A7, 0x4228, 0x4208, 0x39C7, 0x39C7, 0x31A7, 0x20E3, 0x2165, 0x74D1, 0x9E37, 0x7512, 0x74D1, 
-0x8DB5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D6, 0x95D6, 0x95F6, 
-0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x9616, 0x9E16, 0x9E16, 0x9E16, 
-0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E17, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E36, 0x9E36, 0x9E36, 0x9E37, 
-0x9E37, 0xA657, 0xA657, 0x8D95, 0x8D94, 0x95F6, 0x9E16, 0x8574, 0x3207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x3186, 
-0x41E7, 0x3185, 0x20E4, 0x18A3, 0x1082, 0x10A2, 0x2104, 0x2104, 0x2104, 0x2104, 0x18C2, 0x18E2, 0x2104, 0x2124, 0x2925, 0x2945, 
-0x2945, 0x2125, 0x2125, 0x3186, 0x3186, 0x2125, 0x18C3, 0x1061, 0x0882, 0x4AEB, 0x95D6, 0x9E57, 0x95F6, 0x8D95, 0x8554, 0x8533, 
-0x7D33, 0x7D33, 0x7D12, 0x7CF2, 0x74D1, 0x74B1, 0x7490, 0x6C90, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x642F, 0x642F, 0x642E, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5BEE, 0x9553, 0xE77D, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x742F, 0x0882, 0x0000, 0x0020, 0x0861, 0x2145, 0x3166, 0x20E3, 0x10A2, 
-0x1082, 0x1082, 0x1081, 0x1082, 0x2104, 0x2945, 0x2966, 0x39C7, 0x31C7, 0x39C7, 0x2925, 0x18C3, 0x5B8D, 0x95F5, 0x7D32, 0x74D1, 
-0x8DB5, 0x9616, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x95F6, 0x9E16, 0x9E16, 0x9E16, 0x9E16, 0x9E17, 0x9E17, 0x9E37, 0x9E37, 0xA637, 
-0x9E37, 0x9E37, 0x9E37, 0xA657, 0xA657, 0xA657, 0xA658, 0xA658, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 
-0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 0xA657, 
-0xA657, 0xA678, 0xA657, 0x8D94, 0x8594, 0x9616, 0x9E16, 0x74B1, 0x2144, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x2124, 0x39C7, 
-0x2965, 0x18C3, 0x1082, 0x18C3, 0x31A7, 0x4A49, 0x52AB, 0x5AEC, 0x5AEC, 0x5ACC, 0x4A6B, 0x39A8, 0x2125, 0x2104, 0x2944, 0x2945, 
-0x2124, 0x2124, 0x2124, 0x2105, 0x2925, 0x2965, 0x18E3, 0x1061, 0x0861, 0x29A6, 0x8513, 0x9E57, 0x95F6, 0x8D95, 0x7D33, 0x8513, 
-0x7D12, 0x7D12, 0x7CF2, 0x7CF2, 0x74D1, 0x74B1, 0x74B0, 0x7490, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x642F, 0x642F, 0x642E, 0x642E, 0x642F, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C2E, 0x5BEE, 0x84F2, 0xDF1B, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77D, 0x6BEE, 0x0861, 0x0000, 0x0040, 0x18E3, 0x3186, 0x2925, 0x1082, 0x1903, 
-0x2965, 0x2965, 0x2104, 0x18C3, 0x18E3, 0x20E3, 0x2104, 0x2945, 0x2986, 0x3186, 0x2925, 0x1082, 0x3A48, 0x8D74, 0x7D32, 0x74B1, 
-0x8DD5, 0x9E37, 0x9E37, 0x9E37, 0x9E37, 0xA637, 0xA658, 0xA658, 0xA658, 0xA678, 0xA678, 0xA678, 0xAE78, 0xAE99, 0xAE99, 0xAE99, 
-0xAE99, 0xAE99, 0xB699, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 
-0xB6B9, 0xB6B9, 0xB6B9, 0xAEB9, 0xAE99, 0xAE99, 0xAE99, 0xAE99, 0xAE98, 0xAE98, 0xAE98, 0xAE98, 0xA678, 0xA678, 0xA678, 0xA678, 
-0xAE78, 0xA678, 0xA657, 0x8D94, 0x8574, 0x9616, 0x95F6, 0x5BCD, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x39A7, 0x3186, 
-0x18E3, 0x1082, 0x2104, 0x4228, 0x73AF, 0x9492, 0x8C92, 0x8C71, 0x8C72, 0x8C73, 0x8C73, 0x73B0, 0x528B, 0x3187, 0x2125, 0x2945, 
-0x2944, 0x2104, 0x2104, 0x2104, 0x2925, 0x2966, 0x2124, 0x10A2, 0x0000, 0x10A2, 0x6C0F, 0x95F6, 0x95F6, 0x8D95, 0x7D33, 0x7CF2, 
-0x7D12, 0x7CF2, 0x74F2, 0x74D1, 0x74D1, 0x74B1, 0x7490, 0x6C90, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 
-0x644F, 0x644F, 0x642F, 0x642F, 0x642F, 0x642F, 0x642E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5BED, 0x7C90, 0xCEBA, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0x63AD, 0x0040, 0x0000, 0x10A2, 0x2965, 0x2125, 0x18E4, 0x39A6, 0x5ACB, 
-0x634D, 0x6B6D, 0x634D, 0x52AA, 0x3185, 0x18C3, 0x20E3, 0x2104, 0x2104, 0x2945, 0x2945, 0x1062, 0x2965, 0x7CF2, 0x7D53, 0x74D1, 
-0x8DD5, 0xA658, 0xA678, 0xAE99, 0xB6B9, 0xB6B9, 0xB6DA, 0xBEDA, 0xBEDA, 0xBEFA, 0xC6FB, 0xC6FB, 0xC71B, 0xC71B, 0xCF1B, 0xCF3B, 
-0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF5C, 0xCF5C, 0xCF5C, 0xCF5C, 0xCF5C, 0xCF5C, 0xCF5C, 0xCF3C, 0xD73C, 0xD73C, 
-0xCF3C, 0xCF3C, 0xCF3C, 0xCF3B, 0xCF1B, 0xC71B, 0xC71B, 0xC71B, 0xC6FB, 0xC6FB, 0xBEFA, 0xBEDA, 0xBEDA, 0xBEDA, 0xB6B9, 0xB699, 
-0xB699, 0xAE99, 0xA657, 0x8D94, 0x8573, 0x9636, 0x8DB4, 0x42EA, 0x0041, 0x0000, 0x0000, 0x0000, 0x0862, 0x3186, 0x31A6, 0x18E3, 
-0x10A3, 0x2945, 0x52AB, 0x7BCF, 0x8C71, 0x9CF3, 0xA555, 0xAD95, 0xAD95, 0xA554, 0x9CF3, 0x9493, 0x8412, 0x630E, 0x39C8, 0x2125, 
-0x2944, 0x2124, 0x2104, 0x2104, 0x2105, 0x2925, 0x2945, 0x2104, 0x0841, 0x0020, 0x4ACB, 0x8D94, 0x9616, 0x8DB5, 0x7D33, 0x7CF2, 
-0x7CF2, 0x7CF2, 0x74D1, 0x74D1, 0x74D1, 0x74B0, 0x6C90, 0x6C90, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 
-0x642F, 0x642F, 0x642E, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5C0E, 0x5BED, 0x6C4F, 0xBE38, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75D, 0x5B8D, 0x0020, 0x0841, 0x20E4, 0x2125, 0x2125, 0x4A49, 0x6B6D, 0x738E, 
-0x7BEF, 0x8430, 0x8451, 0x7C30, 0x634D, 0x39C7, 0x18C3, 0x20E3, 0x2124, 0x2945, 0x2145, 0x1062, 0x18E3, 0x6C2F, 0x7D53, 0x74F2, 
-0x95F6, 0xAE99, 0xB6DA, 0xBEFA, 0xC71B, 0xC73B, 0xCF5C, 0xCF5C, 0xD75C, 0xD77D, 0xD77D, 0xDF7D, 0xDF7D, 0xDF9D, 0xDF9D, 0xDF9E, 
-0xDF9E, 0xDF9E, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 0xE7BE, 
-0xE7BE, 0xE7BE, 0xDF9E, 0xDF9D, 0xDF9D, 0xDF9D, 0xDF7D, 0xDF7D, 0xD75D, 0xD75D, 0xD75C, 0xCF3C, 0xCF3C, 0xCF1B, 0xC6FB, 0xBEFA, 
-0xBEDA, 0xB6B9, 0x9E37, 0x8D74, 0x8553, 0x9636, 0x8553, 0x3227, 0x0000, 0x0000, 0x0000, 0x0020, 0x18E3, 0x31A6, 0x2104, 0x10A2, 
-0x2145, 0x5B0B, 0x7C0F, 0x8C71, 0xAD75, 0xCE79, 0xE71C, 0xE73C, 0xE75C, 0xE71B, 0xD69A, 0xB5D7, 0x9CF4, 0x8432, 0x632E, 0x3187, 
-0x2104, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2945, 0x2104, 0x1061, 0x0000, 0x29A6, 0x84F2, 0x9616, 0x8D94, 0x7D13, 0x74F2, 
-0x74F2, 0x74F2, 0x74D1, 0x74D1, 0x74B1, 0x74B0, 0x6CB0, 0x6C90, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 0x642F, 
-0x642F, 0x642F, 0x642F, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5C0E, 0x5BEE, 0x642F, 0xADD6, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77D, 0x638D, 0x0040, 0x1082, 0x20E4, 0x2124, 0x3A08, 0x6BAE, 0x8C92, 0xA534, 
-0xB5D6, 0xC638, 0xBE38, 0xB5D7, 0x94F4, 0x634D, 0x31A7, 0x2125, 0x2924, 0x2945, 0x2145, 0x1082, 0x10A2, 0x5BAD, 0x7D53, 0x7D32, 
-0x95B5, 0xA658, 0xA658, 0xAE58, 0xAE78, 0xAE78, 0xB679, 0xB679, 0xB699, 0xB699, 0xB699, 0xB699, 0xB699, 0xB699, 0xB699, 0xB699, 
-0xB699, 0xB699, 0xB699, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xB6B9, 0xBEBA, 0xBEBA, 0xBEBA, 0xBEBA, 0xBEBA, 0xBEBA, 0xBEBA, 
-0xBEBA, 0xBEBA, 0xBEBA, 0xB6B9, 0xB699, 0xB699, 0xB6B9, 0xB6B9, 0xB699, 0xB699, 0xB699, 0xB699, 0xB699, 0xAE99, 0xAE99, 0xAE78, 
-0xAE78, 0xA678, 0x95F6, 0x8554, 0x8553, 0x9636, 0x7CF1, 0x2185, 0x0000, 0x0000, 0x0000, 0x0861, 0x2945, 0x3166, 0x20E3, 0x2124, 
-0x52AA, 0x840F, 0x94B2, 0xBDD7, 0xDF1C, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BF, 0xF7BF, 0xEF9E, 0xE73C, 0xC679, 0xA555, 0x8432, 0x52AC, 
-0x2925, 0x2104, 0x2124, 0x2104, 0x2104, 0x2104, 0x20E4, 0x18E4, 0x1082, 0x0000, 0x10E3, 0x7450, 0x9616, 0x8DB5, 0x8533, 0x74D1, 
-0x74D1, 0x74D2, 0x74D1, 0x74B1, 0x74B0, 0x74B0, 0x6C90, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 
-0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 0x642F, 
-0x642F, 0x642F, 0x642F, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5C0E, 0x5BED, 0x5C0E, 0x9D95, 0xF7DF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x63AD, 0x0861, 0x10A3, 0x18E4, 0x31C7, 0x6B4C, 0x94B2, 0xBDF7, 0xDF1C, 
-0xEF9E, 0xEF7E, 0xEF7D, 0xE73C, 0xC659, 0x9CF3, 0x5AEC, 0x2986, 0x2924, 0x2124, 0x2124, 0x1062, 0x1082, 0x4AEA, 0x8533, 0x7D53, 
-0x8594, 0x9616, 0x95F6, 0x95F5, 0x95F6, 0x95F5, 0x95F5, 0x95F5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 
-0x95D5, 0x95D5, 0x8DD5, 0x8DD5, 0x8DD5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 
-0x95F5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F6, 0x95F6, 0x9DF6, 0x95F6, 0x95F6, 0x95F6, 
-0x9E16, 0x9E36, 0x95B5, 0x7D33, 0x8573, 0x95F6, 0x6C50, 0x1903, 0x0000, 0x0000, 0x0000, 0x18A3, 0x2965, 0x2124, 0x18E3, 0x4A49, 
-0x7BEF, 0x94B2, 0xC639, 0xEF5D, 0xEF9E, 0xEF7D, 0xE75D, 0xEF7D, 0xEF7E, 0xE75D, 0xE75D, 0xE77D, 0xE75D, 0xD6BB, 0xA555, 0x7BF0, 
-0x3A09, 0x18E4, 0x2103, 0x2124, 0x2124, 0x1904, 0x2104, 0x2104, 0x18E3, 0x0020, 0x0821, 0x5B6D, 0x8DD5, 0x8DD5, 0x8533, 0x74D1, 
-0x74B1, 0x74D1, 0x74D1, 0x74B1, 0x7490, 0x7490, 0x6C90, 0x6C70, 0x6C4F, 0x644E, 0x646F, 0x646F, 0x646F, 0x644F, 0x646F, 0x646E, 
-0x644F, 0x644F, 0x644F, 0x646F, 0x646E, 0x646E, 0x646E, 0x646E, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646E, 0x646E, 0x646E, 
-0x646F, 0x646F, 0x644F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x646F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x642F, 0x642F, 0x642F, 0x642F, 0x642F, 0x642F, 0x642E, 0x642E, 0x642E, 0x644E, 
-0x642F, 0x644E, 0x642E, 0x642E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0E, 0x5BEE, 0x540D, 0x53ED, 0x5BED, 0x9554, 0xF7BE, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0x6BCE, 0x1082, 0x10A3, 0x2145, 0x5AEB, 0x8C70, 0xC637, 0xEF7D, 0xF7DF, 
-0xEF9E, 0xEF9E, 0xE73C, 0xE75D, 0xE75D, 0xC659, 0x8C72, 0x3A08, 0x2924, 0x2124, 0x2104, 0x0862, 0x1082, 0x3A48, 0x7CF2, 0x8594, 
-0x8573, 0x95F6, 0x95F6, 0x95F5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DB5, 0x8DB5, 0x8DB5, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB5, 0x8DB5, 0x8DB5, 
-0x8DD5, 0x8DB5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 
-0x9616, 0x9E16, 0x8D94, 0x7D32, 0x8573, 0x8DD5, 0x5BCE, 0x08C2, 0x0000, 0x0000, 0x0841, 0x2104, 0x2945, 0x18E3, 0x31A6, 0x6B4D, 
-0x9491, 0xBDF7, 0xEF7D, 0xF7BF, 0xE75D, 0xE75D, 0xE75D, 0xE73C, 0xE73C, 0xEF7E, 0xEF7D, 0xE73D, 0xEF7D, 0xEF7E, 0xCE7A, 0x9CF4, 
-0x5B0D, 0x2966, 0x20E3, 0x2924, 0x2945, 0x2125, 0x2104, 0x2104, 0x1903, 0x0821, 0x0000, 0x4ACA, 0x8594, 0x8DD5, 0x8553, 0x74D1, 
-0x74B0, 0x74D1, 0x74D1, 0x74B1, 0x7490, 0x6C90, 0x74B1, 0x8D33, 0x8D13, 0x7CB2, 0x7C92, 0x7C92, 0x7491, 0x7471, 0x6C71, 0x6C71, 
-0x6C70, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 0x644F, 
-0x644F, 0x644F, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 0x644E, 
-0x5C4E, 0x5C4E, 0x5C4E, 0x5C4E, 0x5C4E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x642E, 
-0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C2E, 0x5C0E, 0x5C0D, 0x5C0E, 0x5C0D, 0x5BCD, 0x8D13, 0xEF9D, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x740F, 0x18C3, 0x18E3, 0x39E7, 0x73AE, 0xB5B6, 0xE75C, 0xF7DF, 0xDEFC, 
-0xBE18, 0xBE18, 0xD6DB, 0xE73D, 0xE75D, 0xDF1C, 0xADB6, 0x5B2D, 0x2965, 0x2104, 0x2104, 0x1082, 0x1082, 0x31C7, 0x74B1, 0x8594, 
-0x8573, 0x95F5, 0x95F6, 0x95F6, 0x95F5, 0x95F5, 0x95F5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DD5, 0x8DD5, 0x95D5, 
-0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 0x95F6, 0x95F6, 0x95F6, 
-0x9E16, 0x9E37, 0x8D94, 0x7D12, 0x8573, 0x8D94, 0x4B2B, 0x0861, 0x0000, 0x0000, 0x10A2, 0x2965, 0x2124, 0x18E3, 0x528A, 0x8430, 
-0xAD54, 0xDEFB, 0xF7BF, 0xF79E, 0xEF9E, 0xEF7E, 0xE71C, 0xAD96, 0x8451, 0xA535, 0xD6DB, 0xEF7D, 0xEF7E, 0xEF9E, 0xE73C, 0xBDF8, 
-0x8451, 0x4209, 0x20E4, 0x2124, 0x2945, 0x2125, 0x2104, 0x2103, 0x18E3, 0x0841, 0x0000, 0x3207, 0x7D32, 0x8DF5, 0x8553, 0x74D1, 
-0x74B0, 0x74B0, 0x6CB0, 0x74B1, 0x6C90, 0x6C70, 0x7491, 0xA576, 0xAD97, 0x94D4, 0x8472, 0x8472, 0x8472, 0x7C72, 0x7C52, 0x7C52, 
-0x7C52, 0x7C52, 0x7C51, 0x7451, 0x7451, 0x7452, 0x7452, 0x7451, 0x7451, 0x7451, 0x7451, 0x7451, 0x7451, 0x7471, 0x7471, 0x7471, 
-0x7471, 0x7471, 0x7471, 0x7471, 0x7471, 0x7471, 0x7471, 0x7471, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C70, 0x6C70, 0x6C70, 
-0x6C71, 0x6C71, 0x6C71, 0x6C71, 0x6C71, 0x6C71, 0x7471, 0x7491, 0x7491, 0x7491, 0x7491, 0x7471, 0x7471, 0x7471, 0x7471, 0x6C70, 
-0x6C71, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C50, 0x6C51, 0x6C51, 0x6C51, 0x63EF, 0x8CD2, 0xE75C, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8CD2, 0x18E3, 0x18E3, 0x52AA, 0x9492, 0xD6DB, 0xF7DE, 0xD6BB, 0x7C10, 
-0x4228, 0x5ACB, 0xB5B6, 0xE75D, 0xE73D, 0xE75D, 0xCE7A, 0x8451, 0x31C7, 0x2104, 0x2104, 0x1082, 0x0862, 0x2165, 0x7470, 0x8594, 
-0x8553, 0x95F5, 0x95F6, 0x95F5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x8DD5, 0x8DD5, 0x8DD5, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DD5, 0x8DD5, 
-0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 
-0x9E16, 0x9E37, 0x8D74, 0x7D12, 0x8573, 0x8573, 0x42A9, 0x0861, 0x0000, 0x0000, 0x18E3, 0x31A6, 0x2104, 0x2965, 0x6B4D, 0x94B2, 
-0xC658, 0xEF9E, 0xF7BE, 0xDEDB, 0xD6DB, 0xDEDB, 0xBDD7, 0x6B6E, 0x2104, 0x2145, 0x7BCF, 0xD6BB, 0xF79E, 0xE75D, 0xE75D, 0xD6DB, 
-0xA535, 0x5AED, 0x2946, 0x2103, 0x2124, 0x2925, 0x20E4, 0x18E3, 0x18C3, 0x0862, 0x0000, 0x2165, 0x74B1, 0x95F6, 0x8554, 0x74D1, 
-0x74B0, 0x74B0, 0x6C90, 0x74B1, 0x6C90, 0x644F, 0x6BEF, 0x8C72, 0x9C92, 0x7BAF, 0x734D, 0x6B4D, 0x734D, 0x736E, 0x736E, 0x736E, 
-0x736E, 0x736E, 0x738E, 0x738F, 0x73AF, 0x73AF, 0x73CF, 0x73CF, 0x73D0, 0x73D0, 0x73D0, 0x7BF0, 0x7BF1, 0x7C11, 0x7C11, 0x7C11, 
-0x8452, 0x8452, 0x8452, 0x8472, 0x8473, 0x8473, 0x8473, 0x8473, 0x8473, 0x8493, 0x8493, 0x8493, 0x8C93, 0x8C93, 0x8493, 0x8493, 
-0x8493, 0x8493, 0x8493, 0x8472, 0x8493, 0x8493, 0x8493, 0x8CB3, 0x8CD4, 0x8CD4, 0x8CD4, 0x8CD4, 0x8CD4, 0x8CB4, 0x8CB3, 0x8493, 
-0x8472, 0x7C52, 0x7C32, 0x7C31, 0x7C31, 0x7C31, 0x7C31, 0x7C32, 0x7C32, 0x7432, 0x6BD1, 0x636E, 0x8491, 0xE73C, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xADB6, 0x2945, 0x2124, 0x6B6D, 0xBDD7, 0xE75D, 0xD6BA, 0x8430, 0x3A08, 
-0x39C7, 0x4A69, 0x9CF3, 0xDF1C, 0xE75D, 0xE75D, 0xDF3C, 0xA555, 0x4249, 0x2104, 0x2104, 0x10A2, 0x1082, 0x1904, 0x640F, 0x85B4, 
-0x7D33, 0x95D5, 0x95F5, 0x95D5, 0x95D5, 0x95D5, 0x8DB4, 0x8DB4, 0x8DD4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DD5, 
-0x95B5, 0x95B5, 0x8DD5, 0x95D5, 0x95D5, 0x95B5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 
-0x9E16, 0x9E16, 0x8573, 0x7D12, 0x8573, 0x8553, 0x3A68, 0x0041, 0x0000, 0x0020, 0x2104, 0x3186, 0x2104, 0x4228, 0x7BEF, 0xAD75, 
-0xE73D, 0xF7DF, 0xD6DB, 0x8431, 0x738E, 0x8C91, 0x8C72, 0x73CF, 0x5AEC, 0x39E8, 0x2966, 0x73AF, 0xD69A, 0xE75D, 0xE75D, 0xDF3C, 
-0xBDF8, 0x7BF1, 0x39C8, 0x18E3, 0x2104, 0x2925, 0x18E4, 0x18C3, 0x18C3, 0x1082, 0x0821, 0x1904, 0x642F, 0x8DD5, 0x8573, 0x74D1, 
-0x6C90, 0x74B1, 0x7491, 0x74B0, 0x6CB0, 0x6C90, 0x6BCE, 0x8410, 0x8C10, 0x734D, 0x6B0B, 0x6B0B, 0x6B0B, 0x6B0B, 0x6AEB, 0x6AEB, 
-0x6AEB, 0x6AEB, 0x6AEB, 0x62EB, 0x62EB, 0x62EB, 0x62EB, 0x62EB, 0x62EC, 0x62EC, 0x62EC, 0x62EC, 0x62EC, 0x630C, 0x630C, 0x630C, 
-0x630C, 0x630C, 0x630D, 0x632D, 0x632D, 0x632D, 0x632D, 0x6B2D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4E, 0x6B6E, 0x6B6E, 0x6B6E, 0x6B4E, 
-0x6B4E, 0x6B4D, 0x6B4D, 0x6B2D, 0x632D, 0x632D, 0x6B2D, 0x6B4D, 0x6B4E, 0x6B6E, 0x6B6E, 0x6B6E, 0x6B6E, 0x6B4E, 0x6B4D, 0x632D, 
-0x632C, 0x630C, 0x62EC, 0x5AEC, 0x5ACB, 0x5ACB, 0x5ACB, 0x5ACB, 0x52CB, 0x52AB, 0x528B, 0x4AAA, 0x7C50, 0xDF3B, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC658, 0x39C7, 0x31A6, 0x8430, 0xD6BA, 0xEF9E, 0xAD75, 0x52CB, 0x52AA, 
-0x5B0B, 0x5B0C, 0x7BEF, 0xA555, 0xCE79, 0xE73C, 0xEF9E, 0xC659, 0x634E, 0x2125, 0x18E3, 0x18C3, 0x1082, 0x10C3, 0x63AD, 0x8593, 
-0x7D32, 0x8DD5, 0x95F5, 0x8DD5, 0x8DD5, 0x95D5, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DD5, 0x8DD5, 0x8DD5, 0x95B5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 
-0x9E16, 0x9E16, 0x8553, 0x7CF2, 0x8573, 0x7D32, 0x3227, 0x0020, 0x0000, 0x0841, 0x2104, 0x2965, 0x2124, 0x5ACB, 0x8C71, 0xC638, 
-0xFFFF, 0xE75D, 0x8C92, 0x4249, 0x5AEB, 0x8410, 0x7C10, 0x8431, 0x8C72, 0x8C52, 0x528B, 0x3166, 0x8410, 0xDEDB, 0xE75D, 0xE75C, 
-0xCE9A, 0x94D4, 0x4A6A, 0x18E3, 0x2104, 0x2945, 0x18E4, 0x18C3, 0x18C3, 0x1082, 0x0841, 0x10C3, 0x5BCD, 0x8DD5, 0x8573, 0x74D1, 
-0x6C90, 0x6C90, 0x6C90, 0x7490, 0x6CB0, 0x6C6F, 0x6BEE, 0x8C71, 0x9CB2, 0x840F, 0x738D, 0x736D, 0x736C, 0x734C, 0x6B2C, 0x6B4C, 
-0x6B2B, 0x6B2B, 0x6B0B, 0x630B, 0x630B, 0x630B, 0x630B, 0x62EB, 0x62EB, 0x62EB, 0x5ACA, 0x5ACA, 0x5AAA, 0x5AAA, 0x5AAA, 0x5AAA, 
-0x528A, 0x528A, 0x528A, 0x52AA, 0x5289, 0x5289, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 
-0x528A, 0x528A, 0x526A, 0x5269, 0x5269, 0x4A69, 0x4A69, 0x5269, 0x4A69, 0x4A69, 0x5269, 0x4A69, 0x4A69, 0x4A69, 0x4A49, 0x4A49, 
-0x4A49, 0x4A48, 0x4A48, 0x5248, 0x4A48, 0x4A48, 0x4A28, 0x4A28, 0x4A08, 0x4A29, 0x4A29, 0x4A8A, 0x7C4F, 0xD6FA, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC659, 0x4229, 0x4228, 0x9CD3, 0xE73C, 0xEF9E, 0x9D14, 0x632C, 0x6B4C, 
-0x73CF, 0x73AF, 0x6B6D, 0x632C, 0x8C71, 0xD6BA, 0xEF9E, 0xD6BB, 0x73D0, 0x3186, 0x20E3, 0x18E3, 0x0862, 0x1082, 0x5B6C, 0x7D73, 
-0x7D12, 0x8DB5, 0x9616, 0x95F5, 0x95D5, 0x95D5, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x95B4, 0x8DD5, 0x95B5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 
-0x9E16, 0x9E16, 0x8553, 0x74F1, 0x8594, 0x7D12, 0x2A07, 0x0000, 0x0000, 0x0861, 0x2124, 0x2965, 0x2965, 0x6B4D, 0xA514, 0xDEFB, 
-0xFFFF, 0xBE18, 0x52AB, 0x528A, 0x8410, 0x8C71, 0x8431, 0x8451, 0x8C92, 0x94B3, 0x8411, 0x39E8, 0x4229, 0xB596, 0xE75D, 0xE75D, 
-0xD6DB, 0xAD76, 0x5AEC, 0x18E4, 0x2104, 0x2924, 0x2104, 0x18C3, 0x18C3, 0x10A2, 0x0841, 0x1082, 0x536C, 0x8DB4, 0x8573, 0x74D1, 
-0x74B0, 0x6C90, 0x6C90, 0x74B0, 0x74B0, 0x6C6F, 0x6C0E, 0x8470, 0xA534, 0x9CB2, 0x8410, 0x83CF, 0x7BCE, 0x7BCE, 0x7BAE, 0x7BAE, 
-0x7B8D, 0x7B8D, 0x738D, 0x738D, 0x738D, 0x738D, 0x738D, 0x738D, 0x736D, 0x736D, 0x736D, 0x6B4D, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B2C, 
-0x6B2C, 0x6B2C, 0x6B2C, 0x6B2C, 0x630C, 0x630B, 0x630B, 0x630B, 0x630B, 0x62EB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5ACB, 
-0x5ACA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x5AEB, 0x62EB, 0x630B, 0x630B, 0x62EB, 0x62EB, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x5AEB, 
-0x5AEB, 0x62EB, 0x62EB, 0x62EB, 0x62EB, 0x62EB, 0x62EB, 0x5AEB, 0x62CC, 0x62EC, 0x62EC, 0x5B2C, 0x7430, 0xCEBA, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x4A49, 0x5B0C, 0xAD95, 0xEF9D, 0xE73C, 0x94B2, 0x5B0B, 0x738E, 
-0x8451, 0x8C92, 0x7C10, 0x52AA, 0x5AEB, 0xAD96, 0xCE79, 0x94D3, 0x5B2D, 0x39A7, 0x20E3, 0x18C2, 0x1061, 0x0841, 0x4B0B, 0x7D52, 
-0x74F2, 0x7512, 0x74F1, 0x74F1, 0x7D12, 0x7D12, 0x7D32, 0x7D32, 0x7D12, 0x7D12, 0x7D12, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D53, 
-0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8573, 0x8573, 0x8573, 0x8573, 0x8573, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 
-0x8DD5, 0x8DD4, 0x8DD5, 0x8DD5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95F5, 0x95F5, 0x95F5, 0x9DF5, 0x9DF5, 0x9616, 0x9E16, 0x9E16, 
-0xA657, 0x9E36, 0x8553, 0x74F1, 0x8DB4, 0x7CF2, 0x29E6, 0x0000, 0x0000, 0x1082, 0x2124, 0x2945, 0x31A6, 0x738E, 0xBDD7, 0xEF9E, 
-0xEF9E, 0x94D2, 0x4A49, 0x738E, 0x8C71, 0x8430, 0x94B3, 0x9D15, 0x9CF4, 0x94B3, 0x8C72, 0x630D, 0x4229, 0x9492, 0xDEFB, 0xE75D, 
-0xDF1C, 0xBDF8, 0x6B8E, 0x2125, 0x2104, 0x2924, 0x2104, 0x18C3, 0x18C3, 0x10A2, 0x0841, 0x0861, 0x4B2B, 0x8DB4, 0x8593, 0x7D12, 
-0x74B0, 0x6C90, 0x6CB0, 0x6C90, 0x6C8F, 0x6C8F, 0x6C2E, 0x740F, 0x9470, 0x9491, 0x8C10, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 
-0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAD, 0x7BAD, 
-0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7BAE, 0x7B8D, 0x738D, 0x738D, 0x738D, 0x738D, 0x736D, 0x736D, 0x736D, 0x736D, 0x736D, 0x736D, 
-0x6B6D, 0x6B6D, 0x736D, 0x738D, 0x738D, 0x738D, 0x73AD, 0x73AE, 0x73AE, 0x73AD, 0x738D, 0x738D, 0x738D, 0x738D, 0x738D, 0x738D, 
-0x738D, 0x736D, 0x736D, 0x736D, 0x736D, 0x736D, 0x6B6D, 0x6B6D, 0x6B4C, 0x6B6C, 0x6B6C, 0x6BAD, 0x7450, 0xC6BA, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x4228, 0x6B6D, 0xBDF7, 0xEF9E, 0xC618, 0x73AE, 0x5B0B, 0x7BF0, 
-0x8492, 0x94B4, 0x8C93, 0x6B6E, 0x5B0C, 0x94B2, 0x8CB2, 0x31C7, 0x31A7, 0x3A08, 0x20E3, 0x18E3, 0x0861, 0x0821, 0x4289, 0x7D32, 
-0x7D53, 0x646F, 0x53AD, 0x536C, 0x536C, 0x5B8C, 0x5B8C, 0x538C, 0x538C, 0x538C, 0x538C, 0x53AD, 0x5BAD, 0x5BCD, 0x5BCD, 0x5BCD, 
-0x5BED, 0x63EE, 0x63EE, 0x640E, 0x63EE, 0x640E, 0x642F, 0x642F, 0x642F, 0x642F, 0x642F, 0x6C4F, 0x6C4F, 0x6C70, 0x6C70, 0x7490, 
-0x6C90, 0x6C90, 0x74B0, 0x74B1, 0x74B1, 0x74D1, 0x74D1, 0x7CF1, 0x7CF1, 0x7CF2, 0x7D12, 0x7D12, 0x7D12, 0x7D12, 0x8532, 0x8532, 
-0x8553, 0x8532, 0x646F, 0x6CB0, 0x8DD4, 0x7D11, 0x29E6, 0x0000, 0x0000, 0x10A3, 0x2925, 0x2945, 0x4228, 0x7BEF, 0xC639, 0xFFFF, 
-0xD6DB, 0x73AE, 0x630C, 0x7BEF, 0x8431, 0x8C92, 0x9D15, 0x9D35, 0x9D15, 0x94B4, 0x8452, 0x73AF, 0x738E, 0xA514, 0xDEFB, 0xE73C, 
-0xDF1C, 0xC639, 0x73CF, 0x2945, 0x20E3, 0x2104, 0x2104, 0x18C3, 0x10A2, 0x0882, 0x0841, 0x0020, 0x42CA, 0x8574, 0x8574, 0x7CF2, 
-0x74B0, 0x6C90, 0x6C8F, 0x7490, 0x6C8F, 0x7490, 0x6C6F, 0x5C0D, 0x6BAD, 0x6BAD, 0x6B6D, 0x632C, 0x62EB, 0x62EB, 0x630C, 0x62EC, 
-0x630B, 0x630B, 0x630B, 0x630B, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x630C, 0x6B0C, 0x6B0C, 
-0x6B2C, 0x6B2C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B2C, 0x6B2C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B2D, 0x6B2D, 0x6B2D, 
-0x6B2C, 0x6B2C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B4C, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4D, 0x6B4C, 0x6B2C, 0x6B2C, 0x6B2C, 
-0x6B2C, 0x6B2C, 0x6B2C, 0x6B2C, 0x632C, 0x632C, 0x632C, 0x630B, 0x630B, 0x632C, 0x6B8D, 0x63CD, 0x7450, 0xD6BA, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xB596, 0x4228, 0x73AE, 0xC659, 0xDEFC, 0x94D3, 0x634C, 0x6B8E, 0x73F0, 
-0x73F0, 0x7C11, 0x8C72, 0x73CF, 0x5B0C, 0x7C30, 0x8CB2, 0x3A08, 0x39C7, 0x39C7, 0x18E3, 0x18E3, 0x0862, 0x0000, 0x31E7, 0x74D1, 
-0x95D5, 0x8553, 0x74B1, 0x6C4F, 0x6C2F, 0x640E, 0x640E, 0x5C0E, 0x63EE, 0x63EE, 0x63CE, 0x63CD, 0x5BCD, 0x5BCD, 0x5BAD, 0x5BAD, 
-0x5BAD, 0x5BAD, 0x5B8C, 0x5B8C, 0x5B8C, 0x5B8C, 0x5BAD, 0x534B, 0x42C9, 0x4AEA, 0x4B0B, 0x4B0B, 0x4AEA, 0x4AEA, 0x42EA, 0x42CA, 
-0x42CA, 0x42CA, 0x42CA, 0x42CA, 0x42CA, 0x42CA, 0x42CA, 0x4AEA, 0x4AEA, 0x4AEA, 0x4AEA, 0x42EA, 0x4AEA, 0x4AEA, 0x4AEA, 0x4AEA, 
-0x42EA, 0x42C9, 0x430B, 0x7490, 0x9DF5, 0x7D12, 0x29E6, 0x0000, 0x0000, 0x10A3, 0x2125, 0x2945, 0x4A49, 0x8430, 0xCE9A, 0xFFFF, 
-0xBDF8, 0x6B4D, 0x6B6D, 0x7BEF, 0x8431, 0x8C72, 0x8C72, 0x8431, 0x8451, 0x8451, 0x7C10, 0x73CF, 0x8C72, 0xBE18, 0xDF1C, 0xDF1C, 
-0xDF1C, 0xCE7A, 0x7C10, 0x2966, 0x20E4, 0x2104, 0x2104, 0x18C3, 0x1082, 0x0882, 0x0840, 0x0000, 0x3A68, 0x7D12, 0x7D53, 0x7CD1, 
-0x7490, 0x6C6F, 0x6C6F, 0x6C8F, 0x6C6F, 0x6C6F, 0x6C6F, 0x642E, 0x63CD, 0x5B8C, 0x534B, 0x532B, 0x530A, 0x4ACA, 0x4AA9, 0x4AC9, 
-0x4AA9, 0x4AA9, 0x4A89, 0x4A89, 0x4289, 0x4A69, 0x4268, 0x4268, 0x4A48, 0x4A48, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 0x4248, 
-0x4228, 0x4228, 0x4228, 0x4A28, 0x4A28, 0x4A28, 0x4A28, 0x4228, 0x4228, 0x4228, 0x4A28, 0x4A48, 0x4A48, 0x4A48, 0x4A48, 0x4A48, 
-0x4A48, 0x4A48, 0x4A48, 0x4A48, 0x4A48, 0x4A48, 0x4A48, 0x4A48, 0x4A68, 0x4A69, 0x4A69, 0x4A69, 0x4A89, 0x4A89, 0x5289, 0x5289, 
-0x4AA9, 0x4ACA, 0x52CA, 0x52EA, 0x52EA, 0x52EA, 0x52EA, 0x52EA, 0x4B0A, 0x5B4B, 0x5B8C, 0x5BCD, 0x7CB1, 0xDEFB, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xAD55, 0x4208, 0x7C0F, 0xCE99, 0xC659, 0x73CF, 0x632C, 0x73CF, 0x73AF, 
-0x634D, 0x73AF, 0x7C10, 0x73AF, 0x5AEB, 0x73CF, 0xBE39, 0xADB7, 0x7BCF, 0x39E7, 0x18A2, 0x20E3, 0x1082, 0x0000, 0x2145, 0x644F, 
-0x8DD5, 0x8DB4, 0x8D94, 0x8D94, 0x8D74, 0x8D73, 0x8573, 0x8573, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 
-0x8552, 0x8552, 0x8532, 0x8532, 0x8532, 0x8532, 0x8D73, 0x74D1, 0x640E, 0x7490, 0x8512, 0x8512, 0x7CF2, 0x7CF1, 0x7CF1, 0x7CD1, 
-0x7CD1, 0x74B1, 0x74B1, 0x7490, 0x7490, 0x7490, 0x7470, 0x7470, 0x744F, 0x742F, 0x6C2F, 0x6C0F, 0x6C0F, 0x6C0E, 0x6C0E, 0x6BEE, 
-0x63EE, 0x63CE, 0x744F, 0x8D53, 0x9E36, 0x7D12, 0x2A07, 0x0021, 0x0000, 0x10A3, 0x2125, 0x2945, 0x4A69, 0x8C71, 0xD6BA, 0xF7DF, 
-0xA555, 0x5AEC, 0x73AE, 0x7BCF, 0x7BF0, 0x7C10, 0x73CF, 0x6B8E, 0x73AE, 0x7C10, 0x7C10, 0x6B8E, 0x8451, 0xBE18, 0xDF1C, 0xDEFC, 
-0xDF1C, 0xCE9A, 0x8451, 0x3186, 0x20E3, 0x2104, 0x2104, 0x10A3, 0x1082, 0x1082, 0x0861, 0x0000, 0x29C6, 0x6C90, 0x7511, 0x74B0, 
-0x6C6F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C4F, 0x6C4E, 0x6C4E, 0x642E, 0x642E, 0x640D, 0x5BED, 0x5BED, 0x63ED, 0x5BCC, 0x5BCC, 0x5BCC, 
-0x5BAC, 0x5B8C, 0x538C, 0x536B, 0x536B, 0x534B, 0x534B, 0x4B2A, 0x4B0A, 0x4B0A, 0x4B0A, 0x4AEA, 0x42EA, 0x42C9, 0x42C9, 0x42C9, 
-0x42A9, 0x42A9, 0x4289, 0x4288, 0x4288, 0x4288, 0x4288, 0x4288, 0x4268, 0x4268, 0x4268, 0x3A68, 0x3A68, 0x4268, 0x4268, 0x4268, 
-0x3A68, 0x3A68, 0x3A68, 0x4288, 0x4288, 0x4288, 0x42A9, 0x42A9, 0x42A9, 0x42A9, 0x42C9, 0x42C9, 0x42C9, 0x4AEA, 0x4AEA, 0x4B0A, 
-0x4B2A, 0x534B, 0x534B, 0x536B, 0x536B, 0x536C, 0x536C, 0x536C, 0x538C, 0x5BAC, 0x5BAD, 0x53AC, 0x84F1, 0xE75C, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xA534, 0x4228, 0x8430, 0xCE7A, 0xBDF8, 0x73AF, 0x634D, 0x73AF, 0x6B8E, 
-0x634C, 0x6B8E, 0x73AF, 0x6B8E, 0x52CB, 0x6B6E, 0xD6DB, 0xEF9E, 0xA534, 0x39C7, 0x1061, 0x2103, 0x1082, 0x0000, 0x10C3, 0x5BAD, 
-0x8DB4, 0x8DB4, 0x8D94, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DD4, 0x8DB4, 0x8DD4, 0x8DD4, 0x8DD4, 0x8DD4, 0x8DD4, 0x8DD4, 0x8DD4, 
-0x95D4, 0x95D4, 0x95F5, 0x95D4, 0x95D4, 0x95F5, 0x9E36, 0x8D73, 0x6C90, 0x8533, 0x9E15, 0x9E16, 0x9615, 0x9E15, 0x9E16, 0x9615, 
-0x9616, 0x9616, 0x9616, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95F5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95B5, 0x95B4, 0x8D94, 
-0x9594, 0x8D94, 0x95B5, 0x95D5, 0x95F5, 0x7D32, 0x3227, 0x0020, 0x0000, 0x10A3, 0x2124, 0x2965, 0x5289, 0x8C71, 0xD69A, 0xF7BE, 
-0xA535, 0x630C, 0x738E, 0x7BCF, 0x7BF0, 0x73CF, 0x6B8E, 0x6B6E, 0x6B8E, 0x7C0F, 0x7C10, 0x738E, 0x7BF0, 0xAD96, 0xDEFC, 0xDF1C, 
-0xDEFC, 0xCE9A, 0x8C72, 0x31A6, 0x18C3, 0x2103, 0x18E3, 0x10A2, 0x0861, 0x0861, 0x1062, 0x0000, 0x1903, 0x5BCD, 0x6CB0, 0x6C8F, 
-0x6C4F, 0x6C4F, 0x6C4F, 0x6C4F, 0x6C4E, 0x6C4E, 0x642E, 0x642D, 0x640D, 0x642D, 0x644E, 0x642D, 0x642D, 0x642E, 0x642D, 0x642D, 
-0x640D, 0x640D, 0x5C0D, 0x5BED, 0x5BED, 0x5BED, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x53CC, 0x53AC, 0x53AC, 0x53AC, 0x538C, 0x538C, 
-0x538C, 0x538B, 0x538B, 0x538B, 0x538B, 0x536B, 0x536B, 0x4B6B, 0x536B, 0x536B, 0x4B6B, 0x4B4B, 0x4B4B, 0x4B4B, 0x4B6B, 0x536B, 
-0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x536B, 0x538B, 0x538B, 0x538C, 
-0x538B, 0x538C, 0x53AC, 0x53AC, 0x53AC, 0x53AC, 0x53AC, 0x53AC, 0x5BAC, 0x5B8C, 0x5B8C, 0x5BAD, 0x9D54, 0xF7BE, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xA534, 0x4228, 0x8430, 0xCE9A, 0xBE18, 0x73CF, 0x634D, 0x738F, 0x6BAE, 
-0x6B6D, 0x6B6E, 0x6B8E, 0x6B8E, 0x52AA, 0x634D, 0xD6BA, 0xEF7E, 0x9D14, 0x39C7, 0x1082, 0x20E3, 0x10A2, 0x0000, 0x0841, 0x4AEA, 
-0x8573, 0x8573, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8573, 0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8573, 0x8573, 0x8573, 
-0x8573, 0x8573, 0x8D93, 0x8D73, 0x8D73, 0x8D73, 0x95B4, 0x7D32, 0x642E, 0x7490, 0x8D53, 0x8D94, 0x8D94, 0x8DB4, 0x8DB4, 0x8D94, 
-0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DB4, 0x8DD5, 0x95B5, 0x95B5, 0x95D4, 0x95D4, 0x95D5, 0x95D5, 0x95D5, 0x95D5, 0x95D4, 0x95D4, 
-0x8DD4, 0x8DD4, 0x95B4, 0x8DB4, 0x95F5, 0x8532, 0x3248, 0x0020, 0x0000, 0x10A3, 0x2925, 0x3186, 0x52AA, 0x9491, 0xD6BA, 0xF7BF, 
-0xC619, 0x8410, 0x738E, 0x73AF, 0x7BCF, 0x73CF, 0x6B6E, 0x6B6D, 0x6B6E, 0x7BCF, 0x7BEF, 0x7BF0, 0x73AE, 0x7C10, 0xBDF7, 0xDEFB, 
-0xDEFC, 0xCE9A, 0x8C72, 0x31A6, 0x18C3, 0x2103, 0x2104, 0x1082, 0x0862, 0x1082, 0x1082, 0x0820, 0x0861, 0x42A9, 0x6C6F, 0x644E, 
-0x6C2E, 0x6C4E, 0x6C4E, 0x6C4E, 0x642E, 0x642E, 0x640D, 0x640D, 0x640D, 0x63ED, 0x63ED, 0x63ED, 0x5BED, 0x63ED, 0x5BEC, 0x5BCC, 
-0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x53AC, 0x5BAC, 0x5BAC, 0x5BAC, 0x5BAC, 0x5BAC, 0x5BAC, 0x5B8C, 0x5B8C, 0x538B, 
-0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 
-0x536B, 0x536B, 0x536B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x538B, 0x536B, 0x536B, 0x536B, 
-0x538B, 0x538B, 0x536B, 0x536B, 0x536B, 0x536B, 0x538B, 0x538B, 0x536B, 0x5B8C, 0x5B6C, 0x6C0E, 0xBE17, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xAD55, 0x4228, 0x8431, 0xCE9A, 0xC638, 0x7BF0, 0x6B6E, 0x73AF, 0x6BAE, 
-0x6B6E, 0x6B6E, 0x6B8E, 0x6B8E, 0x632C, 0x8430, 0xD6BA, 0xE73C, 0x94B2, 0x31A6, 0x1082, 0x18C3, 0x10A2, 0x0000, 0x0000, 0x3227, 
-0x7D11, 0x8552, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D12, 0x7D12, 0x8512, 0x8512, 0x8512, 0x8512, 0x7D32, 0x7D32, 0x8532, 0x8532, 
-0x7D52, 0x7D32, 0x8552, 0x8552, 0x8553, 0x8552, 0x8D93, 0x7D32, 0x642E, 0x642E, 0x7D32, 0x8D93, 0x8573, 0x8573, 0x8573, 0x8593, 
-0x8D93, 0x8D93, 0x8D93, 0x8D93, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x8D94, 
-0x8D94, 0x8D94, 0x8D94, 0x8D94, 0x95D4, 0x7D32, 0x3A89, 0x0041, 0x0000, 0x10A3, 0x2925, 0x3186, 0x52AA, 0x8C71, 0xD69A, 0xF7DF, 
-0xE71D, 0xA514, 0x738E, 0x6B8E, 0x73CF, 0x73AF, 0x6B6E, 0x6B4D, 0x6B4D, 0x7BCF, 0x7BF0, 0x8431, 0x6B8E, 0x4A8A, 0x94D3, 0xD6BA, 
-0xDF1C, 0xCE9A, 0x8C72, 0x31A6, 0x18C3, 0x2103, 0x18E3, 0x1082, 0x0861, 0x1082, 0x1082, 0x0861, 0x0000, 0x2185, 0x63CD, 0x642E, 
-0x640D, 0x642E, 0x6C4E, 0x642E, 0x642E, 0x642D, 0x640D, 0x63ED, 0x63ED, 0x63CD, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BAC, 
-0x5BAC, 0x5BAC, 0x5BAC, 0x5B8C, 0x538C, 0x538C, 0x538C, 0x538C, 0x538B, 0x538B, 0x538B, 0x536B, 0x536B, 0x536B, 0x536B, 0x536B, 
-0x536B, 0x536B, 0x534B, 0x534B, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 0x534A, 
-0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4B, 0x4B4B, 0x4B4B, 0x4B4B, 0x534B, 0x534B, 0x534B, 0x534B, 0x534B, 0x4B4B, 0x4B4B, 
-0x536B, 0x534B, 0x534B, 0x534B, 0x534B, 0x534B, 0x534B, 0x534B, 0x4B6B, 0x536B, 0x536B, 0x8CF2, 0xDF3C, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xB596, 0x4249, 0x8431, 0xCE7A, 0xCE79, 0x8431, 0x73AF, 0x7BF0, 0x6BAE, 
-0x6B8E, 0x6B6E, 0x6B4E, 0x6BAF, 0x8C92, 0xB5F7, 0xDEFB, 0xDEFB, 0x8451, 0x2965, 0x18A3, 0x18C3, 0x1082, 0x0820, 0x0000, 0x2165, 
-0x644E, 0x8532, 0x7CF1, 0x74F1, 0x74F1, 0x74F1, 0x74F1, 0x7CD1, 0x74F1, 0x74F1, 0x74F1, 0x74F1, 0x74F1, 0x74F1, 0x7CF1, 0x7D11, 
-0x7D11, 0x7D11, 0x7D11, 0x7D12, 0x7D12, 0x7D12, 0x8532, 0x7D32, 0x6C2E, 0x5BAD, 0x7CD1, 0x8573, 0x8552, 0x8552, 0x8552, 0x8553, 
-0x8553, 0x8553, 0x8553, 0x8553, 0x8553, 0x8573, 0x8573, 0x8D73, 0x8573, 0x8573, 0x8573, 0x8573, 0x8D73, 0x8D73, 0x8D73, 0x8D73, 
-0x8D73, 0x8D73, 0x8D53, 0x8D53, 0x8D94, 0x8552, 0x4B0B, 0x0881, 0x0000, 0x10A2, 0x2925, 0x3165, 0x528A, 0x8C71, 0xCE7A, 0xF7BF, 
-0xDF1C, 0xA535, 0x6B8E, 0x6B8E, 0x73CF, 0x73AF, 0x6B6E, 0x632D, 0x632D, 0x73AE, 0x7BCF, 0x8431, 0x6B8E, 0x4229, 0x9CD3, 0xD6DB, 
-0xDF1C, 0xCE7A, 0x8451, 0x3186, 0x18C3, 0x2103, 0x18E3, 0x1082, 0x0841, 0x1082, 0x1082, 0x0861, 0x0000, 0x1082, 0x4288, 0x63ED, 
-0x63EC, 0x63ED, 0x640D, 0x642D, 0x642D, 0x640D, 0x63ED, 0x63ED, 0x5BCC, 0x5BED, 0x5BED, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BAC, 
-0x5BAC, 0x5BAC, 0x538B, 0x538B, 0x538B, 0x536B, 0x536B, 0x536B, 0x536B, 0x536B, 0x536B, 0x4B6B, 0x4B6B, 0x4B4A, 0x4B4A, 0x4B4A, 
-0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B4A, 0x4B4A, 
-0x4B4A, 0x4B4A, 0x4B2A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4B, 0x4B4B, 0x4B4B, 0x4B4B, 0x4B4A, 0x4B4A, 
-0x4B2A, 0x4B2A, 0x4B2A, 0x534B, 0x534B, 0x534B, 0x534B, 0x534B, 0x4B4B, 0x4B4B, 0x742F, 0xC678, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x4A69, 0x7C10, 0xCE7A, 0xDEFB, 0x8C72, 0x73AF, 0x8C72, 0x73EF, 
-0x6B6D, 0x634D, 0x6B8E, 0x8431, 0xB5B7, 0xDF1C, 0xDF1C, 0xCE9A, 0x73CF, 0x2945, 0x20E3, 0x18C3, 0x0882, 0x0841, 0x0000, 0x08A2, 
-0x4B4B, 0x74D1, 0x74B0, 0x6C8F, 0x6C90, 0x6C8F, 0x6C90, 0x6C8F, 0x6C8F, 0x6C8F, 0x6C8F, 0x6C8F, 0x6C8F, 0x6C90, 0x6CB0, 0x6CB0, 
-0x6CB0, 0x6CB0, 0x6CB0, 0x74B0, 0x74D0, 0x74D0, 0x74F1, 0x7511, 0x642E, 0x4B4B, 0x6C6F, 0x7D12, 0x7511, 0x7D32, 0x7D11, 0x7D11, 
-0x7D11, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x7D32, 0x8532, 0x8552, 0x8552, 0x8552, 0x8552, 
-0x8552, 0x8552, 0x8532, 0x8532, 0x8573, 0x8552, 0x536C, 0x10C2, 0x0000, 0x10A2, 0x2125, 0x2945, 0x5289, 0x8C51, 0xCE59, 0xEF9E, 
-0xDF1C, 0xAD76, 0x7BCF, 0x738E, 0x7BF0, 0x73D0, 0x73AF, 0x6B6E, 0x738E, 0x73CE, 0x7BF0, 0x8451, 0x6B8E, 0x4A6A, 0xAD55, 0xDEFC, 
-0xDEFB, 0xC659, 0x7C10, 0x2945, 0x18C3, 0x2103, 0x18C3, 0x1082, 0x0861, 0x1081, 0x10A2, 0x0861, 0x0841, 0x0000, 0x10E2, 0x4B09, 
-0x5BCC, 0x5BAC, 0x5BCC, 0x640D, 0x640D, 0x63ED, 0x63ED, 0x63CD, 0x5BEC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BAC, 0x5BAC, 0x5BAC, 
-0x53AB, 0x538B, 0x538B, 0x536B, 0x536B, 0x536B, 0x536B, 0x4B6B, 0x534B, 0x534A, 0x534A, 0x4B4A, 0x4B4A, 0x4B2A, 0x4B2A, 0x4B2A, 
-0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B0A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 
-0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B0A, 0x4B0A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 
-0x4B2A, 0x4B2A, 0x4B2A, 0x4B4A, 0x4B4B, 0x4B4B, 0x4B4B, 0x534B, 0x532B, 0x6C0E, 0xBE38, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x526A, 0x73CF, 0xC67A, 0xE75C, 0xA513, 0x73CF, 0x8CB3, 0x8CB3, 
-0x7C31, 0x73D0, 0x73F0, 0x8C72, 0xBE18, 0xDEFC, 0xDF1C, 0xC638, 0x632C, 0x2104, 0x2104, 0x10A2, 0x0861, 0x0841, 0x0820, 0x0020, 
-0x29C6, 0x640E, 0x644E, 0x5C0D, 0x5C0D, 0x63ED, 0x5BED, 0x5BED, 0x5BED, 0x5C0D, 0x5C0D, 0x5C0D, 0x5BED, 0x5C0D, 0x5C0E, 0x5C0E, 
-0x640E, 0x640E, 0x640E, 0x642E, 0x642E, 0x642E, 0x644F, 0x6C6F, 0x5BCD, 0x432A, 0x5BCD, 0x6C90, 0x6C90, 0x6C8F, 0x6C8F, 0x6C90, 
-0x6CB0, 0x6CB0, 0x6CB0, 0x74B0, 0x74B0, 0x74B0, 0x74B0, 0x74D0, 0x74D0, 0x74D0, 0x74D0, 0x74D1, 0x74D1, 0x7CF1, 0x74F1, 0x7CF1, 
-0x7CF1, 0x7511, 0x7D11, 0x7CF1, 0x7D12, 0x7D32, 0x642E, 0x1923, 0x0000, 0x10A2, 0x2103, 0x2965, 0x4A69, 0x8431, 0xC659, 0xEF7D, 
-0xE71C, 0xAD75, 0x7BF0, 0x7BCF, 0x8410, 0x7BF0, 0x7C10, 0x7BEF, 0x7BEF, 0x7BEF, 0x8410, 0x8C72, 0x632D, 0x52CB, 0xBE18, 0xE75D, 
-0xDEFC, 0xC659, 0x73AF, 0x2124, 0x18C3, 0x2104, 0x18C3, 0x0862, 0x0841, 0x1082, 0x10A2, 0x0861, 0x0861, 0x0840, 0x0020, 0x18E3, 
-0x42A8, 0x534A, 0x536A, 0x538B, 0x53AB, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BCC, 0x5BEC, 0x5BCC, 0x5BCC, 0x5BAC, 0x53AC, 0x53AC, 
-0x5B8B, 0x538B, 0x538B, 0x538B, 0x538B, 0x536B, 0x4B6B, 0x4B6B, 0x534A, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B29, 
-0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B29, 0x4B2A, 0x4B09, 0x4B0A, 0x4B0A, 0x4B2A, 
-0x4B2A, 0x4B2A, 0x4B2A, 0x4B0A, 0x4B0A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B2A, 
-0x4B2A, 0x4B2A, 0x4B2A, 0x4B0A, 0x4B2A, 0x4B0A, 0x4B0A, 0x4AEA, 0x636D, 0xBE38, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x5AAB, 0x634D, 0xB5F8, 0xDF1C, 0xCE79, 0x9D14, 0x94D3, 0xA556, 
-0xAD96, 0x9D14, 0x632D, 0x6B6D, 0xAD96, 0xDEFB, 0xD6DB, 0xB5B6, 0x4A69, 0x18E3, 0x2104, 0x10A2, 0x0841, 0x0841, 0x0841, 0x0020, 
-0x08C2, 0x42A9, 0x5BCC, 0x53AB, 0x4B8B, 0x538B, 0x536B, 0x4B6B, 0x536B, 0x534B, 0x4B4A, 0x534B, 0x534B, 0x536B, 0x536B, 0x536B, 
-0x4B6B, 0x4B6B, 0x4B6B, 0x536B, 0x538B, 0x538B, 0x538B, 0x53AC, 0x538C, 0x4309, 0x432A, 0x53AC, 0x5C0D, 0x5C0D, 0x5BED, 0x5BED, 
-0x5BED, 0x5BED, 0x640D, 0x640D, 0x640D, 0x642E, 0x642E, 0x642E, 0x642E, 0x644E, 0x644E, 0x6C4F, 0x6C6F, 0x6C6F, 0x6C6F, 0x6C90, 
-0x7490, 0x6CB0, 0x6CB0, 0x748F, 0x74B0, 0x7D11, 0x6C6F, 0x3206, 0x0000, 0x0841, 0x2104, 0x2124, 0x4A49, 0x8431, 0xC618, 0xEF7D, 
-0xDF1C, 0x94B2, 0x52CB, 0x7BF0, 0x8451, 0x8431, 0x7C10, 0x7C10, 0x7BEF, 0x7BF0, 0x8C92, 0x7BF0, 0x4A8A, 0x73AE, 0xD69A, 0xDEFB, 
-0xDEFB, 0xCE59, 0x6B4D, 0x10A3, 0x18E3, 0x2104, 0x10A2, 0x0841, 0x0861, 0x1082, 0x1082, 0x0861, 0x1082, 0x1081, 0x0020, 0x0020, 
-0x10C2, 0x29A5, 0x3A47, 0x4288, 0x42E9, 0x4B2A, 0x4B4A, 0x536B, 0x538B, 0x536B, 0x536B, 0x536A, 0x536A, 0x536B, 0x536B, 0x4B4A, 
-0x534A, 0x534A, 0x4B4A, 0x4B2A, 0x4B2A, 0x4B2A, 0x4B0A, 0x4B2A, 0x4B0A, 0x4B09, 0x4B09, 0x4B09, 0x4B09, 0x4AE9, 0x4AE9, 0x4309, 
-0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x4AE9, 0x42E9, 0x42E9, 0x42E9, 0x42C9, 0x42C9, 0x42C9, 0x42C9, 
-0x42C9, 0x42C9, 0x42C9, 0x42C9, 0x42C9, 0x42C9, 0x42A8, 0x3AA8, 0x3AA8, 0x3AA8, 0x3AA8, 0x3AA8, 0x3AA8, 0x3AA8, 0x3AA8, 0x3AA8, 
-0x3AA8, 0x3AA8, 0x3AA8, 0x3A68, 0x3A47, 0x3A27, 0x3207, 0x2985, 0x73AE, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x630B, 0x52AB, 0xAD97, 0xD6DB, 0xDF1C, 0xCE9A, 0xAD76, 0x94B2, 
-0x8C72, 0x73AF, 0x39E8, 0x632D, 0xBDF7, 0xDEFB, 0xD6BA, 0x94D3, 0x39A6, 0x18C3, 0x18E3, 0x1082, 0x0841, 0x0841, 0x0861, 0x0020, 
-0x0000, 0x1944, 0x42E9, 0x4B6B, 0x432A, 0x4309, 0x42E8, 0x42E8, 0x42C8, 0x42C9, 0x42C8, 0x42C8, 0x3AC8, 0x3AA8, 0x3AA8, 0x3AC8, 
-0x3AC8, 0x3AC8, 0x3AC8, 0x42C9, 0x42C9, 0x3AC8, 0x3AE9, 0x42E9, 0x4309, 0x3AC8, 0x3287, 0x42E9, 0x4B4A, 0x4B4A, 0x4B4A, 0x4B4A, 
-0x4B6A, 0x4B4A, 0x4B4A, 0x4B6B, 0x4B6B, 0x4B6B, 0x4B6B, 0x538B, 0x538B, 0x538B, 0x538C, 0x53AC, 0x53AC, 0x5BCC, 0x5BED, 0x5BED, 
-0x5BED, 0x5C0D, 0x5C0D, 0x640E, 0x642E, 0x6C8F, 0x6C6F, 0x42C9, 0x0861, 0x0020, 0x20E4, 0x2124, 0x3A08, 0x8430, 0xBDF7, 0xE71C, 
-0xE75C, 0x94B3, 0x4229, 0x6B8F, 0x9493, 0x8C92, 0x8431, 0x7C11, 0x8431, 0x94B3, 0x9CF4, 0x5ACC, 0x4208, 0x9CF3, 0xAD75, 0x7BEF, 
-0x8C51, 0xA535, 0x5AEC, 0x10A2, 0x18E3, 0x18E3, 0x1082, 0x0841, 0x0861, 0x1082, 0x1082, 0x0861, 0x0861, 0x1081, 0x0861, 0x0020, 
-0x0000, 0x0841, 0x0881, 0x10E2, 0x1943, 0x2185, 0x29C5, 0x29E6, 0x3206, 0x3247, 0x3A88, 0x42C8, 0x3A88, 0x3267, 0x3247, 0x3247, 
-0x3247, 0x3247, 0x3226, 0x2A26, 0x3206, 0x2A06, 0x29E6, 0x29E6, 0x31E6, 0x29E6, 0x29E6, 0x29E6, 0x29E5, 0x29C5, 0x21E5, 0x21C5, 
-0x21C5, 0x29C5, 0x29C5, 0x21C5, 0x21C5, 0x21C5, 0x21C5, 0x21C5, 0x29A5, 0x29C5, 0x29C5, 0x21C5, 0x21A5, 0x21A5, 0x21C5, 0x21C5, 
-0x21A5, 0x21A5, 0x21A5, 0x21A4, 0x21A4, 0x2184, 0x2184, 0x2184, 0x1984, 0x1984, 0x1984, 0x21A5, 0x21A5, 0x21C5, 0x21C5, 0x21C5, 
-0x29A5, 0x2185, 0x2144, 0x1903, 0x10C2, 0x1082, 0x1081, 0x10A2, 0x9491, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x7BCF, 0x4229, 0xA555, 0xCEBB, 0xD6DB, 0xE75D, 0xCE79, 0x7BF0, 
-0x4229, 0x3A08, 0x634C, 0xA534, 0xCE9A, 0xD6BA, 0xBE18, 0x6B6E, 0x2924, 0x18E3, 0x18C2, 0x1082, 0x0841, 0x0841, 0x0861, 0x0841, 
-0x0000, 0x0020, 0x1943, 0x3226, 0x3247, 0x3226, 0x3206, 0x3206, 0x2A26, 0x2A26, 0x3226, 0x3247, 0x3247, 0x3226, 0x2A26, 0x2A26, 
-0x2A26, 0x2A26, 0x2A26, 0x3226, 0x2A26, 0x2A26, 0x3247, 0x3247, 0x3247, 0x3267, 0x2A06, 0x2A26, 0x3267, 0x3288, 0x32A8, 0x3288, 
-0x3288, 0x3AA8, 0x3AA8, 0x32A8, 0x3AA8, 0x3AC9, 0x3AC9, 0x3AC9, 0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x42E9, 0x4309, 0x4B2A, 0x4B2A, 
-0x4B4A, 0x4B6B, 0x4B6A, 0x538B, 0x538B, 0x53CC, 0x5C0D, 0x538B, 0x1944, 0x0881, 0x20E4, 0x2945, 0x31A7, 0x7C10, 0xB5B6, 0xD69A, 
-0xEF9D, 0xC638, 0x632D, 0x4A6A, 0x8411, 0xA535, 0xA535, 0x9D15, 0x9D35, 0x9D15, 0x6B8F, 0x2966, 0x630C, 0xBE18, 0x73AF, 0x0041, 
-0x2986, 0x73AF, 0x528A, 0x1082, 0x18C3, 0x18E3, 0x0881, 0x0861, 0x0861, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0861, 0x0860, 0x0881, 0x1103, 0x21A5, 0x29C5, 0x21A4, 0x1984, 0x1984, 
-0x1964, 0x1964, 0x1964, 0x1944, 0x1943, 0x1123, 0x1102, 0x10E2, 0x08E2, 0x10E2, 0x1102, 0x1103, 0x1923, 0x1923, 0x1123, 0x1123, 
-0x1123, 0x1123, 0x1923, 0x1923, 0x1123, 0x1923, 0x1923, 0x1123, 0x10E2, 0x08E2, 0x08C2, 0x08C2, 0x10E2, 0x1102, 0x1103, 0x1123, 
-0x1123, 0x1123, 0x1123, 0x1123, 0x1123, 0x1123, 0x1943, 0x1143, 0x1123, 0x1103, 0x1102, 0x10E2, 0x10E2, 0x10C2, 0x08C2, 0x08A1, 
-0x0881, 0x0881, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x3165, 0xC5F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x9CD3, 0x39E7, 0x8C92, 0xCE9A, 0xD6DB, 0xDEFB, 0xDEDA, 0xA534, 
-0x738E, 0x8410, 0xB5F7, 0xD6BA, 0xCE9A, 0xC659, 0xA555, 0x4228, 0x18E3, 0x18C3, 0x1082, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0000, 0x0020, 0x0881, 0x10C2, 0x31A6, 0x52EA, 0x634C, 0x634C, 0x634C, 0x636C, 0x6B8D, 0x73CE, 0x73EE, 0x73CE, 0x6BAD, 
-0x638C, 0x5B6C, 0x5B2B, 0x530B, 0x52EA, 0x4AEA, 0x4ACA, 0x4ACA, 0x4AC9, 0x4ACA, 0x4289, 0x3227, 0x3206, 0x3227, 0x3247, 0x3A47, 
-0x3247, 0x3247, 0x3247, 0x3247, 0x3247, 0x3247, 0x3247, 0x3247, 0x3226, 0x3247, 0x3226, 0x3247, 0x3267, 0x3247, 0x3247, 0x3A88, 
-0x3AA7, 0x3AC8, 0x42E8, 0x42E9, 0x4309, 0x4B4A, 0x538B, 0x53AB, 0x3A88, 0x1944, 0x2104, 0x2925, 0x2966, 0x738F, 0xAD56, 0xC639, 
-0xE73C, 0xE75D, 0xAD76, 0x52CC, 0x52AB, 0x8431, 0xA535, 0xA536, 0xA555, 0x94B3, 0x4249, 0x4229, 0xAD75, 0xCE9A, 0x73F0, 0x08A4, 
-0x39E8, 0x738E, 0x39E8, 0x10A2, 0x18E3, 0x18C3, 0x0861, 0x0861, 0x0861, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0861, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x08A1, 0x1923, 0x1944, 0x1123, 0x1123, 
-0x1923, 0x1903, 0x1903, 0x1103, 0x1102, 0x1123, 0x1123, 0x0902, 0x08E2, 0x08E2, 0x1103, 0x1923, 0x1923, 0x1903, 0x10E2, 0x1923, 
-0x1923, 0x1903, 0x1903, 0x2124, 0x1923, 0x1103, 0x1103, 0x1923, 0x1123, 0x1102, 0x0902, 0x1123, 0x1923, 0x1103, 0x10E2, 0x10E2, 
-0x1103, 0x1103, 0x1903, 0x1923, 0x1923, 0x1923, 0x1903, 0x1103, 0x10C2, 0x08A2, 0x0861, 0x0040, 0x0040, 0x0020, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0020, 0x0841, 0x0020, 0x0841, 0x1061, 0x5AEB, 0xE6FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x4A49, 0x52AB, 0xC67A, 0xDEFC, 0xC659, 0xD699, 0xCE9A, 
-0xC639, 0xCE79, 0xCE99, 0xCE79, 0xCE79, 0xBE18, 0x7BCF, 0x2144, 0x10A2, 0x18C2, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 
-0x0840, 0x0020, 0x0000, 0x0000, 0x1081, 0x738E, 0xD6BA, 0xEF5D, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF7D, 0xEF5D, 0xE73C, 
-0xE73C, 0xDF1B, 0xDEDB, 0xD6BA, 0xCE99, 0xCE79, 0xCE59, 0xC659, 0xC658, 0xC638, 0xB5F7, 0x9D13, 0x8C71, 0x8C71, 0x94B2, 0x94D2, 
-0x8CD2, 0x7C2F, 0x7C2F, 0x8470, 0x8470, 0x7C0F, 0x636C, 0x52CA, 0x42A9, 0x42A9, 0x4AA9, 0x4AC9, 0x4AC9, 0x4ACA, 0x4AEA, 0x4288, 
-0x3226, 0x29C5, 0x3206, 0x3226, 0x3247, 0x3A67, 0x3AA8, 0x4B09, 0x4309, 0x31E6, 0x2144, 0x2945, 0x2104, 0x4A6A, 0x9D35, 0xBE19, 
-0xCE9A, 0xE73C, 0xDF1C, 0x9D14, 0x5AEC, 0x4A4A, 0x5AEC, 0x7C10, 0x9D14, 0xB596, 0x9492, 0xA514, 0xD6BA, 0xD6DB, 0xADB7, 0x6BD0, 
-0x8410, 0x632C, 0x2104, 0x18E3, 0x2104, 0x10A2, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x0840, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1041, 0x1082, 0x0020, 0x0020, 0x0881, 0x10C2, 0x08A2, 0x08A2, 
-0x0882, 0x0881, 0x0881, 0x0861, 0x0881, 0x1103, 0x2184, 0x1964, 0x1944, 0x1103, 0x08A2, 0x10A2, 0x10A2, 0x0881, 0x0861, 0x10A2, 
-0x10A2, 0x0881, 0x10A2, 0x18E3, 0x10A2, 0x0020, 0x0061, 0x18E3, 0x2184, 0x1964, 0x1964, 0x1944, 0x1103, 0x0861, 0x0020, 0x0020, 
-0x0020, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0020, 0x0821, 0x0841, 0x0841, 0x0841, 0x2104, 0x94B2, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x632C, 0x2945, 0x9D14, 0xDF1C, 0xCE79, 0xBE17, 0xC638, 
-0xCE7A, 0xC638, 0xBE17, 0xBE18, 0xC659, 0xA535, 0x4229, 0x2124, 0x18C2, 0x10A2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 
-0x0841, 0x0020, 0x0821, 0x0000, 0x2965, 0xB575, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 
-0xF79E, 0xEF7D, 0xEF7D, 0xF79D, 0xF79D, 0xEF5D, 0xDF1B, 0xCE99, 0xC658, 0xC658, 0xC679, 0xCE79, 0xC658, 0xCE79, 0xCE99, 0xB5D6, 
-0x52CA, 0x18E2, 0x08A2, 0x10A2, 0x10C2, 0x1103, 0x1923, 0x2164, 0x29C5, 0x2144, 0x2124, 0x2965, 0x2104, 0x2965, 0x8451, 0xC639, 
-0xC638, 0xCE9A, 0xDEFB, 0xD6DB, 0xB5B7, 0x73CF, 0x5B0C, 0x8C71, 0xC659, 0xD6DB, 0xD6BB, 0xD6BA, 0xCE99, 0xCE79, 0xCE9A, 0xC65A, 
-0x9CF4, 0x4208, 0x10A2, 0x2124, 0x2104, 0x1082, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 
-0x1082, 0x18A2, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x0841, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 
-0x0000, 0x0020, 0x0020, 0x0000, 0x0061, 0x18E3, 0x2185, 0x29A5, 0x2164, 0x10C2, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0861, 
-0x0861, 0x0020, 0x0841, 0x1082, 0x0861, 0x0000, 0x0020, 0x10C2, 0x2164, 0x2144, 0x1903, 0x08C2, 0x0040, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x4228, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x3185, 0x52AB, 0xBE18, 0xE71C, 0xCE59, 0xB5F7, 
-0xB5B6, 0xB5D6, 0xB5F6, 0xC659, 0xB5B7, 0x630D, 0x2124, 0x2103, 0x18C3, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 
-0x0840, 0x0841, 0x0020, 0x0020, 0x5AEB, 0xE71B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 
-0xAD55, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1082, 0x2124, 0x2124, 0x2104, 0x52CB, 0xB5F8, 
-0xCE7A, 0xC638, 0xC658, 0xDEDB, 0xDEFC, 0xC619, 0xB5B7, 0xC638, 0xD6DA, 0xDEFB, 0xD6BA, 0xCE99, 0xC638, 0xC638, 0xC639, 0xBE18, 
-0x73AF, 0x18E3, 0x18E3, 0x2124, 0x18C3, 0x1062, 0x0820, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x10A2, 
-0x5AEB, 0x8C91, 0x94B3, 0x8C51, 0x7BCF, 0x52AA, 0x31A6, 0x2965, 0x2986, 0x31A6, 0x2965, 0x20E4, 0x0821, 0x0000, 0x0000, 0x0800, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0881, 0x10C2, 0x10E3, 0x10A2, 0x18E3, 0x3165, 0x3186, 0x2965, 0x2124, 0x2104, 0x2104, 
-0x18E3, 0x0841, 0x0020, 0x1061, 0x0861, 0x0000, 0x0000, 0x0861, 0x0881, 0x0861, 0x0041, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0040, 0x0841, 0x0861, 0x0841, 0x0841, 0x18C3, 0x7BEF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE38, 0x528A, 0x2104, 0x6B4D, 0xC639, 0xE73D, 0xDF1C, 
-0xCEBA, 0xD6DA, 0xD6DB, 0xB5D7, 0x632D, 0x2125, 0x2104, 0x18E3, 0x1082, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 
-0x0841, 0x0020, 0x0840, 0x2104, 0x9CD2, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xEF7D, 0x7BEF, 0x18C3, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18C3, 0x2925, 0x2945, 0x3186, 0x8C51, 
-0xDEDC, 0xCE59, 0xB5D7, 0xC658, 0xCE99, 0xD6BA, 0xD6BA, 0xCE9A, 0xCE79, 0xC638, 0xC638, 0xC618, 0xBDF7, 0xBDF8, 0xBDF8, 0x94D3, 
-0x3186, 0x1082, 0x2124, 0x18E4, 0x10A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x2945, 
-0xAD75, 0xF7BE, 0xFFDF, 0xEF7D, 0xEF5D, 0xD69A, 0xBDF7, 0xB596, 0xB596, 0xB5B6, 0xB5B6, 0xA534, 0x8430, 0x73AE, 0x7BCF, 0x73AE, 
-0x738E, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x632C, 0x630C, 0x630C, 0x630C, 0x8430, 0xC618, 0xDEFB, 0xC638, 0xB596, 0xAD75, 0xAD75, 
-0xA514, 0x8C51, 0x7BEF, 0x8430, 0x8C51, 0x5AEB, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 
-0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x4228, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8C30, 0x2945, 0x2965, 0x634D, 0xA555, 0xC659, 
-0xC679, 0xBDF7, 0x94D3, 0x5B0C, 0x2125, 0x18E3, 0x2124, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0840, 0x0861, 0x0861, 0x0841, 0x0841, 
-0x0841, 0x0020, 0x0020, 0x5AEB, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xD69A, 0x630C, 0x10A2, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0020, 0x0000, 0x1081, 0x2124, 0x2965, 0x2125, 0x4A49, 
-0xB597, 0xDEFC, 0xC639, 0xBDD7, 0xBDF7, 0xC638, 0xC638, 0xC638, 0xBE18, 0xBE17, 0xBDD6, 0xB5D6, 0xB5B7, 0xBDF8, 0xAD76, 0x52AB, 
-0x1082, 0x18C3, 0x2124, 0x18C3, 0x0862, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0020, 0x5ACB, 
-0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xEF7D, 0xEF7D, 0xEF7D, 
-0xEF5D, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xF7BE, 0xF79E, 0xFFDF, 0xFFDF, 0xC638, 0x630C, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0841, 
-0x0841, 0x0861, 0x0861, 0x0841, 0x2104, 0x8C51, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x5ACA, 0x2104, 0x2965, 0x39E8, 0x5ACB, 
-0x630C, 0x52AA, 0x31A6, 0x2124, 0x2945, 0x2945, 0x18C3, 0x0861, 0x0861, 0x0020, 0x0840, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0841, 0x2945, 0xA513, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xBDF7, 0x528A, 0x1082, 0x0841, 0x0020, 0x0020, 0x0021, 0x0020, 0x0000, 0x0000, 0x18E3, 0x3186, 0x2965, 0x2124, 
-0x528B, 0xBDF8, 0xE73D, 0xD6BB, 0xBDD7, 0xB5B7, 0xB5D7, 0xB5D7, 0xB5B6, 0xAD96, 0xB5B6, 0xBDF7, 0xC619, 0xB5B7, 0x6B4E, 0x10A3, 
-0x10A2, 0x2945, 0x2104, 0x1082, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x18C3, 0x9492, 
-0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xB596, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 
-0x0841, 0x0861, 0x0841, 0x0861, 0x630C, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xA4F3, 0x39C6, 0x2104, 0x2966, 0x2945, 
-0x2945, 0x2945, 0x2965, 0x2965, 0x2945, 0x18C3, 0x0861, 0x0862, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 
-0x0020, 0x1082, 0x7BCF, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x5AEB, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2945, 0x3186, 0x2104, 
-0x18C3, 0x52AB, 0xC639, 0xEF5E, 0xD6BB, 0xC618, 0xB5B7, 0xB5B7, 0xB5B6, 0xB5B6, 0xBE18, 0xC639, 0xB5D7, 0x738F, 0x10A3, 0x1082, 
-0x2945, 0x2945, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x4A49, 0xD6BA, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x8C71, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 
-0x0841, 0x0841, 0x0861, 0x4A69, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BEF, 0x2924, 0x2104, 0x2124, 
-0x2945, 0x2965, 0x2924, 0x18E3, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0860, 0x0861, 0x1081, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 
-0x0020, 0x5ACB, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x7BCF, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x2945, 0x2124, 
-0x18E3, 0x2104, 0x4A49, 0x9493, 0xD69A, 0xDEFC, 0xD6DB, 0xCE7A, 0xCE7A, 0xCE7A, 0xC639, 0x94D3, 0x4A49, 0x10A3, 0x1062, 0x2124, 
-0x2124, 0x18C3, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0840, 0x2104, 0x9CF3, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x738E, 0x1082, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 
-0x0841, 0x0841, 0x39E7, 0xB5B6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x6B6D, 0x2104, 0x18E3, 
-0x2103, 0x18E3, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x1081, 0x1081, 0x0861, 0x0840, 0x0020, 0x0000, 0x0020, 
-0x528A, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xEF7D, 0xEF7D, 0xEF5D, 0xE73C, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 
-0xD6BA, 0xD69A, 0xCE79, 0xCE59, 0xBDF7, 0x9CF3, 0x5AEB, 0x2945, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x18C3, 0x2124, 0x2945, 
-0x2124, 0x2104, 0x2945, 0x39C7, 0x52AB, 0x8431, 0xA514, 0xAD55, 0xA515, 0x8C52, 0x52AB, 0x2125, 0x0862, 0x18E3, 0x2945, 0x2103, 
-0x18C3, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0020, 0x0020, 0x630C, 0xE73C, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x738E, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0020, 0x0020, 
-0x0020, 0x39E7, 0xAD55, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x738D, 0x2944, 
-0x0861, 0x1081, 0x0861, 0x0020, 0x0841, 0x0841, 0x0020, 0x0841, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0000, 0x18E3, 0x73AE, 
-0xCE79, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xFFDF, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xEF7D, 0xEF5D, 0xE73C, 0xE71C, 
-0xEF7D, 0xEF7D, 0xF79E, 0xEF7D, 0xEF7D, 0xEF5D, 0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xCE79, 0xCE59, 0xC638, 
-0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xB5B6, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C51, 0x8410, 
-0x7BF0, 0x7BCF, 0x73AE, 0x738E, 0x738E, 0x73AE, 0x632C, 0x4228, 0x31A6, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39E7, 0x31A6, 0x2924, 
-0x2104, 0x2124, 0x2924, 0x2945, 0x18E4, 0x2945, 0x3186, 0x39A7, 0x3186, 0x18E4, 0x1082, 0x18C3, 0x2125, 0x2945, 0x2104, 0x18C2, 
-0x1082, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0000, 0x2124, 0x9492, 0xDEFB, 0xEF7D, 
-0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 
-0xFFDF, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFDF, 
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xA514, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 
-0x5ACB, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xFFDF, 0xF7BE, 0xF7BF, 0xEF7E, 0xE71C, 0xC638, 0x7BEE, 
-0x3185, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x4A48, 0xA514, 
-0xD6BA, 0xD6BA, 0xCE59, 0xC638, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 0xAD75, 0xAD55, 0xA514, 0x9CF3, 0x9CD3, 
-0x8C71, 0x8430, 0x7BEF, 0x7BCF, 0x73AE, 0x738E, 0x6B6D, 0x6B4D, 0x630C, 0x630C, 0x5AEB, 0x5ACB, 0x52AA, 0x528A, 0x4A49, 0x4A49, 
-0x4228, 0x4228, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 
-0x31A6, 0x31A7, 0x31A7, 0x31A6, 0x39C7, 0x39C7, 0x39E7, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x4A69, 0x4207, 0x2945, 
-0x20E4, 0x18E3, 0x20E4, 0x2104, 0x2124, 0x2124, 0x2104, 0x18E3, 0x2104, 0x2124, 0x2924, 0x2944, 0x2924, 0x18E3, 0x10A3, 0x0862, 
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0840, 0x0020, 0x0000, 0x0861, 0x4A69, 0x8C71, 0x9CD3, 0x9492, 
-0x9492, 0x9492, 0x9CD3, 0x9CD3, 0x9CF3, 0xA514, 0xA514, 0xA534, 0xA534, 0xAD55, 0xAD75, 0xAD75, 0xB596, 0xB5B6, 0xB5B6, 0xB5B6, 
-0xBDD7, 0xBDF7, 0xC618, 0xC638, 0xCE59, 0xCE59, 0xCE59, 0xCE79, 0xCE79, 0xD69A, 0xD69A, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEDB, 0xDEFB, 
-0xDEFB, 0xDEFB, 0xDEFB, 0xE71C, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xEF7D, 0xF79E, 0xD69A, 0x8410, 0x3186, 0x0020, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x5AEB, 
-0xAD75, 0xDEFB, 0xEF7D, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xEF7D, 0xEF5D, 0xE73C, 0xE71C, 0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xD69A, 0xC618, 0xA534, 
-0x6B4D, 0x39C7, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x18C3, 0x18E3, 0x3186, 0x528A, 0x738E, 0x73AE, 
-0x738E, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x630C, 0x5AEB, 0x5ACB, 0x5ACB, 
-0x528A, 0x4A69, 0x4A49, 0x4228, 0x4228, 0x4208, 0x39E7, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 
-0x3186, 0x3186, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 
-0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 
-0x2124, 0x18C3, 0x10A2, 0x18C3, 0x20E4, 0x2104, 0x2124, 0x2924, 0x2945, 0x2945, 0x2124, 0x18C3, 0x1082, 0x0861, 0x0861, 0x0861, 
-0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x2124, 0x4228, 0x4A69, 0x4228, 0x4208, 
-0x4228, 0x4228, 0x4A49, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5ACB, 0x5AEB, 0x5AEB, 0x630C, 0x630C, 
-0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x738E, 0x73AE, 0x73AE, 0x7BCF, 0x7BCF, 0x7BEF, 0x7BEF, 0x8410, 0x8430, 0x8430, 0x8430, 
-0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8C51, 0x8430, 0x8410, 0x8410, 0x8410, 0x8C51, 0x8410, 0x52AA, 0x2945, 0x1082, 0x0841, 
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x10A2, 0x2965, 0x630C, 0x94B2, 
-0xBDD7, 0xC618, 0xC638, 0xCE79, 0xD69A, 0xD6BA, 0xDEFB, 0xE71C, 0xE73C, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 
-0xFFDF, 0xF7BE, 0xF79E, 0xF79E, 0xEF7D, 0xEF5D, 0xE73C, 0xE73C, 0xDEFB, 0xDEDB, 0xD6BA, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC618, 
-0xBDF7, 0xB596, 0xB596, 0xB595, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xAD75, 0xB596, 0xB596, 0xB596, 0xB596, 0xAD75, 
-0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xAD55, 0xA534, 0xA514, 0x9CF3, 0x9CD3, 0x94B2, 0x94B2, 
-0x9492, 0x9492, 0x8C71, 0x8C51, 0x8430, 0x8430, 0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B6D, 
-0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x5AEB, 0x5AEB, 0x5ACB, 0x5ACB, 0x52AA, 0x528A, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A49, 
-0x4A49, 0x4A49, 0x4228, 0x4228, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x39E7, 0x39E7, 0x39C7, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 
-0x39C7, 0x2945, 0x18A3, 0x1061, 0x1061, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 0x31A6, 0x39C7, 0x3186, 0x2965, 0x2965, 
-0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x3186, 0x3186, 0x3186, 
-0x3186, 0x3186, 0x31A6, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4228, 0x4228, 0x4A49, 0x4A69, 
-0x4A69, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x528A, 0x52AA, 0x528A, 0x528A, 0x5ACB, 0x630C, 0x632C, 0x6B4D, 0x6B4D, 0x632C, 
-0x5ACB, 0x4A69, 0x4228, 0x4208, 0x4208, 0x4208, 0x4A49, 0x52AA, 0x632C, 0x73AE, 0x8C51, 0x9492, 0xA514, 0xAD75, 0xBDD7, 0xC618, 
-0xCE59, 0xCE79, 0xD69A, 0xD6BA, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 
-0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xEF7D, 0xEF7D, 
-0xEF5D, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD6BA, 0xD69A, 
-0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDD7, 0xBDD7, 0xB5B6, 0xB596, 0xB596, 
-0xAD75, 0xAD75, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 0x94B2, 0x9492, 0x8C71, 0x8C71, 0x8C51, 0x8430, 0x8430, 
-0x8410, 0x7BEF, 0x7BEF, 0x7BCF, 0x73AE, 0x73AE, 0x738E, 0x738E, 0x6B6D, 0x6B4D, 0x6B4D, 0x632C, 0x632C, 0x630C, 0x630C, 0x630C, 
-0x630C, 0x5ACB, 0x4208, 0x18E3, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 
-0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0020, 0x0861, 0x18E3, 0x3186, 0x4208, 0x39E7, 0x39C7, 0x39C7, 0x31A6, 0x31A6, 
-0x31A6, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7, 
-0x39C7, 0x39E7, 0x39E7, 0x4208, 0x4228, 0x4A49, 0x4A69, 0x4A69, 0x528A, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x6B4D, 0x6B6D, 0x738E, 
-0x7BCF, 0x7BEF, 0x8410, 0x8430, 0x8C71, 0x9492, 0x94B2, 0x9CD3, 0xA514, 0xA534, 0xAD55, 0xAD75, 0xB5B6, 0xBDF7, 0xC618, 0xC638, 
-0xCE59, 0xCE59, 0xCE59, 0xCE79, 0xCE79, 0xD69A, 0xD6BA, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79E, 
-0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 
-0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEFB, 
-0xDEDB, 0xDEDB, 0xD6BA, 0xD6BA, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE59, 0xC638, 0xC638, 0xC618, 0xC618, 0xBDF7, 0xBDF7, 
-0xBDD7, 0xBDD7, 0xB5B6, 0xB5B6, 0xB5B6, 0xB596, 0xAD75, 0xAD75, 0xAD55, 0xAD55, 0xA534, 0xA534, 0xA514, 0x9CF3, 0x9CF3, 0x9CD3, 
-0x94B2, 0x94B2, 0x8C51, 0x6B4D, 0x39C7, 0x10A2, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 
-0x0841, 0x0020, 0x0000, 0x0000, 0x0020, 0x1082, 0x2124, 0x31A6, 0x4A49, 0x528A, 0x528A, 0x4A69, 0x4A69, 0x4A69, 0x4A69, 0x528A, 
-0x4A69, 0x528A, 0x528A, 0x52AA, 0x52AA, 0x5ACB, 0x5AEB, 0x630C, 0x632C, 0x632C, 0x6B4D, 0x6B6D, 0x738E, 0x73AE, 0x7BCF, 0x7BCF, 
-0x8410, 0x8410, 0x8C51, 0x8C71, 0x94B2, 0x9CD3, 0x9CF3, 0xA514, 0xAD55, 0xAD55, 0xB596, 0xB5B6, 0xB5B6, 0xBDD7, 0xBDF7, 0xC618, 
-0xCE59, 0xCE59, 0xCE79, 0xD69A, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF5D, 0xF79E, 
-0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 
-0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF5D, 0xE73C, 0xE73C, 0xE73C, 0xE73C, 
-0xE73C, 0xE71C, 0xDEFB, 0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xCE79, 0xCE59, 0xC618, 0xBDF7, 0xB5B6, 0xAD75, 0xA534, 0x9CF3, 0x94B2, 
-0x8C71, 0x8430, 0x7BEF, 0x738E, 0x528A, 0x2124, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
-0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x2104, 0x31A6, 0x4208, 0x4228, 0x4228, 0x4A69, 0x5ACB, 0x5AEB, 0x632C, 0x6B6D, 0x73AE, 
-0x7BEF, 0x8410, 0x8C71, 0x9492, 0x9CD3, 0x9CF3, 0xA534, 0xAD55, 0xAD75, 0xB596, 0xB5B6, 0xBDD7, 0xBDF7, 0xC618, 0xC638, 0xC638, 
-0xCE59, 0xCE79, 0xD69A, 0xD69A, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF7D, 
-0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 
-0xF79E, 0xEF7D, 0xEF5D, 0xEF5D, 0xE73C, 0xDEFB, 0xDEDB, 0xD6BA, 0xD69A, 0xCE59, 0xC618, 0xBDD7, 0xB596, 0xA534, 0x9CF3, 0x9492, 
-0x8C71, 0x8410, 0x7BCF, 0x73AE, 0x738E, 0x6B4D, 0x5AEB, 0x528A, 0x4A69, 0x4A49, 0x4228, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 
-0x4228, 0x4A49, 0x52AA, 0x5AEB, 0x6B4D, 0x738E, 0x7BCF, 0x8410, 0x8C51, 0x9492, 0x9CD3, 0xA514, 0xAD55, 0xB596, 0xBDD7, 0xBDF7, 
-0xC638, 0xCE59, 0xCE79, 0xD69A, 0xD6BA, 0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 
-0xEF7D, 0xEF7D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xEF7D, 0xEF5D, 0xE73C, 0xE73C, 0xE73C, 0xE71C, 0xE71C, 0xDEFB, 
-0xDEDB, 0xD6BA, 0xD69A, 0xD69A, 0xD69A, 0xD69A, 0xCE79, 0xCE79, 0xCE59, 0xCE79, 0xCE79, 0xCE79, 0xCE79, 0xD69A, 0xD6BA, 0xD6BA, 
-0xDEDB, 0xDEDB, 0xDEFB, 0xDEFB, 0xE71C, 0xE71C, 0xE73C, 0xE73C, 0xE73C, 0xEF5D, 0xEF5D, 0xEF5D, 0xEF7D, 0xEF7D, 0xEF7D, 0xF79E, 
-0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+const uint8_t img1[] PROGMEM = {
+0xF0, 0x00, 0xF0, 0x00, 0x55, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xC6, 0x66, 0xC0, 0x55, 0x52, 0x55, 0x52, 0x51, 0x51, 0x55, 0x52, 0x65, 0x56, 0x55, 0x66, 0x66, 0x59,
+0x66, 0x66, 0xC0, 0x56, 0x69, 0xC0, 0x66, 0x20, 0x1B, 0xC0, 0x20, 0xC0, 0x27, 0xC0, 0x34, 0xC0, 0x03, 0x0D, 0x1C, 0x7F, 0xA2, 0x76, 0xA1, 0xA9,
+0x0C, 0xA2, 0x88, 0xA3, 0x98, 0xC0, 0x01, 0x7A, 0x10, 0x6E, 0xC0, 0x1D, 0xC0, 0x2C, 0x31, 0xC1, 0x2C, 0x5A, 0x31, 0xFD, 0xFD, 0xF7, 0x52, 0x10,
+0x3C, 0x52, 0x51, 0x51, 0x51, 0x51, 0x56, 0x08, 0x03, 0x34, 0x66, 0x27, 0xC0, 0x65, 0xC1, 0x5A, 0x66, 0x1B, 0xC2, 0x18, 0x13, 0x65, 0x56, 0x65,
+0xC0, 0x6E, 0xC1, 0x56, 0x33, 0xC0, 0x38, 0x6F, 0x33, 0x51, 0x6E, 0xC0, 0x1F, 0xC0, 0x24, 0x65, 0x24, 0x7A, 0x33, 0x7E, 0x6E, 0x07, 0xA2, 0x87,
+0x7F, 0xA3, 0x88, 0xA4, 0x98, 0x5E, 0x61, 0x27, 0xA3, 0x88, 0xA2, 0x88, 0xA3, 0x88, 0x01, 0x10, 0xA2, 0x88, 0x31, 0xFD, 0xFD, 0xEC, 0x2C, 0x15,
+0x9D, 0x88, 0x9D, 0x88, 0x0C, 0x51, 0x51, 0x51, 0x03, 0x34, 0x2F, 0x56, 0xC0, 0x69, 0xC4, 0x1B, 0x5A, 0xC0, 0x27, 0xC2, 0x1B, 0x18, 0x1B, 0x20,
+0x13, 0x3F, 0x33, 0xC3, 0x6E, 0xC0, 0x33, 0x38, 0xC0, 0x9C, 0x88, 0x9B, 0x78, 0xC0, 0x9D, 0x88, 0x9A, 0x87, 0x9B, 0x87, 0x9C, 0x88, 0x55, 0x66,
+0x55, 0x7A, 0x05, 0x66, 0x08, 0x6E, 0x7F, 0x28, 0x19, 0x7E, 0x10, 0xA4, 0x88, 0xA2, 0x87, 0xA3, 0x99, 0xA3, 0x89, 0xA3, 0x88, 0xA3, 0x99, 0xA3,
+0x88, 0xA3, 0x99, 0xA3, 0x98, 0xA6, 0x77, 0xA4, 0x99, 0xA3, 0x88, 0x23, 0x6E, 0xA4, 0x87, 0xA2, 0x89, 0x6E, 0x31, 0xFD, 0xFD, 0xDF, 0x2C, 0x51,
+0x01, 0x28, 0x9D, 0x77, 0x9D, 0x89, 0x41, 0x51, 0x34, 0x51, 0xC4, 0x27, 0xC0, 0x6E, 0x20, 0xC2, 0x27, 0x2F, 0xC5, 0x20, 0x1B, 0x13, 0x69, 0x51,
+0xC1, 0x7F, 0x0C, 0x1B, 0xC1, 0x20, 0xC0, 0x7A, 0x38, 0x98, 0x89, 0x9D, 0x87, 0x5A, 0x97, 0x86, 0x14, 0x9B, 0x87, 0x65, 0x56, 0xC0, 0x69, 0x66,
+0xC1, 0xA4, 0x77, 0xA1, 0xA8, 0x6B, 0x5F, 0x52, 0x00, 0x0C, 0xA7, 0x89, 0x56, 0x51, 0x2C, 0x20, 0x39, 0xA3, 0x99, 0x6B, 0xA2, 0x78, 0xA2, 0x87,
+0x10, 0xA4, 0x88, 0xA8, 0x98, 0xA7, 0x88, 0xA4, 0x78, 0xA3, 0x99, 0xA4, 0x88, 0xA5, 0x98, 0xA4, 0x88, 0x28, 0xA2, 0x88, 0x18, 0xA2, 0x88, 0x6E,
+0xFD, 0xFD, 0xD5, 0x2C, 0x18, 0x09, 0x3C, 0x28, 0x9B, 0x78, 0x9D, 0x88, 0x03, 0x55, 0xC0, 0x66, 0x5A, 0x27, 0xC0, 0x1B, 0x6E, 0x2C, 0xC0, 0x27,
+0x2F, 0x34, 0x03, 0xC2, 0x56, 0x34, 0x2F, 0x20, 0x65, 0x56, 0x61, 0x5A, 0x61, 0x51, 0x41, 0x9D, 0x87, 0x9D, 0x78, 0x7E, 0xA3, 0x89, 0x3C, 0x13,
+0x27, 0x3B, 0xC0, 0x38, 0xC0, 0x7E, 0xC0, 0x98, 0x89, 0x1C, 0x37, 0x98, 0x77, 0x95, 0x87, 0x98, 0x98, 0x61, 0x69, 0x05, 0xC0, 0x08, 0x6E, 0x6B,
+0x5A, 0xA3, 0x89, 0xA3, 0x98, 0x7A, 0x6E, 0x51, 0x9A, 0x89, 0x05, 0xA7, 0x8A, 0xA3, 0x79, 0x52, 0x9C, 0x87, 0x9B, 0xA6, 0x08, 0x29, 0xA5, 0x7B,
+0xC0, 0x55, 0x9C, 0x88, 0x9B, 0x98, 0x20, 0xA3, 0x98, 0x39, 0xA2, 0x99, 0xA3, 0x88, 0xA5, 0x99, 0xA5, 0x88, 0x1C, 0xA7, 0x98, 0xA6, 0x88, 0xA6,
+0x88, 0xA7, 0x88, 0xA3, 0x99, 0xA3, 0x88, 0x7F, 0xA2, 0x87, 0xFD, 0xFD, 0xCF, 0x56, 0x9D, 0x88, 0x9D, 0x88, 0x9C, 0x78, 0x9D, 0x78, 0x9D, 0x88,
+0x03, 0x56, 0x2F, 0xC2, 0x2C, 0xC1, 0x2F, 0x66, 0x2F, 0xC4, 0x55, 0x1B, 0x65, 0x56, 0x38, 0x51, 0x51, 0x51, 0x9D, 0x87, 0x56, 0x51, 0x65, 0x51,
+0x66, 0xC0, 0x55, 0x9C, 0x88, 0xA2, 0x88, 0x20, 0x6F, 0x34, 0x00, 0xC0, 0x69, 0x00, 0x39, 0x7F, 0xC0, 0x1B, 0x08, 0x3C, 0x91, 0x88, 0x97, 0x87,
+0x9C, 0x87, 0x65, 0x05, 0x7E, 0x6F, 0xC0, 0x7E, 0x5F, 0x7E, 0x6F, 0xA4, 0x6A, 0x7E, 0x74, 0x7A, 0x55, 0x9B, 0x98, 0x6F, 0xA6, 0x79, 0xA3, 0x79,
+0x42, 0x9B, 0x87, 0x9C, 0xA7, 0x7D, 0xA4, 0x89, 0xA3, 0x88, 0xA2, 0x89, 0x9C, 0x87, 0x99, 0x77, 0x0D, 0xA2, 0x88, 0x14, 0x05, 0x6B, 0x14, 0x20,
+0xA2, 0x88, 0xA2, 0x88, 0x1C, 0xA4, 0x88, 0xA6, 0x88, 0xA9, 0x88, 0xA9, 0x99, 0xA8, 0x88, 0xA7, 0x99, 0xA6, 0x87, 0xA3, 0x89, 0x7E, 0x31, 0xFD,
+0xFD, 0xC8, 0x2C, 0xC0, 0x9D, 0x78, 0x9B, 0x77, 0x9B, 0x78, 0x9D, 0x88, 0x03, 0xC5, 0x5A, 0x65, 0x2F, 0xC3, 0x65, 0x56, 0x65, 0x41, 0x9D, 0x88,
+0x50, 0x9D, 0x77, 0x66, 0x51, 0x39, 0x66, 0xC4, 0x7F, 0x08, 0xC0, 0x7F, 0xA2, 0x78, 0xC0, 0x34, 0xC0, 0xA3, 0x89, 0x1C, 0x5A, 0x14, 0xC0, 0x69,
+0x08, 0xC0, 0x34, 0x56, 0x50, 0x03, 0x28, 0x2B, 0x97, 0x76, 0x20, 0x54, 0x7A, 0x6F, 0x6F, 0x1E, 0xC0, 0x2A, 0x2D, 0xA2, 0x77, 0xA4, 0x6A, 0xA6,
+0x79, 0xA2, 0x88, 0x78, 0xC0, 0x70, 0x9D, 0x77, 0x7B, 0xA4, 0x79, 0xA3, 0x89, 0x57, 0x9A, 0x88, 0x9C, 0x87, 0x60, 0x7F, 0xA5, 0x88, 0xA3, 0x98,
+0x9D, 0x77, 0x9B, 0x88, 0x32, 0x62, 0x51, 0x55, 0xC0, 0x14, 0xC2, 0x2D, 0x28, 0xC0, 0xA3, 0x89, 0xA5, 0x99, 0xA8, 0x77, 0x15, 0xAA, 0x88, 0x18,
+0xA9, 0x98, 0x24, 0x31, 0xFD, 0xFD, 0xC5, 0x9D, 0x88, 0x9A, 0x88, 0x9B, 0x77, 0xA1, 0x8B, 0x9C, 0x88, 0x51, 0xC2, 0x6E, 0x6E, 0x6B, 0x08, 0x61,
+0x2F, 0x0F, 0x41, 0x13, 0x51, 0x41, 0x55, 0x61, 0x56, 0x34, 0xC0, 0x66, 0x2C, 0x34, 0x6B, 0x08, 0x6F, 0xC3, 0x7E, 0x28, 0xC0, 0x7E, 0x6B, 0x6E,
+0x7F, 0x3F, 0x14, 0x08, 0x3C, 0xA4, 0x88, 0x6E, 0x24, 0x55, 0xC1, 0x51, 0x51, 0x08, 0x2C, 0x00, 0x14, 0x99, 0x88, 0x94, 0x87, 0x20, 0x50, 0x7F,
+0x20, 0x6E, 0xC0, 0x1E, 0x77, 0x59, 0x69, 0x1E, 0xA7, 0x6B, 0xA7, 0x6B, 0xA3, 0x87, 0xA1, 0xA6, 0x7E, 0x7E, 0x9C, 0x97, 0x1B, 0xC0, 0xA1, 0x8A,
+0xA2, 0x78, 0x9D, 0x79, 0x9A, 0x98, 0x65, 0xA3, 0x88, 0xA4, 0x87, 0x3F, 0x51, 0x06, 0x9D, 0x97, 0x9D, 0x77, 0x9C, 0x99, 0x19, 0xC0, 0x14, 0x65,
+0x14, 0x23, 0xA2, 0x77, 0x9D, 0x87, 0x52, 0xC0, 0xA2, 0x78, 0xA2, 0x88, 0xA5, 0x98, 0xA6, 0x89, 0xA9, 0x98, 0xAB, 0x89, 0xAA, 0x88, 0xA8, 0x88,
+0xA8, 0x87, 0xA2, 0x88, 0xFD, 0xFD, 0xC1, 0x9B, 0x78, 0x97, 0x79, 0x9C, 0x88, 0xA2, 0x88, 0x6B, 0x55, 0x66, 0x08, 0x56, 0x61, 0x51, 0x40, 0x9D,
+0x87, 0x9D, 0x88, 0x21, 0x51, 0x51, 0x62, 0x59, 0xC0, 0x66, 0xC0, 0x2F, 0xC0, 0x34, 0xC0, 0x7F, 0x6E, 0xA2, 0x88, 0x6F, 0x7E, 0x3C, 0x37, 0xC0,
+0x30, 0xC0, 0x66, 0xC0, 0x28, 0xC2, 0x30, 0x28, 0x03, 0x5A, 0xA7, 0x88, 0xA7, 0x88, 0xC0, 0x56, 0x02, 0xC0, 0x6B, 0x02, 0x9D, 0x88, 0x9A, 0x88,
+0x00, 0x3B, 0xA3, 0x88, 0x2C, 0x93, 0x87, 0x99, 0x87, 0x05, 0x7E, 0x19, 0xC0, 0x20, 0x19, 0xC1, 0x61, 0xC0, 0x19, 0xA7, 0x5B, 0xA7, 0x79, 0xA2,
+0x78, 0x7A, 0xA2, 0x86, 0xA1, 0xA7, 0x66, 0x9D, 0x87, 0x9C, 0x98, 0x51, 0x6B, 0x7F, 0xA3, 0x78, 0x66, 0x69, 0x17, 0x6F, 0x24, 0x7A, 0x9D, 0x97,
+0x9D, 0x78, 0x9C, 0x78, 0x9D, 0x88, 0x11, 0x0C, 0x11, 0x2A, 0xA2, 0x98, 0x6F, 0x9D, 0x87, 0x9C, 0x88, 0x66, 0x05, 0x7F, 0x20, 0x19, 0xA3, 0x99,
+0xA7, 0x89, 0xAB, 0x99, 0xAC, 0x87, 0xAB, 0x89, 0xAA, 0x87, 0xA5, 0x99, 0x31, 0xFD, 0xF8, 0x2C, 0x31, 0x51, 0x98, 0x89, 0x9B, 0x78, 0x51, 0x6B,
+0x9D, 0x77, 0x9C, 0x98, 0x38, 0x9D, 0x88, 0x55, 0x51, 0x21, 0x9D, 0x88, 0x51, 0x56, 0x25, 0x66, 0xC0, 0x25, 0x2C, 0x39, 0x08, 0xA2, 0x78, 0x21,
+0x6F, 0x30, 0xC6, 0x66, 0x5A, 0x1C, 0x66, 0x5A, 0xC3, 0x1C, 0x28, 0xC0, 0x1C, 0x9D, 0x88, 0x3B, 0x3C, 0x3D, 0x02, 0x3A, 0xC2, 0x7F, 0xC0, 0x9B,
+0x87, 0x14, 0x2C, 0xA3, 0x99, 0x08, 0x93, 0x77, 0x97, 0x87, 0x61, 0x69, 0x6F, 0xC2, 0x0D, 0x19, 0x14, 0xC0, 0x05, 0x2A, 0xA6, 0x5A, 0xA5, 0x7A,
+0x6B, 0x7D, 0xA3, 0x97, 0xA2, 0x88, 0x79, 0x9D, 0x86, 0x99, 0x98, 0x9B, 0x88, 0xA1, 0xAA, 0xA4, 0x87, 0xA4, 0x78, 0x5A, 0x9B, 0x78, 0x65, 0xA5,
+0x98, 0xA3, 0xA8, 0xA2, 0x77, 0x51, 0x99, 0x78, 0x99, 0x78, 0x0C, 0x11, 0x6B, 0x25, 0x3E, 0xA4, 0x88, 0x3F, 0x9D, 0x98, 0x9A, 0x88, 0x9B, 0x88,
+0x05, 0xC1, 0x00, 0x0C, 0x2D, 0xA3, 0x99, 0xA7, 0x89, 0xAF, 0x98, 0xB4, 0x88, 0xAB, 0x89, 0x31, 0xFD, 0xF8, 0x9B, 0x88, 0x98, 0x78, 0x9A, 0x89,
+0x67, 0x9D, 0x77, 0x9A, 0x87, 0x21, 0x51, 0x39, 0x51, 0x20, 0x65, 0x6B, 0x20, 0x7E, 0xA2, 0x79, 0x0F, 0xA2, 0x88, 0x6E, 0x7A, 0x6F, 0xC1, 0x59,
+0x37, 0xC0, 0x28, 0xC0, 0x23, 0xC2, 0x1C, 0xC6, 0x28, 0x2D, 0xC0, 0x28, 0x1C, 0x23, 0x1C, 0x03, 0x00, 0xA6, 0x88, 0x3D, 0x3A, 0x65, 0xC0, 0x66,
+0x6F, 0x3A, 0xC0, 0x51, 0x28, 0x9A, 0x88, 0x08, 0x1C, 0x93, 0x88, 0x96, 0x87, 0x9D, 0x87, 0xC3, 0x19, 0x14, 0x19, 0x6B, 0xC0, 0x14, 0x69, 0xA3,
+0x79, 0xA6, 0x5A, 0xA4, 0x79, 0x6B, 0xA2, 0x88, 0xA2, 0x87, 0xA2, 0x87, 0xA1, 0xA7, 0x9C, 0x98, 0x9A, 0x98, 0x9C, 0xA9, 0x50, 0xA2, 0x88, 0xA4,
+0x78, 0x55, 0x65, 0xA4, 0x97, 0xA3, 0x89, 0x7E, 0x41, 0x9D, 0x79, 0x9D, 0x88, 0x9D, 0x78, 0x9C, 0x89, 0x61, 0x6E, 0x6E, 0xA3, 0x88, 0xA5, 0x99,
+0xA4, 0x88, 0x65, 0x9B, 0x87, 0x19, 0x51, 0x66, 0x05, 0xC0, 0xA3, 0x99, 0x15, 0x10, 0x55, 0xAC, 0x88, 0xB6, 0x88, 0xB2, 0x88, 0xA4, 0x88, 0xFD,
+0xF6, 0x09, 0x93, 0x78, 0x9B, 0x78, 0x07, 0x9C, 0x88, 0x99, 0x77, 0x99, 0x87, 0x6E, 0x2C, 0xA2, 0x87, 0x14, 0x1C, 0x6F, 0x30, 0xC0, 0x28, 0x23,
+0xC6, 0x1C, 0xC0, 0x23, 0xC0, 0x65, 0x23, 0xC0, 0x28, 0xC0, 0x6E, 0xC0, 0x7F, 0xC0, 0x6E, 0x6F, 0x7A, 0xA2, 0x77, 0x7B, 0x29, 0xC0, 0x10, 0x28,
+0x1C, 0x17, 0x03, 0x39, 0x3C, 0x3D, 0x5A, 0x2E, 0x29, 0x5A, 0xC2, 0x66, 0x28, 0x99, 0x87, 0xA3, 0x89, 0x28, 0x95, 0x87, 0x95, 0x87, 0x9B, 0x87,
+0x05, 0x14, 0x6E, 0xC6, 0x65, 0x5A, 0xA4, 0x89, 0xA7, 0x69, 0xA1, 0x8A, 0x5B, 0xC0, 0xA2, 0x77, 0xA2, 0x98, 0x7D, 0x50, 0x9B, 0x97, 0x9C, 0x98,
+0x9B, 0x99, 0x7E, 0xA5, 0x88, 0xA5, 0x98, 0x0F, 0xC0, 0x9D, 0x88, 0x9C, 0x88, 0xA5, 0x8A, 0x25, 0x41, 0x97, 0x88, 0x9A, 0x88, 0x18, 0x62, 0x13,
+0xA2, 0x78, 0xA5, 0x78, 0xA7, 0x98, 0xA4, 0x87, 0x09, 0x99, 0x87, 0x9A, 0x88, 0x66, 0xC0, 0xA5, 0x88, 0xA7, 0x98, 0xA2, 0x88, 0x9D, 0x88, 0x9B,
+0x77, 0xA5, 0x89, 0xB7, 0x99, 0xB7, 0x88, 0xA6, 0x88, 0xFD, 0xF4, 0x9A, 0x89, 0x92, 0x88, 0x98, 0x78, 0x10, 0x9D, 0x78, 0x9D, 0x87, 0x9D, 0x88,
+0x69, 0xA5, 0x88, 0xA2, 0x89, 0x37, 0xC0, 0x69, 0x37, 0x3C, 0xC0, 0x37, 0x55, 0x65, 0xC2, 0x5A, 0xC1, 0x1C, 0x23, 0x28, 0x30, 0x3C, 0x6E, 0x10,
+0x6E, 0x1A, 0x6B, 0x7E, 0xC0, 0x2E, 0xC0, 0x3A, 0xC2, 0x02, 0x6F, 0x2E, 0x99, 0x88, 0x19, 0x14, 0x51, 0x69, 0x01, 0xA6, 0x88, 0x3A, 0x2E, 0x29,
+0x26, 0x21, 0x26, 0x21, 0xC0, 0x28, 0x99, 0x77, 0x2F, 0x1C, 0x99, 0x78, 0x94, 0x87, 0x9A, 0x97, 0x0A, 0x6B, 0x19, 0xC0, 0x66, 0x19, 0xC1, 0x0D,
+0x19, 0xC0, 0x0D, 0xA3, 0x98, 0xA7, 0x79, 0xA2, 0x88, 0x5B, 0x56, 0x5F, 0x6B, 0xA2, 0x87, 0x58, 0x9D, 0x96, 0x52, 0x9C, 0x99, 0x71, 0xA5, 0x98,
+0xA5, 0x88, 0x7F, 0x0A, 0x97, 0x88, 0x9B, 0x78, 0x08, 0xAD, 0x78, 0x39, 0x56, 0x9A, 0x88, 0x98, 0x88, 0x9A, 0x89, 0x61, 0xC0, 0x24, 0xA4, 0x78,
+0x12, 0x02, 0x65, 0x96, 0x99, 0x05, 0x66, 0xA3, 0x87, 0xAA, 0x88, 0xA6, 0x88, 0x1E, 0x9A, 0x88, 0x14, 0xA6, 0x88, 0xB9, 0x88, 0x04, 0xA5, 0x88,
+0xFD, 0xF2, 0x9A, 0x89, 0x8C, 0x88, 0x95, 0x78, 0x28, 0xA2, 0x78, 0xC0, 0x9D, 0x87, 0x9C, 0x98, 0x08, 0xA5, 0x89, 0xC0, 0x65, 0x28, 0xC6, 0x6E,
+0x6E, 0x7A, 0x01, 0xC0, 0x7E, 0x15, 0xC0, 0x1A, 0xC0, 0x6F, 0xC0, 0x7E, 0xC2, 0x6B, 0xC2, 0x3A, 0x2E, 0xC1, 0x3A, 0x7E, 0x9D, 0x88, 0x2D, 0x19,
+0x66, 0x51, 0x69, 0x01, 0x3D, 0x3A, 0x26, 0x29, 0x26, 0x21, 0xC2, 0x32, 0x98, 0x99, 0x65, 0x08, 0x20, 0x95, 0x77, 0x98, 0x98, 0x51, 0xC0, 0x11,
+0x7A, 0xC0, 0x0D, 0x14, 0xC1, 0x6E, 0xC0, 0x11, 0xA2, 0x97, 0xA5, 0x98, 0x36, 0x6E, 0xC0, 0x6B, 0x6B, 0x06, 0x59, 0x65, 0x41, 0x62, 0xA2, 0xA8,
+0xA4, 0x86, 0x7F, 0x6B, 0x9C, 0x88, 0x97, 0x78, 0x9D, 0x88, 0x0C, 0xA6, 0x88, 0xAB, 0x78, 0xA8, 0x88, 0xC0, 0x9B, 0x78, 0x07, 0x99, 0x98, 0x9B,
+0x99, 0x6E, 0xC0, 0xA3, 0x78, 0xA6, 0x98, 0xA7, 0x98, 0xA2, 0x87, 0x9A, 0x88, 0x97, 0x87, 0x9A, 0x98, 0xA6, 0x87, 0x0A, 0xA6, 0x88, 0x36, 0x98,
+0x89, 0x0D, 0xA7, 0x89, 0xBD, 0x99, 0xB6, 0x88, 0xA3, 0x88, 0xFD, 0xF0, 0x9C, 0x89, 0x92, 0x78, 0x8E, 0x89, 0x6E, 0xA4, 0x89, 0xA5, 0x88, 0xC0,
+0x99, 0x87, 0x2C, 0x14, 0x2D, 0x61, 0xC0, 0x28, 0x2D, 0x7A, 0x6E, 0x6F, 0x7E, 0x6F, 0xC0, 0x6F, 0x7E, 0x6E, 0xC0, 0x6B, 0xC0, 0x2E, 0xC3, 0x5A,
+0xC1, 0x2E, 0x56, 0xC7, 0x2E, 0x35, 0x21, 0x2D, 0x19, 0x62, 0x34, 0xC0, 0x01, 0x3D, 0x35, 0x26, 0xC0, 0x21, 0xC3, 0x01, 0x99, 0x88, 0x9C, 0x98,
+0x34, 0xC0, 0x95, 0x78, 0x97, 0x86, 0x51, 0x65, 0x11, 0xC1, 0x7A, 0x11, 0xC0, 0x14, 0xC1, 0x05, 0x11, 0xA1, 0xA8, 0xA5, 0x88, 0xA2, 0x87, 0x7F,
+0xA2, 0x88, 0x6F, 0x0A, 0x05, 0x3B, 0x56, 0x56, 0x33, 0x0A, 0xA2, 0x87, 0x67, 0x09, 0x99, 0x78, 0x66, 0xC0, 0x05, 0xA7, 0x89, 0xA9, 0x89, 0xA7,
+0x88, 0x3E, 0x41, 0x99, 0x88, 0x96, 0x89, 0x9C, 0x99, 0x6E, 0x2B, 0x30, 0xA5, 0x89, 0xAD, 0x87, 0xA7, 0x98, 0x98, 0x98, 0x8F, 0x87, 0x00, 0xA8,
+0x87, 0xA8, 0x77, 0x62, 0x99, 0x78, 0x9B, 0x87, 0x6F, 0xAC, 0x88, 0x81, 0x88, 0x31, 0xFD, 0xEF, 0x18, 0x96, 0x79, 0x8E, 0x88, 0x56, 0xA5, 0x88,
+0xA4, 0x79, 0xA2, 0x88, 0x9C, 0x88, 0x95, 0x98, 0x2C, 0xA5, 0x98, 0x6E, 0x2D, 0xA2, 0x88, 0x7F, 0x6E, 0x6E, 0x6F, 0x7A, 0x2E, 0x3A, 0xC5, 0x55,
+0xC1, 0x26, 0xC0, 0x66, 0xC3, 0x26, 0xC0, 0x21, 0xC0, 0x26, 0xC1, 0x29, 0x26, 0xC0, 0x2E, 0x21, 0x28, 0x51, 0x76, 0x2F, 0x34, 0x01, 0x3D, 0x2E,
+0x26, 0x21, 0xC0, 0x1A, 0x56, 0xC1, 0x01, 0x9A, 0x88, 0x9B, 0x87, 0x7F, 0x05, 0x95, 0x88, 0x97, 0x86, 0x19, 0x56, 0xC0, 0x6E, 0xC1, 0x76, 0xC0,
+0x11, 0x0C, 0x69, 0x0C, 0xC0, 0x11, 0x25, 0xC0, 0x7F, 0x7E, 0xA2, 0x86, 0xA3, 0x99, 0xA2, 0x89, 0x0A, 0x66, 0x36, 0xC0, 0x0F, 0x79, 0x0A, 0x99,
+0x68, 0x99, 0x98, 0x66, 0xC1, 0x05, 0xA7, 0x79, 0xAB, 0x88, 0xA5, 0x9A, 0xA1, 0xA8, 0x31, 0x99, 0x68, 0x97, 0x88, 0x30, 0x6B, 0xC0, 0x6E, 0xA8,
+0x67, 0xAB, 0x98, 0x1E, 0x97, 0x97, 0x92, 0x97, 0x09, 0xA6, 0x88, 0x6E, 0x9A, 0x88, 0x9B, 0x78, 0x19, 0x7F, 0xB7, 0x88, 0xBC, 0x88, 0xA8, 0x88,
+0xFD, 0xED, 0x56, 0x97, 0x78, 0x8E, 0x9A, 0x9A, 0x78, 0x3A, 0xA4, 0x88, 0xC0, 0x6B, 0x97, 0x87, 0x97, 0x97, 0x7F, 0xA3, 0x88, 0x2D, 0xA4, 0x88,
+0xA3, 0x88, 0x6B, 0xC1, 0x2E, 0x6E, 0x3A, 0x35, 0x2E, 0x26, 0xC3, 0x1A, 0x6B, 0xC3, 0x1A, 0xC1, 0x21, 0xC3, 0x26, 0xC0, 0x7A, 0xC0, 0x26, 0x29,
+0x35, 0x21, 0x2D, 0x9D, 0x98, 0x5A, 0x34, 0x2C, 0x2D, 0x2E, 0xC0, 0x1A, 0x21, 0x1A, 0xC0, 0x12, 0xC0, 0x0D, 0x56, 0x9B, 0x87, 0x99, 0x97, 0x7E,
+0xA5, 0x89, 0x97, 0x78, 0x97, 0x87, 0x9B, 0x87, 0x50, 0x7F, 0x20, 0x6E, 0x16, 0xC0, 0x19, 0x56, 0x6B, 0x11, 0x66, 0x11, 0xA3, 0x79, 0x6F, 0xC0,
+0x66, 0x65, 0x65, 0x19, 0xA4, 0x87, 0xA4, 0x78, 0xA2, 0xA9, 0xC0, 0x6D, 0x6E, 0x0F, 0x62, 0x9A, 0x79, 0x9B, 0x79, 0x1D, 0x60, 0x7A, 0x56, 0x0C,
+0xA8, 0x78, 0xAB, 0x89, 0xA5, 0x98, 0x5E, 0x34, 0x30, 0x97, 0x68, 0x35, 0x3C, 0x6F, 0x6F, 0xA4, 0x87, 0xA9, 0x87, 0xAA, 0x97, 0xA1, 0xA7, 0x40,
+0x6E, 0x7A, 0x41, 0x92, 0xA9, 0x96, 0x98, 0x52, 0xA9, 0x89, 0x80, 0x88, 0xB2, 0x99, 0x31, 0xFD, 0xEB, 0x66, 0x9A, 0x78, 0x91, 0x79, 0x94, 0x88,
+0xA4, 0x78, 0xA7, 0x89, 0x6E, 0xC0, 0x61, 0x96, 0x88, 0x99, 0x97, 0xA4, 0x88, 0xA3, 0x88, 0x01, 0xA5, 0x88, 0x6F, 0x66, 0x26, 0x6E, 0x35, 0xC0,
+0x26, 0xC0, 0x66, 0xC0, 0x69, 0xC0, 0x21, 0x1A, 0xC0, 0x12, 0xC3, 0x1A, 0xC2, 0x21, 0xC4, 0x26, 0xC0, 0x7A, 0xC0, 0x2E, 0x21, 0x9B, 0x87, 0x17,
+0x5A, 0x9C, 0x98, 0x20, 0x2D, 0x26, 0x21, 0x12, 0x7A, 0x1A, 0xC0, 0x12, 0x65, 0x5A, 0x66, 0x9C, 0x98, 0x98, 0x98, 0xC0, 0x08, 0x99, 0x78, 0x96,
+0x88, 0x9A, 0x97, 0x05, 0x7F, 0x20, 0x6E, 0x6F, 0x66, 0x20, 0xC1, 0x18, 0x69, 0x1D, 0xA4, 0x79, 0xA2, 0x78, 0xC0, 0x5B, 0x7E, 0x9D, 0x88, 0x18,
+0x00, 0xA4, 0x77, 0xA3, 0x99, 0xA5, 0x88, 0x3B, 0x0A, 0xA2, 0x87, 0x9D, 0x88, 0x9A, 0x6A, 0x43, 0x65, 0x1D, 0x79, 0x05, 0x00, 0xA4, 0x67, 0xAA,
+0x89, 0xA8, 0x88, 0xA2, 0x88, 0x34, 0x9D, 0x88, 0x98, 0x68, 0x37, 0xC0, 0xA4, 0x68, 0x66, 0x65, 0xA3, 0x88, 0xAD, 0x97, 0xB4, 0x86, 0xAA, 0x86,
+0x9C, 0x87, 0x51, 0xC0, 0x93, 0x89, 0x88, 0xA9, 0x98, 0x89, 0x7F, 0xB6, 0x88, 0xBD, 0x88, 0xAA, 0x88, 0xFD, 0xEB, 0x9B, 0x78, 0x94, 0x89, 0x91,
+0x88, 0x28, 0xA9, 0x79, 0xA3, 0x88, 0x51, 0xC0, 0x9B, 0x88, 0x96, 0x98, 0x61, 0xA5, 0x88, 0x28, 0x15, 0xA2, 0x78, 0x55, 0x12, 0xC6, 0x7E, 0x12,
+0xC3, 0x1A, 0xC9, 0x6E, 0xC0, 0x67, 0xC0, 0x26, 0x21, 0x26, 0xC0, 0x7E, 0x21, 0x28, 0x14, 0xC0, 0x34, 0x51, 0xA7, 0x79, 0x12, 0xC0, 0x66, 0xC1,
+0x12, 0xC0, 0x0D, 0x55, 0x6F, 0x25, 0x20, 0x0C, 0x39, 0x9C, 0x89, 0x96, 0x88, 0x99, 0x86, 0x05, 0x7F, 0x6E, 0x25, 0x5F, 0x7A, 0xC0, 0x2C, 0x25,
+0x55, 0x11, 0xA2, 0x79, 0x09, 0xA2, 0x78, 0x5A, 0x6E, 0xA2, 0x79, 0xC0, 0x9B, 0xA7, 0x11, 0x00, 0x05, 0xA5, 0x78, 0xA4, 0x98, 0xA4, 0x98, 0xA3,
+0x87, 0x51, 0x98, 0x7A, 0x37, 0x6F, 0x24, 0x00, 0xC2, 0x25, 0xA8, 0x98, 0xA7, 0x79, 0x7E, 0xA2, 0x88, 0x9C, 0x79, 0x98, 0x89, 0x3C, 0x08, 0x6B,
+0x6E, 0xC0, 0xA4, 0x87, 0xB2, 0x85, 0xB5, 0x86, 0xA2, 0x87, 0x3B, 0x56, 0x9B, 0x88, 0x8D, 0x88, 0x8E, 0xA9, 0x00, 0xA9, 0x88, 0xBC, 0x88, 0xB9,
+0x99, 0x6E, 0xFD, 0xE9, 0x9D, 0x78, 0x96, 0x89, 0x90, 0x99, 0x99, 0x67, 0x12, 0xA7, 0x89, 0x66, 0xA2, 0x87, 0x7F, 0x94, 0x88, 0x18, 0xA2, 0x98,
+0xA4, 0x88, 0xA3, 0x78, 0x21, 0x6E, 0x12, 0x66, 0xC0, 0x65, 0x5A, 0xC0, 0x7B, 0x0D, 0x12, 0xC0, 0x7E, 0xC3, 0x66, 0xC5, 0x21, 0x15, 0x21, 0x1A,
+0xC4, 0x26, 0x21, 0xC0, 0x26, 0x15, 0x28, 0x9D, 0x87, 0x51, 0x1B, 0xA2, 0x78, 0xA6, 0x78, 0x12, 0x0D, 0x69, 0xC1, 0x0D, 0xC0, 0x06, 0x3E, 0xC0,
+0x51, 0x2C, 0x0C, 0x2C, 0xC0, 0x96, 0x88, 0x98, 0x96, 0x9C, 0x88, 0xC0, 0x7F, 0x1E, 0x6B, 0x6F, 0x5F, 0x69, 0x75, 0x25, 0x1D, 0x29, 0x09, 0xA2,
+0x78, 0x69, 0x66, 0x1A, 0xA3, 0x79, 0xC0, 0x3A, 0x05, 0x00, 0xC0, 0xA3, 0x88, 0xA5, 0x99, 0xA6, 0x86, 0x7F, 0x97, 0x69, 0x9B, 0x8B, 0xA3, 0x78,
+0x24, 0x14, 0x00, 0xC1, 0x16, 0xA9, 0x7A, 0xA9, 0x88, 0xA4, 0x88, 0xA3, 0x88, 0xA4, 0x78, 0x9B, 0x89, 0x91, 0x88, 0x3C, 0x6F, 0xA2, 0x77, 0x66,
+0x08, 0xA7, 0x77, 0xBB, 0x96, 0xAD, 0x97, 0x9C, 0x87, 0x9C, 0x87, 0x6F, 0x97, 0x89, 0x86, 0xA9, 0x05, 0x7E, 0xB0, 0x89, 0x85, 0x77, 0xA8, 0x88,
+0xFD, 0xE9, 0x96, 0x79, 0x95, 0x88, 0x91, 0x89, 0x59, 0xAB, 0x78, 0xA3, 0x88, 0xA2, 0x99, 0xAA, 0x76, 0x62, 0x8B, 0x88, 0x95, 0x88, 0xA5, 0x98,
+0x14, 0xA4, 0x78, 0xA2, 0x88, 0xA4, 0x87, 0xA8, 0x88, 0xA3, 0x89, 0x50, 0x9D, 0x88, 0x51, 0x9D, 0x78, 0x2E, 0x2B, 0x26, 0x56, 0x79, 0x56, 0xC2,
+0x15, 0xC1, 0x12, 0x15, 0xC0, 0x12, 0x15, 0x12, 0x7B, 0x15, 0xC1, 0x1A, 0xC1, 0x5A, 0x1A, 0x6B, 0x7E, 0x21, 0x9B, 0x97, 0x97, 0x87, 0x97, 0x78,
+0xA5, 0x99, 0x34, 0x2D, 0x12, 0x0D, 0x55, 0xC0, 0x06, 0xC2, 0x3E, 0xC0, 0x51, 0x9A, 0x98, 0x04, 0xA3, 0x98, 0xA2, 0x89, 0x97, 0x87, 0x96, 0x87,
+0x9D, 0x77, 0x05, 0x7F, 0xA2, 0x77, 0xC0, 0xA2, 0x79, 0x5B, 0xC0, 0x7A, 0x65, 0x56, 0xC0, 0x09, 0x5F, 0x66, 0x75, 0x55, 0x12, 0xA2, 0x79, 0x61,
+0x1D, 0x00, 0xC1, 0x1D, 0xA5, 0xA7, 0xA3, 0x98, 0x46, 0xA4, 0x5A, 0xA6, 0x79, 0xA2, 0x87, 0xA2, 0x96, 0x7E, 0x6F, 0xC0, 0x4B, 0xA4, 0x6A, 0xA7,
+0x88, 0xA5, 0x98, 0xA2, 0x88, 0xA3, 0x89, 0x27, 0x8D, 0x99, 0x0F, 0x61, 0xA5, 0x67, 0x0D, 0x0F, 0x19, 0xB2, 0x86, 0xB7, 0x96, 0xA3, 0x97, 0x9A,
+0x87, 0x24, 0x51, 0x8E, 0xA9, 0x8C, 0x9A, 0x9C, 0x88, 0xA3, 0x99, 0x80, 0x88, 0xB9, 0x99, 0x6E, 0xFD, 0xE7, 0x9C, 0x88, 0x94, 0x79, 0x93, 0x88,
+0x3B, 0xA8, 0x78, 0xA8, 0x77, 0x56, 0xAA, 0x98, 0xAD, 0x87, 0x95, 0x87, 0x86, 0x9A, 0x9A, 0x88, 0xA6, 0x98, 0xA3, 0x78, 0x39, 0x08, 0x0E, 0xAE,
+0x87, 0xA5, 0x89, 0x9C, 0x87, 0x9D, 0x78, 0x51, 0x9D, 0x88, 0x51, 0x9D, 0x87, 0x0E, 0x51, 0x26, 0x21, 0x69, 0xC1, 0x56, 0xC4, 0x66, 0xC4, 0x12,
+0xC1, 0x1A, 0x17, 0x21, 0xC0, 0x26, 0x61, 0x98, 0x98, 0x92, 0x88, 0x97, 0x87, 0xAB, 0x89, 0xAA, 0x88, 0xA6, 0x78, 0x1A, 0x0D, 0x39, 0x6E, 0xC0,
+0x7E, 0xC1, 0x0D, 0x5A, 0x39, 0x9B, 0x87, 0x9A, 0x88, 0x7A, 0x00, 0x99, 0x87, 0x95, 0x77, 0x11, 0x65, 0x7F, 0x6E, 0x7A, 0xA2, 0x68, 0x3D, 0x5A,
+0xC0, 0x65, 0x66, 0xC0, 0x35, 0x6F, 0x6E, 0x7E, 0x69, 0xA1, 0x8A, 0xA4, 0x79, 0xA3, 0x88, 0x74, 0x9B, 0xA6, 0x68, 0x9D, 0x79, 0x53, 0xA2, 0x78,
+0x75, 0xA8, 0x67, 0xB4, 0x58, 0xAB, 0x7A, 0x69, 0xC0, 0xA2, 0x97, 0xA2, 0x88, 0x46, 0x9B, 0x68, 0x9E, 0x5B, 0xA3, 0xA8, 0xA5, 0x98, 0x7B, 0x69,
+0xA2, 0x77, 0x93, 0xA8, 0x86, 0xBA, 0x98, 0xB9, 0xA3, 0x78, 0x69, 0x14, 0x6F, 0xA6, 0x86, 0xBA, 0x95, 0xAD, 0x86, 0x9A, 0x98, 0x24, 0x27, 0x99,
+0x89, 0x88, 0x98, 0x93, 0x89, 0x7A, 0xAE, 0x89, 0x82, 0x88, 0xAD, 0x88, 0xFD, 0xE6, 0x51, 0x97, 0x79, 0x94, 0x88, 0x93, 0x78, 0xC0, 0xAA, 0x78,
+0xA2, 0x88, 0xA3, 0x88, 0xAF, 0x88, 0xA5, 0xA8, 0x16, 0x8C, 0x99, 0x7A, 0x08, 0xA2, 0x78, 0xA4, 0x78, 0x7E, 0xA6, 0x78, 0xA9, 0x88, 0xA2, 0x88,
+0x14, 0xC0, 0x51, 0x66, 0x51, 0x16, 0x56, 0x51, 0x65, 0x56, 0xC1, 0x69, 0x66, 0x12, 0xC0, 0x1A, 0x1F, 0xC0, 0x1A, 0x1F, 0x69, 0x1A, 0xC5, 0x26,
+0x21, 0x26, 0x1A, 0x9B, 0x88, 0x94, 0x97, 0x92, 0x99, 0x05, 0xAC, 0x8A, 0xAB, 0x88, 0x2D, 0x1A, 0x52, 0x3E, 0xC0, 0x65, 0x3E, 0x7A, 0xC0, 0x06,
+0x3E, 0x01, 0x9D, 0x77, 0x98, 0x98, 0x62, 0xA5, 0x89, 0x9C, 0x87, 0x95, 0x77, 0x99, 0x87, 0x05, 0xC0, 0x7E, 0x6F, 0xC0, 0xA2, 0x79, 0x02, 0xC0,
+0x5A, 0x7F, 0xA2, 0x87, 0x6F, 0x6E, 0x7F, 0xA2, 0x87, 0xA2, 0x78, 0xA2, 0x88, 0xA3, 0x89, 0xA3, 0x98, 0x6F, 0x70, 0x9D, 0x85, 0x97, 0x88, 0x3D,
+0xA3, 0x89, 0x54, 0x19, 0xB8, 0x67, 0xAC, 0x79, 0x51, 0x52, 0x7D, 0x79, 0x42, 0x9B, 0x49, 0x9C, 0x5A, 0xA2, 0xA7, 0xA3, 0xA9, 0xA2, 0x98, 0xC0,
+0xA3, 0x88, 0x9D, 0x96, 0x89, 0xB8, 0x8F, 0x9A, 0x66, 0xA2, 0x78, 0xC0, 0x6E, 0xA2, 0x78, 0xB6, 0x85, 0xB2, 0x95, 0x60, 0x51, 0x36, 0x45, 0x8E,
+0x99, 0x8A, 0xA9, 0x9C, 0x99, 0xA1, 0x9A, 0xBF, 0x88, 0xBC, 0x88, 0x6E, 0xFD, 0xE5, 0x9B, 0x88, 0x94, 0x69, 0x94, 0x98, 0x95, 0x78, 0x01, 0xA8,
+0x79, 0x09, 0x0D, 0xAD, 0x77, 0x9A, 0x99, 0x89, 0x88, 0x97, 0x88, 0xA4, 0x98, 0xA2, 0x78, 0x2D, 0x06, 0x6B, 0xA4, 0x77, 0xA3, 0x99, 0x69, 0x56,
+0xC0, 0x65, 0x3F, 0xC1, 0x33, 0x2B, 0x26, 0xC0, 0x2E, 0xC1, 0x2B, 0x26, 0x2E, 0xA2, 0x77, 0x07, 0x6E, 0xC0, 0x7A, 0x6D, 0x56, 0x38, 0x2E, 0x21,
+0x55, 0x06, 0x3E, 0x66, 0x2D, 0xC0, 0x9D, 0x78, 0x98, 0x97, 0x95, 0x88, 0x98, 0x97, 0x6E, 0xAB, 0x9A, 0x2C, 0x2D, 0xA4, 0x88, 0x3E, 0xC0, 0x39,
+0x3E, 0x65, 0x39, 0x3E, 0x39, 0xC0, 0xA2, 0x88, 0x39, 0x2C, 0x9C, 0x98, 0xA5, 0x88, 0x9C, 0x89, 0x97, 0x76, 0x99, 0x87, 0x05, 0x00, 0x0A, 0x7A,
+0x0A, 0xA3, 0x89, 0xA6, 0x88, 0xA3, 0x79, 0x6E, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x78, 0x76, 0x66, 0xA2, 0x77, 0xA2, 0x88, 0x29, 0x7A, 0x58, 0xA1,
+0x9A, 0xA2, 0x88, 0x9C, 0x86, 0x94, 0xA9, 0x97, 0x9A, 0xA5, 0x69, 0xA4, 0x78, 0xA9, 0x88, 0xB3, 0x67, 0xAA, 0x89, 0x51, 0x56, 0x0B, 0xA1, 0xB7,
+0x46, 0x9A, 0x4A, 0x9B, 0x69, 0x7F, 0xA4, 0x87, 0xA3, 0x98, 0xA2, 0x98, 0x7F, 0x79, 0x92, 0xC7, 0x8A, 0x99, 0x99, 0x89, 0x6F, 0x19, 0x66, 0x19,
+0xAE, 0x76, 0xB4, 0x95, 0xA7, 0x97, 0x9D, 0x98, 0x6E, 0x59, 0x97, 0x89, 0x89, 0x98, 0x91, 0x9A, 0x7F, 0xB0, 0x77, 0x82, 0x88, 0xAC, 0x88, 0xFD,
+0xE4, 0x56, 0x96, 0x89, 0x93, 0x78, 0x92, 0x98, 0x5E, 0xAC, 0x78, 0xA3, 0x89, 0x7A, 0xA6, 0x78, 0xA5, 0x77, 0x09, 0x90, 0x87, 0x76, 0xA4, 0x88,
+0x6F, 0xA4, 0x78, 0xA2, 0x78, 0x7E, 0x7E, 0x2E, 0x6E, 0xC0, 0x38, 0x33, 0xC0, 0x38, 0x7A, 0xC0, 0x2E, 0x56, 0x2E, 0xC2, 0x55, 0xA2, 0x87, 0xA2,
+0x78, 0x7A, 0x57, 0x3A, 0x33, 0x6D, 0x2C, 0x9C, 0x89, 0x9D, 0x98, 0x51, 0x51, 0x52, 0x20, 0x55, 0x66, 0xC1, 0x59, 0x9A, 0x88, 0x96, 0xA8, 0x9C,
+0x88, 0x28, 0xAB, 0x89, 0xA8, 0x79, 0xA7, 0x88, 0x12, 0x3E, 0x32, 0x39, 0xC1, 0x32, 0x6E, 0x52, 0x66, 0xA4, 0x77, 0x12, 0x97, 0x97, 0x9A, 0x99,
+0xA2, 0x88, 0xC0, 0x99, 0x67, 0x97, 0x86, 0x9D, 0x88, 0x65, 0xC0, 0x11, 0x75, 0xA5, 0x88, 0xAA, 0x67, 0xA5, 0x78, 0x57, 0x01, 0x7E, 0xA2, 0x88,
+0x09, 0x35, 0x7F, 0xA2, 0x88, 0x6F, 0x6D, 0x61, 0xA3, 0x79, 0xA5, 0x88, 0x9C, 0xA9, 0x92, 0xA7, 0x05, 0x6F, 0xA8, 0x69, 0xAE, 0x67, 0xB1, 0x78,
+0xA8, 0x88, 0x51, 0x5A, 0x7F, 0xA1, 0xA8, 0x13, 0x9A, 0x68, 0x9A, 0x4B, 0x7F, 0xA2, 0x87, 0xA3, 0xA8, 0xA3, 0xA9, 0xA2, 0x88, 0x17, 0x9A, 0xB6,
+0x02, 0x93, 0x6A, 0x67, 0x6E, 0x0D, 0x14, 0xA6, 0x77, 0xB6, 0x84, 0xAD, 0xA6, 0xC0, 0x66, 0xC0, 0x40, 0x8D, 0x99, 0x8B, 0x9A, 0x08, 0xA5, 0x78,
+0xBC, 0x88, 0xBC, 0x88, 0x7F, 0xFD, 0xE3, 0x9B, 0x78, 0x94, 0x89, 0x91, 0x88, 0x96, 0x78, 0xA9, 0x88, 0xAB, 0x79, 0xC0, 0x65, 0xA3, 0x89, 0x59,
+0x2D, 0x18, 0x9C, 0x97, 0xC0, 0xA7, 0x79, 0xA9, 0x89, 0xA2, 0x78, 0x51, 0xA3, 0x87, 0x26, 0x2B, 0x7F, 0x0E, 0x7E, 0x65, 0x5A, 0x6E, 0x52, 0x61,
+0x1F, 0xC0, 0x66, 0x15, 0x55, 0x66, 0x54, 0x51, 0x51, 0x39, 0x51, 0x61, 0x59, 0x59, 0x62, 0xC1, 0x57, 0x6E, 0x0A, 0xA2, 0x78, 0xA2, 0x88, 0x7F,
+0xA2, 0x89, 0x6E, 0x98, 0x98, 0x92, 0x98, 0x9A, 0x98, 0x08, 0xAA, 0x89, 0xA6, 0x78, 0xA7, 0x78, 0x12, 0x51, 0x65, 0x6B, 0xC1, 0x32, 0xC0, 0x2A,
+0x66, 0xA4, 0x77, 0x1A, 0x98, 0x98, 0x98, 0x89, 0x7E, 0x7F, 0x9B, 0x67, 0x96, 0x97, 0x9C, 0x98, 0x05, 0xC1, 0x14, 0xA6, 0x76, 0xA7, 0x88, 0xA5,
+0x79, 0xA1, 0x7A, 0x66, 0x7E, 0xA2, 0x77, 0x09, 0x04, 0x3C, 0x04, 0x1D, 0x6F, 0x69, 0x7E, 0xA4, 0x79, 0x7B, 0x93, 0x97, 0x92, 0x98, 0x9D, 0x98,
+0xA4, 0x68, 0x01, 0xB5, 0x69, 0xA9, 0x88, 0x0B, 0x59, 0x0B, 0x7E, 0xC0, 0x9C, 0x68, 0x98, 0x5B, 0x6E, 0xA2, 0x88, 0xA2, 0x97, 0xA2, 0x99, 0xA3,
+0x98, 0xA3, 0xA7, 0x9D, 0xA6, 0x17, 0x8D, 0x7A, 0x9B, 0x89, 0x6E, 0x6E, 0x08, 0xA2, 0x78, 0xB4, 0x84, 0xB3, 0x96, 0xA2, 0x87, 0x76, 0x5A, 0xC0,
+0x95, 0x78, 0x8B, 0x99, 0x92, 0xA9, 0x56, 0xAF, 0x99, 0x83, 0x77, 0xAC, 0x88, 0xFD, 0xE2, 0x52, 0x98, 0x88, 0x93, 0x78, 0x91, 0x78, 0x18, 0xAE,
+0x78, 0xA6, 0x88, 0x5A, 0x65, 0x1D, 0x9C, 0x78, 0x95, 0x98, 0x9C, 0x97, 0x96, 0x88, 0x9A, 0x88, 0x11, 0xAF, 0x79, 0x6E, 0x51, 0x12, 0xC0, 0x66,
+0x15, 0x26, 0x79, 0x15, 0x51, 0x55, 0x9D, 0x88, 0x51, 0x51, 0x20, 0x11, 0x52, 0x51, 0x61, 0x69, 0x5E, 0x69, 0x7F, 0x36, 0xA2, 0x78, 0xA2, 0x88,
+0xA2, 0x87, 0x2F, 0x6E, 0x6B, 0x6E, 0x7F, 0xA4, 0x77, 0xA4, 0x87, 0x7F, 0x52, 0x7B, 0x12, 0x95, 0x97, 0x8F, 0x98, 0x9A, 0x87, 0xAA, 0x88, 0xA8,
+0x89, 0x25, 0xA6, 0x79, 0x0D, 0x51, 0x55, 0x7A, 0x2A, 0xC0, 0x32, 0xC0, 0x25, 0xC0, 0xA4, 0x76, 0xA4, 0x88, 0x9A, 0x98, 0x95, 0x99, 0x51, 0xA3,
+0x99, 0x38, 0x96, 0x88, 0x9B, 0x87, 0x50, 0xC0, 0x7B, 0xA2, 0x77, 0xA6, 0x77, 0xA4, 0x87, 0xA3, 0x89, 0xA4, 0x79, 0x5F, 0xC0, 0x09, 0xC1, 0x01,
+0xC0, 0xA3, 0x99, 0xA2, 0x87, 0x56, 0x9D, 0x96, 0x5F, 0xA4, 0x89, 0x99, 0x88, 0x93, 0x98, 0x00, 0xC0, 0xB0, 0x58, 0xBA, 0x47, 0xA9, 0x99, 0x9D,
+0x78, 0xC1, 0x7E, 0x6E, 0x9C, 0x7A, 0x99, 0x58, 0x56, 0x3A, 0x7E, 0xA1, 0xAA, 0xA4, 0x87, 0xA3, 0xA7, 0xA0, 0xB7, 0x92, 0xB7, 0x8D, 0x8A, 0x98,
+0x79, 0x52, 0x6E, 0x08, 0x66, 0xB1, 0x75, 0xB5, 0xA6, 0xA6, 0x86, 0x3E, 0x5A, 0xA2, 0x78, 0x9C, 0x98, 0x8F, 0x89, 0x89, 0x99, 0x00, 0xA4, 0x88,
+0xBC, 0x88, 0xBC, 0x88, 0xA3, 0x88, 0xFD, 0xE1, 0x9A, 0x89, 0x97, 0x78, 0x91, 0x78, 0x94, 0x88, 0xA7, 0x88, 0xAB, 0x89, 0x6F, 0x6E, 0x7E, 0x55,
+0x9A, 0x99, 0x95, 0x97, 0x9A, 0x87, 0x94, 0x98, 0x9B, 0x78, 0xB1, 0x78, 0xAD, 0x9A, 0x59, 0x19, 0x51, 0x66, 0x50, 0x56, 0x61, 0xC1, 0x55, 0x61,
+0xC0, 0x56, 0xC1, 0x6E, 0x2C, 0xC0, 0xA2, 0x67, 0x07, 0xA3, 0x88, 0xA2, 0x87, 0x6F, 0xA1, 0x9A, 0xA3, 0x88, 0xA2, 0x88, 0xA3, 0x88, 0xC1, 0xA3,
+0x98, 0xA5, 0x89, 0x7B, 0x51, 0x9D, 0x66, 0x66, 0x9D, 0x89, 0x12, 0x55, 0x98, 0xA8, 0x91, 0x98, 0x9B, 0x77, 0xA8, 0x87, 0xA5, 0x9A, 0xA4, 0x78,
+0xA7, 0x79, 0x12, 0x9D, 0x88, 0x25, 0x2A, 0xC2, 0x7A, 0x25, 0x1E, 0xA5, 0x77, 0x31, 0x9C, 0x88, 0x1D, 0x24, 0xA5, 0x99, 0x0C, 0x97, 0x77, 0x99,
+0x87, 0x9D, 0x87, 0xC0, 0x7A, 0xA2, 0x78, 0xA6, 0x77, 0xA4, 0x87, 0x6E, 0xA4, 0x7A, 0xA4, 0x78, 0x6F, 0xC0, 0x66, 0x0E, 0x09, 0x10, 0xC0, 0x65,
+0x56, 0x9C, 0x97, 0x51, 0xA4, 0x79, 0xA2, 0x79, 0x98, 0x98, 0x96, 0xB8, 0x60, 0xAD, 0x68, 0xBB, 0x58, 0xAD, 0x89, 0x9D, 0x77, 0x51, 0x6B, 0x7A,
+0x6E, 0x9D, 0x69, 0x9C, 0x69, 0x41, 0x3A, 0x7B, 0x7E, 0xA4, 0x97, 0xA4, 0xA7, 0xA1, 0xC7, 0x96, 0x97, 0x8F, 0x99, 0x95, 0x7A, 0x9A, 0x79, 0x66,
+0x08, 0x62, 0xAD, 0x65, 0xB6, 0xA5, 0xAC, 0x76, 0x61, 0x5B, 0xA2, 0x88, 0x6D, 0x93, 0x99, 0x8A, 0x99, 0x91, 0x99, 0x52, 0xAF, 0x88, 0x84, 0x88,
+0xAC, 0x88, 0xFD, 0xE0, 0x66, 0x96, 0x89, 0x94, 0x78, 0x92, 0x88, 0x1D, 0xAE, 0x89, 0xA5, 0x88, 0x52, 0x1A, 0x69, 0x62, 0x98, 0x88, 0x91, 0x97,
+0x98, 0x97, 0x05, 0xC0, 0xAC, 0x78, 0xA8, 0x89, 0xC0, 0x9D, 0x88, 0x59, 0x38, 0x55, 0xC1, 0xA3, 0x88, 0xA3, 0x88, 0x1E, 0xA2, 0x88, 0x6F, 0x56,
+0x7F, 0xA3, 0x87, 0xA3, 0x88, 0xA2, 0x88, 0xC0, 0x5E, 0xA2, 0x88, 0x7E, 0x1A, 0x63, 0x12, 0x69, 0x6E, 0x6E, 0xC0, 0xA6, 0x99, 0xAA, 0x97, 0xA7,
+0x99, 0x9D, 0x89, 0x96, 0x79, 0x94, 0x88, 0x9A, 0x77, 0x2A, 0x12, 0xC0, 0x9B, 0x87, 0x38, 0x9A, 0x98, 0x24, 0xA2, 0x98, 0xA4, 0x78, 0xA7, 0x79,
+0xA4, 0x88, 0x39, 0x25, 0xC0, 0x2A, 0xC1, 0x25, 0x66, 0xA2, 0x76, 0xA6, 0x76, 0xA5, 0x88, 0x0E, 0x93, 0xAA, 0x24, 0xA4, 0x88, 0x6F, 0x98, 0x88,
+0x98, 0x97, 0x9C, 0x87, 0x00, 0xC0, 0x05, 0xA6, 0x88, 0xA8, 0x77, 0xA2, 0x77, 0xA3, 0x88, 0xA3, 0x8A, 0xA3, 0x7A, 0x65, 0x62, 0x59, 0xC0, 0x7A,
+0x9D, 0x77, 0x9B, 0x88, 0x66, 0x62, 0x54, 0x03, 0xA3, 0x7A, 0x9D, 0x78, 0x98, 0xA7, 0x9C, 0xA7, 0xA9, 0x77, 0xBB, 0x59, 0xAF, 0x89, 0x51, 0x9D,
+0x78, 0x6F, 0x7E, 0x65, 0x9C, 0x6A, 0x9F, 0x58, 0x65, 0x61, 0x69, 0xA1, 0xA8, 0xA2, 0x97, 0xA4, 0xA7, 0xA3, 0xB7, 0x98, 0x89, 0x91, 0x79, 0x95,
+0x99, 0x99, 0x69, 0x9C, 0x88, 0x67, 0xC0, 0xA7, 0x76, 0xB7, 0xA5, 0xB1, 0x86, 0x6B, 0x9D, 0x89, 0x69, 0x9C, 0x88, 0x99, 0x78, 0x90, 0x99, 0x8E,
+0x99, 0x00, 0xA5, 0x88, 0xBD, 0x99, 0xB8, 0x88, 0x31, 0xFD, 0xDF, 0x9B, 0x78, 0x96, 0x89, 0x90, 0x88, 0x94, 0x89, 0xA7, 0x88, 0x1D, 0xC0, 0x41,
+0xC0, 0x7E, 0x9D, 0x88, 0x95, 0x87, 0x91, 0x97, 0x99, 0x87, 0x9D, 0x77, 0xA5, 0x89, 0xAB, 0x89, 0xA4, 0x88, 0x6F, 0x7A, 0x6E, 0xA2, 0x77, 0x7B,
+0x3E, 0xA2, 0x78, 0xA5, 0x98, 0xA5, 0x88, 0xA2, 0x88, 0x66, 0x56, 0x51, 0x5A, 0xA2, 0x87, 0xA2, 0x87, 0xC0, 0x55, 0x29, 0x6E, 0xC0, 0x9D, 0x88,
+0x9C, 0x9A, 0x66, 0x3E, 0x6D, 0x6E, 0xA7, 0xA9, 0xAE, 0x98, 0x31, 0xC0, 0x9B, 0x8A, 0x95, 0x78, 0x92, 0x78, 0x94, 0x87, 0xA2, 0x78, 0x3E, 0xA3,
+0x98, 0x9A, 0x88, 0x96, 0xA9, 0x9D, 0x77, 0x38, 0x7E, 0x20, 0xA8, 0x68, 0x0D, 0x41, 0x61, 0xC0, 0x2A, 0xC1, 0x25, 0x16, 0xA3, 0x98, 0xA7, 0x65,
+0xA3, 0x99, 0x9C, 0x88, 0x94, 0xAB, 0x98, 0x98, 0x38, 0xA3, 0x89, 0x24, 0x96, 0x88, 0x9B, 0x87, 0x65, 0x05, 0x6E, 0xA4, 0x88, 0xA9, 0x78, 0xA4,
+0x87, 0x65, 0xA2, 0x79, 0xA3, 0x8B, 0x6E, 0x1F, 0x40, 0x66, 0x7A, 0x9C, 0x88, 0x9C, 0x98, 0x5A, 0x63, 0xA2, 0x87, 0xA3, 0x88, 0x46, 0x42, 0x9C,
+0x98, 0x9C, 0xA6, 0xA9, 0x77, 0xB8, 0x58, 0xB0, 0x78, 0x66, 0x51, 0x6B, 0xC0, 0x55, 0x9C, 0x89, 0x5A, 0xA1, 0xA8, 0x64, 0x74, 0x7E, 0xC0, 0xA4,
+0x87, 0xA5, 0x99, 0x9A, 0x9A, 0x8E, 0x89, 0x02, 0x9D, 0x78, 0x97, 0x79, 0x9B, 0x99, 0x03, 0xA5, 0x86, 0xB3, 0x95, 0xB2, 0x86, 0x66, 0x9B, 0x78,
+0x9C, 0x88, 0x99, 0x87, 0x9D, 0x79, 0x99, 0x77, 0x91, 0xAA, 0x9D, 0x77, 0x05, 0xAE, 0x88, 0x82, 0x88, 0xAE, 0x88, 0xFD, 0xDF, 0x95, 0x79, 0x95,
+0x77, 0x8E, 0x89, 0x9C, 0x88, 0xAF, 0x89, 0xA8, 0x77, 0x56, 0x06, 0x66, 0x7E, 0x9B, 0x77, 0x92, 0xA8, 0x99, 0x87, 0x9A, 0x88, 0x9B, 0x87, 0xAB,
+0x79, 0x1E, 0x3E, 0x65, 0xC0, 0x6E, 0xC1, 0x32, 0xC0, 0xA4, 0x77, 0xA4, 0x88, 0xA2, 0x88, 0x65, 0x33, 0x55, 0xC0, 0x6D, 0x27, 0xC0, 0x52, 0x76,
+0xC0, 0x6E, 0x10, 0x51, 0x7F, 0x5E, 0x69, 0x7A, 0xAB, 0xAA, 0xAC, 0x99, 0x61, 0x9A, 0x78, 0x66, 0x9B, 0x78, 0x94, 0x87, 0x92, 0x88, 0x9D, 0x77,
+0xAB, 0x89, 0xA9, 0x88, 0x99, 0x88, 0x38, 0x65, 0xA2, 0x88, 0xC0, 0x20, 0xA8, 0x78, 0x12, 0x9D, 0x88, 0x51, 0xC1, 0x6E, 0x25, 0xC0, 0x16, 0xA4,
+0x87, 0xA6, 0x65, 0x27, 0x1D, 0x97, 0x89, 0x97, 0x98, 0x62, 0xA4, 0x78, 0x38, 0x96, 0x88, 0x9B, 0x87, 0x65, 0xA2, 0x77, 0xA2, 0x87, 0xA2, 0x88,
+0xA4, 0x88, 0x6F, 0x69, 0x56, 0xA2, 0x89, 0xA4, 0x79, 0x6F, 0x51, 0x55, 0x17, 0x51, 0x9D, 0x88, 0x52, 0x5A, 0xA4, 0x87, 0x17, 0x9B, 0x78, 0x9D,
+0x78, 0x66, 0x64, 0xA9, 0x88, 0xB9, 0x67, 0xAD, 0x89, 0x6F, 0x34, 0x52, 0x68, 0x66, 0x52, 0x7D, 0xA1, 0xA8, 0x65, 0x51, 0x61, 0x5A, 0xA2, 0x78,
+0xA4, 0x88, 0x72, 0x90, 0x8A, 0x95, 0x88, 0x52, 0x99, 0x78, 0x98, 0x89, 0x66, 0xA6, 0x85, 0xAB, 0x96, 0xA9, 0x98, 0x59, 0x9D, 0x88, 0x9D, 0x78,
+0x9B, 0x88, 0xA3, 0x89, 0x6E, 0x93, 0x98, 0x98, 0x89, 0xC0, 0xA3, 0x99, 0xBD, 0x99, 0xBA, 0x88, 0xA3, 0x88, 0xFD, 0xDD, 0x9D, 0x78, 0x93, 0x78,
+0x93, 0x88, 0x38, 0xA4, 0x88, 0xB2, 0x79, 0xA2, 0x77, 0x55, 0x9D, 0x88, 0x6F, 0x6E, 0x39, 0x91, 0x97, 0x60, 0x9B, 0x78, 0x9B, 0x87, 0xAE, 0x68,
+0xAE, 0x89, 0x12, 0x55, 0x3E, 0x69, 0x3E, 0xC0, 0x39, 0x32, 0x3E, 0x12, 0xA2, 0x77, 0x7E, 0x66, 0x24, 0x69, 0x69, 0x6E, 0x6B, 0x1D, 0x59, 0xC0,
+0x6B, 0x65, 0xC0, 0x1B, 0x6F, 0x13, 0x67, 0xA3, 0xAA, 0xA2, 0xA9, 0x99, 0x77, 0x9C, 0x88, 0xA3, 0x89, 0x04, 0x99, 0x96, 0x96, 0x78, 0x9A, 0x89,
+0xAF, 0x79, 0xAB, 0x88, 0x97, 0x88, 0x96, 0xA8, 0xA2, 0x88, 0xA3, 0x88, 0x9C, 0x89, 0xA3, 0x88, 0xAA, 0x78, 0xA5, 0x78, 0x39, 0x25, 0x6E, 0xC0,
+0x2D, 0x2A, 0x25, 0x65, 0xA4, 0x76, 0x13, 0x1B, 0x1D, 0x99, 0x99, 0x97, 0x88, 0x9C, 0x98, 0x11, 0x0C, 0x96, 0x88, 0x9B, 0x87, 0x69, 0xA3, 0x99,
+0xA3, 0x87, 0xA2, 0x88, 0xC0, 0x6F, 0xC0, 0x9C, 0x87, 0x9C, 0x98, 0xA6, 0x5A, 0xA3, 0x99, 0x5A, 0xC1, 0x12, 0x51, 0x9C, 0x89, 0x5A, 0xA5, 0x88,
+0xA4, 0x87, 0x9B, 0x87, 0x9C, 0x79, 0xA2, 0x89, 0x0F, 0xAC, 0x77, 0xB1, 0x87, 0xA9, 0x78, 0x61, 0x7B, 0x40, 0x65, 0x65, 0x56, 0x56, 0xA0, 0xA7,
+0xC0, 0x9C, 0x88, 0x9A, 0x99, 0x9D, 0x77, 0x51, 0x6B, 0xA3, 0x99, 0x99, 0x89, 0x9B, 0x77, 0xA2, 0x99, 0x09, 0x94, 0x7A, 0x9B, 0x98, 0x1E, 0xA5,
+0xA7, 0xA4, 0x87, 0xA3, 0x88, 0x6E, 0x51, 0x9D, 0x79, 0xA6, 0x89, 0xA8, 0x77, 0x92, 0xA8, 0x93, 0x88, 0x9D, 0x78, 0xC0, 0xAE, 0x99, 0x80, 0x88,
+0xAF, 0x88, 0xFD, 0xDD, 0x97, 0x88, 0x94, 0x6A, 0x90, 0x97, 0x98, 0x88, 0xAC, 0x79, 0xAC, 0x77, 0xC0, 0x65, 0x06, 0xC0, 0x61, 0x94, 0x98, 0x94,
+0x97, 0xA2, 0x88, 0x55, 0x6F, 0xAA, 0x88, 0xA6, 0x78, 0x6F, 0x32, 0xC4, 0x66, 0x2A, 0x32, 0x6E, 0xC0, 0x3E, 0xC0, 0x03, 0xA2, 0x87, 0xA3, 0x88,
+0xA3, 0x88, 0x65, 0xC0, 0x02, 0x51, 0x29, 0x6D, 0x7A, 0x27, 0x55, 0x9C, 0x9A, 0x99, 0xA8, 0x9C, 0xA8, 0x41, 0x6E, 0xA2, 0x99, 0xA3, 0x88, 0x9D,
+0x77, 0x96, 0x98, 0x9D, 0x79, 0x25, 0xA6, 0x88, 0x38, 0x97, 0x87, 0x30, 0xA4, 0x89, 0x9D, 0x87, 0x5F, 0xAB, 0x78, 0xA6, 0x88, 0x9D, 0x88, 0xC0,
+0x6E, 0x7F, 0x2A, 0x2D, 0x25, 0x2A, 0x03, 0x10, 0xA2, 0x87, 0xA2, 0x87, 0x9B, 0x89, 0x96, 0x99, 0x33, 0xA3, 0x99, 0xA2, 0x76, 0x97, 0x78, 0x98,
+0x88, 0xA0, 0xA7, 0xA3, 0x88, 0xA3, 0x89, 0xA3, 0x88, 0x69, 0x6E, 0x7F, 0x9D, 0x98, 0x9D, 0x77, 0x6F, 0xA4, 0x69, 0xA2, 0x69, 0x76, 0xC0, 0xA2,
+0x76, 0x6B, 0x9C, 0xA9, 0x41, 0xA4, 0x77, 0xA6, 0x88, 0x6E, 0x6D, 0xA3, 0x99, 0xA4, 0x88, 0xA4, 0x78, 0xA3, 0x98, 0x74, 0x9B, 0x88, 0x56, 0x4B,
+0x42, 0x9C, 0x98, 0x10, 0x52, 0x65, 0xA2, 0x87, 0x75, 0x9B, 0x87, 0x9C, 0x88, 0xC0, 0x6F, 0xA6, 0x88, 0xA5, 0x89, 0x52, 0xA2, 0x88, 0x6E, 0x97,
+0x88, 0x95, 0x89, 0xA4, 0x98, 0xA7, 0x95, 0x7E, 0xA6, 0x76, 0x7B, 0x9D, 0x89, 0x9D, 0x57, 0xA9, 0x79, 0xAA, 0x89, 0x9A, 0x87, 0x8D, 0xA8, 0x98,
+0x98, 0x56, 0xA4, 0x88, 0xBC, 0x88, 0xBB, 0x99, 0xA3, 0x88, 0xFD, 0xDB, 0x51, 0x94, 0x89, 0x93, 0x78, 0x90, 0x88, 0xA2, 0x88, 0x3A, 0xA3, 0x99,
+0xA2, 0x87, 0xC0, 0x41, 0x52, 0x9A, 0x98, 0x93, 0x87, 0x97, 0x97, 0xA5, 0x99, 0xA3, 0x88, 0xA5, 0x78, 0xA6, 0x78, 0x32, 0x6E, 0x32, 0xC3, 0x56,
+0xC0, 0x6E, 0x37, 0x6F, 0x7A, 0x59, 0x37, 0x2F, 0x32, 0x06, 0xA2, 0x88, 0x55, 0xA3, 0x88, 0xA2, 0x88, 0x56, 0xC0, 0x6D, 0x38, 0x55, 0x56, 0x23,
+0x19, 0x9D, 0x97, 0xA4, 0x87, 0xA2, 0x89, 0xA2, 0x88, 0xA4, 0x67, 0x41, 0x93, 0x98, 0x98, 0x89, 0xA8, 0x88, 0x56, 0x97, 0x87, 0x9C, 0x98, 0x6F,
+0xA3, 0x99, 0xA2, 0x78, 0x0D, 0xA4, 0x78, 0x15, 0x01, 0x6E, 0xA2, 0x88, 0x7F, 0xA2, 0x78, 0x09, 0xA2, 0x88, 0xA4, 0x77, 0x2F, 0x0B, 0xA2, 0x77,
+0xA2, 0x98, 0x9D, 0x88, 0x97, 0x89, 0x98, 0xA9, 0xA2, 0x87, 0xA2, 0x78, 0x99, 0x78, 0x97, 0x87, 0x9D, 0x97, 0x2D, 0xA3, 0x98, 0xAA, 0x77, 0xA6,
+0x77, 0xC1, 0x6E, 0x15, 0x62, 0x6F, 0x5B, 0x4A, 0x52, 0xC0, 0x66, 0x9D, 0x88, 0x9E, 0x67, 0x61, 0xA2, 0x88, 0xA2, 0x89, 0x2A, 0x6E, 0x79, 0x51,
+0xC0, 0x75, 0x9C, 0x88, 0xC0, 0x17, 0xA4, 0x78, 0x2F, 0x61, 0xA3, 0x77, 0x3C, 0xA4, 0x88, 0xA4, 0x97, 0x69, 0x9D, 0x88, 0xC0, 0x08, 0xA5, 0x88,
+0x7A, 0x98, 0x9A, 0x9C, 0x88, 0xA2, 0x88, 0x9D, 0x68, 0x96, 0x88, 0x65, 0xA5, 0xB6, 0xA3, 0x88, 0xA5, 0x88, 0x3D, 0x12, 0x1F, 0xA8, 0x69, 0xAE,
+0x88, 0x35, 0x92, 0x98, 0x90, 0xA9, 0x9D, 0x88, 0x19, 0xAE, 0x88, 0x81, 0x88, 0x31, 0xFD, 0xDB, 0x9B, 0x78, 0x91, 0x78, 0x91, 0x88, 0x96, 0x88,
+0xAB, 0x89, 0xAD, 0x78, 0xC0, 0x6F, 0x7E, 0x9D, 0x78, 0x9D, 0x87, 0x97, 0x88, 0x92, 0x97, 0x9D, 0x87, 0xA3, 0x99, 0xA4, 0x89, 0xA7, 0x77, 0xA5,
+0x89, 0xC5, 0x56, 0xC0, 0x69, 0x2A, 0xA2, 0x88, 0xA2, 0x87, 0x13, 0x5A, 0x62, 0x32, 0x9C, 0x98, 0x9A, 0x99, 0x41, 0x20, 0xA7, 0x78, 0xA3, 0x99,
+0x0B, 0xA2, 0x78, 0x7E, 0xC0, 0x66, 0x56, 0x3E, 0x99, 0x87, 0x9D, 0xA6, 0xA4, 0x98, 0xA3, 0x88, 0x6F, 0xA2, 0x68, 0x41, 0x96, 0x98, 0x9A, 0x99,
+0x29, 0x99, 0x87, 0x97, 0x88, 0x65, 0x6E, 0xA2, 0x89, 0xA2, 0x77, 0x7B, 0x6E, 0x7A, 0x9D, 0x87, 0x52, 0x6E, 0xA2, 0x77, 0x6B, 0x34, 0xA2, 0x88,
+0x35, 0x29, 0xA3, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x16, 0x9D, 0x88, 0x29, 0x38, 0xA4, 0x88, 0x9B, 0x78, 0x97, 0x87, 0x9B, 0x97, 0xC0, 0xA6, 0x77,
+0xB0, 0x77, 0xAA, 0x77, 0x40, 0x9C, 0x89, 0x65, 0x62, 0x65, 0x51, 0x42, 0x56, 0x47, 0x52, 0x41, 0x79, 0xC0, 0xA2, 0x88, 0x66, 0x20, 0x7A, 0x51,
+0x7D, 0xC0, 0xA4, 0x89, 0xA3, 0x87, 0x7E, 0xC0, 0xA4, 0x78, 0xA6, 0x89, 0xA3, 0x88, 0x6E, 0x6F, 0xA2, 0x87, 0xA3, 0x99, 0xA4, 0x87, 0xA2, 0x88,
+0x65, 0x51, 0x7E, 0xA3, 0x89, 0x9A, 0x89, 0x90, 0xAA, 0x3D, 0xA4, 0x88, 0x5F, 0x98, 0x98, 0x9C, 0x96, 0x79, 0x12, 0xAB, 0x77, 0xA5, 0x88, 0x99,
+0x88, 0x98, 0x7B, 0xA5, 0x79, 0xAB, 0x97, 0xA3, 0x99, 0x97, 0x87, 0x8D, 0x98, 0x98, 0x99, 0xA2, 0x88, 0xA4, 0x77, 0xBC, 0x99, 0xBB, 0x88, 0xA2,
+0x88, 0xFD, 0xDA, 0x96, 0x79, 0x8F, 0x88, 0x8F, 0x87, 0x07, 0xB0, 0x68, 0x22, 0x65, 0x5A, 0xC0, 0x52, 0x61, 0x95, 0x87, 0x91, 0x97, 0x7A, 0xA3,
+0x89, 0xA4, 0x78, 0xA7, 0x88, 0xA5, 0x89, 0x6E, 0x37, 0x32, 0x2D, 0xC3, 0x55, 0xC0, 0x6E, 0x32, 0x37, 0xC1, 0x1E, 0x99, 0x98, 0x97, 0x87, 0x9D,
+0x88, 0xA8, 0x77, 0xA7, 0x8A, 0x23, 0xA3, 0x88, 0xA3, 0x88, 0xC0, 0x66, 0xC0, 0x6F, 0x7B, 0x9E, 0x86, 0x9C, 0x87, 0x9D, 0xA8, 0x6E, 0x6F, 0xA3,
+0x79, 0x4A, 0x17, 0x66, 0x39, 0x09, 0x96, 0x88, 0x9C, 0x98, 0xC0, 0x6E, 0xA2, 0x89, 0x69, 0x52, 0x7E, 0x65, 0x05, 0xC2, 0x00, 0xC1, 0x05, 0x6F,
+0xC0, 0x19, 0x20, 0x25, 0x7E, 0xA6, 0x89, 0xAA, 0x78, 0x6B, 0x95, 0x87, 0x25, 0x71, 0xA7, 0x77, 0xB1, 0x78, 0xAE, 0x78, 0x5A, 0x9B, 0x88, 0x9C,
+0x99, 0x51, 0x50, 0x9D, 0x77, 0x9A, 0x98, 0x9B, 0x99, 0x52, 0xA2, 0x68, 0xA2, 0x69, 0xA3, 0x88, 0xA6, 0x97, 0xAB, 0x88, 0xA4, 0x87, 0x65, 0x6E,
+0x6E, 0x7F, 0x7E, 0x6F, 0x7E, 0xA2, 0x88, 0x55, 0x9D, 0x87, 0x1C, 0xA3, 0x89, 0x6F, 0x3C, 0x56, 0x66, 0x34, 0x3C, 0x7A, 0x69, 0x51, 0x7E, 0x17,
+0x90, 0x99, 0x96, 0x9B, 0xA5, 0x88, 0xA2, 0x88, 0x11, 0x9A, 0x97, 0x9D, 0x75, 0xA4, 0x89, 0xB0, 0x77, 0xB0, 0x86, 0x9D, 0x78, 0x98, 0x7B, 0x5F,
+0xA6, 0x97, 0xA2, 0x98, 0x9C, 0x88, 0x8F, 0x88, 0x8F, 0x98, 0x00, 0xC0, 0xB0, 0x78, 0x83, 0x87, 0xAC, 0x88, 0xFD, 0xD9, 0x9D, 0x88, 0x93, 0x68,
+0x8F, 0x78, 0x90, 0x97, 0xAA, 0x89, 0xB0, 0x69, 0xA2, 0x87, 0x51, 0xC0, 0x55, 0x66, 0x21, 0x92, 0x97, 0x94, 0x98, 0xA3, 0x98, 0xA2, 0x89, 0xA5,
+0x88, 0xA8, 0x78, 0xA5, 0x78, 0xC1, 0x32, 0x2D, 0xC0, 0x5A, 0xC0, 0x23, 0x66, 0x55, 0xC0, 0x6B, 0xC0, 0x23, 0xC0, 0x9D, 0x88, 0x9A, 0xA8, 0x9A,
+0x88, 0x65, 0x00, 0xA7, 0x79, 0xA5, 0x77, 0xA3, 0x88, 0xA2, 0x77, 0xC1, 0x76, 0xA2, 0x89, 0x7E, 0x6E, 0x50, 0x99, 0x98, 0x9C, 0x89, 0x6E, 0xA4,
+0x78, 0xA2, 0x78, 0x73, 0x05, 0x97, 0x98, 0x9B, 0x76, 0x9C, 0x98, 0x9C, 0x88, 0x9C, 0x88, 0x6E, 0x7F, 0x56, 0xC0, 0x14, 0x05, 0x6E, 0x05, 0xC1,
+0x7A, 0xC0, 0x00, 0xC6, 0xA5, 0x99, 0xAB, 0x89, 0xA3, 0x89, 0x98, 0x78, 0x98, 0x97, 0x9D, 0x97, 0xA3, 0x88, 0xAD, 0x68, 0xAF, 0x88, 0x31, 0x2E,
+0x7F, 0xA3, 0x89, 0x7E, 0x9C, 0x87, 0x98, 0x98, 0x98, 0xA8, 0x9B, 0x98, 0xA5, 0x79, 0xA9, 0x69, 0xA5, 0x68, 0xA3, 0x98, 0xA6, 0x88, 0xA4, 0x98,
+0x5D, 0x51, 0x62, 0x69, 0xC0, 0x7A, 0x3C, 0xC0, 0x65, 0x9C, 0x97, 0x6E, 0xA4, 0x79, 0x03, 0x3C, 0x51, 0x66, 0x2F, 0x28, 0x7F, 0x3F, 0x30, 0x79,
+0x9D, 0x78, 0x19, 0x3E, 0x11, 0xA4, 0x78, 0x9C, 0x97, 0x9A, 0x97, 0x9D, 0x77, 0x7F, 0xAE, 0x77, 0xB7, 0x87, 0xA5, 0x78, 0x9B, 0x68, 0xA0, 0x8A,
+0xA3, 0x99, 0xA2, 0xA7, 0x5A, 0x96, 0x88, 0x87, 0xA8, 0x08, 0x00, 0xA4, 0x88, 0xBE, 0x78, 0xBB, 0x98, 0xA2, 0x88, 0xFD, 0xD8, 0x99, 0x78, 0x8F,
+0x79, 0x90, 0x87, 0x96, 0x98, 0x32, 0x22, 0x56, 0x0E, 0xC0, 0x56, 0x0E, 0x99, 0x88, 0x90, 0x97, 0x97, 0x98, 0xA5, 0x87, 0xA2, 0x89, 0xA4, 0x78,
+0xA8, 0x78, 0xA5, 0x88, 0x6F, 0x66, 0x37, 0x32, 0xC0, 0x5A, 0x2A, 0x69, 0x1E, 0x5A, 0x1E, 0xC3, 0x9B, 0x88, 0x07, 0x33, 0x69, 0x6F, 0x25, 0xA3,
+0x88, 0xA2, 0x77, 0x6E, 0xC0, 0x7B, 0xC2, 0x6E, 0xC0, 0x3E, 0x9C, 0x88, 0x6B, 0xA2, 0x87, 0x7F, 0x9C, 0x88, 0x99, 0x88, 0x9D, 0x87, 0x18, 0xA4,
+0x88, 0x9B, 0x77, 0x99, 0x78, 0x69, 0x05, 0x7E, 0xA2, 0x88, 0x04, 0xA2, 0x78, 0xA2, 0x87, 0x7F, 0xC0, 0x6E, 0x3D, 0x7E, 0xC0, 0x6E, 0x11, 0x7E,
+0x66, 0x19, 0x16, 0x36, 0x9D, 0x88, 0x6B, 0x6F, 0x9D, 0x88, 0x9B, 0x76, 0x9D, 0x87, 0x28, 0x6E, 0xA5, 0x88, 0xA7, 0x88, 0xA3, 0x89, 0xA5, 0x78,
+0xA5, 0x89, 0xA5, 0x88, 0x7B, 0x64, 0x9C, 0x87, 0x97, 0xA8, 0x61, 0xAC, 0x69, 0xAC, 0x58, 0x59, 0x61, 0xA3, 0x89, 0xA5, 0x89, 0xA2, 0x88, 0x0F,
+0x55, 0xC0, 0x7E, 0xA2, 0x88, 0x23, 0x08, 0x9D, 0x86, 0x65, 0x35, 0xA1, 0x9A, 0x1C, 0x55, 0x61, 0x56, 0x66, 0x34, 0x3C, 0x7E, 0x6E, 0x65, 0x89,
+0x9A, 0x8A, 0xAA, 0xA6, 0x89, 0xA9, 0x88, 0x1D, 0x9B, 0x96, 0xC0, 0x55, 0xA8, 0x89, 0xB5, 0x67, 0xA8, 0x77, 0x3C, 0xA2, 0x79, 0x9D, 0x99, 0x74,
+0x0B, 0x2B, 0x8C, 0xA9, 0x8B, 0x99, 0x9B, 0x88, 0x6B, 0x29, 0x84, 0x97, 0xAA, 0x88, 0xFD, 0xD7, 0x66, 0x94, 0x79, 0x8E, 0x88, 0x91, 0x87, 0xA3,
+0x79, 0xB1, 0x88, 0xA5, 0x89, 0x52, 0x22, 0xC2, 0x95, 0x98, 0x8F, 0x87, 0x9C, 0x97, 0xA3, 0x99, 0x18, 0x6F, 0x11, 0xA5, 0x89, 0xA4, 0x77, 0x32,
+0x37, 0x32, 0xC1, 0x56, 0x1E, 0x66, 0x55, 0xC1, 0x05, 0x65, 0x66, 0x11, 0x9D, 0x88, 0xC2, 0x7E, 0x3D, 0x65, 0x55, 0x24, 0x2C, 0x3D, 0x7E, 0x11,
+0xC0, 0xA2, 0x78, 0x39, 0x7F, 0x19, 0xA2, 0x88, 0x7E, 0x65, 0x7F, 0xA5, 0x88, 0xA5, 0x88, 0x6F, 0x9C, 0x78, 0x23, 0x41, 0xA5, 0x88, 0xA8, 0x98,
+0xA5, 0x98, 0xA2, 0x99, 0xA2, 0x87, 0x6B, 0x6E, 0x7F, 0x6E, 0xC1, 0x6F, 0xC0, 0x7E, 0x6F, 0x7A, 0x69, 0x1B, 0x07, 0x9C, 0x88, 0x9B, 0x88, 0x56,
+0x55, 0x9C, 0x89, 0x9D, 0x86, 0x9D, 0x88, 0x9C, 0x88, 0x9B, 0x87, 0x36, 0x1D, 0x41, 0x66, 0x59, 0x66, 0x65, 0x69, 0x9D, 0x87, 0x9C, 0xA9, 0xA6,
+0x78, 0xAB, 0x79, 0xA5, 0x77, 0x66, 0xA2, 0x88, 0xA7, 0x79, 0xA6, 0x89, 0xA2, 0x78, 0x9D, 0x87, 0x9D, 0x77, 0xA2, 0x88, 0xA3, 0x89, 0xA2, 0x89,
+0x69, 0x35, 0x50, 0xA2, 0x88, 0xA3, 0x88, 0xA2, 0x89, 0x7F, 0x65, 0x9D, 0x77, 0x56, 0x35, 0x51, 0x75, 0xA7, 0x77, 0xA6, 0x87, 0x91, 0x99, 0x88,
+0x9A, 0x9D, 0x77, 0xA7, 0x98, 0x76, 0x16, 0x5A, 0x61, 0xA4, 0x78, 0xAC, 0x79, 0xA5, 0x79, 0xA3, 0x69, 0xA2, 0x88, 0x9A, 0x99, 0x60, 0xA6, 0x87,
+0x18, 0x98, 0x87, 0x8E, 0xA9, 0x96, 0x99, 0xC0, 0xA6, 0x78, 0xFE, 0x94, 0x92, 0xB7, 0x88, 0xA4, 0x88, 0xFD, 0xD6, 0x09, 0x90, 0x79, 0x34, 0x96,
+0x88, 0xAF, 0x88, 0xAD, 0x79, 0x65, 0x52, 0x59, 0x66, 0x6F, 0x61, 0x94, 0x98, 0x93, 0x87, 0x7A, 0xA3, 0x88, 0x66, 0x55, 0x10, 0xA3, 0x88, 0xA5,
+0x89, 0xA3, 0x88, 0x7F, 0xC0, 0x00, 0x69, 0x56, 0x66, 0x65, 0x56, 0x11, 0xC0, 0x56, 0x11, 0x7A, 0x56, 0x11, 0xA2, 0x87, 0x7F, 0x6E, 0x6F, 0x6E,
+0x7F, 0xA2, 0x88, 0xA2, 0x99, 0xA2, 0x88, 0xA2, 0x78, 0xA2, 0x87, 0xA2, 0x88, 0xA2, 0x98, 0xA2, 0x77, 0xA2, 0x99, 0xA3, 0x88, 0x6F, 0xA3, 0x88,
+0x7E, 0xA2, 0x89, 0xA3, 0x98, 0xA2, 0x88, 0x5E, 0x9C, 0x79, 0x99, 0x77, 0x9A, 0x79, 0x51, 0x2D, 0xAB, 0xA9, 0xA1, 0xB8, 0xC8, 0x5A, 0xC0, 0x31,
+0xC0, 0x2E, 0x5A, 0xC0, 0x2E, 0xC0, 0x2B, 0x46, 0x55, 0x61, 0x38, 0x55, 0x9D, 0x88, 0x9C, 0x88, 0x9D, 0x88, 0x9C, 0x99, 0x9D, 0x77, 0x9C, 0x87,
+0x26, 0x9C, 0x78, 0x9D, 0x88, 0x51, 0x9C, 0x97, 0x9D, 0x88, 0x6E, 0x6F, 0x09, 0x55, 0x6F, 0x1A, 0x5A, 0x06, 0x9C, 0x98, 0x5A, 0x6E, 0xA2, 0x89,
+0xC0, 0x9D, 0x88, 0x65, 0x1E, 0xA3, 0x97, 0xA2, 0x7A, 0xA2, 0x87, 0x7E, 0x9D, 0x78, 0x17, 0x12, 0x9D, 0x87, 0x21, 0x1A, 0xA9, 0x87, 0xA5, 0x88,
+0x6B, 0x6F, 0xA3, 0x87, 0x61, 0x9C, 0xA8, 0x51, 0x56, 0x55, 0xA3, 0x79, 0x43, 0x9E, 0x6A, 0x40, 0x9A, 0x98, 0x7A, 0xAA, 0xA7, 0xA7, 0xA8, 0x69,
+0x22, 0x93, 0x77, 0x9C, 0xA9, 0x6E, 0xB2, 0x88, 0x82, 0x88, 0xAA, 0x88, 0xFD, 0xD6, 0x99, 0x78, 0x89, 0x78, 0x91, 0x88, 0x5A, 0xB1, 0x89, 0xA5,
+0x99, 0x9C, 0x88, 0x40, 0x62, 0x51, 0x65, 0x9C, 0x87, 0x3C, 0x9C, 0x98, 0xA3, 0x89, 0x65, 0xC0, 0x6E, 0x56, 0xC0, 0xA4, 0x88, 0xA3, 0x88, 0x66,
+0x69, 0x29, 0xA2, 0x88, 0xA2, 0x88, 0x7E, 0xA2, 0x78, 0x39, 0xA2, 0x88, 0xA2, 0x87, 0xA2, 0x89, 0xA3, 0x88, 0xA3, 0x88, 0xA2, 0x88, 0xA3, 0x89,
+0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x87, 0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0x6E, 0x7F, 0x7E, 0x2E, 0xC1, 0x31, 0xC6, 0x9D,
+0x58, 0x99, 0x67, 0x99, 0x78, 0x9C, 0x88, 0x6E, 0xAB, 0xA8, 0xA9, 0xA9, 0x2E, 0xC0, 0x31, 0xC6, 0x52, 0x65, 0xC1, 0x46, 0x9C, 0x87, 0xA4, 0x88,
+0x2E, 0xC1, 0x45, 0x17, 0x0F, 0xC0, 0x6E, 0xC0, 0x6B, 0xC0, 0x14, 0xC0, 0x52, 0x69, 0x52, 0x50, 0x9D, 0x78, 0x51, 0x9C, 0x88, 0x9D, 0x77, 0x9B,
+0x98, 0x9D, 0x88, 0x9C, 0x88, 0x9D, 0x77, 0x9C, 0x99, 0x51, 0x9D, 0x87, 0x29, 0x9D, 0x87, 0x51, 0x51, 0x51, 0x51, 0x51, 0x61, 0x52, 0x69, 0xC1,
+0xA3, 0x89, 0xA4, 0x88, 0x0D, 0x9D, 0x88, 0x20, 0x07, 0x6E, 0x21, 0xAF, 0x78, 0xA8, 0x88, 0xA5, 0x78, 0xA4, 0x87, 0x69, 0x61, 0x6F, 0x0A, 0x46,
+0x9D, 0x78, 0x9B, 0x79, 0x98, 0x79, 0x98, 0x99, 0x55, 0xA6, 0xA7, 0xAA, 0x96, 0x27, 0x97, 0x77, 0x8F, 0x88, 0x97, 0x97, 0x00, 0xA7, 0x88, 0x81,
+0x88, 0xB5, 0x88, 0xA2, 0x88, 0xFD, 0xD4, 0x66, 0x92, 0x78, 0x8A, 0x89, 0x98, 0x88, 0xA6, 0x88, 0xAB, 0x89, 0x61, 0x9B, 0x78, 0x08, 0x34, 0xC0,
+0x66, 0x98, 0x87, 0x98, 0x88, 0xA4, 0x98, 0xA6, 0x78, 0xC1, 0xA3, 0x89, 0x11, 0x6E, 0xA3, 0x99, 0xA3, 0x88, 0x7F, 0x26, 0xA4, 0x78, 0xA4, 0x88,
+0xA4, 0x88, 0xA3, 0x98, 0xA3, 0x89, 0xA4, 0x87, 0xA3, 0x99, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0x7E, 0xC0, 0x31, 0xD2, 0x2E, 0x51, 0x98,
+0x78, 0x99, 0x68, 0x15, 0x9D, 0x77, 0xA5, 0x98, 0xAC, 0x98, 0x1C, 0x17, 0x1A, 0x26, 0xC1, 0x7A, 0xC0, 0x2E, 0x31, 0xC1, 0x2E, 0x29, 0xC0, 0x51,
+0x9C, 0x88, 0x06, 0x2E, 0x29, 0x26, 0x17, 0x66, 0x5A, 0x66, 0x03, 0x5A, 0xC0, 0x6B, 0xC1, 0x6E, 0xC0, 0x7E, 0x6F, 0xC0, 0x6E, 0x20, 0x66, 0x5E,
+0x0C, 0x55, 0x62, 0x55, 0x51, 0x55, 0x52, 0x61, 0x51, 0x9D, 0x77, 0x61, 0x41, 0x9D, 0x88, 0x50, 0x9D, 0x88, 0x9D, 0x87, 0x9D, 0x88, 0x5A, 0xA4,
+0x88, 0x10, 0x7F, 0x0B, 0x37, 0x9C, 0x98, 0x9B, 0x88, 0x9D, 0x77, 0x5E, 0x7F, 0xA6, 0x77, 0xA8, 0x88, 0xA3, 0x98, 0x65, 0x5A, 0xA3, 0x89, 0xA4,
+0x78, 0x56, 0x9C, 0x89, 0x97, 0x79, 0x95, 0x88, 0x99, 0x79, 0xA2, 0x87, 0xA9, 0xA7, 0xA9, 0xA8, 0x7D, 0x92, 0x98, 0x91, 0x88, 0x9B, 0x98, 0xA2,
+0x78, 0xB5, 0x98, 0xBE, 0x88, 0xAA, 0x88, 0xFD, 0xD4, 0x9B, 0x88, 0x8E, 0x79, 0x8A, 0x88, 0xC0, 0xA9, 0x89, 0xA3, 0x88, 0x14, 0x51, 0x6E, 0x7E,
+0xA3, 0x88, 0x17, 0x9C, 0x88, 0xA2, 0x88, 0xA9, 0x99, 0xA5, 0x98, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0xA2, 0x88, 0xA3, 0x88, 0xA2,
+0x88, 0x7F, 0x7F, 0xA2, 0x87, 0x6F, 0x7F, 0x6E, 0xC1, 0x2E, 0xC5, 0x31, 0xC1, 0x2E, 0xC5, 0x29, 0xC2, 0x26, 0xC1, 0x1A, 0xC0, 0x56, 0xC0, 0x40,
+0x98, 0x79, 0x9C, 0x78, 0x9C, 0x88, 0x9D, 0x87, 0xA8, 0x88, 0xAA, 0x98, 0xA3, 0x88, 0x62, 0xC1, 0x7E, 0xC3, 0x12, 0xC0, 0x17, 0xC0, 0x1A, 0xC0,
+0x12, 0x2F, 0x3E, 0x17, 0x12, 0xC2, 0x0A, 0x03, 0x3B, 0xC0, 0x2C, 0x6B, 0xC3, 0x6E, 0x7E, 0x38, 0x6E, 0xC1, 0x3B, 0xC0, 0x6F, 0xC4, 0x5A, 0x3D,
+0xC1, 0x38, 0xC1, 0x55, 0x24, 0x66, 0x59, 0x6F, 0x29, 0x24, 0xC0, 0x6F, 0x33, 0x2C, 0x9D, 0x88, 0x9C, 0x88, 0x9C, 0x88, 0x41, 0xC0, 0x6E, 0x65,
+0x51, 0x56, 0x6E, 0x09, 0x56, 0x9B, 0x78, 0x98, 0x88, 0x96, 0x8A, 0x9A, 0x89, 0x7E, 0xA8, 0x96, 0xA7, 0xA8, 0x9B, 0x97, 0x91, 0x87, 0x99, 0x88,
+0xC0, 0xA8, 0x78, 0xFE, 0x9C, 0xD3, 0xB8, 0x88, 0x6E, 0xFD, 0xD3, 0x95, 0x88, 0x89, 0x68, 0x93, 0x88, 0xA4, 0x78, 0xA7, 0x98, 0x6F, 0x2D, 0xA7,
+0x88, 0xA4, 0x88, 0xA8, 0x97, 0xA3, 0x89, 0x59, 0x0C, 0xA4, 0x99, 0x1A, 0x26, 0x6E, 0x7A, 0xCD, 0x66, 0x2E, 0x29, 0x26, 0xC3, 0x5A, 0x17, 0x7E,
+0x17, 0xC4, 0x12, 0x5A, 0x69, 0x66, 0xC0, 0x5A, 0xC0, 0x34, 0x5A, 0x66, 0x51, 0x99, 0x78, 0x40, 0x9C, 0x89, 0x9C, 0x98, 0x14, 0xA8, 0x87, 0x20,
+0x18, 0xC0, 0x1D, 0xC0, 0x18, 0x20, 0x6B, 0x20, 0x27, 0x2C, 0xC0, 0x2F, 0x34, 0x3B, 0x34, 0x18, 0x1D, 0x31, 0x34, 0xC0, 0x3B, 0x00, 0x03, 0xC0,
+0x3B, 0xC0, 0x2C, 0xC1, 0x56, 0xC4, 0x18, 0xC0, 0x6B, 0xC0, 0x24, 0x27, 0xC0, 0x24, 0x2C, 0x5A, 0xC0, 0x24, 0xC0, 0x33, 0xC5, 0x6E, 0xC0, 0x33,
+0x5A, 0x29, 0x30, 0x33, 0xC0, 0x3D, 0x7F, 0x7E, 0x0C, 0x33, 0x24, 0xC1, 0x1F, 0x55, 0xC0, 0x65, 0x56, 0x66, 0x9D, 0x77, 0x98, 0x89, 0x94, 0x79,
+0x95, 0x88, 0x79, 0xA5, 0xA8, 0xA1, 0xA8, 0x96, 0x88, 0x94, 0x88, 0x65, 0xC0, 0xB4, 0x88, 0x80, 0x88, 0xAB, 0x88, 0xFD, 0xD2, 0x66, 0x8E, 0x78,
+0x8B, 0x67, 0xA3, 0x89, 0xA8, 0x98, 0xA8, 0x88, 0xA6, 0x88, 0x02, 0xA4, 0x88, 0xA5, 0x98, 0xA2, 0x88, 0x12, 0x03, 0x26, 0x31, 0xC1, 0x2E, 0xC4,
+0x26, 0xC1, 0x23, 0x1C, 0xC0, 0x66, 0xC3, 0x0F, 0xC3, 0x69, 0xC0, 0x03, 0xC2, 0x5A, 0x34, 0xC2, 0x56, 0xC1, 0x29, 0xC0, 0x65, 0xC0, 0x56, 0xC0,
+0x69, 0x52, 0x9B, 0x87, 0x9D, 0x78, 0x9C, 0x88, 0x51, 0xAA, 0x88, 0xA5, 0x98, 0xC0, 0x01, 0xC6, 0x09, 0xC2, 0x15, 0x18, 0x15, 0x9D, 0x87, 0x01,
+0x15, 0x18, 0xC0, 0x24, 0x2C, 0x2F, 0xC1, 0x2C, 0xC0, 0x27, 0xC0, 0x24, 0xC1, 0x18, 0xC2, 0x15, 0xC0, 0x10, 0x15, 0xC0, 0x10, 0x15, 0xC0, 0x10,
+0xC9, 0x15, 0xC0, 0x10, 0x15, 0x1F, 0x15, 0x10, 0x15, 0x10, 0x1F, 0x38, 0x3D, 0x38, 0x24, 0x15, 0x6B, 0x29, 0x24, 0x29, 0xC0, 0x24, 0x29, 0x24,
+0x15, 0x9D, 0x78, 0x9B, 0x88, 0x9D, 0x88, 0x65, 0x65, 0x9B, 0x88, 0x0A, 0x97, 0x87, 0x9C, 0x88, 0x2E, 0xB7, 0x98, 0xB0, 0x98, 0xA3, 0x89, 0xA2,
+0x98, 0x6E, 0xFD, 0xCF, 0x15, 0x91, 0x78, 0x40, 0xA7, 0x98, 0xA6, 0x88, 0xA4, 0x88, 0x2B, 0x7A, 0xC1, 0x00, 0x99, 0x87, 0x20, 0x17, 0x66, 0xC2,
+0x0F, 0x08, 0x0F, 0xC0, 0x08, 0xC2, 0x00, 0xC5, 0x66, 0xC0, 0x5A, 0x69, 0x66, 0x66, 0xC2, 0x1D, 0xC3, 0x18, 0x5A, 0xC0, 0x0E, 0x09, 0xC2, 0x66,
+0x5A, 0x65, 0x5A, 0xC1, 0x51, 0x36, 0x9A, 0x88, 0x66, 0x0D, 0xA5, 0x88, 0x32, 0x65, 0xC1, 0x6B, 0x26, 0x2D, 0xC0, 0x32, 0xC3, 0x7A, 0x3A, 0x35,
+0x51, 0xC0, 0x35, 0x04, 0xC1, 0x10, 0x18, 0xC0, 0x24, 0x27, 0xC0, 0x24, 0x1F, 0x18, 0x15, 0xC2, 0x10, 0xC2, 0x5A, 0x66, 0x01, 0xC1, 0x7B, 0x01,
+0x3C, 0x39, 0xCD, 0x6E, 0x3C, 0xC2, 0xA2, 0x77, 0x15, 0x0D, 0x39, 0x51, 0xC0, 0x6E, 0xC0, 0x2D, 0xC0, 0x39, 0xC0, 0x3C, 0x06, 0x15, 0x08, 0x51,
+0x01, 0x15, 0x01, 0x14, 0x9D, 0x87, 0x9D, 0x78, 0xA4, 0x98, 0xA5, 0x88, 0x7A, 0xC0, 0xA2, 0x88, 0xA6, 0x98, 0xA3, 0x99, 0x7E, 0xFD, 0xCB, 0x29,
+0x1A, 0x12, 0xA2, 0x88, 0x2E, 0xC0, 0x2B, 0x17, 0xC0, 0x2B, 0x17, 0x13, 0x51, 0xA7, 0x98, 0x17, 0x3B, 0x2F, 0x2C, 0x6E, 0xC0, 0x2C, 0xC4, 0x27,
+0xC0, 0x20, 0x1D, 0xC2, 0x66, 0x15, 0xC1, 0x0E, 0x09, 0xC2, 0x01, 0xC4, 0x3A, 0x35, 0xC0, 0x32, 0xC2, 0x2D, 0xC0, 0x69, 0xC0, 0x5A, 0x1E, 0x23,
+0x1E, 0x51, 0x9A, 0x88, 0x51, 0x0A, 0x2D, 0x1E, 0xC2, 0x19, 0x69, 0x1E, 0xC6, 0x26, 0x21, 0x19, 0xC0, 0x1E, 0x32, 0x2D, 0x35, 0x01, 0xC1, 0x09,
+0x15, 0x18, 0xC0, 0x10, 0xC4, 0x08, 0x01, 0xC1, 0x3E, 0x39, 0xC4, 0x2D, 0x25, 0xC6, 0x2A, 0x25, 0xC0, 0x2A, 0xC3, 0x25, 0xC0, 0x2A, 0xC0, 0x2D,
+0x32, 0x39, 0x2A, 0x51, 0x51, 0x6E, 0x7B, 0x07, 0x11, 0x16, 0xC0, 0x11, 0x14, 0x25, 0x66, 0x5A, 0x2A, 0x01, 0xA4, 0x88, 0x6F, 0xC1, 0x15, 0x01,
+0x3C, 0x30, 0x04, 0x13, 0xA2, 0x98, 0xA4, 0x88, 0xA2, 0x98, 0x7E, 0xFD, 0xC8, 0x51, 0x1A, 0x6F, 0x17, 0x5A, 0x0F, 0x03, 0x17, 0x2B, 0xC0, 0x2E,
+0x9A, 0x79, 0x3F, 0x2A, 0x12, 0x51, 0x2C, 0x15, 0x69, 0x15, 0x10, 0xC1, 0x09, 0xC2, 0x5A, 0x09, 0x01, 0xC0, 0x06, 0x65, 0xC1, 0x01, 0x59, 0xC1,
+0x32, 0xC2, 0x65, 0x23, 0xCC, 0x1E, 0x69, 0x1E, 0xC0, 0x17, 0x1E, 0xC0, 0x9B, 0x77, 0x9C, 0x88, 0xA6, 0x98, 0x23, 0x51, 0xC1, 0x7A, 0xC1, 0x5E,
+0x1E, 0xC3, 0x23, 0xC2, 0x1E, 0x16, 0x1E, 0x32, 0xC1, 0x37, 0x01, 0xC0, 0x09, 0x10, 0x15, 0x18, 0xC0, 0x24, 0x15, 0xC0, 0x10, 0x15, 0xC1, 0x10,
+0xC0, 0x0D, 0xC1, 0x01, 0x39, 0xC1, 0x55, 0x25, 0xC1, 0x16, 0xC4, 0x11, 0xC5, 0x16, 0xC1, 0x11, 0xC0, 0x16, 0x19, 0x20, 0x11, 0x51, 0x69, 0x5A,
+0x3D, 0xC0, 0x33, 0x3D, 0x5D, 0x67, 0xC0, 0x7D, 0x02, 0x52, 0xA2, 0x88, 0x2A, 0x39, 0x66, 0x39, 0xC1, 0x34, 0x39, 0x2D, 0x25, 0x61, 0x30, 0xA6,
+0xA8, 0x1D, 0x31, 0xFD, 0xC6, 0x9D, 0x88, 0x5A, 0x5E, 0x03, 0x56, 0x59, 0x2C, 0x7E, 0xA2, 0x88, 0xA1, 0x9A, 0x00, 0x98, 0x98, 0x9A, 0x77, 0x16,
+0xA7, 0x98, 0xC0, 0x0E, 0x66, 0x30, 0x01, 0x37, 0x66, 0xC5, 0x66, 0xC1, 0x26, 0xC0, 0x23, 0xC4, 0x66, 0xC2, 0x23, 0x1E, 0xC2, 0x23, 0xC0, 0x1E,
+0xC1, 0x23, 0x1E, 0x23, 0x1E, 0xC0, 0x23, 0x1E, 0xC0, 0x69, 0x0F, 0xC0, 0x6E, 0x1E, 0x36, 0x3F, 0xA6, 0x88, 0x1E, 0x0F, 0xC2, 0x0A, 0xCB, 0x3B,
+0x0A, 0x0F, 0x16, 0xC0, 0x6E, 0x1E, 0xC1, 0x2D, 0x32, 0x7A, 0xC0, 0x3C, 0xC5, 0x39, 0xC2, 0x66, 0xC0, 0x2D, 0x66, 0x25, 0xC1, 0x19, 0x16, 0x11,
+0xC7, 0x02, 0xC0, 0x07, 0xC3, 0x02, 0xC2, 0x07, 0x67, 0x3D, 0x51, 0xC1, 0x6E, 0xC6, 0x29, 0x59, 0xA2, 0x88, 0x02, 0x11, 0xC0, 0x0C, 0x11, 0xC0,
+0x0C, 0xC0, 0x69, 0x02, 0xC0, 0x05, 0x04, 0xA8, 0xA8, 0xA2, 0x98, 0xFD, 0xC5, 0x1A, 0x51, 0x46, 0x2C, 0x66, 0x55, 0x7B, 0xA3, 0x77, 0x27, 0x96,
+0x76, 0x93, 0x86, 0x9B, 0x79, 0xA9, 0x68, 0xAD, 0x89, 0xA5, 0x99, 0x9D, 0x98, 0x1B, 0x23, 0x6E, 0x56, 0x23, 0xC2, 0x1E, 0xCD, 0x1B, 0x1E, 0xC2,
+0x1B, 0x14, 0xC3, 0x0F, 0xC4, 0x0A, 0x69, 0xC0, 0x56, 0x03, 0xC0, 0x5A, 0x0F, 0x12, 0x05, 0x9C, 0x87, 0x9B, 0x78, 0xA6, 0x88, 0xA2, 0x87, 0x56,
+0x65, 0xC0, 0x5A, 0x66, 0xC1, 0x65, 0xC1, 0x3F, 0xC1, 0x66, 0x69, 0xC0, 0x5A, 0x65, 0x6B, 0xC8, 0x7A, 0xC2, 0x2B, 0x26, 0x2B, 0xC0, 0x3A, 0xC3,
+0x3F, 0x6B, 0xC0, 0x6E, 0xC2, 0x7A, 0x66, 0xC0, 0x0E, 0x13, 0x18, 0x13, 0x29, 0xC0, 0x6E, 0xC0, 0x6E, 0xC0, 0x6B, 0xC0, 0x3D, 0xC0, 0x02, 0xC5,
+0x5A, 0x33, 0x2E, 0xC0, 0x5A, 0xC1, 0x2E, 0xC0, 0x22, 0x1F, 0x2E, 0x1F, 0x66, 0x1F, 0x33, 0x36, 0xC2, 0x33, 0x2E, 0xC1, 0x56, 0xC0, 0x29, 0x7E,
+0xA6, 0x98, 0xA9, 0xA9, 0xA3, 0xA8, 0xFD, 0xC3, 0x56, 0x12, 0x9D, 0x77, 0x9D, 0x78, 0x5E, 0x65, 0xC0, 0xA2, 0x88, 0x5A, 0x94, 0x98, 0x8B, 0x86,
+0x96, 0x88, 0xA8, 0x59, 0xAF, 0xA8, 0xFE, 0xC4, 0xD2, 0x9B, 0xA9, 0xA7, 0x37, 0xA8, 0x18, 0xA2, 0x78, 0x23, 0x17, 0x1E, 0x1B, 0xC0, 0x1E, 0xC3,
+0x23, 0xC1, 0x1E, 0xC2, 0x1B, 0x14, 0xC0, 0x66, 0xC0, 0x0A, 0x00, 0x3B, 0xC0, 0x36, 0x27, 0x69, 0x66, 0x56, 0x69, 0x07, 0x56, 0xC0, 0x65, 0xC0,
+0x56, 0xC1, 0x65, 0x6E, 0x3F, 0x27, 0x6E, 0x0A, 0x7A, 0x65, 0x99, 0x78, 0x98, 0x78, 0xA5, 0x88, 0x2B, 0x24, 0xC2, 0x2B, 0xC4, 0x24, 0xC0, 0x1F,
+0xC0, 0x5A, 0x1F, 0x59, 0x66, 0xC1, 0x17, 0x10, 0xC0, 0x17, 0xC0, 0x55, 0xC1, 0x66, 0xCA, 0x66, 0x5A, 0x69, 0x66, 0x5A, 0x65, 0xC1, 0x66, 0x65,
+0x6B, 0xC0, 0x0F, 0x6E, 0x1B, 0x7A, 0x6E, 0x7F, 0x6E, 0x7F, 0x0B, 0x6B, 0x7E, 0x2B, 0x6B, 0x7E, 0x6F, 0x0E, 0x6F, 0x7A, 0x6F, 0xA2, 0x77, 0xC1,
+0x2E, 0xC9, 0x55, 0x1A, 0x22, 0x33, 0x2E, 0xC1, 0x5A, 0x1F, 0xC0, 0x1A, 0xC0, 0x66, 0x5A, 0x69, 0x1A, 0xA7, 0xB9, 0xAA, 0xA8, 0x31, 0xFD, 0xC2,
+0x15, 0x9D, 0x67, 0x9D, 0x78, 0x35, 0x6F, 0x69, 0x56, 0x09, 0x9D, 0x67, 0x8F, 0x97, 0x89, 0xA8, 0x9B, 0x78, 0xAD, 0x58, 0xFE, 0x9B, 0x4B, 0xFE,
+0xD9, 0xA7, 0x98, 0x88, 0xAC, 0x08, 0xFE, 0xA5, 0x34, 0xAA, 0x38, 0x65, 0x5E, 0x56, 0x75, 0xC2, 0x65, 0x00, 0x66, 0x65, 0x66, 0x27, 0x65, 0x56,
+0xC0, 0x07, 0xC0, 0x3F, 0x69, 0xC0, 0x66, 0x5A, 0x66, 0x24, 0xC2, 0x66, 0xC5, 0x24, 0x2B, 0xC0, 0x7A, 0xC0, 0x33, 0x7F, 0x1B, 0x3B, 0xC0, 0x0F,
+0x7A, 0xC0, 0x02, 0x94, 0x89, 0x17, 0x13, 0x0C, 0x6F, 0x1B, 0x6E, 0x27, 0xC1, 0x2A, 0xC0, 0x2F, 0xC4, 0x36, 0xC1, 0x27, 0xC0, 0x36, 0xC3, 0x27,
+0xC4, 0x22, 0x27, 0x2A, 0x6B, 0x36, 0x31, 0xC1, 0x36, 0x31, 0xC0, 0x22, 0x65, 0x13, 0x06, 0x3F, 0x30, 0x2B, 0x56, 0x55, 0x61, 0x51, 0x61, 0x51,
+0x69, 0x66, 0xC1, 0x03, 0xC1, 0x0A, 0x6E, 0xC0, 0x7E, 0x1E, 0x6E, 0x7F, 0xC0, 0x37, 0x6F, 0x7F, 0xC1, 0x7E, 0x6F, 0x2B, 0x2E, 0x6F, 0xC0, 0x3F,
+0x06, 0x0B, 0x0E, 0x6F, 0xC0, 0x6E, 0x7F, 0xC2, 0x56, 0xC1, 0x1F, 0x1A, 0x66, 0x06, 0x6F, 0x55, 0xA0, 0xA9, 0xAA, 0xA8, 0xAA, 0xA7, 0xA2, 0x88,
+0xFD, 0xC0, 0x41, 0x9D, 0x78, 0x41, 0x9D, 0x77, 0x3C, 0x6D, 0x56, 0x67, 0xA3, 0x87, 0x9B, 0x77, 0x1E, 0x8B, 0xB8, 0x96, 0x99, 0xAB, 0x67, 0xFE,
+0xA9, 0xA6, 0xFE, 0xE8, 0x20, 0x9F, 0x08, 0xA5, 0x39, 0xFE, 0x94, 0x71, 0xAF, 0x07, 0x22, 0x18, 0x62, 0x55, 0xC0, 0x38, 0x33, 0xC0, 0x2B, 0x69,
+0xC0, 0x66, 0xC1, 0x66, 0xC0, 0x1F, 0xC2, 0x24, 0x2B, 0xC0, 0x33, 0xC0, 0x3F, 0x6E, 0x0E, 0x13, 0xC0, 0x1B, 0x7F, 0x6E, 0x3B, 0xC0, 0x7E, 0x6B,
+0x7E, 0x6E, 0xC0, 0x6B, 0xA2, 0x87, 0xC0, 0x45, 0x0F, 0xC2, 0x07, 0x95, 0x88, 0xAB, 0x99, 0x32, 0x2D, 0x32, 0x35, 0x3A, 0xC2, 0x01, 0xC0, 0x06,
+0x09, 0xC4, 0x6F, 0xC0, 0x61, 0x01, 0xA2, 0x98, 0x6E, 0x18, 0x1D, 0xC0, 0x18, 0xC0, 0x15, 0xC0, 0x66, 0xC0, 0x15, 0xC0, 0x18, 0x6F, 0x7E, 0xC0,
+0x6F, 0x7A, 0x6E, 0xC3, 0x3B, 0x38, 0x6E, 0x38, 0x55, 0x15, 0x39, 0x50, 0x52, 0x36, 0x0E, 0x51, 0x66, 0x55, 0xC0, 0x55, 0x66, 0x55, 0xC0, 0x37,
+0xC0, 0x55, 0x23, 0xC0, 0x66, 0x59, 0xC0, 0x66, 0xC2, 0x14, 0xC1, 0x7A, 0x6E, 0x17, 0x23, 0x28, 0xC0, 0x37, 0xC0, 0x6E, 0x7B, 0x12, 0x1A, 0x26,
+0x6E, 0xC0, 0x3A, 0xC0, 0x6F, 0xC0, 0x7F, 0x06, 0x6F, 0xC0, 0x06, 0xA3, 0x99, 0xAB, 0xB8, 0x31, 0xFD, 0xC0, 0x9C, 0x78, 0x41, 0x09, 0x32, 0x65,
+0x56, 0x55, 0x0A, 0xA3, 0x78, 0x9C, 0x98, 0x93, 0x88, 0x8D, 0xA8, 0x93, 0x98, 0xAD, 0x57, 0xFE, 0x92, 0x8A, 0xFE, 0xC8, 0xA2, 0x9B, 0x48, 0xAB,
+0x08, 0xFE, 0x7C, 0x90, 0xA9, 0x38, 0x9A, 0xA8, 0x65, 0x76, 0x1A, 0xC1, 0x1F, 0xC0, 0x6E, 0x33, 0xC0, 0x07, 0xC0, 0x6F, 0x6E, 0x7E, 0x6F, 0x7A,
+0x6E, 0x7B, 0x6F, 0x0F, 0x7A, 0x1E, 0xC0, 0x6E, 0x26, 0xC0, 0x6F, 0xC1, 0x6E, 0x7A, 0xC0, 0x6F, 0x3A, 0xC0, 0x01, 0x06, 0xC0, 0x09, 0x06, 0x3A,
+0x1E, 0x3B, 0x3E, 0x5E, 0x6F, 0x99, 0x88, 0x98, 0x98, 0xAC, 0x98, 0x09, 0xC1, 0x6E, 0xC0, 0x6B, 0xC0, 0x7A, 0x1D, 0xC2, 0x7F, 0xC0, 0x6E, 0xC0,
+0x7A, 0x6F, 0xC0, 0x2C, 0xC0, 0xA3, 0x98, 0x7F, 0x66, 0xC1, 0x08, 0xC0, 0x66, 0xC1, 0x56, 0x00, 0xC0, 0x03, 0xC0, 0x08, 0x6B, 0x17, 0xC0, 0x7F,
+0xC1, 0x6E, 0xC3, 0x9D, 0x89, 0x9A, 0x88, 0x9B, 0x77, 0x51, 0x5A, 0xA2, 0x88, 0x5E, 0x59, 0x52, 0x66, 0x69, 0x56, 0x69, 0xC0, 0x2E, 0xC0, 0x29,
+0x59, 0x66, 0x65, 0x0B, 0x66, 0x65, 0x5A, 0x65, 0x66, 0x55, 0xC0, 0x65, 0x3C, 0x66, 0x56, 0x65, 0x66, 0x69, 0x14, 0x66, 0xC0, 0x65, 0x5A, 0x03,
+0xC2, 0x0F, 0x7A, 0x17, 0xC0, 0xA1, 0x9A, 0x6E, 0x7F, 0xC0, 0x6F, 0x6E, 0x6E, 0xC0, 0xA8, 0xA8, 0xAD, 0xAA, 0xA5, 0xA8, 0xFC, 0x41, 0x9A, 0x78,
+0x9D, 0x67, 0x0A, 0x9D, 0x77, 0xC0, 0x13, 0xC0, 0x69, 0xC0, 0x7F, 0x22, 0x9B, 0x88, 0x98, 0x98, 0xA7, 0x68, 0xA4, 0xB8, 0x95, 0xD6, 0x94, 0xBA,
+0xAA, 0x27, 0xAC, 0x27, 0x13, 0x1B, 0x2A, 0xA2, 0x77, 0x6B, 0xC0, 0x7A, 0x0A, 0xC0, 0x6E, 0x7E, 0x6B, 0x6E, 0xC1, 0x7E, 0x6B, 0xC3, 0x6E, 0xC1,
+0x7A, 0xC3, 0x6B, 0xC0, 0x6E, 0xC0, 0x01, 0xC0, 0x06, 0xC0, 0x01, 0xC0, 0x06, 0xC2, 0x61, 0x23, 0x0A, 0xC0, 0x0F, 0x6F, 0x22, 0x26, 0xAB, 0x98,
+0xA6, 0x88, 0x66, 0xC1, 0x0E, 0x15, 0xC0, 0x18, 0x6E, 0xC0, 0x7B, 0x6E, 0xC0, 0x7A, 0x6F, 0xC0, 0x7E, 0xC0, 0x08, 0x51, 0x2F, 0xA3, 0x99, 0x1A,
+0xC1, 0x6E, 0x1A, 0xC1, 0x5A, 0xC1, 0x12, 0xC4, 0x17, 0xC1, 0x1A, 0x17, 0x7F, 0xC0, 0x6E, 0x52, 0x99, 0x87, 0x95, 0x98, 0x97, 0x77, 0x99, 0x88,
+0x55, 0xA3, 0x99, 0xA6, 0x78, 0xA5, 0x68, 0xA3, 0x88, 0x2E, 0x33, 0x7B, 0xC1, 0x02, 0xC1, 0x6B, 0xC2, 0x02, 0xC2, 0x3D, 0x5A, 0x2E, 0xC1, 0x55,
+0x66, 0xC0, 0x66, 0x55, 0xC0, 0x65, 0x56, 0x69, 0x56, 0x66, 0x64, 0x66, 0x56, 0x69, 0x55, 0x62, 0x55, 0xC0, 0x65, 0xC0, 0x52, 0x69, 0x36, 0x2F,
+0x36, 0x6E, 0xA4, 0x89, 0xAE, 0xA8, 0xAE, 0xB9, 0x31, 0xFB, 0x99, 0x67, 0x97, 0x67, 0x9B, 0x77, 0x41, 0x55, 0xA2, 0x88, 0x07, 0xA2, 0x78, 0x6E,
+0x13, 0xC0, 0xA6, 0x98, 0x2C, 0xA2, 0x77, 0x9D, 0x78, 0x9C, 0x78, 0x9A, 0x77, 0x18, 0x52, 0x6D, 0xA4, 0x99, 0xA4, 0x98, 0x6F, 0x6E, 0xC2, 0x7F,
+0xC0, 0x65, 0xC0, 0x37, 0x35, 0xC0, 0x6F, 0xC1, 0x35, 0xC1, 0x3A, 0xC0, 0x35, 0xC0, 0x3A, 0x35, 0xC1, 0x3A, 0xCB, 0x35, 0xC0, 0x3A, 0x32, 0xC0,
+0x26, 0xC0, 0x32, 0x9A, 0x88, 0x9B, 0x87, 0xA9, 0x89, 0xA4, 0x98, 0x01, 0xC0, 0x09, 0xC1, 0x0E, 0x6B, 0x7A, 0x6E, 0xC0, 0x27, 0x2C, 0x7A, 0x34,
+0x6B, 0x7E, 0xC0, 0x6F, 0x3B, 0x2F, 0xA3, 0x99, 0xA2, 0x88, 0xC0, 0x7A, 0x26, 0xC1, 0x66, 0xC0, 0x17, 0xC0, 0x12, 0xC3, 0x0F, 0xC1, 0x12, 0x0F,
+0x08, 0x17, 0x0F, 0xC0, 0x99, 0x98, 0x92, 0x89, 0x91, 0x96, 0x99, 0x77, 0x9D, 0x87, 0x6F, 0xA5, 0x98, 0xA7, 0x89, 0xA4, 0x89, 0xA3, 0x78, 0xA5,
+0x58, 0x3F, 0xA2, 0x89, 0x1F, 0x7B, 0x2E, 0xC0, 0x3D, 0xC1, 0x6E, 0xC0, 0x7F, 0xC1, 0x6E, 0xC3, 0x5A, 0x66, 0xC3, 0x59, 0x02, 0x5A, 0xC0, 0x65,
+0x2E, 0x5A, 0x66, 0x1F, 0x56, 0x66, 0x65, 0x66, 0x32, 0x55, 0x65, 0x56, 0x3E, 0x55, 0xC0, 0x51, 0x7A, 0x5F, 0xA7, 0xC9, 0xB2, 0xA8, 0x31, 0xFB,
+0x99, 0x57, 0x98, 0x88, 0x45, 0x36, 0x3E, 0xA2, 0x89, 0x7E, 0x6F, 0x6E, 0x55, 0x9B, 0x87, 0x07, 0xA3, 0x88, 0xA3, 0x99, 0x9C, 0x88, 0x9B, 0x88,
+0xA2, 0x67, 0xA2, 0x78, 0x76, 0x20, 0xA5, 0x99, 0x3A, 0x6F, 0x66, 0xC0, 0x3A, 0xC1, 0x37, 0xCA, 0x32, 0xC1, 0x37, 0x32, 0xC2, 0x37, 0xC1, 0x3A,
+0xC1, 0x37, 0xC0, 0x76, 0xC3, 0x32, 0xC0, 0x35, 0xC0, 0x32, 0x3A, 0x06, 0x37, 0x36, 0x9C, 0x88, 0xA8, 0x88, 0x06, 0x01, 0xC1, 0x7E, 0xC1, 0x6E,
+0x15, 0x1D, 0xC0, 0x7B, 0x2C, 0x7A, 0x34, 0x6B, 0x6E, 0x7A, 0x6F, 0x3B, 0x34, 0xA2, 0x99, 0xA2, 0x88, 0xC0, 0x7A, 0x26, 0xC2, 0x65, 0x5A, 0xC1,
+0x12, 0xC1, 0x0F, 0x03, 0xC1, 0x5E, 0x73, 0x69, 0x4D, 0x00, 0x9B, 0x9A, 0x93, 0x96, 0x91, 0x88, 0x99, 0x76, 0x9D, 0x88, 0x6F, 0x7F, 0x59, 0xA6,
+0x87, 0xA7, 0x98, 0xA2, 0x88, 0x5B, 0xA3, 0x58, 0xA3, 0x78, 0x7A, 0x7F, 0xA2, 0x78, 0x7A, 0x6F, 0x22, 0x6F, 0xC0, 0x3D, 0x6E, 0xC5, 0x11, 0xC2,
+0x16, 0x11, 0xA2, 0x67, 0x13, 0x66, 0x13, 0x16, 0x11, 0x13, 0x0E, 0xC2, 0x66, 0xC0, 0x3F, 0x62, 0x2E, 0x56, 0x1A, 0x56, 0x0B, 0x66, 0xC0, 0x7F,
+0x1A, 0xA1, 0xA9, 0xA6, 0x98, 0xA9, 0xA9, 0xA3, 0xA8, 0x6E, 0xF9, 0x03, 0x9D, 0x77, 0xC0, 0x1D, 0x20, 0x6F, 0xC0, 0x1D, 0xC1, 0x9B, 0x77, 0x07,
+0x9A, 0x88, 0x55, 0x51, 0xC0, 0xA5, 0x89, 0x04, 0x1B, 0xA4, 0x88, 0x26, 0xA2, 0x88, 0xC0, 0x32, 0xD2, 0x37, 0x32, 0xC5, 0x37, 0xC1, 0x32, 0xC1,
+0x7A, 0xC0, 0x32, 0xC6, 0x3A, 0x32, 0x99, 0x88, 0x9D, 0x77, 0x1E, 0x3A, 0xC1, 0x01, 0xC0, 0x7E, 0xC0, 0x6E, 0x6B, 0x1D, 0xC0, 0x20, 0x2C, 0xC0,
+0x34, 0x6B, 0x7E, 0xC0, 0x0F, 0x3B, 0x2F, 0xA3, 0x99, 0xA2, 0x88, 0xC5, 0x65, 0x17, 0xC0, 0x12, 0xC0, 0x0F, 0x03, 0xC1, 0x3B, 0x34, 0x5A, 0x72,
+0x2C, 0x1D, 0x62, 0x98, 0xA9, 0x8E, 0x98, 0x9D, 0x77, 0x56, 0x69, 0xA7, 0x98, 0xA5, 0x89, 0x98, 0x89, 0x99, 0x87, 0xA6, 0x87, 0xA7, 0x98, 0x46,
+0x9F, 0x57, 0xA3, 0x78, 0x0B, 0x6F, 0x7F, 0x6E, 0x7F, 0xA2, 0x78, 0x7A, 0xC0, 0x55, 0x52, 0x2B, 0xC0, 0x26, 0xC1, 0x2B, 0xC0, 0x3A, 0xC1, 0x3F,
+0x7B, 0x0B, 0x7E, 0x6B, 0xC0, 0x22, 0x6B, 0x2E, 0x33, 0x7F, 0xC1, 0x6E, 0x6B, 0x07, 0x0E, 0x02, 0x56, 0x2E, 0x55, 0xC1, 0x2E, 0xC0, 0x3D, 0x11,
+0xA4, 0x88, 0x7F, 0x75, 0xA2, 0xA8, 0xA5, 0x99, 0xA4, 0x87, 0xF6, 0x66, 0x12, 0xC0, 0x55, 0x3B, 0x00, 0x3B, 0x69, 0x56, 0x1D, 0xC0, 0x51, 0x9C,
+0x77, 0x9C, 0x88, 0x13, 0x9D, 0x87, 0xC0, 0xA6, 0x89, 0xA3, 0x98, 0x1E, 0x7F, 0x6E, 0x37, 0x32, 0xC2, 0x2D, 0xC1, 0x32, 0xE1, 0x2D, 0x32, 0xC0,
+0x37, 0x1E, 0x22, 0x65, 0x23, 0x35, 0x32, 0x35, 0x6E, 0x01, 0xC0, 0x09, 0xC1, 0x15, 0x1D, 0xC0, 0x27, 0x2C, 0x34, 0x3B, 0x03, 0xC0, 0x0F, 0x3B,
+0x34, 0xA2, 0x99, 0x7F, 0x6E, 0xC1, 0x21, 0x69, 0xC0, 0x5A, 0x12, 0xC1, 0x03, 0xC0, 0x3B, 0xC0, 0x34, 0x2C, 0xC0, 0x56, 0x65, 0x09, 0x01, 0x9C,
+0x99, 0x95, 0xA8, 0x91, 0x87, 0xA7, 0x89, 0xA5, 0x9A, 0x6D, 0xA8, 0x87, 0x6B, 0x2C, 0x28, 0xC0, 0x0D, 0x6F, 0x9D, 0x56, 0x5A, 0xA2, 0x78, 0xA2,
+0x78, 0x7F, 0xC0, 0x2B, 0x6F, 0x2B, 0x17, 0x51, 0x51, 0x69, 0xC0, 0x66, 0xC4, 0x28, 0x2F, 0x7A, 0xC0, 0x6E, 0x03, 0xC0, 0x08, 0x7B, 0x17, 0x6E,
+0x7B, 0x2B, 0xC0, 0x6F, 0x7A, 0x6E, 0x06, 0x13, 0x22, 0xC0, 0x6B, 0x1F, 0x66, 0x66, 0xC0, 0x0B, 0x6F, 0x1A, 0x29, 0x9B, 0x98, 0x98, 0x97, 0xA3,
+0xA9, 0xAC, 0x98, 0x10, 0x31, 0xF5, 0x51, 0x4A, 0xC0, 0x51, 0x3B, 0x6E, 0x51, 0xC0, 0x27, 0x59, 0x56, 0x09, 0x01, 0x69, 0x5A, 0x9A, 0x88, 0x36,
+0xA4, 0x98, 0xA2, 0x88, 0x5A, 0xC4, 0x2D, 0xC6, 0x32, 0xD8, 0x65, 0xC7, 0x32, 0x9D, 0x77, 0x13, 0x22, 0x26, 0x32, 0xC1, 0x35, 0x3A, 0x01, 0xC0,
+0x09, 0xC0, 0x15, 0x1D, 0xC0, 0x27, 0x2C, 0x6E, 0x7B, 0xC0, 0x03, 0x6F, 0x3B, 0x34, 0xA2, 0x99, 0x7E, 0xC4, 0x17, 0x12, 0xC0, 0x03, 0xC0, 0x66,
+0x3B, 0x34, 0x2C, 0xC0, 0x1D, 0x18, 0x51, 0x01, 0x40, 0x1E, 0x9A, 0xA9, 0x94, 0xB8, 0x95, 0x88, 0xA9, 0x7A, 0xA9, 0x99, 0xA3, 0x88, 0x64, 0x11,
+0x9D, 0x78, 0x9B, 0x87, 0x9C, 0x97, 0xA7, 0x89, 0xA5, 0x99, 0x9D, 0x66, 0x4A, 0xA4, 0x67, 0x7F, 0x6F, 0x7F, 0xA2, 0x77, 0x26, 0x9D, 0x77, 0x51,
+0x28, 0xC1, 0x66, 0xC0, 0x28, 0x7A, 0xC3, 0x28, 0xC1, 0x6E, 0x7B, 0xC2, 0x5A, 0x6E, 0x72, 0x23, 0xC0, 0x6B, 0x23, 0x2F, 0x37, 0xC0, 0x03, 0x17,
+0x26, 0xA2, 0x88, 0xC1, 0x56, 0x55, 0x59, 0xA0, 0xAA, 0x9D, 0xA8, 0x95, 0x98, 0x97, 0x97, 0xA6, 0x87, 0xAC, 0x88, 0xAF, 0x89, 0xAD, 0x88, 0xA2,
+0x88, 0xF3, 0x56, 0x51, 0x12, 0x55, 0x55, 0x5A, 0x34, 0x2C, 0x55, 0xC0, 0x56, 0x09, 0xC0, 0x5A, 0xC0, 0x65, 0x9A, 0x78, 0x36, 0xA5, 0x99, 0x6E,
+0xC2, 0x65, 0x5A, 0xC8, 0x26, 0xC1, 0x32, 0xC0, 0x26, 0x32, 0xC0, 0x26, 0x32, 0xC2, 0x26, 0xC1, 0x32, 0x69, 0xC0, 0x32, 0x2B, 0xC1, 0x23, 0x26,
+0xC6, 0x23, 0x26, 0x23, 0x32, 0x9C, 0x88, 0x9A, 0x88, 0x36, 0x26, 0x32, 0xC2, 0x3A, 0xC0, 0x6B, 0xC0, 0x09, 0x15, 0x1D, 0xC0, 0x7B, 0x2C, 0x31,
+0x34, 0x6B, 0x03, 0x0F, 0x3B, 0x34, 0x12, 0x7E, 0xC3, 0x5A, 0x12, 0xC0, 0x03, 0xC0, 0x3B, 0x34, 0x66, 0x2C, 0x1D, 0x18, 0x09, 0x01, 0x62, 0x1E,
+0x9D, 0x77, 0x51, 0x9A, 0xBA, 0x94, 0xA7, 0x99, 0x89, 0xA8, 0x79, 0xA6, 0x9A, 0x9E, 0x86, 0x9B, 0x76, 0x55, 0x66, 0x50, 0x9D, 0x88, 0x21, 0xA8,
+0x99, 0x45, 0x48, 0xA5, 0x68, 0xA2, 0x89, 0x7E, 0x33, 0xC0, 0x0B, 0x51, 0x28, 0x7E, 0x66, 0xC1, 0x6B, 0x28, 0x2B, 0x32, 0x2B, 0x32, 0xC1, 0x37,
+0x59, 0x9C, 0x99, 0x61, 0xA2, 0x88, 0x6E, 0xC1, 0x6F, 0x17, 0x23, 0xC1, 0x66, 0x23, 0xC0, 0x55, 0xC0, 0x17, 0x23, 0xA2, 0x89, 0xA2, 0x88, 0x6E,
+0x55, 0x51, 0x5A, 0xA1, 0xBA, 0x9A, 0xB9, 0x96, 0x98, 0x9D, 0x87, 0xA3, 0x87, 0xA6, 0x88, 0xAF, 0x9A, 0xB1, 0x88, 0xA6, 0x88, 0xF2, 0x56, 0x1A,
+0x56, 0x03, 0x56, 0xC0, 0x2C, 0xC0, 0x66, 0x18, 0xC0, 0x55, 0xC0, 0x56, 0x65, 0x5A, 0xC0, 0x36, 0x65, 0xA6, 0x78, 0x32, 0x23, 0xEC, 0x66, 0x23,
+0xC0, 0x32, 0x9B, 0x77, 0x9B, 0x88, 0x3B, 0x23, 0x32, 0xC3, 0x3A, 0xC0, 0x01, 0x09, 0x6E, 0x18, 0x1D, 0x2C, 0xC0, 0x7E, 0x6B, 0x03, 0xC0, 0x6F,
+0x3B, 0x2F, 0x12, 0x1A, 0xC0, 0x5A, 0xC1, 0x12, 0xC0, 0x03, 0xC0, 0x3B, 0x34, 0x2C, 0x27, 0x18, 0x56, 0x01, 0x35, 0x56, 0x51, 0x36, 0x40, 0x9C,
+0x99, 0x9B, 0xA8, 0x96, 0xA8, 0x9C, 0x89, 0xAA, 0x8A, 0xA5, 0x8A, 0x96, 0x86, 0x9A, 0x87, 0xA5, 0x98, 0x7F, 0x9D, 0x78, 0x9B, 0x86, 0xA5, 0x89,
+0xAB, 0x99, 0x55, 0x9D, 0x56, 0x37, 0xA4, 0x89, 0x7F, 0x3A, 0x1F, 0x37, 0x2B, 0x5A, 0x2B, 0x6B, 0x2B, 0x32, 0xC3, 0x2B, 0x32, 0x5E, 0x37, 0x6E,
+0x9C, 0x99, 0x94, 0xA8, 0x9C, 0x88, 0x7F, 0x66, 0xA2, 0x87, 0x6F, 0x13, 0xA9, 0x68, 0x28, 0x6E, 0x28, 0x66, 0xC0, 0x69, 0xC2, 0x56, 0x1E, 0x28,
+0x37, 0xC0, 0x41, 0xC0, 0xA2, 0xA9, 0x9C, 0xCA, 0x65, 0x0C, 0x59, 0x9B, 0x87, 0xA2, 0x99, 0xB5, 0x88, 0xAB, 0x99, 0x31, 0xF1, 0x51, 0x42, 0x03,
+0x51, 0xC0, 0x6E, 0x56, 0x66, 0x55, 0xC0, 0x09, 0x56, 0x69, 0x66, 0x5A, 0xC0, 0x55, 0x9A, 0x88, 0xC0, 0x23, 0xC4, 0x66, 0xC3, 0x23, 0xD7, 0x1E,
+0xCD, 0x23, 0x9C, 0x88, 0x9B, 0x88, 0xA6, 0x87, 0x23, 0x7A, 0xC0, 0x32, 0xC1, 0x35, 0x3A, 0x01, 0x09, 0x6F, 0x18, 0x7F, 0x2C, 0x34, 0x6B, 0x7E,
+0xC1, 0x6F, 0x3B, 0x2F, 0x12, 0x1A, 0x12, 0xC2, 0x69, 0x03, 0x3B, 0x34, 0x2F, 0x2C, 0x27, 0x18, 0x09, 0x01, 0x35, 0x56, 0x19, 0x50, 0x9D, 0x78,
+0x9D, 0x77, 0x9D, 0x77, 0x9B, 0xA9, 0x98, 0xB8, 0x9B, 0x88, 0x06, 0xA6, 0x79, 0x99, 0x86, 0x9B, 0x86, 0x65, 0x3C, 0x55, 0x9C, 0x89, 0xAA, 0x88,
+0xAE, 0x88, 0x9B, 0x87, 0x98, 0x56, 0xA3, 0x78, 0xA5, 0x89, 0xA2, 0x98, 0x2B, 0x9C, 0x87, 0x65, 0x67, 0x69, 0xC0, 0x32, 0x37, 0x32, 0x37, 0xC2,
+0x32, 0xC1, 0x37, 0xA2, 0x78, 0x9B, 0x98, 0x92, 0xA8, 0x62, 0x51, 0x9B, 0x97, 0xA2, 0x78, 0x6F, 0x1A, 0xAC, 0x57, 0x2B, 0x37, 0x28, 0xC0, 0x76,
+0x5A, 0x28, 0xC1, 0x23, 0xC1, 0x6F, 0x37, 0x2F, 0x66, 0xA0, 0xA8, 0xA5, 0xBA, 0xA8, 0x99, 0xA2, 0x77, 0x98, 0x77, 0x98, 0x89, 0x9B, 0x97, 0xB1,
+0x88, 0xB0, 0x88, 0x31, 0xF1, 0x9D, 0x78, 0x41, 0x56, 0x2C, 0xC1, 0x5A, 0x65, 0x51, 0xC0, 0x01, 0xC0, 0x65, 0x56, 0xC1, 0x55, 0x9B, 0x77, 0x69,
+0xA6, 0x89, 0xC0, 0x1E, 0xE4, 0x69, 0xC7, 0x56, 0x1E, 0x23, 0x9B, 0x88, 0x9C, 0x88, 0x0A, 0x23, 0x7A, 0xC1, 0x2D, 0x6E, 0x35, 0x6E, 0x09, 0xC0,
+0x1D, 0x2C, 0x7E, 0x6F, 0xC0, 0x03, 0xC2, 0x6F, 0x3B, 0x34, 0x12, 0x7E, 0x12, 0xC1, 0x0B, 0x03, 0x3E, 0x34, 0x66, 0x2C, 0x24, 0x65, 0x09, 0x01,
+0x66, 0x2D, 0x1E, 0x0A, 0x36, 0x9D, 0x78, 0x9D, 0x76, 0x9D, 0x88, 0x9C, 0xA8, 0x9A, 0xB8, 0x99, 0x89, 0xAA, 0x7A, 0xAC, 0x77, 0x79, 0x9D, 0x88,
+0x99, 0x87, 0x9B, 0x77, 0x9C, 0x78, 0xA2, 0x89, 0xB1, 0x9A, 0xAD, 0x88, 0x95, 0x87, 0x94, 0x66, 0xA3, 0x67, 0x3F, 0x7A, 0x17, 0x9D, 0x87, 0x2B,
+0x37, 0xC3, 0x69, 0xC5, 0x2B, 0x30, 0x7F, 0x9C, 0x89, 0x94, 0x98, 0x7A, 0x9B, 0x88, 0x99, 0x98, 0xA4, 0x78, 0x6E, 0x26, 0xAE, 0x57, 0x37, 0x5A,
+0x28, 0xC0, 0x66, 0x28, 0xC2, 0x23, 0x28, 0x23, 0x28, 0x37, 0x56, 0x23, 0x76, 0xA6, 0xA9, 0xA7, 0x99, 0x9D, 0x78, 0x99, 0x77, 0x9D, 0x87, 0x9A,
+0x98, 0xAC, 0x88, 0xB3, 0x99, 0x31, 0xF0, 0x42, 0x3E, 0x3B, 0x51, 0xC0, 0x6E, 0x27, 0x1D, 0x18, 0x55, 0xC0, 0x51, 0x56, 0xC0, 0x69, 0x5A, 0xC0,
+0x66, 0x9A, 0x88, 0x6E, 0x1E, 0xC6, 0x59, 0xCA, 0x66, 0xC3, 0x14, 0xC0, 0x0F, 0xC1, 0x7E, 0xC0, 0x1E, 0x17, 0xC3, 0x0F, 0xCB, 0x17, 0x36, 0x9B,
+0x77, 0x0A, 0x23, 0x1E, 0x26, 0x6E, 0x32, 0xC0, 0x3A, 0x6B, 0xA2, 0x87, 0xA1, 0xA9, 0x2C, 0xC0, 0x1D, 0xC0, 0x18, 0x5A, 0xC0, 0x0E, 0x15, 0x18,
+0x09, 0x7A, 0xA4, 0x88, 0x12, 0x7A, 0x12, 0xC0, 0x03, 0xC0, 0x34, 0x5A, 0x2C, 0x20, 0x18, 0x5A, 0x61, 0x01, 0x35, 0x2D, 0x1E, 0x0A, 0x36, 0x9D,
+0x87, 0x3F, 0x9C, 0x88, 0x60, 0x9B, 0xA9, 0x99, 0x99, 0xA4, 0x89, 0xAB, 0x8A, 0xAB, 0x88, 0xA5, 0x98, 0x99, 0x66, 0x94, 0x99, 0x91, 0x87, 0xA8,
+0x88, 0xBB, 0x89, 0x21, 0x8E, 0x88, 0x96, 0x66, 0xA4, 0x78, 0xA7, 0x78, 0x9B, 0x98, 0x9B, 0x78, 0x54, 0x7F, 0xCD, 0x3C, 0x9D, 0x88, 0x91, 0xB9,
+0x9D, 0x77, 0x9C, 0x98, 0x9C, 0x88, 0xA3, 0x89, 0xC0, 0xA2, 0x98, 0xAF, 0x57, 0x37, 0x5A, 0x28, 0xC2, 0x7A, 0x28, 0xC6, 0x67, 0x76, 0xA2, 0xA9,
+0x66, 0x9C, 0x87, 0x1F, 0x61, 0x9C, 0x99, 0xAB, 0x88, 0xB5, 0x99, 0xA7, 0x88, 0xEF, 0x56, 0x51, 0x9D, 0x67, 0x5A, 0xC1, 0x6E, 0x2C, 0x1D, 0x66,
+0x01, 0x3A, 0x56, 0x66, 0x26, 0x1E, 0xC1, 0x0F, 0x9A, 0x88, 0x7F, 0x1E, 0xC0, 0x69, 0x0F, 0xEF, 0x9C, 0x88, 0x9C, 0x88, 0x0F, 0xA2, 0x88, 0xC0,
+0x26, 0xC0, 0x32, 0xC0, 0x01, 0x7E, 0x1D, 0x18, 0x59, 0x09, 0x51, 0x51, 0x56, 0x69, 0x66, 0x12, 0x0D, 0x19, 0x0A, 0x0F, 0xA5, 0x99, 0x1D, 0x2F,
+0x03, 0xC0, 0x66, 0x3B, 0x2F, 0x2C, 0x1D, 0x18, 0x5A, 0x10, 0x01, 0x66, 0x32, 0x2D, 0x1E, 0x0A, 0x55, 0x22, 0x3F, 0x9D, 0x88, 0x9C, 0x97, 0x61,
+0x9C, 0xA9, 0x9B, 0x99, 0xA3, 0x7A, 0xAC, 0x88, 0xAA, 0x88, 0x99, 0x87, 0x1C, 0x0C, 0xB1, 0x89, 0xBA, 0x86, 0x9B, 0x89, 0x8C, 0x87, 0x9D, 0x57,
+0xA7, 0x78, 0x13, 0x99, 0x88, 0x9D, 0x87, 0x69, 0x37, 0xCB, 0x32, 0x37, 0x6E, 0x9D, 0x88, 0x90, 0xB9, 0x9D, 0x87, 0x9C, 0x99, 0x9C, 0x88, 0xA2,
+0x78, 0x7A, 0x1A, 0xAF, 0x68, 0x37, 0x34, 0x65, 0xC2, 0x2B, 0xC1, 0x28, 0xC3, 0x34, 0x51, 0x9F, 0xA9, 0xA1, 0xB9, 0x52, 0x9D, 0x76, 0x69, 0x66,
+0x52, 0xAA, 0x98, 0xB6, 0x88, 0xA7, 0x88, 0xEF, 0x9D, 0x78, 0x51, 0x2F, 0x2C, 0xC1, 0x6E, 0x2C, 0x1D, 0x18, 0x09, 0x35, 0x55, 0xC0, 0x1E, 0xC0,
+0x17, 0x5A, 0x0A, 0x0E, 0xA2, 0x77, 0xA5, 0x99, 0xC1, 0x0A, 0x0F, 0xC6, 0x0A, 0xC6, 0x59, 0xC3, 0x0A, 0xC9, 0x69, 0xC7, 0x0A, 0xC2, 0x03, 0x0F,
+0xC0, 0x27, 0x9C, 0x88, 0x0F, 0xA2, 0x88, 0xC0, 0x1E, 0x23, 0x7B, 0xA2, 0x87, 0x09, 0xC1, 0x3A, 0x26, 0x1E, 0x23, 0x7F, 0xC0, 0x6E, 0xC2, 0x32,
+0x0F, 0x0A, 0x0F, 0x1E, 0x35, 0xA2, 0x98, 0xA2, 0x89, 0xA2, 0x88, 0xC0, 0x2C, 0x65, 0x56, 0xC0, 0x56, 0x65, 0x5A, 0x35, 0x32, 0x2D, 0x1E, 0x19,
+0x40, 0x22, 0x9D, 0x88, 0x54, 0x9C, 0x88, 0x9C, 0x98, 0x71, 0x9C, 0xAA, 0x9C, 0x7A, 0x5A, 0xA2, 0x87, 0x9C, 0x88, 0x61, 0xAD, 0x79, 0xB4, 0x98,
+0xA6, 0x99, 0x93, 0x85, 0x96, 0x68, 0xA6, 0x68, 0xA5, 0x77, 0x9A, 0x88, 0x9B, 0x87, 0x65, 0x6E, 0x37, 0xCB, 0x30, 0x37, 0x3C, 0x9D, 0x88, 0x92,
+0xA9, 0x65, 0x9D, 0x88, 0x9B, 0x87, 0xA3, 0x89, 0x1A, 0x6E, 0x25, 0x37, 0x34, 0x65, 0xC1, 0x34, 0x75, 0x28, 0x34, 0xC1, 0x28, 0xC3, 0x9C, 0xB9,
+0xA1, 0xBA, 0xA5, 0x88, 0x41, 0x9D, 0x87, 0xC0, 0x9B, 0x88, 0xAB, 0x99, 0xB4, 0x88, 0xA7, 0x88, 0xEE, 0x56, 0x15, 0x2F, 0x51, 0x41, 0x55, 0xC1,
+0x01, 0x7E, 0x6E, 0x09, 0x35, 0x55, 0x1E, 0x65, 0x0F, 0xC1, 0x00, 0x9A, 0x88, 0x7F, 0x0F, 0xC0, 0x66, 0xC5, 0x00, 0xC4, 0x3B, 0xCF, 0x00, 0xC4,
+0x3B, 0xC5, 0x03, 0xC3, 0x0A, 0x0F, 0x9B, 0x87, 0x9D, 0x78, 0x0F, 0xA2, 0x88, 0x1E, 0x23, 0x26, 0x35, 0xA2, 0x78, 0xC0, 0x3A, 0x21, 0x56, 0x1E,
+0x23, 0x32, 0x6E, 0x6E, 0x7A, 0x06, 0xC0, 0x6E, 0x09, 0x32, 0x1E, 0x26, 0x1E, 0x12, 0xC0, 0x2D, 0x09, 0xA3, 0x99, 0xC0, 0x66, 0x55, 0x56, 0x09,
+0x01, 0x66, 0x32, 0xC0, 0x2D, 0x1E, 0x19, 0x0A, 0x36, 0x9D, 0x88, 0x9D, 0x77, 0x50, 0x9D, 0x77, 0x9B, 0x98, 0x9E, 0xB9, 0x9F, 0x8A, 0x9C, 0x77,
+0x9C, 0x89, 0xC0, 0xAA, 0x88, 0xB1, 0x89, 0xA7, 0x98, 0x94, 0x98, 0x96, 0x76, 0xA7, 0x68, 0xA9, 0x79, 0x13, 0x98, 0x98, 0x40, 0x6E, 0x77, 0xC2,
+0x6E, 0xC8, 0x69, 0x37, 0x3C, 0x9C, 0x99, 0x95, 0x97, 0x7F, 0x9A, 0x88, 0x9D, 0x88, 0xA4, 0x98, 0x9C, 0x88, 0x2B, 0xAE, 0x67, 0x37, 0xC0, 0x65,
+0xC0, 0x28, 0x34, 0x28, 0x34, 0xC3, 0x28, 0xC2, 0x9B, 0xA9, 0x22, 0xA8, 0x88, 0xA2, 0x88, 0x9D, 0x78, 0x9C, 0x99, 0x9C, 0x88, 0xAC, 0x88, 0xAF,
+0x99, 0xA7, 0x87, 0xEE, 0x9C, 0x78, 0x6F, 0x9B, 0x67, 0x19, 0x0A, 0xA2, 0x88, 0x0F, 0xC2, 0x1E, 0x7F, 0x35, 0x2D, 0x1E, 0x69, 0x0F, 0xC1, 0x3B,
+0x9A, 0x88, 0x13, 0x0F, 0x0A, 0x59, 0xC2, 0x3B, 0xCB, 0x65, 0xC4, 0x3B, 0xD6, 0x03, 0x0A, 0x03, 0x1B, 0x51, 0x0F, 0xA2, 0x88, 0x1E, 0x23, 0x2D,
+0xA2, 0x87, 0x01, 0x55, 0x23, 0x1E, 0x23, 0x7E, 0x26, 0x9C, 0x88, 0x9B, 0x88, 0x9A, 0x88, 0x9B, 0x88, 0x60, 0x28, 0xA4, 0x87, 0xA4, 0x88, 0xA6,
+0x78, 0xA4, 0x88, 0x32, 0x6E, 0x23, 0x1E, 0x0F, 0x1E, 0x01, 0xA2, 0x88, 0x7E, 0x18, 0x56, 0x69, 0x01, 0x35, 0x32, 0x2D, 0xC0, 0x1E, 0x19, 0x0D,
+0x56, 0x36, 0x9D, 0x88, 0x9D, 0x77, 0x40, 0x9C, 0x98, 0x9D, 0x98, 0x9D, 0x97, 0x77, 0x6B, 0xA3, 0x89, 0xA6, 0x89, 0xA2, 0x87, 0x9D, 0x77, 0x9B,
+0x77, 0xA4, 0x77, 0xAA, 0x68, 0x6E, 0x98, 0x88, 0x9B, 0x97, 0x5E, 0x37, 0x66, 0x37, 0xC6, 0x3C, 0x37, 0xC4, 0x3C, 0x26, 0x98, 0x99, 0x69, 0x9C,
+0x99, 0x51, 0xA3, 0x98, 0x9C, 0x88, 0x6E, 0xAB, 0x69, 0x37, 0x34, 0x75, 0x32, 0x5D, 0x34, 0x28, 0x34, 0xC2, 0x28, 0xC2, 0x2B, 0x9C, 0x99, 0x76,
+0xA2, 0xA9, 0xA7, 0x89, 0x1D, 0x30, 0xA3, 0x99, 0xAB, 0x87, 0xAD, 0x99, 0xA6, 0x87, 0xEC, 0x66, 0x31, 0x99, 0x68, 0x59, 0x9B, 0x68, 0x0F, 0x6F,
+0xA2, 0x87, 0x6F, 0x28, 0x23, 0x0F, 0x51, 0x7F, 0x1E, 0x7E, 0x1E, 0x69, 0x0A, 0xC1, 0x3B, 0x3F, 0x7F, 0xA6, 0x87, 0xC0, 0x3B, 0xC4, 0x2F, 0xC4,
+0x5A, 0xCE, 0x2F, 0xC4, 0x2C, 0xC2, 0x2F, 0xC0, 0x6E, 0x36, 0x3B, 0xC4, 0x03, 0xC0, 0x9C, 0x88, 0x0E, 0x0F, 0x1E, 0xC0, 0x26, 0x6F, 0x7E, 0x28,
+0x0F, 0x23, 0xC1, 0x22, 0x95, 0x87, 0x94, 0x98, 0x97, 0x98, 0x9B, 0x88, 0x61, 0x66, 0x5A, 0xA3, 0x98, 0xA3, 0x78, 0xA4, 0x88, 0xA8, 0x78, 0x04,
+0xAD, 0x78, 0xA6, 0x78, 0x66, 0x23, 0x0A, 0x12, 0xA2, 0x89, 0xA3, 0x98, 0x18, 0x56, 0x09, 0x56, 0x32, 0xC0, 0x2D, 0xC0, 0x1E, 0xC0, 0x7A, 0x56,
+0x5A, 0x02, 0x9C, 0x98, 0x45, 0x65, 0x9C, 0x88, 0x9B, 0x87, 0x0D, 0x9D, 0x98, 0x6E, 0x7B, 0x37, 0xA3, 0x79, 0xA8, 0x78, 0xA8, 0x77, 0x55, 0x98,
+0x98, 0x23, 0x7A, 0x6E, 0x6F, 0xD0, 0x59, 0x9D, 0xA8, 0x5A, 0xC0, 0x66, 0xC0, 0x61, 0x5A, 0x23, 0x37, 0x2D, 0x77, 0xC0, 0x59, 0x6F, 0x37, 0xC1,
+0x34, 0xC1, 0x28, 0xC0, 0x2B, 0xC0, 0x23, 0x9B, 0x98, 0x9A, 0xB9, 0x52, 0xA2, 0x79, 0xA9, 0x89, 0xA9, 0xA8, 0xA3, 0x87, 0xAF, 0x88, 0x31, 0xED,
+0x9D, 0x78, 0x9B, 0x67, 0x09, 0x9C, 0x88, 0x03, 0x66, 0x9D, 0x77, 0x9C, 0x88, 0x6B, 0x1B, 0x0A, 0xA2, 0x77, 0x0A, 0x59, 0x7F, 0xC1, 0x0A, 0x00,
+0xC0, 0x2C, 0x9A, 0x88, 0xA2, 0x88, 0x03, 0x00, 0x3B, 0xC1, 0x2F, 0x2C, 0xC2, 0x27, 0xCC, 0x69, 0xC0, 0x27, 0xCC, 0x2C, 0xC0, 0x2F, 0xC2, 0x36,
+0x3B, 0xC1, 0x03, 0x00, 0x1B, 0x56, 0x0F, 0x1E, 0x6E, 0x7A, 0x6F, 0x23, 0x14, 0x23, 0xC0, 0x2F, 0x91, 0x98, 0x91, 0x88, 0x93, 0x98, 0x9D, 0x98,
+0xC8, 0x25, 0xAE, 0x77, 0xAF, 0x79, 0xAD, 0x88, 0x26, 0x23, 0x0F, 0x7A, 0xA2, 0x89, 0xA2, 0x88, 0x09, 0x01, 0x65, 0xC0, 0x2D, 0xC0, 0x65, 0xC0,
+0x2D, 0xC0, 0x35, 0x6B, 0x2D, 0xC0, 0x19, 0x45, 0x9D, 0x78, 0x9C, 0x88, 0x9B, 0x87, 0x9C, 0x97, 0x17, 0x66, 0xA3, 0x89, 0x30, 0x2B, 0x64, 0x99,
+0x88, 0x23, 0x28, 0x37, 0x32, 0xC0, 0x28, 0x37, 0xCC, 0x32, 0x5E, 0x69, 0x7F, 0xC0, 0x6E, 0x3C, 0xC2, 0x32, 0x34, 0x2D, 0x32, 0x69, 0x34, 0xC1,
+0x37, 0xC1, 0x34, 0xC0, 0x2B, 0xC2, 0x37, 0x9B, 0x87, 0x98, 0xA9, 0x9A, 0x99, 0xA6, 0x8A, 0xAE, 0x88, 0xA2, 0x87, 0x59, 0xB1, 0x98, 0xA9, 0xA9,
+0xED, 0x9A, 0x68, 0x45, 0x41, 0x96, 0x98, 0x94, 0x87, 0x97, 0x88, 0x10, 0x9D, 0x88, 0xC0, 0x10, 0xAA, 0x78, 0xAD, 0x89, 0x0A, 0x6E, 0x55, 0x0A,
+0xC1, 0x00, 0xC0, 0x2C, 0x30, 0x3F, 0x00, 0x3B, 0x65, 0x2C, 0xC0, 0x66, 0xC3, 0x1B, 0xC3, 0x5A, 0x1B, 0x18, 0xC4, 0x1B, 0x18, 0x1B, 0xCB, 0x20,
+0xC0, 0x27, 0xC0, 0x2C, 0x2F, 0xC3, 0x3B, 0x7E, 0xC0, 0x3B, 0x22, 0x13, 0x0F, 0x1E, 0x6E, 0x7A, 0x21, 0x55, 0x23, 0xC0, 0x3A, 0x8C, 0x98, 0x8F,
+0xB8, 0x9D, 0x88, 0xC3, 0x6E, 0xC1, 0x00, 0x05, 0x00, 0xC2, 0xA4, 0x78, 0xB0, 0x67, 0xB3, 0x78, 0x1E, 0xA2, 0x88, 0x1E, 0x12, 0x21, 0xA2, 0x88,
+0x6F, 0x35, 0x56, 0xC0, 0x21, 0x1E, 0x21, 0x2D, 0xA2, 0x78, 0x01, 0xA2, 0x98, 0xA2, 0x78, 0x51, 0x99, 0x88, 0x9D, 0x67, 0x6E, 0x2E, 0x5A, 0x65,
+0x66, 0xC0, 0x2E, 0xC0, 0x9D, 0x87, 0x9D, 0x67, 0x0B, 0x7A, 0x5E, 0xC0, 0x17, 0x61, 0x0B, 0x06, 0xC0, 0x69, 0xC4, 0x3C, 0x66, 0xC5, 0x69, 0x66,
+0x37, 0xC0, 0x30, 0x37, 0x55, 0x34, 0x76, 0x28, 0xCC, 0x66, 0xC0, 0x28, 0x61, 0x9B, 0x98, 0x9D, 0x99, 0xA3, 0x9A, 0xA5, 0x88, 0x54, 0xA3, 0x78,
+0xB2, 0x98, 0xAB, 0xA9, 0x7F, 0xEB, 0x9D, 0x88, 0x9C, 0x57, 0x40, 0x93, 0x87, 0x8D, 0x88, 0x92, 0x98, 0x9A, 0x99, 0x66, 0xC0, 0x00, 0xC1, 0xAA,
+0x77, 0xB5, 0x68, 0x27, 0xA3, 0x88, 0xC0, 0x3B, 0x7F, 0x3B, 0x00, 0x9D, 0x98, 0x9B, 0x77, 0x6E, 0x3B, 0xC0, 0x55, 0x27, 0xC3, 0x1B, 0xC0, 0x5A,
+0xC0, 0x13, 0xCD, 0x18, 0xC9, 0x1B, 0x6E, 0xC1, 0x27, 0xC0, 0x2C, 0x2F, 0xC0, 0x6E, 0xC0, 0x3B, 0x03, 0x3B, 0x18, 0x7B, 0x0F, 0xA2, 0x88, 0xC0,
+0x66, 0x59, 0x6E, 0x23, 0x90, 0xA8, 0x88, 0xA9, 0x95, 0x98, 0xC6, 0x6F, 0x05, 0x00, 0xC0, 0x05, 0xC0, 0x00, 0xC2, 0xA8, 0x78, 0x1F, 0x12, 0xA3,
+0x78, 0x12, 0x66, 0x1E, 0xA2, 0x98, 0xC0, 0x5A, 0x66, 0x1E, 0xC1, 0x2D, 0x35, 0x15, 0x29, 0x61, 0x93, 0x77, 0x92, 0x98, 0x9C, 0x88, 0xA8, 0x78,
+0xAA, 0x68, 0x22, 0xC0, 0x6B, 0x2E, 0x51, 0x65, 0x3A, 0xC7, 0x59, 0x3A, 0xC0, 0x30, 0xC2, 0x66, 0xC2, 0x65, 0xC0, 0x1C, 0x66, 0xC0, 0x10, 0xC0,
+0x66, 0xC0, 0x5A, 0xC0, 0x66, 0xC0, 0x69, 0xC1, 0x37, 0xC6, 0x5A, 0x65, 0xC2, 0x66, 0x28, 0xC0, 0x61, 0x9D, 0x88, 0x51, 0xA2, 0x89, 0xA6, 0x88,
+0xA5, 0x68, 0x39, 0xAC, 0xB9, 0x31, 0xEB, 0x9C, 0x79, 0x9D, 0x66, 0x8E, 0x78, 0x88, 0xA7, 0x95, 0x88, 0x6F, 0x16, 0xC0, 0x66, 0x65, 0x00, 0xC0,
+0x05, 0x1B, 0xB4, 0x78, 0x0E, 0xA6, 0x77, 0x3B, 0xC2, 0x2F, 0x2B, 0xA2, 0x88, 0x3B, 0x2F, 0x27, 0xC2, 0x65, 0x5A, 0xC0, 0x13, 0xC0, 0x69, 0xC5,
+0x66, 0xC3, 0x0C, 0x07, 0x0C, 0xC4, 0x13, 0x0C, 0xC1, 0x6E, 0x13, 0x18, 0xC0, 0x1B, 0xC1, 0x6E, 0x27, 0xC0, 0x2C, 0x2F, 0xC0, 0x6E, 0x3B, 0x0A,
+0x3B, 0x18, 0x27, 0xA4, 0x88, 0xA2, 0x88, 0x1E, 0x69, 0x14, 0x17, 0x93, 0x88, 0x85, 0xA8, 0x96, 0xA9, 0xD2, 0xA5, 0x78, 0xB4, 0x78, 0xB6, 0x67,
+0x1E, 0x0F, 0x12, 0x7F, 0x6F, 0xC1, 0x51, 0xC0, 0x1E, 0xC0, 0x35, 0xA2, 0x89, 0x1D, 0x94, 0x99, 0x8B, 0x97, 0x94, 0x98, 0x9C, 0x88, 0xA5, 0x88,
+0xB1, 0x58, 0x2B, 0x0E, 0x56, 0x0E, 0x5A, 0x3F, 0x3A, 0xC0, 0x3F, 0xC9, 0x0B, 0x0E, 0xC3, 0x0B, 0xC1, 0x04, 0xC0, 0x3F, 0xC4, 0x3A, 0xC0, 0x30,
+0xC3, 0x2B, 0xC4, 0x66, 0x1F, 0xC1, 0x56, 0xC2, 0x69, 0x66, 0xC0, 0x66, 0x1A, 0x3F, 0x0E, 0x6F, 0xAB, 0xB9, 0xA8, 0xB8, 0x31, 0xE9, 0x55, 0x46,
+0x92, 0x78, 0x82, 0x97, 0x91, 0x98, 0x6E, 0xA3, 0x89, 0xC1, 0x76, 0xC0, 0x6E, 0x9D, 0x88, 0x05, 0x00, 0x16, 0xB3, 0x88, 0xB5, 0x58, 0xA5, 0x88,
+0x36, 0x3B, 0xC0, 0x34, 0x2B, 0x7A, 0xA7, 0x88, 0x5A, 0x20, 0x1B, 0xC0, 0x5A, 0x13, 0xC1, 0x0C, 0xC2, 0x07, 0xC3, 0x04, 0xC3, 0x07, 0xC2, 0x0C,
+0xC9, 0x11, 0x18, 0x1B, 0xC1, 0x20, 0x27, 0x2C, 0x2F, 0xC0, 0x34, 0x3B, 0xA2, 0x88, 0x3B, 0x13, 0x27, 0xA5, 0x99, 0x23, 0x12, 0x0F, 0xA3, 0x88,
+0x95, 0x98, 0x85, 0xA8, 0x92, 0xA9, 0xD4, 0xA2, 0x78, 0xB6, 0x67, 0x3E, 0x28, 0x9C, 0x99, 0x12, 0x23, 0x21, 0x1E, 0x66, 0x0A, 0x12, 0x0F, 0x1E,
+0xA3, 0x99, 0x51, 0x8E, 0xA8, 0x90, 0xA8, 0x61, 0x9A, 0x98, 0x9B, 0x68, 0xAD, 0x57, 0xB0, 0x78, 0x2B, 0x3A, 0xC0, 0x6E, 0xC0, 0x3A, 0x3F, 0xC8,
+0x6B, 0xC1, 0x6E, 0xC1, 0x0E, 0xDB, 0x0B, 0xC0, 0x06, 0xC0, 0x3F, 0x5A, 0x66, 0x3A, 0x3F, 0x0B, 0x6F, 0x1A, 0x6E, 0xA4, 0xA9, 0xA9, 0xB8, 0x31,
+0xE9, 0x51, 0x9B, 0x47, 0x86, 0x98, 0x16, 0x05, 0xA4, 0x77, 0x6F, 0x2A, 0xC0, 0x7A, 0x55, 0xA2, 0x88, 0x2D, 0x51, 0x00, 0xC0, 0x11, 0xB8, 0x57,
+0x27, 0x3B, 0x65, 0x3B, 0x2C, 0x30, 0x33, 0x2F, 0x2C, 0x61, 0xC0, 0x18, 0xC0, 0x13, 0x0C, 0xC2, 0x07, 0x04, 0xC5, 0x69, 0xC1, 0x04, 0xC5, 0x07,
+0xC0, 0x0C, 0xC5, 0x6E, 0x18, 0x1B, 0xC1, 0x6E, 0x27, 0xC0, 0x2F, 0xC0, 0x34, 0x3B, 0x0F, 0x2F, 0x13, 0x36, 0xA4, 0x87, 0xC0, 0x12, 0x5E, 0x27,
+0x88, 0xB8, 0x05, 0x66, 0xC9, 0x19, 0x28, 0x2D, 0xC0, 0x28, 0x19, 0x66, 0x05, 0x00, 0xC2, 0x19, 0xBA, 0x57, 0x0F, 0x7F, 0x0F, 0x1E, 0xC0, 0x66,
+0xC0, 0x51, 0x3B, 0x36, 0x3B, 0x0A, 0x9C, 0x88, 0x1C, 0x95, 0xA8, 0xA1, 0xBA, 0x9B, 0x77, 0x28, 0xA9, 0x68, 0xB2, 0x67, 0xA5, 0x88, 0xA2, 0x88,
+0xC0, 0x2B, 0xC5, 0x30, 0xC1, 0x3A, 0xC1, 0x3F, 0xC2, 0x6F, 0xC2, 0x0E, 0xCC, 0x13, 0xC6, 0x0E, 0xC6, 0x66, 0x0B, 0x06, 0x3F, 0x3A, 0x6B, 0x3A,
+0x06, 0x7F, 0x1A, 0x9A, 0x98, 0xA4, 0xB8, 0xB3, 0xA9, 0xA3, 0x88, 0xE8, 0x41, 0x8F, 0x57, 0x80, 0xA8, 0x95, 0x98, 0xA2, 0x88, 0x23, 0x2A, 0x16,
+0x66, 0x19, 0x16, 0x7E, 0xC0, 0x51, 0x00, 0xC1, 0xA6, 0x67, 0xBA, 0x67, 0x3B, 0xC0, 0x3E, 0x55, 0x99, 0x78, 0xC0, 0x2F, 0x2C, 0x1B, 0x5A, 0xC0,
+0x13, 0x0C, 0xC1, 0x07, 0xC0, 0x04, 0xC2, 0x3D, 0xC3, 0x66, 0xC0, 0x3D, 0xC1, 0x04, 0xC3, 0x07, 0xC1, 0x0C, 0xC3, 0x6E, 0x18, 0x1B, 0xC1, 0x20,
+0x27, 0xC0, 0x2F, 0xC0, 0x34, 0x6F, 0x0F, 0x2F, 0x13, 0x36, 0x17, 0x0F, 0xC0, 0x69, 0x26, 0x2A, 0x9B, 0x98, 0xC7, 0x14, 0xA4, 0x88, 0x29, 0x7F,
+0xC0, 0x6F, 0xA2, 0x87, 0x66, 0x55, 0x9D, 0x88, 0x51, 0x41, 0x19, 0x00, 0xC1, 0xA6, 0x67, 0xBC, 0x78, 0xB1, 0x68, 0x66, 0x0F, 0x1E, 0x66, 0x55,
+0x3E, 0x36, 0x22, 0x13, 0x55, 0x33, 0x97, 0x98, 0x96, 0xB9, 0x77, 0x9B, 0x78, 0x97, 0x77, 0xAC, 0x56, 0xAF, 0x78, 0xA2, 0x78, 0x69, 0x7B, 0x6E,
+0x06, 0x0B, 0xC3, 0x6E, 0xC0, 0x6B, 0x7A, 0x17, 0xC0, 0x1F, 0xC1, 0x2B, 0xC2, 0x30, 0xC0, 0x3A, 0xC0, 0x3F, 0xC9, 0x6F, 0xC3, 0x0E, 0xC2, 0x0B,
+0xC0, 0x66, 0x0B, 0x3F, 0xC4, 0x3A, 0xC0, 0x66, 0x3A, 0xC0, 0x0B, 0x51, 0x92, 0xB8, 0xA0, 0xA8, 0xBA, 0x98, 0x31, 0xE8, 0x9C, 0x78, 0x88, 0x67,
+0x81, 0xA8, 0x05, 0x1E, 0x2F, 0x65, 0x9D, 0x88, 0x05, 0xC0, 0x0A, 0xC0, 0x16, 0x05, 0xC0, 0x00, 0xC1, 0xAE, 0x57, 0x2E, 0xA9, 0x78, 0x36, 0x3B,
+0x2B, 0x30, 0x2C, 0xC0, 0x1B, 0x18, 0xC0, 0x13, 0xC0, 0x69, 0xC0, 0x07, 0xC0, 0x04, 0xC3, 0x69, 0xC5, 0x04, 0xC4, 0x07, 0xC0, 0x0C, 0xC5, 0x18,
+0xC0, 0x1B, 0xC0, 0x20, 0x27, 0xC0, 0x2C, 0x7A, 0xC0, 0x3B, 0x7E, 0x0F, 0x27, 0x13, 0x3B, 0x0F, 0xC0, 0x59, 0x07, 0x87, 0xA9, 0x8F, 0xA8, 0xC1,
+0x6E, 0x00, 0xC2, 0x6F, 0xA5, 0x98, 0x38, 0xA5, 0x88, 0x7F, 0xC0, 0x51, 0xC0, 0x6F, 0xC0, 0x25, 0x20, 0x56, 0x9D, 0x77, 0x9C, 0x88, 0x2D, 0x51,
+0x00, 0xC0, 0xAC, 0x68, 0x0E, 0xA9, 0x88, 0x0F, 0x66, 0x0F, 0x3E, 0x3B, 0x27, 0x13, 0x02, 0x40, 0x66, 0x9B, 0x98, 0x9A, 0xA9, 0x9B, 0x99, 0x2C,
+0x46, 0xAC, 0x66, 0xA7, 0x88, 0x59, 0x66, 0x3C, 0x7A, 0x3C, 0x3F, 0x37, 0xC6, 0x3C, 0xC3, 0x6F, 0x7A, 0x08, 0x0B, 0xC0, 0x10, 0xC0, 0x17, 0xC0,
+0x6E, 0xC0, 0x17, 0x1C, 0xC1, 0x1F, 0xC4, 0x2B, 0xCE, 0x24, 0x1F, 0x6B, 0xC0, 0x1F, 0xC0, 0x5F, 0x17, 0x93, 0xA8, 0x9B, 0xA8, 0xBA, 0x88, 0x31,
+0xE7, 0x5A, 0x98, 0x78, 0x84, 0x87, 0x19, 0x55, 0xA3, 0x88, 0x2A, 0x19, 0x51, 0x00, 0xC0, 0x05, 0x19, 0x6F, 0x7A, 0x14, 0xC1, 0x00, 0x05, 0xB6,
+0x68, 0x27, 0xA3, 0x88, 0x3B, 0x2B, 0xC0, 0x27, 0xC0, 0x65, 0xC0, 0x5A, 0xC0, 0x13, 0xC0, 0x69, 0xC0, 0x07, 0xC2, 0x04, 0xC9, 0x07, 0xC0, 0x0C,
+0xC6, 0x6E, 0x18, 0xC0, 0x1B, 0x6E, 0xC1, 0x27, 0x6E, 0x2F, 0xC0, 0x6E, 0xC0, 0x3B, 0x03, 0xA2, 0x88, 0x27, 0x13, 0x3B, 0x0F, 0xC0, 0x00, 0x8F,
+0xA8, 0x87, 0xA8, 0x9A, 0x99, 0xC5, 0x28, 0x29, 0xA5, 0x99, 0x6F, 0x20, 0xC0, 0x66, 0x55, 0xC1, 0x66, 0x5A, 0xA2, 0x88, 0x7F, 0x20, 0x04, 0x9D,
+0x77, 0x9C, 0x98, 0x9D, 0x87, 0x00, 0xC0, 0xB8, 0x57, 0x3B, 0x17, 0x52, 0xC0, 0x3B, 0xC0, 0x61, 0x51, 0x02, 0x24, 0x10, 0x3F, 0x35, 0x9B, 0x88,
+0x9D, 0x88, 0xA4, 0x78, 0x3F, 0x5A, 0x37, 0x3F, 0xC2, 0x66, 0x3F, 0xC2, 0x3C, 0x37, 0xC1, 0x3C, 0xCE, 0x6B, 0xCC, 0x3C, 0xC0, 0x03, 0x3C, 0xC7,
+0x37, 0xC0, 0x3C, 0x37, 0xC0, 0x5A, 0x3C, 0xC0, 0x96, 0xB9, 0x39, 0xBA, 0x78, 0x31, 0xE7, 0x55, 0x96, 0x68, 0x81, 0x87, 0x05, 0xC0, 0x23, 0x6B,
+0x1E, 0x05, 0xC0, 0xA3, 0x99, 0xA4, 0x88, 0x29, 0xA2, 0x88, 0xC1, 0x61, 0x10, 0x1C, 0x9D, 0x78, 0xA9, 0x78, 0x1A, 0xAD, 0x68, 0x61, 0x2B, 0x1F,
+0xA7, 0x89, 0xC0, 0x65, 0xC1, 0x5A, 0xC1, 0x13, 0xC1, 0x69, 0xC2, 0x66, 0x0C, 0xCB, 0x6E, 0xC0, 0x18, 0xC2, 0x1B, 0xC1, 0x6E, 0xC0, 0x27, 0xC0,
+0x6E, 0x7A, 0x6E, 0xC0, 0x3B, 0xC0, 0x00, 0x7E, 0x17, 0x9B, 0x88, 0x16, 0x3B, 0x0F, 0xC0, 0x16, 0x89, 0x98, 0x8C, 0xB9, 0xC5, 0x28, 0xA8, 0x88,
+0xA4, 0x88, 0x52, 0x69, 0xC0, 0x52, 0xC1, 0x04, 0xC1, 0x3F, 0x04, 0xC0, 0x0C, 0x20, 0x3D, 0x9D, 0x88, 0x9C, 0x98, 0x9D, 0x68, 0x00, 0xA7, 0x89,
+0x26, 0x0F, 0x0A, 0xC0, 0x3B, 0x36, 0x51, 0x16, 0x52, 0x55, 0x9E, 0x86, 0x55, 0x62, 0xC1, 0x6E, 0x3F, 0x3C, 0x3F, 0xC1, 0x3C, 0xC0, 0x3F, 0x3C,
+0xC6, 0x3F, 0xC0, 0x3C, 0xC2, 0x3F, 0x3C, 0xC4, 0x6F, 0xC1, 0x3C, 0xC0, 0x03, 0xC8, 0x3C, 0xC2, 0x37, 0xC6, 0x65, 0x6B, 0xC1, 0x5A, 0xC0, 0x69,
+0xC0, 0x6F, 0x37, 0x99, 0x98, 0x76, 0xB7, 0x99, 0x31, 0xE7, 0x45, 0x91, 0x77, 0xFE, 0x29, 0xC6, 0x00, 0x05, 0x19, 0x23, 0x56, 0x19, 0xA4, 0x88,
+0x38, 0xA5, 0x89, 0xA2, 0x88, 0xC0, 0x66, 0x69, 0x2C, 0x0C, 0x24, 0x9A, 0x88, 0xA2, 0x77, 0xB3, 0x78, 0xB7, 0x58, 0xA2, 0x88, 0x95, 0x88, 0xC0,
+0xA6, 0x87, 0x27, 0x20, 0xC2, 0x66, 0xC0, 0x5A, 0xCB, 0x1B, 0xC7, 0x20, 0xC2, 0x27, 0xC2, 0x6E, 0x7A, 0xC2, 0x6E, 0xC0, 0x6B, 0xC0, 0x7E, 0xC1,
+0x17, 0x27, 0x1B, 0x3E, 0xA2, 0x77, 0xC0, 0x92, 0xA9, 0x85, 0x98, 0x98, 0xA9, 0xC4, 0xA5, 0x89, 0x0C, 0x7F, 0x38, 0x9D, 0x88, 0x24, 0x69, 0x51,
+0x7F, 0x24, 0xC0, 0x6B, 0x6E, 0x3D, 0x38, 0x6B, 0xC0, 0x38, 0x0C, 0xC0, 0x24, 0x9C, 0x88, 0x9B, 0x88, 0xC0, 0xB2, 0x67, 0x2A, 0x14, 0x3E, 0x3B,
+0x27, 0x62, 0x59, 0x02, 0x5A, 0x61, 0x1A, 0x0B, 0x7A, 0xC0, 0x69, 0x56, 0xC6, 0x5A, 0xCC, 0x3F, 0xC8, 0x3C, 0xCD, 0x66, 0xC7, 0x5A, 0x37, 0x34,
+0x65, 0xC3, 0x66, 0x34, 0x51, 0xA3, 0xC9, 0xB3, 0xAA, 0x31, 0xE7, 0x41, 0x8E, 0x77, 0xFE, 0x19, 0x44, 0x00, 0xC0, 0x05, 0xA2, 0x78, 0x01, 0xA5,
+0x88, 0xA1, 0x9A, 0x3D, 0xA2, 0x88, 0x7F, 0x6B, 0xA3, 0x88, 0x7A, 0x55, 0x20, 0x51, 0x9B, 0x77, 0x2D, 0xAC, 0x67, 0xBB, 0x68, 0x14, 0x95, 0x88,
+0x65, 0xA7, 0x88, 0x2F, 0x56, 0xC1, 0x20, 0xC0, 0x27, 0x20, 0xC4, 0x27, 0xC3, 0x2C, 0xCA, 0x2F, 0x6E, 0xC8, 0x3B, 0xC0, 0x6E, 0xC0, 0x7A, 0xC0,
+0x6F, 0xC0, 0x7E, 0x27, 0x1B, 0x3B, 0x08, 0x3B, 0x8A, 0xB8, 0x16, 0x9D, 0x98, 0xC3, 0x2D, 0x0C, 0x11, 0x24, 0x10, 0x65, 0x51, 0x56, 0xC0, 0x2D,
+0x30, 0x01, 0x15, 0xC0, 0x24, 0x6F, 0x29, 0x24, 0xC0, 0x30, 0x11, 0x3D, 0x10, 0x28, 0x51, 0x12, 0x06, 0xAF, 0x78, 0x0F, 0x9D, 0x88, 0x51, 0x13,
+0x66, 0x02, 0xC0, 0x33, 0x1F, 0x66, 0x69, 0x66, 0x59, 0xC0, 0x3F, 0xC4, 0x3C, 0xD5, 0x3F, 0xC0, 0x3C, 0xCB, 0x37, 0xCC, 0x5A, 0xC1, 0x65, 0xC0,
+0x7A, 0x28, 0x23, 0xA9, 0xB9, 0xB2, 0xA9, 0x31, 0xE7, 0x41, 0x89, 0x66, 0x32, 0x00, 0x05, 0xC0, 0x2D, 0x29, 0x0C, 0x29, 0x10, 0x69, 0xA1, 0x9A,
+0x29, 0xA2, 0x99, 0xA4, 0x77, 0x66, 0x0C, 0xC0, 0x56, 0x9A, 0x97, 0xA4, 0x68, 0xBB, 0x57, 0x0F, 0x97, 0x77, 0x1F, 0x27, 0x2F, 0xCA, 0x36, 0xC0,
+0x3B, 0xC6, 0x6E, 0xC4, 0x03, 0xC8, 0x0A, 0x03, 0xC2, 0x6E, 0xC1, 0x0F, 0xC0, 0x17, 0xC0, 0x22, 0x1B, 0x3B, 0x03, 0x9B, 0x78, 0x85, 0xB8, 0x90,
+0xA9, 0xC3, 0xA3, 0x88, 0x38, 0xA3, 0x98, 0x9D, 0x77, 0x9B, 0x89, 0x51, 0x55, 0x2D, 0x10, 0xC2, 0x50, 0x6E, 0x10, 0x15, 0x7B, 0x24, 0xC0, 0x56,
+0xC0, 0x38, 0xC0, 0x1C, 0x9D, 0x87, 0x9D, 0x87, 0x5F, 0xB3, 0x78, 0x36, 0xA4, 0x77, 0x3B, 0x22, 0x51, 0x02, 0x5A, 0xC0, 0x33, 0x66, 0x55, 0x66,
+0x65, 0x5A, 0x69, 0x66, 0xC5, 0x5A, 0xE0, 0x66, 0xCD, 0x66, 0xC0, 0x2B, 0xC1, 0x5A, 0xC0, 0x23, 0xC0, 0x66, 0xAB, 0xA8, 0xB1, 0xAA, 0xA4, 0x98,
+0xE7, 0x9D, 0x77, 0x85, 0x67, 0x25, 0x00, 0x05, 0x19, 0x21, 0xA1, 0xA9, 0x9C, 0x87, 0x2D, 0x66, 0xC0, 0x69, 0x28, 0x10, 0x24, 0x6F, 0x0C, 0x5A,
+0x0C, 0x9B, 0x88, 0x9D, 0x77, 0xB6, 0x57, 0xB3, 0x67, 0x9A, 0x88, 0x9D, 0x88, 0x27, 0xA3, 0x88, 0x3B, 0xC3, 0x03, 0xC2, 0x0A, 0xC0, 0x0F, 0xC0,
+0x7A, 0x0F, 0xC1, 0x17, 0xC1, 0x6B, 0xC0, 0x17, 0xD7, 0x6F, 0x17, 0x9A, 0x88, 0x5A, 0x00, 0x03, 0x1A, 0x85, 0xB8, 0x96, 0x99, 0xC2, 0x6F, 0x15,
+0xA5, 0x99, 0x29, 0x3C, 0x28, 0x3C, 0xA7, 0x89, 0xA5, 0x98, 0xA3, 0x89, 0xA2, 0x88, 0xC0, 0x66, 0x9D, 0x78, 0x9A, 0x98, 0x9C, 0x77, 0x10, 0xA2,
+0x87, 0x24, 0x15, 0xC1, 0x67, 0x7E, 0x29, 0x01, 0x9C, 0x98, 0x19, 0xAA, 0x78, 0xBB, 0x68, 0xAA, 0x67, 0x3B, 0x22, 0x9D, 0x77, 0x3D, 0x59, 0xC0,
+0x2E, 0xC0, 0x55, 0x66, 0x69, 0x66, 0x59, 0x66, 0xC5, 0x5A, 0xDE, 0x37, 0xCF, 0x32, 0xC0, 0x2B, 0xC0, 0x32, 0x59, 0xC0, 0x66, 0x28, 0x62, 0xA8,
+0x98, 0xB1, 0xB9, 0xA7, 0x99, 0xE7, 0x06, 0x84, 0x77, 0x19, 0x00, 0xA2, 0x77, 0x01, 0xA5, 0x99, 0x9D, 0x88, 0x9B, 0x77, 0xA4, 0x77, 0x29, 0xC0,
+0x10, 0x51, 0x01, 0x7A, 0x10, 0xA2, 0x88, 0xA2, 0x78, 0x38, 0x1F, 0x28, 0xAE, 0x67, 0xB9, 0x68, 0x40, 0x1A, 0x2C, 0x0F, 0xC2, 0x12, 0x6F, 0xC1,
+0x6E, 0xC1, 0x7A, 0x6F, 0xC3, 0x7A, 0x6E, 0xCE, 0x5A, 0x32, 0xC2, 0x69, 0xC2, 0x23, 0xC2, 0x26, 0x23, 0x65, 0x1B, 0x56, 0xA5, 0x88, 0x3B, 0x8F,
+0x97, 0x2D, 0x9B, 0x88, 0xC2, 0x01, 0xA6, 0x99, 0x55, 0x01, 0x28, 0x10, 0xA9, 0x88, 0xAC, 0x89, 0xA7, 0x98, 0x5A, 0x65, 0x6B, 0x6B, 0xC0, 0x9A,
+0x88, 0x97, 0x87, 0x98, 0x88, 0x9D, 0x77, 0x7E, 0x1D, 0x10, 0xC1, 0x1F, 0x30, 0x15, 0x2D, 0x00, 0x2D, 0xBB, 0x68, 0x3B, 0xC0, 0x22, 0x9D, 0x77,
+0x2E, 0x33, 0x2E, 0x5A, 0x65, 0xC0, 0x1A, 0x0E, 0x0B, 0x69, 0x66, 0xC5, 0x5A, 0xDE, 0x66, 0xCD, 0x66, 0x37, 0xC0, 0x32, 0xC2, 0x69, 0x5A, 0x66,
+0xC0, 0x65, 0xA5, 0xA9, 0xB1, 0xAA, 0x31, 0xE7, 0x9B, 0x78, 0x83, 0x66, 0x85, 0x98, 0x00, 0x2D, 0x29, 0x1C, 0x51, 0xA6, 0x97, 0xA9, 0x89, 0xA4,
+0x78, 0x7E, 0x01, 0x9B, 0x87, 0x97, 0x87, 0x9A, 0x89, 0x7E, 0x6F, 0xC0, 0x24, 0xC0, 0x99, 0x88, 0x29, 0x2E, 0xA3, 0x78, 0x1F, 0x2C, 0x1E, 0x6E,
+0x7F, 0x3A, 0xC0, 0x6F, 0x7A, 0xC0, 0x6E, 0x7B, 0xC0, 0x6E, 0xC0, 0x7A, 0x6E, 0x6B, 0xC4, 0x6E, 0xC5, 0x2C, 0x7A, 0xC0, 0x2C, 0xC1, 0x25, 0x20,
+0x1D, 0xC1, 0x18, 0xC0, 0x0E, 0x09, 0xC1, 0x3A, 0x35, 0xC0, 0x32, 0x50, 0x1B, 0x55, 0xA6, 0x78, 0x9C, 0x98, 0x8A, 0xA9, 0x8B, 0xA9, 0x61, 0xC1,
+0xA3, 0x89, 0x38, 0x6E, 0x9A, 0x88, 0x52, 0x24, 0xAB, 0x89, 0xA9, 0x98, 0x19, 0xA4, 0x88, 0xA3, 0x89, 0xA2, 0x87, 0xC0, 0x51, 0x01, 0x9D, 0x89,
+0x9C, 0x89, 0x98, 0x88, 0x96, 0x87, 0x9B, 0x77, 0x7D, 0x15, 0x10, 0xC0, 0x6B, 0x7E, 0x24, 0x10, 0x9A, 0x88, 0x55, 0xB5, 0x79, 0x1B, 0xA4, 0x78,
+0x9D, 0x88, 0x9C, 0x88, 0x61, 0xC1, 0x55, 0xC1, 0x65, 0x0B, 0xC0, 0x69, 0x66, 0xC5, 0x5A, 0xDE, 0x37, 0xCD, 0x66, 0xC1, 0x2B, 0xC1, 0x28, 0xC0,
+0x66, 0xC1, 0x65, 0xA3, 0x99, 0xAF, 0xBA, 0xAE, 0x98, 0xE7, 0x9B, 0x78, 0xFE, 0x5B, 0x8D, 0x05, 0x14, 0xA5, 0x99, 0x1C, 0xC0, 0xA9, 0x98, 0xA9,
+0x88, 0x7F, 0xA3, 0x88, 0xA2, 0x88, 0x6F, 0x55, 0x99, 0x88, 0x94, 0x98, 0x98, 0x88, 0x7E, 0x15, 0x24, 0x5A, 0x99, 0x98, 0xA4, 0x77, 0xBA, 0x57,
+0xA9, 0x68, 0x9D, 0x88, 0x3B, 0xA5, 0x99, 0x06, 0x7E, 0x7F, 0x6E, 0x7F, 0xC0, 0x7A, 0x6F, 0xC0, 0x7A, 0xC0, 0x6E, 0xC0, 0x6B, 0xC1, 0x7E, 0xCE,
+0x0F, 0x08, 0xC1, 0x03, 0xC0, 0x56, 0xC0, 0x34, 0x56, 0xC0, 0x65, 0x56, 0x0E, 0x66, 0x55, 0x9C, 0x78, 0x9A, 0x98, 0x55, 0xA7, 0x78, 0x07, 0x87,
+0xA8, 0x8F, 0xA9, 0xC1, 0x6E, 0x01, 0x3D, 0x10, 0x2D, 0x21, 0xAE, 0x87, 0xA8, 0x88, 0x19, 0xA8, 0x88, 0xA8, 0x88, 0xA5, 0x99, 0x6E, 0x6E, 0x61,
+0x9C, 0x89, 0x9A, 0x78, 0x99, 0x88, 0x9A, 0x89, 0x98, 0x88, 0x93, 0x87, 0x10, 0x15, 0xC0, 0x10, 0xC1, 0x24, 0x10, 0x9B, 0x87, 0x00, 0xAD, 0x78,
+0xBA, 0x67, 0xA9, 0x68, 0x1B, 0x9C, 0x89, 0x2B, 0xC1, 0x1F, 0xC0, 0x66, 0x69, 0x5A, 0x66, 0x65, 0xC6, 0x5A, 0xD4, 0x37, 0xD6, 0x66, 0xC3, 0x69,
+0xC0, 0x28, 0xC0, 0x66, 0xC1, 0x66, 0x32, 0xAD, 0xB9, 0xB1, 0xA9, 0xE7, 0x9C, 0x78, 0x81, 0x77, 0x0A, 0xA2, 0x99, 0xA3, 0x99, 0x15, 0xA7, 0x89,
+0xAD, 0x88, 0xA7, 0x99, 0xA5, 0x98, 0xA5, 0x88, 0xA3, 0x99, 0x5A, 0x09, 0x99, 0x78, 0x93, 0x87, 0x93, 0x88, 0x9C, 0x88, 0x79, 0x24, 0x21, 0x28,
+0x2D, 0xB8, 0x57, 0xAD, 0x68, 0x65, 0x2A, 0xA5, 0x89, 0xC0, 0x7A, 0x6E, 0xC0, 0x7B, 0xC0, 0x6E, 0xC9, 0x6E, 0xC4, 0x7B, 0xC8, 0x3A, 0x35, 0xC0,
+0x3A, 0xC0, 0x35, 0xC3, 0x5A, 0xC0, 0x26, 0xC0, 0x5A, 0x9C, 0x88, 0x9B, 0x88, 0x07, 0xA7, 0x78, 0x96, 0xA8, 0x85, 0xA9, 0x94, 0xA9, 0xC1, 0xA3,
+0x88, 0x24, 0x7F, 0x9C, 0x87, 0xA2, 0x78, 0xAC, 0x88, 0xAB, 0x98, 0xA5, 0x89, 0xA9, 0x99, 0xAA, 0x78, 0xA4, 0x98, 0x6E, 0xC0, 0x6B, 0xC0, 0x55,
+0x9D, 0x87, 0x9A, 0x78, 0x97, 0x88, 0x97, 0x89, 0x94, 0x88, 0x94, 0x97, 0x55, 0x6E, 0x10, 0xC1, 0x0B, 0x5A, 0x28, 0x00, 0xA7, 0x78, 0xBB, 0x78,
+0xAE, 0x57, 0x9D, 0x88, 0x9C, 0x98, 0x9D, 0x77, 0xC0, 0x6B, 0x1F, 0x66, 0x69, 0xC0, 0x56, 0x69, 0x66, 0xC6, 0x3C, 0xD3, 0x37, 0xD7, 0x66, 0xC3,
+0x69, 0xC0, 0x5A, 0xC0, 0x66, 0xC1, 0x65, 0x23, 0xAC, 0xA9, 0xB2, 0xA9, 0x31, 0xE6, 0x9C, 0x88, 0xFE, 0x63, 0xAD, 0x19, 0xA2, 0x89, 0x08, 0xA7,
+0x88, 0xAC, 0x97, 0xAB, 0x89, 0xAA, 0x88, 0xA9, 0x89, 0xA4, 0x88, 0x66, 0x69, 0x35, 0x99, 0x78, 0x95, 0x87, 0x90, 0x89, 0x95, 0x77, 0x9D, 0x97,
+0x5A, 0xC0, 0x9A, 0x99, 0x6E, 0xB3, 0x67, 0x02, 0x5E, 0xA2, 0x88, 0x00, 0x3B, 0x69, 0x3B, 0x34, 0xC1, 0x66, 0xC8, 0x5A, 0xC1, 0x2F, 0xC9, 0x34,
+0x2F, 0xC0, 0x34, 0xC5, 0x3B, 0xC0, 0x7A, 0x3B, 0xC1, 0x7E, 0x6E, 0x2A, 0x9C, 0x78, 0xA2, 0x87, 0x3B, 0x93, 0x98, 0x86, 0xB8, 0x98, 0x99, 0xC1,
+0xA5, 0x99, 0xA6, 0x77, 0x15, 0x51, 0xAB, 0x99, 0xAD, 0x88, 0xA6, 0x88, 0xAC, 0x89, 0xA9, 0x98, 0xA2, 0x78, 0x09, 0x56, 0x09, 0x10, 0x01, 0xC0,
+0x6E, 0x01, 0x9B, 0x88, 0x21, 0x95, 0x88, 0x91, 0x78, 0x97, 0x87, 0x7D, 0x6F, 0xC0, 0x56, 0x7A, 0xC0, 0x55, 0x9A, 0x88, 0x7B, 0xBA, 0x57, 0xB3,
+0x57, 0xC0, 0x02, 0x1F, 0x1A, 0x1F, 0xC0, 0x1A, 0x65, 0xC0, 0x0B, 0x66, 0x65, 0x59, 0x3C, 0xC1, 0x66, 0x3C, 0x69, 0x37, 0xC1, 0x3C, 0x35, 0xC2,
+0x3C, 0xC3, 0x35, 0xC1, 0x3C, 0xC0, 0x37, 0x3C, 0xC9, 0x37, 0xC6, 0x32, 0xC4, 0x2B, 0xC1, 0x30, 0x32, 0x30, 0x2B, 0xC0, 0x5A, 0xC0, 0x66, 0xC0,
+0x66, 0x5D, 0x66, 0x17, 0xAB, 0xAA, 0x1D, 0xA2, 0x88, 0xE6, 0x9D, 0x77, 0x82, 0x78, 0x86, 0xA9, 0x6F, 0xA5, 0x88, 0xAD, 0x98, 0xAC, 0x87, 0xAE,
+0x88, 0xAA, 0x89, 0xA3, 0x89, 0x51, 0xC0, 0x9D, 0x87, 0x6F, 0xC0, 0x98, 0x88, 0x91, 0x88, 0x8D, 0x77, 0x99, 0x97, 0x5A, 0x10, 0x9B, 0x78, 0x28,
+0xAE, 0x67, 0x2E, 0xA5, 0x78, 0x0C, 0x3B, 0xC0, 0x69, 0x2F, 0xC2, 0x2C, 0xC3, 0x66, 0xC1, 0x69, 0xCB, 0x27, 0xC1, 0x2C, 0x27, 0x2C, 0xC2, 0x2F,
+0xC6, 0x34, 0xC0, 0x6F, 0x7A, 0x9C, 0x88, 0x9D, 0x77, 0x0C, 0x2C, 0x90, 0xA9, 0x88, 0xA8, 0x9A, 0xA9, 0xC0, 0xA2, 0x88, 0x10, 0xA2, 0x88, 0x9D,
+0x77, 0xA6, 0x88, 0xAD, 0x99, 0xAA, 0x87, 0x11, 0x09, 0xA2, 0x89, 0x9D, 0x77, 0xC1, 0x35, 0xC0, 0xA2, 0x89, 0x09, 0x52, 0x09, 0x10, 0x98, 0x88,
+0x94, 0x88, 0x91, 0x78, 0x93, 0x87, 0x9C, 0x97, 0xA2, 0x88, 0x6F, 0x1C, 0x65, 0xC0, 0x59, 0x0F, 0x55, 0xB6, 0x67, 0xB6, 0x47, 0x2C, 0x07, 0x9C,
+0x88, 0x13, 0x1F, 0xC0, 0x1A, 0x65, 0x0B, 0x1A, 0xA4, 0x98, 0x66, 0x9D, 0x78, 0x66, 0xC0, 0x59, 0x66, 0x5A, 0xC0, 0x69, 0x66, 0xC5, 0x37, 0xC8,
+0x69, 0xCC, 0x5A, 0xC3, 0x66, 0xC8, 0x2B, 0x28, 0xC5, 0x23, 0x69, 0x23, 0x1C, 0x62, 0x00, 0xB4, 0xA8, 0xA3, 0x99, 0xE6, 0x51, 0x83, 0x67, 0x86,
+0xA9, 0x6E, 0xA8, 0x88, 0xAE, 0x88, 0xB0, 0x88, 0xAD, 0x88, 0x29, 0x99, 0x88, 0x99, 0x77, 0xC0, 0xA6, 0x88, 0xA3, 0x99, 0x6E, 0x51, 0x95, 0x77,
+0x8C, 0x89, 0x92, 0x97, 0x9D, 0x88, 0xC0, 0x9C, 0x88, 0xC0, 0xAA, 0x78, 0x1A, 0x18, 0x0C, 0xA4, 0x88, 0x3B, 0xC0, 0x34, 0xC1, 0x2C, 0xC6, 0x20,
+0xCC, 0x2C, 0xC0, 0x7A, 0xCA, 0x34, 0xC0, 0x3B, 0xC1, 0x03, 0x6F, 0x1B, 0x9C, 0x88, 0x0C, 0x1B, 0x8D, 0x98, 0x8A, 0xB9, 0x9D, 0x88, 0xC0, 0xA5,
+0x88, 0x29, 0x51, 0x51, 0xAD, 0x99, 0xAD, 0x88, 0xA9, 0x98, 0xAD, 0x89, 0xA6, 0x89, 0x65, 0x5A, 0x66, 0x9D, 0x87, 0x94, 0x78, 0x96, 0x88, 0xA7,
+0x99, 0xAD, 0x88, 0xA5, 0x98, 0x10, 0x15, 0x9D, 0x87, 0x96, 0x89, 0x11, 0x8E, 0x99, 0x97, 0x87, 0xA2, 0x77, 0x7F, 0x56, 0x65, 0x69, 0x01, 0x14,
+0x00, 0xB0, 0x67, 0x38, 0xA6, 0x78, 0x07, 0x9C, 0x88, 0x65, 0xC0, 0x5A, 0x1A, 0x55, 0x06, 0x7F, 0xA7, 0xBA, 0x7F, 0x9A, 0x88, 0x9D, 0x77, 0xC1,
+0x5A, 0x66, 0xC2, 0x69, 0x5A, 0xC0, 0x6B, 0xC0, 0x0B, 0xC4, 0x6E, 0xC9, 0x55, 0xC3, 0x06, 0xC1, 0x0D, 0xC4, 0x10, 0x6E, 0xC2, 0x10, 0xC2, 0x06,
+0x0D, 0x01, 0xC5, 0x6B, 0xC1, 0x9D, 0x87, 0xA7, 0xA8, 0xB4, 0x98, 0xA5, 0x99, 0xE6, 0x51, 0x2F, 0x81, 0x98, 0xC0, 0xAE, 0x88, 0xAF, 0x99, 0x19,
+0xA8, 0x87, 0x97, 0x89, 0x8B, 0x77, 0x91, 0x87, 0xA5, 0x99, 0xB7, 0x88, 0xAD, 0x89, 0x66, 0x01, 0x99, 0x88, 0x11, 0x8C, 0x88, 0x9A, 0x98, 0xC0,
+0x9C, 0x88, 0x56, 0xA8, 0x77, 0xB8, 0x67, 0xA9, 0x68, 0x07, 0x34, 0x3B, 0x34, 0x66, 0xC2, 0x2C, 0xC1, 0x65, 0xD1, 0x2C, 0xC0, 0x2F, 0xCA, 0x34,
+0xC2, 0x03, 0x0F, 0x16, 0x33, 0x0C, 0xC0, 0x8A, 0xB9, 0x8E, 0xA9, 0x9D, 0x88, 0xC0, 0xA7, 0x88, 0xA6, 0x88, 0x10, 0x29, 0xAF, 0x99, 0xAB, 0x88,
+0xAD, 0x88, 0xAA, 0x89, 0x1D, 0x99, 0x88, 0x5A, 0x1C, 0x98, 0x88, 0x8D, 0x78, 0x8D, 0x87, 0xA2, 0x78, 0xB4, 0x98, 0x14, 0xA7, 0x98, 0x41, 0xC0,
+0x19, 0x93, 0x88, 0x8E, 0x89, 0x93, 0x87, 0x9E, 0x86, 0x6F, 0x7B, 0x51, 0x59, 0x66, 0x9D, 0x78, 0x00, 0x26, 0xBA, 0x57, 0x3B, 0x9B, 0x88, 0x9C,
+0x87, 0x13, 0xC0, 0x56, 0x1A, 0x0B, 0x37, 0x9D, 0xA9, 0xA4, 0xA9, 0xA1, 0xA8, 0x99, 0x78, 0x9D, 0x87, 0x04, 0x07, 0x6F, 0xC3, 0x6E, 0x6B, 0x6E,
+0xC0, 0x6E, 0xC0, 0x6B, 0xC1, 0x7E, 0x6B, 0x6E, 0xC1, 0xA2, 0x88, 0xC1, 0x6E, 0x6B, 0xC3, 0x6E, 0xC1, 0x7A, 0xC0, 0x29, 0xC3, 0x1D, 0x29, 0xC1,
+0x7E, 0x6F, 0xC3, 0x66, 0x31, 0x29, 0x1D, 0x56, 0x66, 0x69, 0xC2, 0x10, 0xC0, 0x5A, 0x9D, 0x88, 0x9D, 0x86, 0xA9, 0x87, 0x35, 0xA6, 0x88, 0xE6,
+0x66, 0x8F, 0x67, 0xFE, 0x29, 0x45, 0x55, 0xB2, 0x88, 0x0C, 0xAC, 0x78, 0x9B, 0x87, 0x05, 0x8F, 0x78, 0x61, 0xA5, 0x88, 0xB4, 0x88, 0xB1, 0x89,
+0xA2, 0x88, 0xC0, 0x55, 0x91, 0x88, 0x88, 0x88, 0x96, 0x98, 0xC0, 0x9D, 0x77, 0x28, 0xA4, 0x78, 0xB8, 0x57, 0xAD, 0x67, 0x9C, 0x99, 0xA5, 0x98,
+0x6E, 0x2F, 0xC1, 0x55, 0xC0, 0x6E, 0x20, 0xD4, 0x6F, 0x76, 0xC0, 0x2C, 0x2F, 0xC0, 0x2A, 0x2F, 0xC8, 0x03, 0xC0, 0x9B, 0x77, 0x33, 0x0C, 0x66,
+0x89, 0xA8, 0x8F, 0x99, 0x00, 0x6E, 0x10, 0xA4, 0x88, 0x10, 0xA9, 0x88, 0xAE, 0x88, 0xAC, 0x88, 0xAE, 0x89, 0xA5, 0x88, 0x19, 0x8B, 0x88, 0x9B,
+0x87, 0xA8, 0x77, 0x67, 0x9B, 0x77, 0x99, 0x88, 0x98, 0x88, 0x9C, 0x88, 0xB2, 0x88, 0xB7, 0x98, 0x01, 0xC0, 0x32, 0x96, 0x99, 0x90, 0x89, 0x8F,
+0x87, 0x99, 0x76, 0x10, 0x7F, 0x41, 0x65, 0xC0, 0x51, 0x9D, 0x88, 0x0D, 0xB9, 0x57, 0xAD, 0x78, 0x9D, 0x87, 0x9B, 0x88, 0x0B, 0x1A, 0x66, 0x6D,
+0x5A, 0x0B, 0x9A, 0xB9, 0xA2, 0xA9, 0x7A, 0x9A, 0x88, 0x50, 0xC2, 0x66, 0xC3, 0x5A, 0xC3, 0x6B, 0xC3, 0x6E, 0xC3, 0x6B, 0x6E, 0xC2, 0x7A, 0x6E,
+0xC1, 0x6B, 0x6E, 0xC1, 0x0B, 0xC0, 0x04, 0xC0, 0x3F, 0x3C, 0xC0, 0x3F, 0x04, 0x0B, 0x10, 0xC2, 0x0B, 0x04, 0x3C, 0x69, 0x30, 0x2B, 0x5A, 0x65,
+0xC2, 0x5A, 0x66, 0x66, 0x5D, 0xAD, 0x88, 0xB7, 0x98, 0xA6, 0x99, 0xE7, 0x93, 0x77, 0xBC, 0x99, 0x55, 0xB4, 0x88, 0xB4, 0x88, 0xA7, 0x89, 0x8F,
+0x87, 0x19, 0x65, 0xA3, 0x88, 0x6B, 0xA7, 0x98, 0x21, 0xA9, 0x98, 0xA6, 0x88, 0x15, 0x96, 0x88, 0x88, 0x89, 0x8F, 0x87, 0x01, 0x66, 0x51, 0xA2,
+0x78, 0xB7, 0x77, 0xAF, 0x57, 0x9D, 0x88, 0xA5, 0x89, 0x34, 0x2C, 0xC0, 0x2F, 0x55, 0xC3, 0x66, 0xC0, 0x20, 0xC2, 0x1B, 0xC7, 0x20, 0xC7, 0x2C,
+0xC1, 0x76, 0x2F, 0xC6, 0x34, 0x7F, 0xC0, 0x9A, 0x88, 0x2E, 0xA4, 0x77, 0x38, 0x88, 0xB9, 0x90, 0xA9, 0x66, 0xA2, 0x88, 0xA6, 0x88, 0xA3, 0x88,
+0x51, 0xAD, 0x99, 0xAD, 0x88, 0xAE, 0x88, 0xAE, 0x88, 0x9B, 0x78, 0x8A, 0x88, 0x8E, 0x88, 0xA5, 0x98, 0xA9, 0x99, 0x5A, 0x7F, 0xA2, 0x88, 0x66,
+0x0F, 0x97, 0x87, 0x00, 0xB6, 0x88, 0x01, 0x69, 0x9A, 0x89, 0x92, 0x89, 0x8D, 0x87, 0x94, 0x87, 0x10, 0xA2, 0x88, 0x9D, 0x78, 0x3C, 0xC0, 0x28,
+0x14, 0x39, 0xB8, 0x56, 0x2C, 0x9D, 0x87, 0x9B, 0x88, 0x51, 0xC1, 0x7A, 0x5E, 0x61, 0x9C, 0xA9, 0x19, 0xA2, 0x98, 0x9B, 0x77, 0x9C, 0x88, 0x66,
+0x69, 0x66, 0x56, 0x6E, 0x65, 0xC0, 0x66, 0x5A, 0xC2, 0x66, 0xC1, 0x55, 0xC0, 0x66, 0xC2, 0x56, 0xC1, 0x0D, 0x65, 0xC0, 0x08, 0xCA, 0x66, 0x69,
+0xC0, 0x5A, 0xC0, 0x3C, 0x39, 0xC0, 0x3C, 0x39, 0xC1, 0x66, 0xC1, 0x69, 0xC0, 0x7A, 0x2D, 0xC0, 0x66, 0xC0, 0x66, 0x6F, 0xC0, 0xA3, 0x78, 0xAE,
+0x76, 0xB5, 0x99, 0xA8, 0x99, 0xE7, 0x93, 0x78, 0xFE, 0x42, 0x29, 0x69, 0xB5, 0x99, 0x35, 0xA3, 0x89, 0x8C, 0x88, 0x91, 0x87, 0x3D, 0xA4, 0x79,
+0x66, 0x09, 0x35, 0x19, 0xB2, 0x88, 0x15, 0x99, 0x88, 0x89, 0x78, 0x8E, 0x97, 0x9B, 0x87, 0x5A, 0x9C, 0x89, 0x7E, 0xB7, 0x67, 0xB0, 0x47, 0x9D,
+0x98, 0xA5, 0x89, 0xA3, 0x88, 0x65, 0x66, 0xC0, 0x55, 0xCC, 0x66, 0xC5, 0x20, 0xCA, 0x7A, 0x5F, 0x2A, 0x2F, 0xC2, 0x34, 0xC0, 0x7F, 0xC0, 0x07,
+0x9D, 0x77, 0xA5, 0x89, 0x33, 0x88, 0xA9, 0x90, 0xB9, 0xC0, 0xA3, 0x88, 0xA6, 0x88, 0xA2, 0x88, 0xC0, 0xAF, 0x99, 0xAE, 0x88, 0xAF, 0x88, 0xA8,
+0x88, 0x91, 0x78, 0x85, 0x88, 0x08, 0xAC, 0x88, 0xA3, 0x88, 0x52, 0x6E, 0xA2, 0x88, 0x7F, 0x9B, 0x88, 0x8F, 0x77, 0xA2, 0x88, 0xBB, 0x98, 0xAE,
+0x78, 0xC0, 0x9C, 0x88, 0x95, 0x88, 0x8C, 0x88, 0x90, 0x88, 0x7E, 0x7E, 0x10, 0x51, 0xC0, 0x55, 0x9D, 0x88, 0xA2, 0x88, 0xB7, 0x57, 0x20, 0x51,
+0x1F, 0x13, 0x0B, 0xC0, 0x13, 0xC0, 0x3F, 0x9D, 0x98, 0xA3, 0xA9, 0xA6, 0x99, 0x9C, 0x98, 0x00, 0x61, 0x59, 0xC0, 0x66, 0xC0, 0x65, 0xC0, 0x5A,
+0xC4, 0x66, 0xC1, 0x04, 0x3D, 0xC1, 0x66, 0xC3, 0x56, 0x69, 0xC2, 0x66, 0x5A, 0xC1, 0x66, 0xC1, 0x69, 0x1C, 0xC0, 0x21, 0xC1, 0x24, 0x29, 0xC0,
+0x24, 0xC0, 0x21, 0xC0, 0x1C, 0xC0, 0x21, 0xC0, 0x24, 0xC4, 0x21, 0x77, 0x6E, 0xC0, 0xA2, 0x67, 0xA8, 0x78, 0xB4, 0x98, 0x31, 0xE7, 0x92, 0x88,
+0x81, 0x88, 0xA6, 0x78, 0xB4, 0x87, 0xB0, 0x88, 0x9D, 0x88, 0x8C, 0x88, 0x93, 0x77, 0xA4, 0x99, 0xA6, 0x78, 0xA2, 0x88, 0x9C, 0x88, 0x95, 0x87,
+0x21, 0xB5, 0x89, 0xA7, 0x98, 0x93, 0x78, 0x93, 0x78, 0x94, 0xA8, 0x9A, 0x87, 0x55, 0x9D, 0x88, 0x56, 0xB6, 0x57, 0xB2, 0x56, 0x9D, 0x89, 0x6E,
+0x65, 0xC0, 0x33, 0xC0, 0x6E, 0xC0, 0x33, 0xC1, 0x38, 0xC2, 0x6F, 0x7A, 0xC3, 0x6E, 0xC3, 0x1B, 0xC0, 0x6E, 0xC2, 0x6F, 0x69, 0x2C, 0xC0, 0x7A,
+0xC2, 0x6E, 0xC1, 0x7A, 0xC0, 0x5F, 0x03, 0xC0, 0xA2, 0x88, 0x55, 0x07, 0x24, 0x20, 0x9A, 0x99, 0x88, 0xA8, 0x91, 0xA9, 0xC0, 0x28, 0xA5, 0x88,
+0x7F, 0xA3, 0x88, 0x18, 0xB2, 0x88, 0xAE, 0x78, 0xC0, 0x8A, 0x87, 0x8C, 0x99, 0x18, 0xA7, 0x88, 0x51, 0xA4, 0x89, 0xA3, 0x89, 0x65, 0x34, 0x51,
+0x95, 0x88, 0x99, 0x77, 0xB3, 0x98, 0xB3, 0x88, 0x01, 0x51, 0x97, 0x88, 0x8D, 0x77, 0x8D, 0x88, 0x10, 0x7E, 0x10, 0x3C, 0xC0, 0x55, 0x9D, 0x88,
+0x6E, 0xB6, 0x57, 0xB4, 0x67, 0x55, 0x33, 0x13, 0x0B, 0x6E, 0x0B, 0x69, 0xC0, 0x9D, 0x98, 0x77, 0xA3, 0xB8, 0x6F, 0x9C, 0x99, 0x9D, 0x77, 0xD1,
+0x69, 0xC0, 0x20, 0xC3, 0x65, 0x5A, 0xC2, 0x66, 0xC4, 0x5A, 0xC0, 0x0C, 0x11, 0xC1, 0x6E, 0x6B, 0xC0, 0x16, 0x11, 0xC5, 0x0C, 0xC3, 0x09, 0xC0,
+0x65, 0x6E, 0xC0, 0xA2, 0x78, 0xA5, 0x79, 0xB3, 0x99, 0x31, 0xE7, 0x8E, 0x88, 0x84, 0x88, 0x09, 0xB4, 0x88, 0xAD, 0x89, 0x94, 0x98, 0x1D, 0x26,
+0xA7, 0x9A, 0xA5, 0x78, 0xA1, 0xAA, 0x55, 0x97, 0x87, 0x9D, 0x77, 0xAD, 0x98, 0x5A, 0x89, 0x88, 0x66, 0xA3, 0x88, 0x97, 0x97, 0x5A, 0x9C, 0x88,
+0x62, 0xB3, 0x67, 0xB5, 0x57, 0x6F, 0x99, 0x87, 0x9A, 0x99, 0x61, 0xC0, 0x7E, 0xC0, 0x5A, 0xC2, 0x0A, 0x7A, 0x12, 0xC1, 0x6E, 0x7B, 0xC0, 0x6E,
+0x21, 0x26, 0x6F, 0xC3, 0x7E, 0xC0, 0x06, 0xC0, 0x7E, 0x0B, 0xC0, 0x7E, 0x1A, 0xC0, 0x1F, 0xC0, 0x7E, 0xC0, 0x6B, 0x6E, 0xC2, 0x7E, 0xC0, 0x6F,
+0x3B, 0x3C, 0xA2, 0x88, 0xA9, 0x88, 0x9A, 0x98, 0x87, 0xA9, 0x00, 0xC0, 0xA5, 0x89, 0xA4, 0x98, 0x24, 0xA7, 0x88, 0xAE, 0x88, 0xB2, 0x89, 0xAE,
+0x87, 0x97, 0x78, 0x87, 0x87, 0x9B, 0x88, 0xA7, 0x88, 0xA2, 0x89, 0xA3, 0x88, 0xA4, 0x89, 0x6E, 0x14, 0x9D, 0x88, 0x9D, 0x77, 0x9B, 0x87, 0x65,
+0xAC, 0x88, 0xAF, 0x88, 0xA2, 0x88, 0x56, 0x2C, 0x8D, 0x77, 0x8C, 0x98, 0x9D, 0x87, 0x6F, 0xC0, 0x51, 0x55, 0x56, 0x61, 0x55, 0xB5, 0x68, 0xB5,
+0x68, 0xC0, 0x2E, 0x50, 0x0B, 0x69, 0x0E, 0x04, 0x0E, 0x55, 0x9D, 0x77, 0x9D, 0xB9, 0xC0, 0x62, 0x51, 0x61, 0xC0, 0x30, 0x66, 0x6D, 0xC2, 0x30,
+0xC8, 0x7A, 0xC0, 0x6E, 0xC0, 0x6E, 0xC4, 0x38, 0xC0, 0x3D, 0xC1, 0x67, 0xC1, 0x38, 0xC0, 0x3D, 0xC2, 0x6B, 0xC4, 0x3D, 0x38, 0xC5, 0x35, 0xC1,
+0x29, 0xC0, 0x35, 0xA3, 0x88, 0xA2, 0x67, 0xA4, 0x89, 0xB3, 0xB9, 0xAA, 0x88, 0xE6, 0x66, 0x8E, 0x88, 0x85, 0x77, 0x1D, 0xB5, 0x89, 0xA5, 0x99,
+0x8F, 0x77, 0x94, 0x87, 0xA2, 0x89, 0xA3, 0x89, 0xC0, 0x7F, 0xA3, 0x98, 0x9B, 0x77, 0x9A, 0x88, 0xA9, 0x88, 0x2A, 0x8B, 0x88, 0x61, 0xC0, 0x99,
+0x77, 0xC0, 0x9C, 0x89, 0x00, 0xAF, 0x78, 0xB7, 0x57, 0x2F, 0x07, 0x1A, 0x9D, 0x87, 0x66, 0x26, 0xC0, 0x5A, 0x76, 0xC0, 0x66, 0x69, 0x12, 0xC0,
+0x66, 0xC2, 0x65, 0xC2, 0x0D, 0x9D, 0x87, 0x9C, 0x88, 0x7F, 0x6F, 0xC0, 0x14, 0xC0, 0x5A, 0x66, 0xC6, 0x14, 0xC2, 0x11, 0x14, 0xC2, 0x11, 0x05,
+0xA2, 0x79, 0xAC, 0x87, 0xAB, 0x88, 0x99, 0x78, 0x87, 0xA8, 0x00, 0xC0, 0x34, 0xA4, 0x88, 0x7E, 0xA8, 0x88, 0xAF, 0x88, 0xB3, 0x89, 0xAB, 0x98,
+0x90, 0x89, 0x8B, 0x87, 0x09, 0xA4, 0x88, 0xA2, 0x89, 0xA2, 0x88, 0xC0, 0x0C, 0x6E, 0xC0, 0x51, 0x29, 0x20, 0xAD, 0x88, 0xA8, 0x88, 0xC1, 0x9B,
+0x88, 0x3D, 0x8B, 0x88, 0x9C, 0x98, 0x10, 0xC0, 0x3C, 0x51, 0x5A, 0x60, 0x52, 0xB3, 0x67, 0x33, 0xA2, 0x78, 0x9C, 0xA8, 0x0E, 0x55, 0xC0, 0x6E,
+0x3F, 0xC1, 0x51, 0x15, 0x01, 0x51, 0x66, 0x65, 0x52, 0x65, 0x6E, 0x03, 0xC0, 0x66, 0xC0, 0x5A, 0x76, 0x59, 0xC0, 0x76, 0xC0, 0x5A, 0xC4, 0x66,
+0xC1, 0x7A, 0xC2, 0x25, 0xC1, 0x28, 0x2D, 0xCB, 0x6E, 0x39, 0xC1, 0x3E, 0xC0, 0x7A, 0xC0, 0x03, 0x0F, 0x7A, 0x6E, 0xC3, 0x5E, 0xA2, 0x98, 0xA2,
+0x78, 0xA2, 0x78, 0xA7, 0x99, 0xB2, 0xB9, 0xA8, 0x88, 0xE6, 0x51, 0x8D, 0x88, 0x86, 0x88, 0xB0, 0x77, 0xB4, 0x88, 0x52, 0x29, 0x9B, 0x87, 0x29,
+0x66, 0x9D, 0x77, 0x24, 0x3D, 0x24, 0x9A, 0x87, 0x29, 0xB3, 0x89, 0x9C, 0x88, 0x91, 0x97, 0x91, 0x77, 0x96, 0x98, 0xA2, 0x88, 0x9D, 0x78, 0x00,
+0xAA, 0x78, 0xB8, 0x46, 0xAC, 0x78, 0x65, 0x1B, 0xC0, 0x66, 0x69, 0x5A, 0xC0, 0x07, 0xC6, 0x69, 0xC0, 0x66, 0xC2, 0x0F, 0x1F, 0x26, 0x0E, 0xA4,
+0x88, 0xC0, 0x2E, 0x27, 0xC0, 0x22, 0xC0, 0x1A, 0xC0, 0x0E, 0xC1, 0x66, 0xC0, 0x65, 0x66, 0x5A, 0x66, 0xC0, 0x69, 0xC0, 0x66, 0x5A, 0x66, 0x3D,
+0xA8, 0x78, 0xA7, 0x78, 0x33, 0x88, 0xA9, 0x91, 0xA9, 0x65, 0xA5, 0x89, 0xA4, 0x88, 0x7E, 0x39, 0xB0, 0x88, 0xB2, 0x88, 0xA9, 0x89, 0x8C, 0x88,
+0x8D, 0x88, 0xA6, 0x87, 0x7F, 0x6F, 0x6E, 0x51, 0x51, 0x1D, 0x3D, 0xC0, 0x15, 0xA6, 0x88, 0xAE, 0x88, 0xA8, 0x88, 0x66, 0x2D, 0x05, 0x11, 0x8A,
+0x98, 0x04, 0x6F, 0xC0, 0x34, 0x65, 0xC0, 0x55, 0x00, 0xAE, 0x67, 0xB6, 0x57, 0xA4, 0x77, 0x9D, 0x98, 0x51, 0xC2, 0x3A, 0x69, 0xC0, 0x2B, 0xC0,
+0x65, 0x56, 0xC0, 0x7A, 0x55, 0xC1, 0x66, 0x66, 0x5A, 0x65, 0xC0, 0x66, 0xC0, 0x55, 0x66, 0xC1, 0x14, 0x5A, 0x65, 0xC1, 0x66, 0xC0, 0x66, 0x69,
+0xC3, 0x2F, 0xC1, 0x5A, 0xC0, 0x2F, 0xC1, 0x2C, 0xC1, 0x34, 0xC1, 0x00, 0xC2, 0x05, 0xC1, 0x14, 0xC0, 0x19, 0x1E, 0x2D, 0xC0, 0x32, 0xC0, 0x6B,
+0xC1, 0x3E, 0x06, 0x6B, 0x59, 0xAA, 0x98, 0xB3, 0xBA, 0xA5, 0x99, 0xE6, 0x51, 0x8C, 0x88, 0x25, 0xB0, 0x88, 0xB2, 0x89, 0x18, 0x8E, 0x88, 0x9D,
+0x77, 0x24, 0x55, 0x50, 0x15, 0x24, 0x15, 0x9A, 0x88, 0xA5, 0x99, 0xBB, 0x88, 0xA6, 0x88, 0x8D, 0x87, 0x85, 0x88, 0x95, 0x87, 0xA5, 0x88, 0x28,
+0x9C, 0x88, 0xA6, 0x78, 0x0D, 0x20, 0xC0, 0x1B, 0x20, 0xC2, 0x6E, 0x20, 0x25, 0xC5, 0x7A, 0xC0, 0x6F, 0x28, 0xC0, 0x34, 0x08, 0x0F, 0x99, 0x78,
+0xA5, 0x99, 0xA7, 0x87, 0x6B, 0x59, 0x3C, 0x03, 0x39, 0x6B, 0xC1, 0x34, 0xC3, 0x66, 0xC3, 0x66, 0x69, 0x1B, 0x7A, 0x1B, 0x2A, 0x2F, 0x34, 0x9A,
+0x88, 0x88, 0xB9, 0x90, 0xA9, 0x66, 0xA5, 0x89, 0xA4, 0x87, 0xA2, 0x88, 0xA9, 0x98, 0xAF, 0x89, 0xB1, 0x99, 0x1D, 0x8C, 0x89, 0x8F, 0x87, 0xA4,
+0x88, 0xA2, 0x88, 0x6F, 0x55, 0x51, 0x10, 0x15, 0xA4, 0x87, 0x3D, 0x18, 0x38, 0xAD, 0x88, 0xAB, 0x99, 0x6E, 0x28, 0x9D, 0x77, 0x8F, 0x88, 0x8A,
+0x87, 0x99, 0x88, 0x09, 0x56, 0x51, 0x51, 0xC0, 0x7B, 0x00, 0xA8, 0x77, 0x12, 0xA7, 0x78, 0x65, 0x62, 0xC2, 0x33, 0xC0, 0x2B, 0x69, 0x1F, 0x24,
+0x6F, 0x24, 0xC0, 0x2B, 0x24, 0xC0, 0x1F, 0xC0, 0x5A, 0x17, 0xC1, 0x65, 0xC2, 0x5A, 0x66, 0xC1, 0x3E, 0xC1, 0x69, 0xC2, 0x32, 0xC0, 0x5A, 0x32,
+0xC0, 0x2F, 0x66, 0xC1, 0x2F, 0x32, 0x2F, 0xCA, 0x32, 0x37, 0xC0, 0x3E, 0x37, 0x3E, 0x03, 0xC4, 0x7A, 0x66, 0xC0, 0x0D, 0xAD, 0xA9, 0x1D, 0x31,
+0xE6, 0x1D, 0x8C, 0x88, 0x88, 0x88, 0xB0, 0x88, 0xB3, 0x89, 0x9C, 0x88, 0x29, 0x9C, 0x88, 0xA2, 0x99, 0x5D, 0x61, 0x6B, 0x6E, 0xC0, 0x99, 0x87,
+0x01, 0xBB, 0x98, 0xA6, 0x89, 0x8D, 0x77, 0x0C, 0x96, 0x88, 0xA3, 0x98, 0x2D, 0x00, 0xA2, 0x88, 0xB5, 0x67, 0xB4, 0x57, 0xC0, 0x07, 0xC3, 0x0C,
+0x07, 0xC3, 0x0C, 0xC3, 0x7E, 0x0F, 0xC1, 0xA2, 0x88, 0x9C, 0x78, 0x2B, 0x0E, 0x0A, 0x1B, 0xC0, 0x6E, 0xC0, 0x1B, 0x20, 0xC3, 0x6F, 0x76, 0xC0,
+0x6D, 0xC0, 0x6B, 0xC2, 0x28, 0xC0, 0x5A, 0xC0, 0x23, 0x20, 0xA2, 0x88, 0x9A, 0x98, 0x89, 0x99, 0x8F, 0xA8, 0x00, 0xA5, 0x89, 0xA4, 0x98, 0xA3,
+0x88, 0xA9, 0x88, 0xAF, 0x98, 0xB1, 0x89, 0xA8, 0x89, 0x93, 0x88, 0x90, 0x87, 0x18, 0x6F, 0x7E, 0x29, 0x9D, 0x88, 0x09, 0x10, 0x2C, 0x6E, 0x6B,
+0x50, 0xA3, 0x89, 0xAF, 0x98, 0xA8, 0x88, 0x6B, 0x9D, 0x77, 0x8F, 0x88, 0x8A, 0x87, 0x3C, 0xA2, 0x87, 0x6B, 0x9C, 0x88, 0x56, 0x28, 0xC0, 0x9D,
+0x87, 0x19, 0xB2, 0x67, 0x3F, 0x30, 0x76, 0x33, 0xC1, 0x2B, 0xC0, 0x65, 0xC1, 0x66, 0xC1, 0x5A, 0x1A, 0x59, 0x0B, 0xC5, 0x03, 0x06, 0xC4, 0x66,
+0xC0, 0x37, 0xCF, 0x32, 0xC1, 0x37, 0xC8, 0x32, 0xC1, 0x37, 0xC0, 0x32, 0xC2, 0x37, 0xC0, 0x32, 0x01, 0x66, 0xA5, 0x88, 0xB0, 0xA9, 0xAF, 0x99,
+0xE7, 0x51, 0x8D, 0x88, 0x87, 0x77, 0xB0, 0x89, 0x05, 0x9D, 0x87, 0x38, 0x9C, 0x88, 0xA2, 0x88, 0x59, 0x10, 0xC0, 0x15, 0xC0, 0x9D, 0x87, 0xA8,
+0x88, 0x0D, 0xA4, 0x88, 0x8C, 0x88, 0x3D, 0x28, 0xA2, 0x88, 0x55, 0x9B, 0x88, 0xC0, 0xB1, 0x67, 0xB7, 0x67, 0xA2, 0x88, 0x56, 0xC2, 0x66, 0xC0,
+0x7A, 0xC2, 0x38, 0xC0, 0x3B, 0xC0, 0x5E, 0x38, 0x00, 0xC0, 0x07, 0x00, 0x14, 0x38, 0x2B, 0xC0, 0x38, 0x14, 0x56, 0xC1, 0x6E, 0x14, 0xC2, 0x1B,
+0xCE, 0xA2, 0x87, 0x38, 0x8B, 0xA9, 0x8E, 0xA9, 0x61, 0x34, 0xA4, 0x98, 0xA3, 0x88, 0xA9, 0x88, 0xAE, 0x88, 0xB1, 0x99, 0xAA, 0x78, 0x9A, 0x99,
+0x90, 0x87, 0x94, 0x88, 0x15, 0xA2, 0x88, 0x24, 0x51, 0x65, 0xC0, 0xA4, 0x88, 0x6F, 0xA2, 0x88, 0x15, 0x98, 0x88, 0xB2, 0x88, 0xAF, 0x98, 0xA3,
+0x89, 0x9C, 0x88, 0x8F, 0x88, 0x8A, 0x87, 0x3C, 0x09, 0x56, 0x9D, 0x88, 0x55, 0x28, 0xC0, 0x19, 0x00, 0xAC, 0x67, 0xB2, 0x77, 0xA3, 0x78, 0x65,
+0x2B, 0x7E, 0x2B, 0xC0, 0x69, 0x1F, 0x66, 0xC0, 0x15, 0x0B, 0xC3, 0x06, 0xC2, 0x66, 0x3E, 0xC2, 0x69, 0xC1, 0x32, 0xC5, 0x66, 0xC0, 0x69, 0xCA,
+0x5A, 0xC3, 0x6B, 0xC2, 0x2D, 0xC3, 0x2A, 0xC0, 0x32, 0x2D, 0xC5, 0x5E, 0x32, 0xC0, 0xAC, 0x99, 0xB2, 0x99, 0x31, 0xE7, 0x66, 0x8E, 0x88, 0x86,
+0x78, 0x0C, 0xB2, 0x88, 0x69, 0x0C, 0x9C, 0x88, 0xA2, 0x88, 0x40, 0x66, 0x10, 0x66, 0xA3, 0x78, 0xA7, 0x98, 0xAB, 0x88, 0xA8, 0x98, 0xC0, 0x8B,
+0x78, 0x89, 0x87, 0x9A, 0x99, 0x3C, 0x28, 0x9D, 0x87, 0x56, 0xAB, 0x78, 0x30, 0x3B, 0x51, 0x5A, 0xC2, 0x22, 0x24, 0xC4, 0x27, 0x6E, 0xC2, 0x6B,
+0xC1, 0x3B, 0x5A, 0x2E, 0x9C, 0x89, 0x22, 0xA5, 0x78, 0x65, 0xC1, 0x07, 0xC4, 0x0C, 0xC0, 0x0F, 0x0C, 0xC2, 0x0F, 0xC4, 0x0A, 0xC0, 0x1B, 0x00,
+0x8E, 0xAA, 0x8C, 0xA8, 0x9C, 0x99, 0xA5, 0x88, 0xA4, 0x99, 0xA2, 0x87, 0xA9, 0x89, 0xAF, 0x88, 0xB0, 0x89, 0xAA, 0x88, 0x9B, 0x77, 0x91, 0x88,
+0x15, 0xC0, 0xA2, 0x88, 0x66, 0x10, 0x51, 0xC0, 0xA4, 0x87, 0x7F, 0xA3, 0x89, 0x15, 0x95, 0x88, 0xB5, 0x98, 0xB0, 0x78, 0x2D, 0x00, 0x11, 0x8A,
+0x98, 0x9A, 0x88, 0x09, 0x56, 0x28, 0x51, 0x28, 0xC0, 0x55, 0x9D, 0x88, 0x28, 0xB0, 0x66, 0xAB, 0x78, 0x69, 0x1A, 0x6E, 0x6E, 0xC0, 0x1F, 0x1A,
+0xC0, 0x55, 0x17, 0xC0, 0x0B, 0xC2, 0x06, 0xC1, 0x55, 0xC1, 0x66, 0xC4, 0x2F, 0xC0, 0x23, 0xC6, 0x66, 0xC7, 0x23, 0xC2, 0x1E, 0x23, 0xC5, 0x2A,
+0xC2, 0x23, 0xC0, 0x1E, 0xC1, 0x7F, 0xC3, 0x2A, 0xC0, 0xA7, 0xA9, 0xB2, 0x98, 0xAC, 0x99, 0xE9, 0x8F, 0x88, 0x85, 0x77, 0xAD, 0x89, 0xB3, 0x99,
+0x21, 0x8C, 0x89, 0x9A, 0x88, 0x20, 0x9C, 0x77, 0x9C, 0x98, 0x56, 0x15, 0xA5, 0x99, 0xAC, 0x88, 0xAB, 0x88, 0xC0, 0x05, 0x29, 0x8C, 0x98, 0x9D,
+0x87, 0x3C, 0x41, 0x14, 0x51, 0xA5, 0x78, 0xB5, 0x67, 0xAC, 0x78, 0x65, 0x55, 0x6B, 0x04, 0x0B, 0x04, 0xC4, 0x0B, 0x6E, 0xC3, 0x13, 0x6E, 0xC0,
+0x6F, 0x6E, 0x2B, 0x2A, 0x3F, 0x33, 0x29, 0x7F, 0x65, 0xC1, 0x38, 0xC8, 0x3B, 0x6E, 0xC4, 0x3B, 0xC0, 0xA2, 0x78, 0x00, 0x91, 0x99, 0x8B, 0xA8,
+0x9A, 0x99, 0xA5, 0x88, 0xA4, 0x89, 0x7E, 0xAA, 0x87, 0xAE, 0x89, 0xB0, 0x88, 0xAA, 0x78, 0x9C, 0x88, 0x93, 0x88, 0x93, 0x87, 0x51, 0xA3, 0x89,
+0x56, 0x65, 0x51, 0x18, 0xA2, 0x77, 0x38, 0x11, 0x9A, 0x88, 0x97, 0x88, 0xB7, 0x98, 0xAD, 0x89, 0x21, 0x9B, 0x78, 0x3D, 0x8A, 0x98, 0x3C, 0xA2,
+0x87, 0x3C, 0x51, 0x19, 0x7E, 0x6F, 0x19, 0x66, 0x51, 0xA7, 0x77, 0xB1, 0x77, 0xA6, 0x78, 0x06, 0x0B, 0xA2, 0x88, 0xC0, 0x1A, 0xC0, 0x66, 0x5D,
+0x0B, 0xC2, 0x06, 0xC1, 0x59, 0x66, 0xC0, 0x66, 0xC2, 0x5A, 0x76, 0x69, 0xC0, 0x23, 0xC0, 0x1E, 0xC6, 0x66, 0x1E, 0xCC, 0x19, 0xC0, 0x1E, 0xCB,
+0x23, 0x2A, 0xC1, 0x2D, 0x66, 0xA7, 0x88, 0xB1, 0xAA, 0xAC, 0x98, 0xA2, 0x88, 0xE9, 0x92, 0x88, 0x82, 0x99, 0xAB, 0x78, 0xB5, 0x89, 0xA7, 0x97,
+0x8E, 0x98, 0x29, 0xA7, 0x89, 0xC0, 0x9C, 0x88, 0x30, 0x6E, 0x20, 0xAD, 0x88, 0xA7, 0x99, 0x6E, 0x25, 0x88, 0x88, 0x8F, 0x88, 0xC0, 0x9D, 0x77,
+0x51, 0x14, 0x65, 0x5A, 0xAD, 0x78, 0xB2, 0x67, 0xA2, 0x77, 0x51, 0xC0, 0x1A, 0x17, 0xC1, 0x1C, 0xC1, 0x17, 0x1C, 0x6B, 0xC0, 0x26, 0xC1, 0x2B,
+0xC1, 0x6F, 0x7E, 0x9B, 0x88, 0x9B, 0x77, 0x12, 0xA6, 0x78, 0xC0, 0x04, 0xC0, 0x0B, 0x6E, 0xC1, 0x13, 0xC2, 0x6E, 0xC2, 0x6B, 0xC0, 0x27, 0x5A,
+0x27, 0xC0, 0x5E, 0x7A, 0x27, 0x33, 0x6E, 0x2B, 0x88, 0xB9, 0x00, 0x2D, 0xA3, 0x98, 0xA3, 0x89, 0xA8, 0x88, 0xAE, 0x89, 0xB1, 0x88, 0xA9, 0x98,
+0x9D, 0x88, 0x93, 0x77, 0x94, 0x89, 0x65, 0xA2, 0x88, 0x38, 0x6E, 0x65, 0xC1, 0x00, 0x20, 0x96, 0x88, 0x9D, 0x77, 0x1D, 0xAA, 0x88, 0x28, 0x9B,
+0x77, 0x8B, 0x88, 0x8C, 0x87, 0x9D, 0x88, 0xA2, 0x88, 0x3C, 0x9D, 0x78, 0x14, 0xA2, 0x88, 0x2D, 0x51, 0xC0, 0x65, 0x05, 0xA6, 0x88, 0xAE, 0x66,
+0xA5, 0x88, 0x6E, 0x6F, 0x6E, 0x7F, 0xC3, 0x6E, 0x0B, 0xC0, 0x06, 0x5A, 0xC0, 0x75, 0x37, 0xC2, 0x32, 0x2F, 0xC0, 0x26, 0x5A, 0xC1, 0x1E, 0xC1,
+0x69, 0xCA, 0x1E, 0x65, 0x6B, 0xC0, 0x1E, 0xC2, 0x19, 0xC0, 0x1E, 0xCC, 0x19, 0x1E, 0x19, 0xC0, 0x66, 0xA4, 0x99, 0x22, 0xAD, 0xA8, 0x6F, 0xEA,
+0x95, 0x88, 0x81, 0x88, 0xA5, 0x78, 0xB5, 0x89, 0xA9, 0x98, 0x9B, 0x87, 0x95, 0x78, 0x51, 0xA4, 0x89, 0xA2, 0x87, 0x0D, 0x91, 0x88, 0xA2, 0x87,
+0x35, 0xAB, 0x98, 0x56, 0x97, 0x87, 0x86, 0x88, 0x94, 0x88, 0x7F, 0x9D, 0x77, 0x9D, 0x88, 0xC1, 0x05, 0xA5, 0x78, 0xAF, 0x88, 0x0B, 0x55, 0x56,
+0x37, 0x32, 0x5A, 0x32, 0x66, 0x23, 0x2D, 0xC0, 0x32, 0xC1, 0x2F, 0xC1, 0x32, 0x37, 0xC1, 0x03, 0x3E, 0x9C, 0x87, 0x1B, 0x03, 0x1C, 0xC0, 0x66,
+0xC2, 0x7E, 0xC1, 0x6F, 0xC2, 0x6E, 0xC0, 0x7B, 0x3F, 0xC1, 0x6F, 0x7A, 0x5E, 0xC0, 0x75, 0x13, 0xA3, 0x88, 0x3F, 0x8D, 0xA8, 0x90, 0xAA, 0x14,
+0xA6, 0x88, 0x6E, 0xA9, 0x99, 0xAF, 0x89, 0xAF, 0x98, 0xAB, 0x88, 0x9D, 0x78, 0x8D, 0x87, 0x91, 0x78, 0x38, 0x11, 0x0C, 0x55, 0xC0, 0x65, 0x38,
+0xA5, 0x88, 0x38, 0x95, 0x77, 0xA9, 0x98, 0x08, 0x21, 0xC0, 0x9B, 0x88, 0x88, 0x88, 0x8B, 0x78, 0x01, 0x10, 0x9D, 0x77, 0x14, 0x6E, 0x7F, 0xC0,
+0x19, 0x28, 0x69, 0x9D, 0x78, 0xC0, 0xA5, 0x88, 0xA7, 0x88, 0xA5, 0x88, 0xA2, 0x88, 0xA3, 0x78, 0x1E, 0x23, 0x7F, 0x37, 0x32, 0xC0, 0x69, 0xC0,
+0x32, 0xC0, 0x23, 0x26, 0xC0, 0x23, 0x1E, 0xC1, 0x66, 0x1E, 0x19, 0x12, 0xC2, 0x66, 0xC0, 0x0F, 0x0A, 0xC6, 0x0D, 0x0A, 0xC1, 0x66, 0xC8, 0x65,
+0x5A, 0xCA, 0x62, 0x20, 0x66, 0x56, 0x9C, 0x98, 0x1D, 0xBC, 0x88, 0xA6, 0x88, 0xEB, 0x99, 0x88, 0xFE, 0x63, 0x0B, 0x9D, 0x79, 0xB7, 0x89, 0xAA,
+0x87, 0xA2, 0x88, 0x9C, 0x88, 0x97, 0x88, 0x9A, 0x87, 0x52, 0x24, 0x92, 0x88, 0xAA, 0x88, 0xB6, 0x87, 0xA8, 0x88, 0x51, 0x91, 0x78, 0x87, 0x97,
+0x99, 0x78, 0x01, 0x28, 0x51, 0xC0, 0x6E, 0x51, 0x66, 0xAA, 0x67, 0x0A, 0x2F, 0x51, 0x0F, 0x65, 0xC0, 0x66, 0x6B, 0x3E, 0xC0, 0x5A, 0x36, 0xC0,
+0x3B, 0xC2, 0x05, 0xC0, 0x3B, 0x6F, 0x0A, 0x0F, 0x3B, 0x51, 0x0A, 0x23, 0xC2, 0x6E, 0x23, 0xC0, 0x2F, 0xC2, 0x37, 0xC1, 0x6B, 0x6E, 0xC0, 0x7E,
+0x6F, 0xC1, 0x1C, 0xC0, 0x7B, 0x6E, 0xA3, 0x88, 0x3F, 0x05, 0x19, 0x51, 0xA6, 0x99, 0x15, 0xA7, 0x89, 0xB1, 0x98, 0x11, 0xA9, 0x99, 0xA2, 0x77,
+0x8B, 0x89, 0x8C, 0x88, 0xAB, 0x89, 0xA8, 0x98, 0x25, 0x0C, 0x56, 0x0C, 0x34, 0xA2, 0x88, 0x8F, 0x88, 0x9A, 0x87, 0xB7, 0x88, 0xA4, 0x88, 0x94,
+0x88, 0xA3, 0x99, 0xA7, 0x89, 0x8E, 0x88, 0x8E, 0x87, 0xA2, 0x88, 0xC0, 0x9D, 0x88, 0x51, 0x19, 0x28, 0xC0, 0x19, 0xC0, 0x7E, 0x19, 0x51, 0x00,
+0x14, 0xA2, 0x77, 0xA3, 0x88, 0xA3, 0x88, 0xA2, 0x89, 0xA2, 0x87, 0x6F, 0x7E, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x87, 0x31, 0x55, 0x1D, 0xC2, 0x65,
+0x5A, 0x0C, 0x5A, 0x04, 0xC0, 0x7A, 0x04, 0xC1, 0x69, 0x38, 0x5E, 0x66, 0xC0, 0x38, 0xC0, 0x35, 0xC3, 0x33, 0x38, 0xC0, 0x35, 0x66, 0xC0, 0x35,
+0xC0, 0x30, 0xC1, 0x69, 0xC0, 0x66, 0xC1, 0x5A, 0xC1, 0x30, 0xC0, 0x35, 0xC1, 0x33, 0x2B, 0x61, 0x51, 0x51, 0x28, 0x69, 0x2D, 0xFE, 0x94, 0x91,
+0xBA, 0x88, 0x6F, 0xEB, 0x9C, 0x88, 0x83, 0x88, 0x93, 0x78, 0xB9, 0x88, 0xAB, 0x89, 0x7E, 0xA4, 0x88, 0x99, 0x87, 0x8C, 0x89, 0x2C, 0x55, 0xAA,
+0x87, 0xAF, 0x99, 0xAB, 0x89, 0x0D, 0x9B, 0x78, 0x8B, 0x88, 0x8E, 0x97, 0x41, 0x65, 0x28, 0x14, 0xC0, 0x6E, 0x14, 0x00, 0x6E, 0xA9, 0x77, 0xA7,
+0x88, 0x6F, 0x11, 0x0C, 0xC0, 0x0E, 0xC0, 0x11, 0x1D, 0xC0, 0x11, 0x0E, 0xC3, 0x11, 0x0E, 0xC0, 0x1D, 0xC1, 0x22, 0x9D, 0x88, 0x0E, 0x22, 0x6F,
+0x6E, 0x2E, 0xC0, 0x36, 0xC0, 0x33, 0x36, 0x6F, 0xC1, 0x0A, 0xC3, 0x0F, 0x7F, 0xC0, 0x6E, 0x6F, 0x69, 0x7F, 0xC0, 0xA2, 0x78, 0xA2, 0x88, 0x37,
+0x8E, 0xAA, 0x9A, 0x98, 0x0B, 0xA3, 0x88, 0xA3, 0x89, 0xB3, 0x88, 0xAD, 0x98, 0xA7, 0x99, 0xA8, 0x77, 0x95, 0x88, 0x88, 0x89, 0x9A, 0x88, 0xAD,
+0x99, 0xA9, 0x88, 0xC0, 0x56, 0x6E, 0x14, 0x94, 0x88, 0x8F, 0x87, 0xAD, 0x98, 0xB8, 0x78, 0x8D, 0x88, 0x85, 0x77, 0xAA, 0x88, 0x24, 0x97, 0x87,
+0x90, 0x88, 0xA2, 0x88, 0x01, 0x1E, 0x66, 0xC0, 0x28, 0x19, 0xC4, 0x66, 0x51, 0xC3, 0xA2, 0x77, 0x19, 0x69, 0x1E, 0xA4, 0x78, 0xA5, 0x88, 0x7E,
+0x29, 0x56, 0xC0, 0x66, 0xC1, 0x17, 0x10, 0x56, 0x65, 0x66, 0x5A, 0x37, 0x3C, 0x03, 0x7E, 0xC0, 0x08, 0xC2, 0x0B, 0xC0, 0x08, 0x0B, 0xC0, 0x08,
+0x37, 0x34, 0x66, 0xC0, 0x37, 0x3C, 0x03, 0x08, 0xC5, 0x10, 0x5A, 0x08, 0x03, 0x3C, 0x37, 0xC0, 0x32, 0x2F, 0x65, 0x1E, 0xC0, 0x19, 0x05, 0x00,
+0xC1, 0xAB, 0x98, 0x84, 0x89, 0x31, 0xEC, 0x51, 0x89, 0x88, 0x89, 0x77, 0xB5, 0x89, 0xB0, 0x88, 0xA2, 0x88, 0x7E, 0x65, 0x93, 0x78, 0x93, 0x88,
+0xA4, 0x88, 0xAF, 0x78, 0xA6, 0x98, 0x05, 0x51, 0x98, 0x88, 0x87, 0x87, 0x01, 0x66, 0x28, 0x55, 0x14, 0xC3, 0x51, 0x6E, 0x1E, 0x32, 0xA7, 0x99,
+0xAA, 0x77, 0x3A, 0xC1, 0x6E, 0x7F, 0xA2, 0x88, 0x6E, 0x22, 0x55, 0x55, 0x56, 0x61, 0x56, 0x17, 0x5A, 0x66, 0xC0, 0x69, 0x0F, 0x51, 0x9D, 0x77,
+0x0C, 0x18, 0x6E, 0x7A, 0x1D, 0xC6, 0x65, 0x1D, 0x11, 0x1D, 0x6E, 0x1D, 0xC0, 0xA2, 0x88, 0x6D, 0x6F, 0x7E, 0x6B, 0x6E, 0xA2, 0x88, 0xA2, 0x88,
+0x6E, 0x31, 0x96, 0x99, 0x72, 0x7F, 0xA2, 0x78, 0xB1, 0x99, 0xAE, 0x88, 0xA7, 0x88, 0xA8, 0x87, 0x6F, 0x91, 0x88, 0x8B, 0x78, 0x65, 0xAC, 0x88,
+0xA8, 0x88, 0x6B, 0x21, 0x9B, 0x88, 0x8D, 0x77, 0x66, 0xBA, 0x87, 0xA9, 0x89, 0x8B, 0x78, 0x86, 0x89, 0xAA, 0x97, 0xAD, 0x98, 0x93, 0x78, 0x2D,
+0xA2, 0x88, 0x66, 0x19, 0xC1, 0x28, 0x19, 0xC5, 0x65, 0x00, 0xC6, 0x6E, 0xA4, 0x77, 0x0B, 0x17, 0x55, 0xC0, 0x0B, 0x06, 0xC0, 0x5A, 0x69, 0x08,
+0xC0, 0x55, 0x66, 0xC0, 0x03, 0x0B, 0xC0, 0x06, 0x55, 0x0B, 0xC0, 0x06, 0xC0, 0x7F, 0x0B, 0x03, 0xC0, 0x0B, 0x08, 0x3C, 0x39, 0x08, 0x0B, 0x03,
+0x37, 0xC0, 0x03, 0xC0, 0x06, 0x0B, 0xC1, 0x06, 0x03, 0x32, 0x56, 0x19, 0x55, 0xC0, 0x05, 0x00, 0xC2, 0x05, 0x7F, 0x05, 0x14, 0x7E, 0xB4, 0x78,
+0x80, 0x99, 0xA8, 0x77, 0xED, 0x92, 0x88, 0x81, 0x88, 0xA3, 0x89, 0xBE, 0x78, 0xA4, 0x98, 0x9B, 0x77, 0xA2, 0x97, 0x5B, 0x9D, 0x88, 0xA2, 0x87,
+0x6E, 0x39, 0xC0, 0x9D, 0x78, 0x8E, 0x98, 0x1A, 0x2D, 0x7E, 0x52, 0x19, 0xC1, 0x66, 0xC0, 0x0D, 0x56, 0x00, 0xC0, 0xA4, 0x87, 0xB8, 0x89, 0xB9,
+0x88, 0xA5, 0x99, 0x51, 0xC0, 0x6E, 0xC0, 0x04, 0x6E, 0x04, 0x35, 0xC0, 0x55, 0x62, 0x0D, 0x3E, 0x39, 0x66, 0x31, 0x69, 0x25, 0x41, 0x99, 0x87,
+0x9B, 0x88, 0xC0, 0xA2, 0x88, 0x6E, 0x5A, 0x9B, 0x87, 0xC0, 0xA2, 0x88, 0xC0, 0x9D, 0x88, 0x3F, 0x9B, 0x88, 0x45, 0xC0, 0x7A, 0x6E, 0xC0, 0x6B,
+0x6E, 0x9D, 0x87, 0x11, 0x9D, 0x88, 0xA2, 0x88, 0x11, 0x6F, 0x7E, 0xA2, 0x78, 0xA3, 0x98, 0x5A, 0x97, 0xA9, 0x1A, 0x7B, 0x10, 0xAB, 0x89, 0xB6,
+0x78, 0xA7, 0x99, 0xA4, 0x87, 0x35, 0x56, 0x90, 0x88, 0x8F, 0x88, 0x9B, 0x88, 0x28, 0xA9, 0x88, 0x0D, 0xA4, 0x98, 0x98, 0x88, 0xA4, 0x88, 0xAD,
+0x88, 0x6F, 0x97, 0x78, 0x91, 0x78, 0xA2, 0xA7, 0x99, 0x77, 0x8F, 0x88, 0x55, 0x10, 0x9D, 0x77, 0x51, 0xC8, 0x65, 0x66, 0x56, 0x6E, 0x00, 0xC2,
+0xA2, 0x98, 0xA2, 0x78, 0x05, 0xC0, 0x1E, 0xA2, 0x88, 0x56, 0xC0, 0x66, 0x1E, 0xC0, 0x19, 0x1E, 0xA4, 0x78, 0xA4, 0x87, 0x56, 0x66, 0x03, 0x2A,
+0x2D, 0xC0, 0x1E, 0x19, 0x2D, 0xC0, 0x1E, 0x2D, 0x01, 0x2D, 0x05, 0xA2, 0x78, 0x01, 0x24, 0x1C, 0xC0, 0x17, 0x03, 0x19, 0x05, 0xC1, 0x0A, 0xC3,
+0x05, 0xC1, 0x00, 0xC6, 0x05, 0x7B, 0x6E, 0xC1, 0x10, 0xBD, 0x88, 0xB8, 0x88, 0xA2, 0x88, 0xED, 0x9A, 0x88, 0x80, 0x88, 0x91, 0x88, 0xBE, 0x78,
+0xB0, 0x88, 0x39, 0x9D, 0x77, 0x7F, 0xA2, 0x89, 0x25, 0x16, 0x6B, 0xA2, 0x88, 0x97, 0x88, 0x88, 0x88, 0x15, 0x9D, 0x87, 0x56, 0x21, 0x19, 0xC2,
+0x14, 0xC0, 0x05, 0x0F, 0x55, 0xAB, 0x88, 0x80, 0x98, 0xB3, 0x89, 0x6E, 0xD0, 0x2C, 0x31, 0x51, 0x66, 0xC3, 0x09, 0xC0, 0x7E, 0xC0, 0x04, 0x26,
+0x3E, 0x51, 0xC0, 0x6F, 0x39, 0x2A, 0x39, 0x3E, 0x9A, 0x88, 0x88, 0x88, 0x91, 0x87, 0x42, 0x2D, 0x32, 0x03, 0x0B, 0xA2, 0x88, 0xA3, 0x88, 0x1A,
+0x15, 0x29, 0x10, 0x29, 0xB7, 0x89, 0xAF, 0x99, 0x25, 0xA3, 0x89, 0xA3, 0x98, 0x56, 0x97, 0x88, 0x91, 0x77, 0x9A, 0x88, 0xAB, 0x98, 0xAF, 0x89,
+0xA4, 0x88, 0x66, 0x69, 0x3E, 0x39, 0x05, 0x52, 0x95, 0x87, 0x89, 0x87, 0x95, 0x77, 0x15, 0x10, 0x28, 0x55, 0x66, 0x19, 0xC6, 0x28, 0x7E, 0x19,
+0xC0, 0x51, 0x00, 0xC1, 0x14, 0x28, 0x14, 0x00, 0xC0, 0x05, 0xC0, 0x00, 0xC0, 0x05, 0xC0, 0x00, 0xA3, 0x78, 0x01, 0xA5, 0x78, 0x7E, 0x1F, 0x32,
+0x05, 0x00, 0xC0, 0x05, 0xC0, 0x19, 0xC0, 0x05, 0x14, 0x28, 0x19, 0x00, 0x05, 0x32, 0x1F, 0x1A, 0x51, 0x41, 0x0A, 0x00, 0xD1, 0x05, 0x14, 0xC1,
+0x19, 0xC0, 0xAE, 0x88, 0x81, 0x88, 0xAD, 0x88, 0xEF, 0x85, 0x88, 0x88, 0x87, 0xA9, 0x8A, 0xBB, 0x88, 0xA8, 0x98, 0x34, 0x0E, 0x61, 0x02, 0x6E,
+0xA3, 0x9A, 0x04, 0x8B, 0x88, 0x15, 0x65, 0x52, 0x19, 0xC3, 0x66, 0xC0, 0x69, 0x14, 0x05, 0xC0, 0xB6, 0x88, 0x81, 0x87, 0xA7, 0x89, 0xE7, 0x51,
+0x8D, 0x88, 0x80, 0x88, 0x00, 0xC3, 0x05, 0x0D, 0xC0, 0xA2, 0x89, 0x15, 0xC0, 0x10, 0xAE, 0x78, 0xB9, 0x89, 0xA4, 0x98, 0x50, 0x6E, 0xA4, 0x99,
+0x6F, 0x99, 0x88, 0x04, 0x25, 0xA5, 0x88, 0x7F, 0x51, 0x3E, 0x25, 0xC0, 0x2C, 0x55, 0x8D, 0x88, 0x01, 0xC0, 0xA2, 0x88, 0x3C, 0x9D, 0x88, 0x50,
+0xA2, 0x78, 0xC2, 0x14, 0x19, 0xC1, 0x2D, 0xB2, 0x88, 0xAD, 0x88, 0xA1, 0x9A, 0x9D, 0x87, 0x9C, 0x88, 0x97, 0x77, 0x98, 0x88, 0x51, 0x6F, 0x3D,
+0x29, 0x9C, 0x99, 0x0F, 0x55, 0xC0, 0x7A, 0x00, 0xC2, 0x05, 0xA3, 0x88, 0x32, 0x6F, 0x2D, 0x01, 0xA4, 0x98, 0x6F, 0x29, 0x15, 0x10, 0xC0, 0x01,
+0x9B, 0x88, 0x05, 0xA2, 0x98, 0x19, 0x00, 0xC0, 0x19, 0x1E, 0x19, 0x56, 0x05, 0x00, 0xD2, 0x0A, 0x14, 0x19, 0x14, 0xC0, 0x3C, 0xB9, 0x88, 0x18,
+0xA3, 0x88, 0xEF, 0x92, 0x98, 0x83, 0x78, 0x10, 0xB2, 0x88, 0xB7, 0x89, 0xA8, 0x88, 0x55, 0x9D, 0x77, 0x12, 0x6B, 0x98, 0x88, 0x8B, 0x88, 0x90,
+0x88, 0x10, 0x01, 0x9D, 0x88, 0x14, 0xC1, 0x6E, 0xC0, 0x14, 0xC1, 0x05, 0x7E, 0x10, 0xBE, 0x87, 0xB8, 0x89, 0x31, 0xE8, 0x9C, 0x88, 0x84, 0x88,
+0x87, 0x88, 0x05, 0xC0, 0x00, 0xC3, 0x05, 0x3C, 0xA3, 0x99, 0x6E, 0x38, 0xB6, 0x88, 0xB4, 0x89, 0x9C, 0x87, 0x9C, 0x78, 0x2A, 0xA2, 0x88, 0x7F,
+0xC0, 0x56, 0x39, 0x25, 0xC0, 0x66, 0x55, 0x6B, 0xC0, 0x97, 0x77, 0x38, 0x28, 0x15, 0x52, 0x50, 0x9D, 0x88, 0x19, 0xC3, 0x14, 0x19, 0xC0, 0x14,
+0x24, 0x81, 0x77, 0xB2, 0x88, 0x2C, 0x9D, 0x77, 0x66, 0x9A, 0x88, 0x11, 0x9D, 0x88, 0xC0, 0x6E, 0xC0, 0x9C, 0x88, 0x98, 0x88, 0x9C, 0x88, 0x7F,
+0x1D, 0x66, 0xC1, 0x55, 0x66, 0x55, 0x66, 0xC1, 0x05, 0x20, 0xA7, 0x88, 0x25, 0x38, 0x29, 0xC0, 0x9D, 0x88, 0x9A, 0x88, 0x31, 0x05, 0x14, 0x95,
+0x77, 0x01, 0x00, 0xD6, 0x6E, 0x7F, 0xC1, 0x19, 0x14, 0xAF, 0x88, 0x20, 0xAF, 0x88, 0xF0, 0x9D, 0x88, 0x85, 0x87, 0x24, 0x6E, 0xAF, 0x89, 0xB0,
+0x88, 0xA8, 0x88, 0x36, 0x11, 0x39, 0x92, 0x88, 0x1C, 0x50, 0xA2, 0x88, 0x9C, 0x88, 0x19, 0x14, 0xC0, 0x69, 0x19, 0xC0, 0x14, 0xC1, 0x05, 0xC0,
+0xB6, 0x88, 0xBE, 0x88, 0xAA, 0x88, 0xEA, 0x95, 0x88, 0x30, 0x2D, 0x14, 0xC0, 0x19, 0x14, 0xC0, 0x05, 0x00, 0xA4, 0x87, 0x15, 0x29, 0x1C, 0xA9,
+0x98, 0xBA, 0x89, 0xAB, 0x88, 0x9A, 0x88, 0x9D, 0x87, 0x11, 0xA2, 0x88, 0xC1, 0x56, 0x69, 0x61, 0x02, 0x67, 0xA2, 0x88, 0x9C, 0x88, 0x8A, 0x88,
+0x8F, 0x87, 0x3C, 0x15, 0x3C, 0x9D, 0x78, 0x19, 0x66, 0xC1, 0x19, 0x14, 0x19, 0xC0, 0x14, 0x55, 0xB5, 0x99, 0x81, 0x77, 0x31, 0xC9, 0x9D, 0x88,
+0x55, 0xC1, 0x66, 0xC1, 0x55, 0xC0, 0x66, 0x21, 0xC1, 0x18, 0x31, 0xC5, 0x51, 0x18, 0xA2, 0x88, 0xC0, 0x25, 0x87, 0x88, 0x05, 0x00, 0xD2, 0x05,
+0x00, 0xC0, 0x14, 0xC0, 0x19, 0xC0, 0x14, 0xA6, 0x88, 0xBA, 0x88, 0x1D, 0x31, 0xF1, 0x25, 0x85, 0x87, 0x10, 0x29, 0xA4, 0x89, 0x1C, 0x30, 0x9D,
+0x77, 0x98, 0x88, 0x9C, 0x88, 0x24, 0xC0, 0x3C, 0x19, 0xC0, 0x05, 0x7E, 0x19, 0xC0, 0x66, 0xC3, 0x24, 0xBE, 0x87, 0x31, 0xEC, 0x11, 0x85, 0x88,
+0x28, 0x14, 0x05, 0xC0, 0x6B, 0x05, 0x00, 0xC0, 0x01, 0xA5, 0x99, 0x29, 0x15, 0xAB, 0x9A, 0xBB, 0x88, 0xAA, 0x88, 0x9C, 0x88, 0x99, 0x87, 0x56,
+0x6E, 0xC0, 0x65, 0x56, 0x3D, 0x11, 0x27, 0x04, 0x8D, 0x88, 0x8B, 0x77, 0x2D, 0x24, 0x10, 0x28, 0x51, 0x19, 0x14, 0x19, 0xC0, 0x14, 0x19, 0xC0,
+0x14, 0x19, 0xA3, 0x99, 0xBE, 0x88, 0x2C, 0x31, 0xE2, 0x1D, 0x8F, 0x88, 0x80, 0x88, 0x00, 0xD4, 0x05, 0x14, 0xC0, 0x19, 0x14, 0x19, 0x30, 0xBE,
+0x88, 0x31, 0xF2, 0x1D, 0x8A, 0x98, 0x87, 0x77, 0x10, 0xA3, 0x89, 0x24, 0xC1, 0x29, 0xC0, 0x24, 0x3C, 0x19, 0x20, 0x0D, 0x19, 0xC3, 0x14, 0xC0,
+0x55, 0xA3, 0x99, 0xBA, 0x88, 0xBA, 0x88, 0x31, 0xED, 0x25, 0x86, 0x88, 0x2D, 0x00, 0xC4, 0x28, 0x24, 0x38, 0x10, 0x3C, 0xAF, 0x89, 0xBC, 0x88,
+0xA9, 0x99, 0x9B, 0x77, 0x9B, 0x87, 0x9D, 0x78, 0xC0, 0x3D, 0xC0, 0xA3, 0x89, 0x2C, 0x09, 0x8E, 0x99, 0x34, 0x28, 0x24, 0xC0, 0x2D, 0x19, 0x66,
+0xC1, 0x19, 0xC0, 0x14, 0x19, 0xC1, 0x14, 0xB0, 0x88, 0x83, 0x77, 0x31, 0xE4, 0x9B, 0x88, 0x89, 0x77, 0x2D, 0x00, 0xD2, 0x05, 0x14, 0xC2, 0x6E,
+0xB0, 0x88, 0x20, 0x31, 0xF4, 0x30, 0x87, 0x77, 0x8A, 0x98, 0x10, 0x15, 0x24, 0x29, 0x18, 0x01, 0x2D, 0x19, 0x14, 0xC0, 0x6D, 0x19, 0x7E, 0x19,
+0x14, 0xC1, 0x05, 0xC0, 0xB5, 0x99, 0xBE, 0x88, 0xAB, 0x88, 0xEF, 0x0D, 0x89, 0x88, 0x24, 0x00, 0xC4, 0x3C, 0x24, 0x15, 0x01, 0x10, 0x34, 0xB2,
+0x89, 0x08, 0xA3, 0x89, 0x55, 0x9D, 0x88, 0xC1, 0x51, 0x95, 0x77, 0x34, 0x93, 0x78, 0x61, 0x15, 0xC0, 0x3C, 0x9D, 0x77, 0x14, 0xC1, 0x19, 0x14,
+0xC0, 0x19, 0x14, 0xC0, 0x69, 0x10, 0xBF, 0x88, 0x31, 0xE6, 0x98, 0x88, 0x85, 0x88, 0x88, 0x88, 0x9C, 0x88, 0xC1, 0x05, 0x00, 0xCD, 0x05, 0x14,
+0xC2, 0xAD, 0x88, 0x3D, 0xB1, 0x99, 0x31, 0xF5, 0x96, 0x88, 0x86, 0x88, 0x10, 0x55, 0x7E, 0x01, 0x2D, 0x19, 0x14, 0xC0, 0x19, 0x14, 0x19, 0x7E,
+0xC0, 0x19, 0x65, 0x05, 0x00, 0x05, 0xB3, 0x99, 0x25, 0x31, 0xDB, 0x2C, 0xC2, 0x55, 0xC1, 0x66, 0xC0, 0x55, 0xC0, 0x04, 0x55, 0xC0, 0x30, 0x55,
+0x66, 0x55, 0x66, 0x55, 0x66, 0x9D, 0x77, 0x98, 0x88, 0x90, 0x88, 0x24, 0x14, 0xC0, 0x05, 0xC1, 0x3C, 0x15, 0x24, 0x15, 0x10, 0x24, 0xA4, 0x88,
+0xA7, 0x89, 0xAC, 0x88, 0xA7, 0x98, 0xA2, 0x88, 0x52, 0x9A, 0x88, 0x14, 0x94, 0x88, 0x9A, 0x88, 0xA4, 0x87, 0xA3, 0x99, 0x50, 0x3C, 0x19, 0xC0,
+0x66, 0x19, 0x14, 0x19, 0xC0, 0x14, 0xC0, 0x19, 0x05, 0xC0, 0xB7, 0x99, 0x35, 0x31, 0xE7, 0x97, 0x88, 0x86, 0x88, 0x3C, 0x00, 0xCF, 0x05, 0x14,
+0x05, 0xC1, 0xAE, 0x88, 0xBB, 0x99, 0x1D, 0x31, 0xF7, 0x0D, 0x87, 0x87, 0x8E, 0x88, 0x19, 0x7E, 0x19, 0x05, 0x14, 0xC0, 0x05, 0x14, 0x19, 0xC0,
+0x05, 0xC1, 0x00, 0x01, 0xB6, 0x88, 0x39, 0x2C, 0x31, 0x2C, 0x31, 0x51, 0x2C, 0x1D, 0x66, 0xC1, 0x55, 0xC0, 0x04, 0x35, 0x66, 0x09, 0xC0, 0x18,
+0x09, 0xC0, 0x04, 0x35, 0x30, 0x55, 0xC0, 0x1C, 0x0D, 0x08, 0x39, 0x34, 0x25, 0x66, 0xC0, 0x55, 0x66, 0x3D, 0x51, 0x24, 0xC0, 0x55, 0x10, 0x51,
+0x55, 0x66, 0x55, 0x66, 0x51, 0x56, 0x65, 0x55, 0x66, 0xC0, 0x1D, 0x9C, 0x88, 0x98, 0x88, 0x9C, 0x88, 0x66, 0x3D, 0xC0, 0x7F, 0x6E, 0x3D, 0x9C,
+0x98, 0x56, 0x6E, 0x18, 0x6F, 0x9D, 0x78, 0x24, 0x38, 0x7F, 0x38, 0x08, 0x9D, 0x87, 0xA2, 0x88, 0xA3, 0x89, 0x24, 0x10, 0x50, 0x28, 0x51, 0xC1,
+0x6E, 0xC0, 0x14, 0xC0, 0x19, 0x14, 0xC0, 0x51, 0x15, 0xBB, 0x99, 0x21, 0x09, 0x51, 0xC3, 0x04, 0xC1, 0x09, 0xC1, 0x7F, 0xC1, 0x6E, 0xC0, 0x7F,
+0x1D, 0x18, 0xC2, 0x1D, 0xC5, 0x2C, 0x31, 0x2C, 0xC2, 0x31, 0x2C, 0x31, 0xC2, 0x04, 0x8E, 0x88, 0x38, 0x00, 0xD1, 0x3C, 0xB0, 0x88, 0xB7, 0x88,
+0x31, 0xF0, 0x2C, 0xC2, 0x1D, 0x2C, 0x1D, 0x6B, 0x51, 0x30, 0x99, 0x77, 0x8E, 0x87, 0x8D, 0x88, 0x19, 0x00, 0xC9, 0xA4, 0x88, 0xAE, 0x87, 0xB6,
+0x89, 0x0D, 0xC0, 0x34, 0x25, 0x20, 0x55, 0x66, 0xC0, 0x3D, 0x66, 0xC0, 0x29, 0x66, 0x10, 0x55, 0x66, 0x9D, 0x77, 0x51, 0x51, 0x66, 0x55, 0x66,
+0x55, 0x66, 0x51, 0xC0, 0x55, 0x1C, 0x55, 0x66, 0x51, 0xC0, 0x55, 0xC0, 0x66, 0xC0, 0x55, 0xC1, 0x66, 0xC3, 0x55, 0xC3, 0x6B, 0xC0, 0x3D, 0x0C,
+0xC0, 0x11, 0x20, 0x25, 0xC0, 0x34, 0x6E, 0xC1, 0x9D, 0x87, 0x9A, 0x89, 0x9D, 0x88, 0x59, 0x0B, 0x6E, 0x15, 0xC0, 0x10, 0x01, 0x10, 0x15, 0x7A,
+0x6E, 0x18, 0x01, 0x52, 0x51, 0x14, 0xC3, 0x6E, 0x14, 0xC0, 0x69, 0x56, 0x00, 0x19, 0x39, 0xB0, 0x88, 0x3C, 0x51, 0xC1, 0x3C, 0xC0, 0x6E, 0x7F,
+0xC0, 0x6E, 0xC0, 0x7F, 0x29, 0xC0, 0x38, 0x6E, 0xC1, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0xC1, 0x6E, 0xC0, 0x7F, 0xC0, 0x6E, 0x7F, 0xC1, 0x6E, 0xC2,
+0x7F, 0x21, 0x30, 0xC0, 0x35, 0xA2, 0x88, 0x7F, 0x08, 0x8C, 0x88, 0x8C, 0x88, 0x05, 0x66, 0xCE, 0xA6, 0x88, 0xB1, 0x88, 0x29, 0xAC, 0x88, 0x09,
+0x18, 0x6E, 0x18, 0x1D, 0xC0, 0x7F, 0xC3, 0x6E, 0xE0, 0x2C, 0xC0, 0x1D, 0xC1, 0x18, 0x09, 0x66, 0x35, 0x30, 0x21, 0x1C, 0x0D, 0x08, 0xC0, 0x20,
+0x15, 0x91, 0x88, 0x94, 0x88, 0x99, 0x77, 0xC3, 0x3C, 0xC0, 0x55, 0x3C, 0x01, 0x38, 0xA8, 0x88, 0xA8, 0x88, 0x6E, 0x18, 0x55, 0xC6, 0x04, 0xC0,
+0x55, 0x66, 0x55, 0x66, 0xC0, 0x08, 0x55, 0x66, 0x55, 0xC0, 0x66, 0x55, 0xC1, 0x0C, 0xC0, 0x55, 0xC0, 0x38, 0xC3, 0x55, 0xCD, 0x38, 0xC5, 0x3D,
+0xC6, 0x9C, 0x88, 0x3C, 0x2D, 0x3C, 0x0B, 0x6E, 0x15, 0x7A, 0x6F, 0xC0, 0x15, 0x3C, 0x51, 0x55, 0xC1, 0x14, 0xC0, 0x19, 0xC1, 0x14, 0xC0, 0x05,
+0xC0, 0x00, 0x05, 0x15, 0x25, 0x39, 0x25, 0x20, 0x25, 0xC0, 0x34, 0xC0, 0x39, 0xC0, 0x08, 0xC0, 0x6E, 0xC0, 0x1C, 0xC0, 0x21, 0xC0, 0x30, 0xC0,
+0x35, 0xC0, 0x04, 0x09, 0x7F, 0xC0, 0x1D, 0xC0, 0x7F, 0xC0, 0x6E, 0xC0, 0x7F, 0x6E, 0xC1, 0x7F, 0xC4, 0x05, 0x00, 0xC1, 0x14, 0x00, 0x0D, 0x24,
+0x28, 0x51, 0x51, 0xC7, 0x6E, 0x14, 0x19, 0x2D, 0x29, 0x30, 0xAD, 0x88, 0xA9, 0x99, 0xA2, 0x88, 0x6E, 0xA2, 0x88, 0x7F, 0x6E, 0xA2, 0x88, 0x7F,
+0x6E, 0x7F, 0x6E, 0xC0, 0x7F, 0xC0, 0x6E, 0xC0, 0x7F, 0xC1, 0x6E, 0xD8, 0x2C, 0xC2, 0x1D, 0x18, 0xC0, 0x09, 0x04, 0x35, 0xC0, 0x21, 0x66, 0x0D,
+0x39, 0xC0, 0x66, 0xC0, 0x20, 0x55, 0x9D, 0x88, 0xC0, 0x69, 0x56, 0xC2, 0x66, 0xC0, 0x29, 0x38, 0xC2, 0x29, 0xC6, 0x24, 0xC1, 0x55, 0x66, 0x55,
+0x66, 0x2D, 0xC0, 0x66, 0xC0, 0x55, 0x66, 0x55, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0xC0, 0x55, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0xC0,
+0x55, 0xC0, 0x66, 0xC0, 0x55, 0x66, 0xC1, 0x55, 0xC0, 0x66, 0xC1, 0x55, 0xC1, 0x66, 0xC2, 0x55, 0xC0, 0x66, 0xC2, 0x11, 0x0C, 0x9C, 0x88, 0x9B,
+0x88, 0x50, 0xC0, 0x6F, 0x6E, 0x7A, 0x2D, 0xC0, 0x28, 0x51, 0xC8, 0x55, 0x66, 0xC1, 0x14, 0xA6, 0x88, 0x3D, 0x0C, 0x51, 0x55, 0xCD, 0x38, 0xC3,
+0x3D, 0xC1, 0x0C, 0xC1, 0x11, 0xC0, 0x20, 0xC0, 0x25, 0xC0, 0x34, 0x39, 0xC0, 0x08, 0xC4, 0x0D, 0x08, 0xC0, 0xA2, 0x88, 0xA2, 0x88, 0x35, 0x04,
+0xC0, 0x35, 0x1C, 0x39, 0x25, 0x20, 0xC1, 0x34, 0x0D, 0x35, 0x1D, 0xA5, 0x99, 0xA2, 0x88, 0xA4, 0x88, 0xA3, 0x88, 0xA3, 0x99, 0xA2, 0x88, 0xA2,
+0x88, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0xC0, 0x7F, 0xC0, 0x6E, 0xC0, 0x7F, 0xC0, 0x6E, 0xE0, 0x2C, 0xC6, 0x31, 0x2C,
+0xC0, 0x31, 0x2C, 0xC4, 0x1D, 0xC2, 0x18, 0xC1, 0x09, 0xC1, 0x04, 0xC1, 0x35, 0xC0, 0x30, 0xC0, 0x21, 0xC1, 0x1C, 0xC0, 0x0D, 0xC1, 0x08, 0xC2,
+0x39, 0xC0, 0x34, 0x55, 0xC0, 0x20, 0xC0, 0x55, 0x0C, 0xC0, 0x55, 0x66, 0xC0, 0x29, 0xC0, 0x66, 0x15, 0xC0, 0x10, 0x01, 0xC0, 0x3C, 0x55, 0x28,
+0x19, 0xC0, 0x14, 0x55, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0x55, 0xC0, 0x66, 0xC0, 0x55, 0x66, 0xC0, 0x55, 0xC0, 0x66, 0xC2, 0x51, 0x9A, 0x88, 0x97,
+0x77, 0x9B, 0x88, 0xC0, 0x6E, 0x14, 0xC3, 0x19, 0x14, 0xC5, 0x55, 0x66, 0x05, 0x19, 0x01, 0xA5, 0x99, 0x20, 0x55, 0x66, 0xC0, 0x55, 0xC2, 0x38,
+0xC8, 0x3D, 0xC0, 0x0C, 0xC1, 0x11, 0xC0, 0x20, 0x6E, 0x7F, 0x6E, 0xC0, 0x7F, 0x6E, 0x1C, 0x6E, 0x30, 0x04, 0x09, 0x18, 0x2C, 0x31, 0x7F, 0x6E,
+0xA2, 0x88, 0x28, 0x2D, 0x3C, 0x10, 0x15, 0x24, 0x29, 0xA2, 0x88, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0xC1, 0x6E, 0xC0, 0x7F, 0x6E, 0x7F, 0x6E, 0x7F,
+0x6E, 0x7F, 0x6E, 0xC1, 0x7F, 0xC1, 0x6E, 0xC3, 0x7F, 0xC2, 0x6E, 0xFD, 0xC6, 0x2C, 0xC5, 0x1D, 0xC2, 0x18, 0xC5, 0x09, 0xC0, 0x04, 0xC1, 0x35,
+0xC1, 0x30, 0xC0, 0x21, 0xC1, 0x1C, 0xC0, 0x0D, 0xC0, 0x08, 0xC0, 0x39, 0xC0, 0x34, 0xC0, 0x25, 0xC0, 0x20, 0xC0, 0x11, 0xC0, 0x66, 0xC0, 0x3D,
+0xC1, 0x66, 0x29, 0xC0, 0x24, 0xC0, 0x15, 0xC0, 0x10, 0x55, 0xC0, 0x3C, 0x2D, 0xC0, 0x9D, 0x88, 0x98, 0x88, 0x94, 0x88, 0x97, 0x77, 0x9D, 0x88,
+0xC4, 0x55, 0xC1, 0x14, 0xC0, 0x05, 0x66, 0xC0, 0x05, 0xA3, 0x99, 0xA5, 0x88, 0xA4, 0x88, 0xA5, 0x99, 0xA2, 0x88, 0xC0, 0x55, 0xC2, 0x08, 0x39,
+0x08, 0xC0, 0x6E, 0xC0, 0x7F, 0x6E, 0x7F, 0x6E, 0xC0, 0x04, 0x6E, 0x7F, 0x6E, 0x7F, 0xC0, 0xA2, 0x88, 0xC0, 0xA2, 0x88, 0x19, 0xA2, 0x88, 0x3C,
+0x01, 0x10, 0x24, 0xC0, 0x38, 0x6E, 0xC0, 0x7F, 0x11, 0x20, 0xA2, 0x88, 0xC0, 0x6E, 0x7F, 0x6E, 0x7F, 0xC0, 0x6E, 0x7F, 0x6E, 0xC0, 0x7F, 0xC2,
+0xA2, 0x88, 0xC0, 0x6E, 0xC2, 0x7F, 0xC3, 0x31, 0xFD, 0xE6, 0x2C, 0xC5, 0x1D, 0xC5, 0x18, 0xC4, 0x55, 0xC2, 0x04, 0xC2, 0x35, 0xC3, 0x30, 0x21,
+0xC0, 0x1C, 0x0D, 0x08, 0x39, 0x34, 0x20, 0x11, 0x3D, 0x29, 0x51, 0x01, 0x2D, 0x19, 0x51, 0x51, 0x9D, 0x88, 0x98, 0x88, 0x95, 0x77, 0x9A, 0x88,
+0x66, 0xC0, 0x55, 0xC1, 0x66, 0xC5, 0x05, 0x28, 0xA4, 0x88, 0xA5, 0x88, 0xA3, 0x99, 0x6E, 0xC0, 0xA2, 0x88, 0xA3, 0x99, 0x6E, 0xA2, 0x88, 0xA2,
+0x88, 0xA2, 0x88, 0x31, 0x7F, 0xA3, 0x88, 0x7F, 0x3C, 0x01, 0xA2, 0x88, 0x24, 0x29, 0x38, 0x6E, 0x0C, 0x11, 0x7F, 0x6E, 0xC0, 0x34, 0x6E, 0x7F,
+0xC0, 0x0D, 0x7F, 0xC0, 0x6E, 0xC0, 0x30, 0xC0, 0x6E, 0xC0, 0x04, 0xC0, 0x6E, 0xC1, 0x7F, 0xC1, 0x6E, 0xC1, 0x2C, 0xC3, 0x6E, 0xFD, 0xFD, 0xCF,
+0x2C, 0xC1, 0x1D, 0xC1, 0x18, 0x09, 0x04, 0xC0, 0x35, 0x21, 0x1C, 0x0D, 0x08, 0x34, 0x20, 0x0C, 0x38, 0x15, 0x01, 0x28, 0x19, 0x00, 0x51, 0x55,
+0x66, 0x51, 0x9D, 0x77, 0x9D, 0x88, 0x55, 0x66, 0x55, 0x51, 0xC2, 0x7F, 0x25, 0x34, 0xA3, 0x88, 0x21, 0x04, 0x18, 0x2C, 0x00, 0xA2, 0x88, 0x28,
+0x3C, 0xA2, 0x88, 0x24, 0x38, 0x0C, 0x6E, 0xA2, 0x88, 0x7F, 0x6E, 0x7F, 0x6E, 0x1C, 0xC0, 0x6E, 0xC0, 0x30, 0x35, 0xC0, 0x7F, 0xC0, 0x09, 0xC2,
+0x7F, 0xC2, 0x6E, 0xC1, 0x7F, 0xC2, 0x31, 0xFD, 0xFD, 0xE7, 0x2C, 0xC0, 0x1D, 0xC0, 0x18, 0xC0, 0x09, 0x04, 0x35, 0xC1, 0x30, 0xC0, 0x21, 0x1C,
+0x0D, 0x08, 0xC2, 0x39, 0xC0, 0x34, 0x39, 0xC2, 0x08, 0x0D, 0xC0, 0x1C, 0xC0, 0x21, 0xC0, 0x30, 0xC0, 0x35, 0xC1, 0x04, 0xC1, 0x09, 0xC1, 0x18,
+0xC4, 0x1D, 0xC2, 0x2C, 0xC4, 0x31, 0xFD, 0xFD, 0xFD, 0xC6, 0x2C, 0xC3, 0x31, 0xD1, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xC0, 0x2C, 0x31, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+0xD2,
 };
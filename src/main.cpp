@@ -7,13 +7,26 @@
 #include <UrlEncode.h>
 #include <ACAN2515.h>
 #include <TelnetStream.h>
-#include <img.h>
-
-// Compiling options
-//#define DEBUG
-//#define DEBUGBT
-#define BTClassic
-//#define BTLowEnergy
+#include <canring.h>
+#include <candecoder.h>
+#include <canfilter.h>
+#include <canstats.h>
+#include <cantrace.h>
+#include <canhealth.h>
+#include <cansniffer.h>
+#include <vehicle.h>
+#include <widgets.h>
+#include <framebuffer.h>
+#include <framescheduler.h>
+#include <screens.h>
+#include <displaymodel.h>
+#include <taskload.h>
+#include <history.h>
+#include <textformat.h>
+#include <allocations.h>
+#include <options.h>
+#include <display.h>
+#include <esp_partition.h>
 
 #ifdef BTClassic
   #include <BluetoothSerial.h>
@@ -23,11 +36,6 @@
   #include <NimBLEDevice.h>
 #endif
 
-const char VERSION[] = "1.1c";
-
-#define ShowConsumptionAsKW true
-#define ShowChargeAsKW true
-
 // Definitions
 #define DISPLAY_POWER_PIN 22
 #define CAN_INTERRUPT 27
@@ -37,65 +45,37 @@ const char VERSION[] = "1.1c";
 #define CAN_SCK 14
 #define CAN_8MHz 8UL * 1000UL * 1000UL
 #define CAN_500Kbs 500UL * 1000UL
+#define CAN_RING_SIZE 128 // frames buffered between CAN receive task and loop
+#define CAN_TASK_CORE 0
+#define CAN_TASK_PRIORITY 10
+#define CAN_TASK_TIMEOUT_MS 5 // drain interval if no interrupt notification arrives
+#define CAN_TRACE_BUFFER_SIZE 8192 // RAM ring for trace records before they are written to flash
+#define CAN_TRACE_FLUSH_BYTES 512
+#define CAN_TRACE_SECTOR 4096
+#define CAN_SNIFFER_SLOTS 64 // IDs tracked in sniffer mode, sizeof(CanSnifferSlot) bytes each, `sniff` shows the total
 #define ONBOARD_LED 2
 
-#define COLOR_ALMOSTBLACK 0x436c
-#define COLOR_BACKGROUND 0x2104
-#define COLOR_BG_GREEN 0x0140
-#define COLOR_BG_RED 0x3000
-#define COLOR_TOPOLINO 0x05f5
-#define COLOR_GREY 0xa554
-#define COLOR_LIGHTRED 0xfa08
-
-struct trip {
-  unsigned long startTime;
-  unsigned long endTime;
-  float startKM;
-  float endKM;
-  int maxSpeed;
-  int startSoC;
-  int endSoC;
-  bool toSend;
-};
-struct CANValues {
-  int ODO = 0;
-  bool ODOUp = false;
-  int Speed = 0;
-  bool SpeedUp = false;
-  int OBCRemainingMinutes = -1;
-  bool OBCRemainingMinutesUp = false;
-  float Battery = 0.0;
-  bool BatteryUp = false;
-  int Temp1 = -99;
-  bool Temp1Up = false;
-  int Temp2 = -99;
-  bool Temp2Up = false;
-  float Volt = 0;
-  bool VoltUp = false;
-  int SoC = 101;
-  bool SoCUp = false;
-  String Gear = "?";
-  bool GearUp = false;
-  int RemainingDistance = 0;
-  bool RemainingDistanceUp = false;
-  int Ready = -1; // 1=Ready, 0=Not Ready, -1=Unknown
-  bool ReadyUp = false;
-  float Current = 0;
-  bool CurrentUp = false;
-  int Handbrake = -1; // 1=On, 0=Off, -1=Unknown
-  bool HandbrakeUp = false;
-};
-struct Charge {
-  unsigned long startTime = 0;
-  unsigned long endTime;
-  int startSoC = 0;
-  int endSoC = 0;
-  int helperCircal = 0;
-};
-
 TFT_eSPI tft = TFT_eSPI();
 SPIClass hspi = SPIClass(HSPI);
 ACAN2515 can((int)CAN_CS, hspi, (int)CAN_INTERRUPT);
+CanFrameRing<CAN_RING_SIZE> CanRing;
+CanStatistics CanStats;
+CanSniffer<CAN_SNIFFER_SLOTS> CanSniff;
+CanTraceBuffer<CAN_TRACE_BUFFER_SIZE> CanTrace;
+TaskHandle_t CanReceiveTaskHandle = NULL;
+TaskHandle_t LoopTaskHandle = NULL;       // woken by the CAN receive task
+FrameScheduler DisplayScheduler;
+HistorySampler PowerHistory;              // drive screen chart, see history.h
+DisplayPower PanelPower;                  // panel sleep and brightness, see displaypower.h
+uint32_t PanelWakeUs = 0;                 // CAN frame that ended the last sleep
+TaskHandle_t RenderTaskHandle = NULL;
+QueueHandle_t RenderQueue = NULL;         // DisplayModel, see DisplayPost()
+SemaphoreHandle_t RenderLock = NULL;      // held by the render task while it draws or its DMA transfer runs
+RenderStatistics RenderStats;
+TaskLoad LoopLoad, CanTaskLoad, RenderLoad;
+DisplaySleepPhase SleepPhase = SleepSending;
+int BTConnectTimeout = 0;
+float DisplaySignalValues[SignalCount];  // last decoded values, for the display invalidation
 
 #ifdef BTClassic
   BluetoothSerial BT;
@@ -104,13 +84,10 @@ ACAN2515 can((int)CAN_CS, hspi, (int)CAN_INTERRUPT);
 #include "../config/config.h"
 
 // Loops intervalls
-unsigned long DisplayRefreshLastRun = 0;
-const unsigned int DisplayRefreshInterval = 0.25 * 1000; 
+#define LOOP_INTERVAL_MS 25 // loop() also runs as soon as CAN frames arrive
 unsigned long SendDataLastRun = 0;
 const unsigned int SendDataInterval = 30 * 1000; 
 unsigned long SerialOutputLastRun = 0;
-const unsigned int TripRecordInterval = 1 * 1000;
-unsigned long TripRecordingLastRun = 0;
 unsigned long KeepAliveLastRun = 0;
 unsigned long ReversingLightLastRun = 0;
 unsigned long BTConnectLastRun = 0;
@@ -126,53 +103,105 @@ String BT_Slave_Name = "JDY-33-SPP";
 int CanError = 0;
 unsigned long CanMessagesProcessed = 0;
 unsigned long CanMessagesLastRecived = 0;
-float Value_Battery_Current_Buffer = 0;
-trip thisTrip; // Trip data structure
-trip RTC_DATA_ATTR lastTrip1; // Last Trip data structure
-trip RTC_DATA_ATTR lastTrip2; // Last Trip data structure
-trip RTC_DATA_ATTR lastTrip3; // Last Trip data structure
-trip RTC_DATA_ATTR lastTrip4; // Last Trip data structure
-trip RTC_DATA_ATTR lastTrip5; // Last Trip data structure
-CANValues canValues; // CAN values structure
-Charge thisCharge;
-bool TripActive = false;
-bool DataToSend = false;
-bool ChargeDataToSend = false;
+uint32_t CanRingOverflowsReported = 0;
+unsigned long CanFramesBadLength = 0;
+unsigned long CanFramesDiscarded = 0; // accepted by the MCP2515 filters but not decoded
+volatile bool CanStatsResetRequested = false;
+uint8_t CanTEC = 0; // MCP2515 transmit error counter
+uint8_t CanREC = 0; // MCP2515 receive error counter
+uint8_t CanEFLG = 0; // MCP2515 error flag register
+CanSupervisor CanHealth;
+CanHealthState CanHealthReported = CanHealthDown;
+volatile bool CanHealthPollRequested = false; // loop -> CAN receive task: read TEC/REC/EFLG
+volatile bool CanReinitRequested = false; // loop -> CAN receive task: reinitialize the controller
+volatile bool CanReinitDone = false; // CAN receive task -> loop: CanError holds the result
+volatile bool CanSnifferRequested = false; // loop -> CAN receive task: open the acceptance filters and record every ID
+volatile bool CanSnifferActive = false; // filters are open, set by the CAN receive task
+const esp_partition_t *CanTracePartition = NULL;
+uint32_t CanTraceLength = 0; // record bytes written to flash
+uint32_t CanTraceErased = 0; // partition bytes erased so far
+#if CAN_FILTER_REPORT
+static const int CanFilterReported = CanFilterReport(std::make_index_sequence<CanFilterReportCount>{}); // build time report of undecoded IDs passing the filters
+#endif
+// CAN message filter, generated from the decoded IDs (see canfilter.h)
+const ACAN2515Mask CanRxm0 = standard2515Mask(CanFilterPlan.mask[0], 0, 0); // Only ID is relevant for filtering
+const ACAN2515Mask CanRxm1 = standard2515Mask(CanFilterPlan.mask[1], 0, 0);
+const ACAN2515AcceptanceFilter CanFilters[] = { 
+  {standard2515Filter(CanFilterPlan.filter[0], 0, 0), NULL}, // RXB0
+  {standard2515Filter(CanFilterPlan.filter[1], 0, 0), NULL},
+  {standard2515Filter(CanFilterPlan.filter[2], 0, 0), NULL}, // RXB1
+  {standard2515Filter(CanFilterPlan.filter[3], 0, 0), NULL},
+  {standard2515Filter(CanFilterPlan.filter[4], 0, 0), NULL},
+  {standard2515Filter(CanFilterPlan.filter[5], 0, 0), NULL}
+};
+bool DataToSend = false; // signals changed beyond their deadband since the last upload
+uint32_t SignalsStaleReported = 0;
+// ioBroker states below 0_userdata.0.topolino, indexed by CanSignal
+const char* const SimpleAPIStates[SignalCount] = {
+  "BattA",                    // SignalCurrent
+  "BattV",                    // SignalVolt
+  "SoC",                      // SignalSoC
+  "ODO",                      // SignalODO
+  "speed",                    // SignalSpeed
+  "OnBoardChargerRemaining",  // SignalOBCRemainingMinutes
+  "12VBatt",                  // SignalBattery
+  "BattTemp1",                // SignalTemp1
+  "BattTemp2",                // SignalTemp2
+  "gear",                     // SignalGear
+  "RemainingKM",              // SignalRemainingDistance
+  "Ready",                    // SignalReady
+  "Handbreake",               // SignalHandbrake
+};
 unsigned long StatusIndicatorStatus = TFT_DARKGREY;
 unsigned long StatusIndicatorCAN = TFT_DARKGREY;
 unsigned long StatusIndicatorWIFI = TFT_DARKGREY;
 unsigned long StatusIndicatorTx = TFT_DARKGREY;
 unsigned long StatusIndicatorBT = TFT_DARKGREY;
 bool IsSleeping = false;
-bool IsCharging = false;
 unsigned int BTReconnectCounter = 0;
 bool BTisStarted = false;
-float avgkWh = 10;
-int SoCchangeDetection = 0;
-int NoScreenupdateBefore = 0;
-bool ScreenResetRequired = false;
+ScreenManager Screens;
 
 // put function declarations here:
 void CanConnect();
+int CanBegin();
+void CanSupervise(unsigned long currentMillis);
+void CanInterrupt();
+void CanReceiveTask(void *parameter);
 void CANCheckMessage();
+void CanReadControllerErrors();
+void CanStatsPrint();
+void CanSnifferStart(bool start);
+void DisplayStatsPrint();
+void DisplayBenchStep(unsigned long currentMillis);
+void DisplayBenchReport(Screen screen, unsigned long currentMillis);
+FrameState DisplayFrameState();
+bool DisplayIndicatorsChanged();
+void CanSnifferPrint();
+void CanTraceStart();
+void CanTraceStop();
+void CanTraceFlush(bool all);
+void ConsoleCheckInput();
+void ConsoleReadLine(Stream &stream, String &line);
+void ConsoleCommand(String command);
 bool WIFIConnect();
 bool WIFICheckConnection();
 void WIFIDisconnect();
-void DisplayBoot();
-void DisplayMainUI();
-void DisplayTripResults();
-void DisplayCharging();
-void DisplayChargingResult();
+bool DisplayScreen(Screen screen);
+DisplayPowerState DisplayPowerStateNow();
+void DisplayPowerPrint();
+void DisplayPost();
+void DisplayRenderTask(void *parameter);
 void ConnectWIFIAndSendData();
 bool SendDataSimpleAPI();
+String SimpleAPIValue(const CANValues &v, CanSignal signal);
+String SignalNames(uint32_t mask);
 void SendRemoteLogSimpleAPI(String message);
 bool SendChargeInfoSimpleAPI();
 bool SendTripInfosSimpleAPI(trip tripToSend);
 void SerialPrintValues();
-void TripRecording();
 void SleepLightStart();
 void SleepDeepStart();
-float average(float newvalue, float &buffer, float factor);
 void DebugFakeValues();
 void Log(String message, bool RemoteLog);
 void Log(String message);
@@ -207,12 +236,15 @@ void setup() {
   digitalWrite(DISPLAY_POWER_PIN, HIGH);
   delay(50);
   // Initialize display
-  tft.init();
-  tft.fillScreen(TFT_BLACK);
+  DisplayBegin();
+  Screens.show(ScreenBoot, millis()); // drawn by setup() itself, the render task starts at the end
+  DisplayClear(tft, TFT_BLACK);
   delay(500);
 
   // Initiate CAN
+  LoopTaskHandle = xTaskGetCurrentTaskHandle(); // setup() and loop() share the Arduino loop task
   CanConnect(); 
+  xTaskCreatePinnedToCore(CanReceiveTask, "CanReceive", 4096, NULL, CAN_TASK_PRIORITY, &CanReceiveTaskHandle, CAN_TASK_CORE);
   delay(500);
   CanMessagesLastRecived = millis();
 
@@ -245,8 +277,14 @@ void setup() {
     default:                        message = "Wakeup was caused by (power) reset"; break;
   }
   Log(message, true);  
+  Log("Display framebuffer: " + (FrameBufferStats.bpp ? String(FrameBufferStats.bpp) + " bpp, " + String(FrameBufferStats.bytes) + " bytes" : String("off, direct drawing")) + " - free heap " + String(FrameBufferStats.heapFreeAfter), true);
   digitalWrite(ONBOARD_LED, LOW);
-  tft.fillScreen(COLOR_BACKGROUND);
+
+  // From here on only the render task draws
+  RenderQueue = xQueueCreate(RENDER_QUEUE_LENGTH, sizeof(DisplayModel));
+  RenderLock = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(DisplayRenderTask, "Render", 8192, NULL, RENDER_TASK_PRIORITY, &RenderTaskHandle, RENDER_TASK_CORE);
+  AllocationCountTask(RenderTaskHandle);
 
   #ifdef BTLowEnergy
     delay(1000);
@@ -263,6 +301,16 @@ void setup() {
 // =====================================================================================================
 void loop() {
   unsigned long currentMillis = millis();
+  LoopLoad.begin(micros());
+#if DISPLAY_BENCHMARK
+  // Render benchmark instead of the normal operation (no CAN, sleep, WIFI data or BT)
+  ConsoleCheckInput();
+  DisplayBenchStep(currentMillis);
+  ArduinoOTA.handle();
+  LoopLoad.end(micros());
+  ulTaskNotifyTake(pdTRUE, 1);
+  return;
+#endif
   //Log(" - Tick: " + String(currentMillis));
 
   // Be Alive status
@@ -277,40 +325,64 @@ void loop() {
     else {
       StatusIndicatorStatus = TFT_WHITE;
     }
-  }
 
-  // No Screen refresh timeout
-  if (currentMillis < NoScreenupdateBefore) {
-    ScreenResetRequired = true;
-  }
-  else if (ScreenResetRequired) {
-    ScreenResetRequired = false;
-    tft.fillScreen(COLOR_BACKGROUND);
-  }
+    // CAN ring overflow reporting
+    if (CanRing.overflowCount() != CanRingOverflowsReported) {
+      Log("WARNING: CAN ring overflow - dropped frames: " + String(CanRing.overflowCount() - CanRingOverflowsReported) + " High water: " + String(CanRing.highWater()) + "/" + String(CanRing.size()));
+      CanRingOverflowsReported = CanRing.overflowCount();
+    }
+
+    CanSupervise(currentMillis);
 
-  // Display Main UI / refresh Values
-  if ((currentMillis - DisplayRefreshLastRun >= DisplayRefreshInterval) && !IsSleeping && !IsCharging && (currentMillis >= NoScreenupdateBefore)){
-    DisplayRefreshLastRun = currentMillis;
-    DisplayMainUI();
+    // Stale signal reporting
+    uint32_t stale = Signals.staleMask(currentMillis);
+    if (stale != SignalsStaleReported) {
+      if (stale & ~SignalsStaleReported) { Log("WARNING: CAN signals stale: " + SignalNames(stale & ~SignalsStaleReported)); }
+      if (SignalsStaleReported & ~stale) { Log("CAN signals back: " + SignalNames(SignalsStaleReported & ~stale)); }
+      SignalsStaleReported = stale;
+    }
   }
 
+  // Commands via Serial / Telnet
+  ConsoleCheckInput();
+
   // Check CAN Messages
-  if (can.available()) {
+  if (CanRing.available()) {
     StatusIndicatorCAN = TFT_YELLOW;
     CanMessagesLastRecived = currentMillis;
     CANCheckMessage();
+    if (canValues.Ready == 1) { PowerHistory.add(canValues.Current * canValues.Volt * -1, canValues.Speed); }
   }
-  else if (CanError) {
-    Log("CAN Connect...");
-    CanConnect();
-  }
-  else if ( CanMessagesLastRecived - currentMillis > 5000) { // If no CAN messages received for 5 seconds, set indicator to grey
+  else if (!CanHealth.faulted() && currentMillis - CanMessagesLastRecived > 5000) { // If no CAN messages received for 5 seconds, set indicator to grey
     StatusIndicatorCAN =  TFT_DARKGREY;
   }
 
+  // Power and speed history while ready
+  if (canValues.Ready != 1) { PowerHistory.pause(currentMillis); }
+  else if (PowerHistory.due(currentMillis)) {
+    PowerHistory.sample(currentMillis);
+    DisplayScheduler.invalidate(micros());
+  }
+
+  // Screens: result screens are held, otherwise the vehicle state picks the screen
+  bool powerChanged = PanelPower.set(DisplayPowerStateNow(), currentMillis);
+  Screen screen = Screens.next(currentMillis, IsSleeping ? ScreenSleeping : IsCharging ? ScreenCharging : ScreenDrive);
+  if (!DisplayScreen(screen) && powerChanged) { DisplayPost(); } // the render task wakes, dims or sleeps the panel
+
+  // Display Main UI / Charging: redrawn on changes, see framescheduler.h
+  if (DisplayIndicatorsChanged()) { DisplayScheduler.invalidate(micros()); }
+  DisplayScheduler.setState(DisplayFrameState(), currentMillis);
+  if ((screen == ScreenDrive || screen == ScreenCharging) && DisplayScheduler.due(currentMillis)) {
+    DisplayPost();
+    DisplayScheduler.rendered(millis(), micros());
+  }
+  if (CanTrace.active()) {
+    CanTraceFlush(false);
+  }
+
   #ifdef BTClassic
     // Check BT connection to Relais box
-    if ((currentMillis - BTConnectLastRun > 5 * 60000 || (BTConnectLastRun == 0 && currentMillis > 15000)) && (canValues.Ready == 1 || (canValues.Gear == "N" || canValues.Gear == "R" || canValues.Gear == "D") )) { // Try to reconnect every 5 minutes
+    if ((currentMillis - BTConnectLastRun > 5 * 60000 || (BTConnectLastRun == 0 && currentMillis > 15000)) && (canValues.Ready == 1 || (canValues.Gear == GearN || canValues.Gear == GearR || canValues.Gear == GearD) )) { // Try to reconnect every 5 minutes
       BTConnectLastRun = currentMillis;
       if (BTisStarted) {
         if (!BT.connected()) {
@@ -324,7 +396,7 @@ void loop() {
       }
     }
     /* Deactivated due to always on BT Module
-    if ((canValues.Ready != 1 || canValues.Gear == "-") && BTisStarted) { // Disconnect BT when car is not ready
+    if ((canValues.Ready != 1 || canValues.Gear == GearNone) && BTisStarted) { // Disconnect BT when car is not ready
       Log ("Car not ready - BT Relais OFF", true);
       BTSetRelais(1, false); // Turn off reversing light
       BTDisconnect();
@@ -335,7 +407,7 @@ void loop() {
     if (currentMillis - ReversingLightLastRun >= 500 && BTisStarted) {
     ReversingLightLastRun = currentMillis;
     if (BT.connected()) {
-      if (canValues.Gear == "R" && CanMessagesLastRecived - currentMillis < 3000) // Only activate if CAN messages are recent and car is in reverse
+      if (canValues.Gear == GearR && currentMillis - CanMessagesLastRecived < 3000) // Only activate if CAN messages are recent and car is in reverse
         {
         BTSetRelais(1, true); // Turn on reversing light
         StatusIndicatorBT = TFT_YELLOW;
@@ -357,83 +429,20 @@ void loop() {
   }
   #endif
 
-  // Check for new trip recording
-  if (canValues.Speed > 0 && canValues.Ready == 1 && !TripActive && (currentMillis - CanMessagesLastRecived) < (5000)) {
-    TripActive = true;
-    Log("Trip started at " + String(thisTrip.startTime) + " with ODO: " + String(thisTrip.startKM));
-    
-    if (thisTrip.toSend == true) {
-      lastTrip5 = lastTrip4;
-      lastTrip4 = lastTrip3;
-      lastTrip3 = lastTrip2; 
-      lastTrip2 = lastTrip1;
-      lastTrip1 = thisTrip;  // Save last trip for sending
-      Log("Last Trip saved for later transmition", true);
-    }
-    // Reset Trip data
-    thisTrip.startTime = 0;
-    thisTrip.endTime = 0;
-    thisTrip.startKM = 0;
-    thisTrip.endKM = 0;
-    thisTrip.maxSpeed = 0;
-    thisTrip.startSoC = canValues.SoC;
-    thisTrip.endSoC = canValues.SoC;
-    thisTrip.toSend = false;
-  } 
-  if (currentMillis - TripRecordingLastRun >= TripRecordInterval && TripActive) {
-    TripRecordingLastRun = currentMillis;
-    TripRecording();
-  }
-
-  // Check current Trip has ended
-  if ((canValues.Ready == 0 || canValues.Gear == "-" || canValues.Gear == "?" || (currentMillis - CanMessagesLastRecived) > (10000))  && TripActive) { //was: || (canValues.Gear == "N" && canValues.Handbrake && canValues.Speed == 0)
-    TripActive = false;
-    
-    // Only trips longer than 100 meter will be transmitted
-    if ( (float)((thisTrip.endKM - thisTrip.startKM) / 10) > 0.1) {
-      thisTrip.toSend = true;
-    }
-    
+  // Trips and charges
+  uint8_t vehicleEvents = VehicleUpdate(currentMillis, CanMessagesLastRecived);
+  if (vehicleEvents & VEHICLE_EVENT_TRIP_ENDED) {
     // Show Trip results
-    DisplayTripResults();
-    NoScreenupdateBefore = millis() + 30000; // No screen updates for 30 seconds to show trip results
-
+    DisplayScreen(ScreenTripResult);
   }
-
-  // Check if new charge
-  if (canValues.OBCRemainingMinutes >= 0 && canValues.Current > 0 && !IsCharging) {
-    IsCharging = true;
-    thisCharge.startSoC = canValues.SoC;
-    thisCharge.startTime = currentMillis;
-    tft.fillScreen(COLOR_BACKGROUND);
-
-    Log("Charging started", true);
-  }
-  // Check if chareging has ended
-  if (IsCharging && canValues.OBCRemainingMinutes == -1) {
-    IsCharging = false;
-    thisCharge.endSoC = canValues.SoC;
-    thisCharge.endTime = currentMillis;
-    if (((thisCharge.endTime - thisCharge.startTime) / 1000 / 60 ) > 5) { //only charges longer than 5 minutes will be transmitted
-      ChargeDataToSend = true;
-    }
-
+  if (vehicleEvents & VEHICLE_EVENT_CHARGE_ENDED) {
     BTReconnectCounter = 0;
-    Log("Charging has ended", true);
 
     // Show Charge end screen
-    DisplayChargingResult();
-    NoScreenupdateBefore = millis() + 60000; // No screen updates for 60 seconds to show charging results
+    DisplayScreen(ScreenChargeResult);
     ConnectWIFIAndSendData();
   }
 
-  // Is currently Charging  
-  if (IsCharging && (currentMillis - DisplayRefreshLastRun >= DisplayRefreshInterval) && (currentMillis >= NoScreenupdateBefore))
-  {
-    DisplayRefreshLastRun = currentMillis;
-    DisplayCharging();
-  }
-
   // Send Data  
   if ((currentMillis - SendDataLastRun >= SendDataInterval) && (canValues.Speed < 1 && canValues.Handbrake) && (DataToSend || thisTrip.toSend || ChargeDataToSend)) //send in interval if ignition is off
   {
@@ -469,40 +478,22 @@ void loop() {
     SleepDeepStart();
   }
 
-  delay(25); //loop delay
+  LoopLoad.end(micros());
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOOP_INTERVAL_MS)); //loop delay, ends early for new CAN frames
 }
 
 // Functions ===========================================================================================
   
 void CanConnect () {
-  // CAN message filter
-  /* Relevant IDs
-  010110000001
-  010110000010
-  010110010011
-  010110010100
-  010110000000
-  011100010011
-  011100010100
-
-  010100000000 - Filter
-  010101100000 - Mask
-  */
-  const ACAN2515Mask rxm0 = standard2515Mask (0b010101100000,0,0); // Only ID is relevant for filtering
-  const ACAN2515AcceptanceFilter canFilters[] = { 
-    {standard2515Filter (0b010100000000,0,0)} // All Ids matching this filter
-  };
-
-  // CAN Module
   StatusIndicatorCAN = TFT_CYAN;
-  hspi.begin(CAN_SCK, CAN_MISO, CAN_MOSI);
-  ACAN2515Settings CanSettings (CAN_8MHz, CAN_500Kbs);
-  CanSettings.mRequestedMode = ACAN2515Settings::ListenOnlyMode ;
-  
-  CanError = can.begin(CanSettings, [] { can.isr () ; });
+  CanError = CanBegin();
+  CanHealth.initDone(millis(), CanError == 0);
 
   if ( CanError == 0) {
     Log("CAN-Module Initialized Successfully!");
+    String unwanted = "";
+    for (size_t i = 0; i < CanFilterReportCount; i++) { unwanted += " 0x" + String(CanFilterPlan.unwanted[i], HEX); }
+    Log("CAN filter: RXM0 0x" + String(CanFilterPlan.mask[0], HEX) + " RXM1 0x" + String(CanFilterPlan.mask[1], HEX) + " - undecoded IDs passing: " + String(CanFilterPlan.unwantedCount) + unwanted);
     StatusIndicatorCAN = TFT_LIGHTGREY;
     } 
   else {
@@ -512,216 +503,433 @@ void CanConnect () {
   CanMessagesLastRecived = millis();
 }
 
+int CanBegin() {
+  // Configures the MCP2515, no logging - also called by the CAN receive task for recovery
+  static bool spiStarted = false;
+
+  // CAN Module
+  if (!spiStarted) {
+    hspi.begin(CAN_SCK, CAN_MISO, CAN_MOSI);
+    spiStarted = true;
+  }
+  ACAN2515Settings CanSettings (CAN_8MHz, CAN_500Kbs);
+  CanSettings.mRequestedMode = ACAN2515Settings::ListenOnlyMode ;
+  
+  if (CanSnifferActive) { return can.begin(CanSettings, CanInterrupt); } // no filters: receive everything
+  return can.begin(CanSettings, CanInterrupt, CanRxm0, CanRxm1, CanFilters, 6);
+}
+
+void CanSupervise(unsigned long currentMillis) {
+  // Runs once per second from loop(). Register reads and reinitialization are done by the
+  // CAN receive task, so a failing controller never blocks the display or the BT relais.
+  if (CanReinitDone) {
+    CanReinitDone = false;
+    CanHealth.initDone(currentMillis, CanError == 0);
+    if (CanError == 0) { Log("CAN-Module reinitialized"); }
+    else { Log("ERROR: Reinitializing CAN-Module failed! ErrCode: " + String(CanError) + " - next try in " + String((CanHealth.nextAttempt() - currentMillis) / 1000) + " s", true); }
+  }
+
+  if (CanHealth.update(currentMillis, CanTEC, CanREC, CanEFLG, CanMessagesLastRecived)) {
+    Log("CAN " + String(CanHealthStateNames[CanHealth.state()]) + " - reinitializing CAN-Module, attempt " + String(CanHealth.metrics().recoveryAttempts));
+    CanReinitRequested = true;
+    xTaskNotifyGive(CanReceiveTaskHandle);
+  }
+
+  if (CanHealth.state() != CanHealthReported) {
+    const CanHealthMetrics &health = CanHealth.metrics();
+    // Silent is normal while the car is off, only faults go to the remote log
+    Log("CAN state: " + String(CanHealthStateNames[CanHealthReported]) + " -> " + String(CanHealthStateNames[health.state]) +
+        " TEC: " + String(health.tec) + " REC: " + String(health.rec) + " EFLG: 0x" + String(health.eflg, HEX), CanHealth.faulted());
+    CanHealthReported = health.state;
+  }
+  if (CanHealth.state() == CanHealthDown || CanHealth.state() == CanHealthBusOff) { StatusIndicatorCAN = COLOR_LIGHTRED; }
+  else if (CanHealth.state() == CanHealthErrorPassive) { StatusIndicatorCAN = TFT_ORANGE; }
+
+  if (CanHealth.initialised() && !CanHealth.pending()) { CanHealthPollRequested = true; }
+}
+
+void CanInterrupt() {
+  can.isr();
+
+  // Wake the CAN receive task to drain the driver buffer
+  if (CanReceiveTaskHandle != NULL) {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(CanReceiveTaskHandle, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) { portYIELD_FROM_ISR(); }
+  }
+}
+
+void CanReceiveTask(void *parameter) {
+  // Moves frames from the ACAN2515 driver buffer into CanRing, independent of loop() being blocked (WIFI, BT, HTTP).
+  // The timeout also picks up frames the ACAN2515 handler task was still reading when we were notified.
+  CANMessage canMsg;
+  CanFrame frame;
+  for (;;) {
+    CanTaskLoad.end(micros());
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CAN_TASK_TIMEOUT_MS));
+    CanTaskLoad.begin(micros());
+    if (CanStatsResetRequested) {
+      CanStats.reset();
+      CanStatsResetRequested = false;
+    }
+    if (CanReinitRequested) {
+      can.end();
+      CanError = CanBegin();
+      CanTEC = 0; // counters and flags were reset with the controller
+      CanREC = 0;
+      CanEFLG = 0;
+      CanReinitRequested = false;
+      CanReinitDone = true;
+    }
+    if (CanSnifferRequested != CanSnifferActive) {
+      if (CanSnifferRequested) { CanSniff.reset(); }
+      CanSnifferActive = CanSnifferRequested;
+      if (CanSnifferActive) { can.setFiltersOnTheFly(); }
+      else { can.setFiltersOnTheFly(CanRxm0, CanRxm1, CanFilters, 6); }
+    }
+    if (CanHealthPollRequested) {
+      CanReadControllerErrors();
+      CanHealthPollRequested = false;
+    }
+    while (can.receive(canMsg)) {
+      frame.timestamp = esp_timer_get_time();
+      frame.id = canMsg.id;
+      frame.len = canMsg.len;
+      frame.rtr = canMsg.rtr;
+      memcpy(frame.data, canMsg.data, sizeof(frame.data));
+      CanStats.record(frame.id, frame.len, frame.timestamp);
+      if (CanSnifferActive) { CanSniff.record(frame.id, frame.len, frame.data, frame.timestamp); }
+      CanTrace.record(frame.timestamp, frame.id, frame.len, frame.rtr, frame.data);
+      CanRing.push(frame);
+      xTaskNotifyGive(LoopTaskHandle);
+    }
+  }
+}
+
 void CANCheckMessage(){
   //Log("CAN check message"); 
 
-  CANMessage canMsg;
-  while (can.receive(canMsg)) {
+  CanFrame canMsg;
+  while (CanRing.pop(canMsg)) {
     StatusIndicatorCAN = TFT_GREEN;
 
-    //can.receive(canMsg);
     //Log("CAN Message recived - ID: " + String(canMsg.id, HEX)); 
     //Log("CAN Message recived - DLC: " + String(canMsg.len));
     //Log("CAN Message recived - RTR:" + String(canMsg.rtr));
-    //Log("CAN Message recived - Data: " + String(canMsg.data[0], HEX) + " " + String(canMsg.data[1], HEX) + " " + String(canMsg.data[2], HEX) + " " + String(canMsg.data[3], HEX) + " " + String(canMsg.data[4], HEX) + " " + String(canMsg.data[5], HEX) + " " + String(canMsg.data[6], HEX) + " " + String(canMsg.data[7], HEX) + " " + String(canMsg.data[8], HEX));
+    //Log("CAN Message recived - Data: " + String(canMsg.data[0], HEX) + " " + String(canMsg.data[1], HEX) + " " + String(canMsg.data[2], HEX) + " " + String(canMsg.data[3], HEX) + " " + String(canMsg.data[4], HEX) + " " + String(canMsg.data[5], HEX) + " " + String(canMsg.data[6], HEX) + " " + String(canMsg.data[7], HEX));
 
-    if (!canMsg.rtr) {
-      CanMessagesProcessed++;
-      
-      if (IsSleeping) {
-        IsSleeping = false;
-        tft.fillScreen(COLOR_BACKGROUND);
-      }
+    if (canMsg.rtr) {
+      // unknow CAN Message
+      StatusIndicatorCAN = TFT_BROWN;
+      continue;
+    }
+
+    CanMessagesProcessed++;
       
-      switch (canMsg.id) {
-        // Electronic control Unit (ECU)
-        case 0x581: { 
-          DataToSend = true;
-          if (!canMsg.len == 8) {Log("CAN: Wrong Lenght"); break;}
-          // Odo
-          unsigned int value1 = canMsg.data[6] << 16 | canMsg.data[5] << 8 | canMsg.data[4];
-          //Log("- CAN Value ODO: " + String(value1));
-          canValues.ODO = (float)value1;
-          canValues.ODOUp = true;
-
-          // Speed 
-          unsigned int value = canMsg.data[7];
-          //Log("- CAN Value Speed: " + String(value));          
-          canValues.Speed = value;
-          canValues.SpeedUp = true;
-          }
-          break;
+    if (IsSleeping) { PanelWakeUs = (uint32_t)canMsg.timestamp; }
+    IsSleeping = false; // the drive or charging screen follows with the next loop(), waking the panel
 
-        // Onboard Charger
-        case 0x582: { 
-          DataToSend = true;
-          if (!canMsg.len == 8) {Log("CAN: Wrong Lenght"); break;}
-          
-          // Remaining Time
-          unsigned int value = canMsg.data[1] << 8 | canMsg.data[0];
-          //Log("- CAN Value Remaining Time: " + String(value)); 
-          canValues.OBCRemainingMinutes = value / 60;
-          if (canValues.OBCRemainingMinutes > 600) { canValues.OBCRemainingMinutes = -1; } // not charging
-          canValues.OBCRemainingMinutesUp = true;
+    uint32_t updated = 0;
+    switch (CanDecodeFrame(canMsg.id, canMsg.len, canMsg.data, CanSignalValues, updated)) {
+      case DecodeOK:
+        if (canMsg.id == 0x580) {
+          StatusIndicatorCAN = TFT_BLUE;
+          VehicleEnergySample(canMsg.timestamp, canMsg.data);
+        }
+        for (uint32_t m = updated; m; m &= m - 1) {
+          int signal = __builtin_ctz(m);
+          if (CanSignalValues[signal] != DisplaySignalValues[signal]) {
+            DisplaySignalValues[signal] = CanSignalValues[signal];
+            DisplayScheduler.invalidate((uint32_t)canMsg.timestamp);
           }
-          break;
-
-        // 12V Battery
-        case 0x593: {
+        }
+        if (CANApplySignals(updated) & VEHICLE_EVENT_READY) { BTReconnectCounter = 0 ; } // Reset BT Reconnect tries when car becomes ready to fore recoennection
+        if (Signals.dirty()) {
           DataToSend = true;
-          if (!canMsg.len == 8) {Log("CAN: Wrong Lenght"); break;}
-          unsigned int value = (canMsg.data[1] << 8) | canMsg.data[0];
-          //Log("- CAN Value 12V: " + String(value));
-          canValues.Battery = (float)value / 100;
-          canValues.BatteryUp = true;
-          }
-          break;
+          StatusIndicatorTx = TFT_YELLOW; // knonw CAN message has changed values
+        }
+        break;
+      case DecodeBadLength:
+        CanFramesBadLength++;
+        Log("CAN: Wrong Length - ID: " + String(canMsg.id, HEX) + " DLC: " + String(canMsg.len));
+        break;
+      case DecodeUnknownId:
+        CanFramesDiscarded++;
+        StatusIndicatorCAN = TFT_BROWN;
+        break;
+    }
+  }
+}
 
-        // Main Battery Temperature
-        case 0x594: {
-          DataToSend = true;
-          if (!canMsg.len == 8) {Log("CAN: Wrong Lenght"); break;}
-          
-          // 1 byte signed integer value
-          // Temp 1
-          int value1 = canMsg.data[0];
-          //Log("- CAN Value Temp1: " + String(value1));
-          if (value1 >= 128) {
-            value1 = value1 - 256; // Convert to signed int
-          }
-          canValues.Temp1 = value1;
-          canValues.Temp1Up = true;
-          #ifdef DEBUG
-            Log("Temp1 RAW value: " + String(canMsg.data[0], BIN));
-          #endif
-
-          //Temp 2
-          int value2 = canMsg.data[3];
-          //Log("- CAN Value Temp2: " + String(value2));
-          if (value2 >= 128) {
-            value2 = value2 - 256; // Convert to signed int
-          }
-          canValues.Temp2 = value2;
-          canValues.Temp2Up = true;
-          #ifdef DEBUG
-            Log("Temp2 RAW value: " + String(canMsg.data[3], BIN));
-          #endif
-          }          
-          break;
-        
-        // Main Battery Voltage and Current
-        case 0x580: {
-          DataToSend = true;
-          StatusIndicatorCAN = TFT_BLUE;
-          if (!canMsg.len == 8) {Log("CAN: Wrong Lenght"); break;}
-
-          // Current
-          int value1 = (canMsg.data[1] << 8 | canMsg.data[0]);
-          if (value1 > 32767) {
-            value1 = value1 - 65536; // Convert to signed int
-            }
-          //Log("- CAN Value Current: " + String(value1));
-         canValues.Current = average((float)value1 / 10, Value_Battery_Current_Buffer, 3); // Average over 3 values 
-         canValues.CurrentUp = true;
-
-          //Voltage
-          int value2 = (canMsg.data[3] << 8) | canMsg.data[2];
-          //Log("- CAN Value Voltage: " + String(value2));
-          if (value2 > 4200 && value2 < 6500) { // Check is value is in valid range
-            canValues.Volt = (float)value2 / 100;
-            canValues.VoltUp = true;
-          }
-        
-          // SoC
-          unsigned int value3 = canMsg.data[5];
-          //Log("- CAN Value SoC: " + String(value3));
-          canValues.SoC = value3;
-          canValues.SoCUp = true;
-          }
-          break;
+void CanReadControllerErrors() {
+  CanTEC = can.transmitErrorCounter();
+  CanREC = can.receiveErrorCounter();
+  CanEFLG = can.errorFlagRegister();
+}
 
-        // Display
-        case 0x713: {
-          DataToSend = true;
-          if (!canMsg.len == 7) {Log("CAN: Wrong Lenght"); break;}
-          //Log("CAN: Display Message Data:" + String(canMsg.data[0],HEX) + " " + String(canMsg.data[1],HEX) + " " + String(canMsg.data[2],HEX) + " " + String(canMsg.data[3],HEX) + " " + String(canMsg.data[4],HEX) + " " + String(canMsg.data[5],HEX) + " " + String(canMsg.data[6],HEX));
-
-          int value1 = ((canMsg.data[1] & 0x01) << 1) | ((canMsg.data[0] >> 7) & 0x01);
-          // Gear
-          switch (value1) {
-            case 0b00: // 0
-              canValues.Gear = "R";
-              break;
-            case 0b01: // 1
-              canValues.Gear = "N";
-              break;
-            case 0b10: // 2
-              canValues.Gear = "D";
-              break; 
-            case 0b11: // 3
-              canValues.Gear = "-";
-              break; 
-            default:
-              canValues.Gear = "?";
-              break;
-            }
-            canValues.GearUp = true;
-          //Log("- CAN Value Gear Selected Bits: " + String(value1, BIN));
-
-          // Remaining Distance
-          unsigned int value2 = canMsg.data[0] & 0x3F; // Mask to get the lower 6 bits
-          //Log("- CAN Value Remaining Distance2: " + String(value2));
-          canValues.RemainingDistance = value2;
-          canValues.RemainingDistanceUp = true; 
-          
-          // Ready indicator
-          switch ((canMsg.data[2] & 0b00000111)) { // Check the last 3 bits
-            case 0b101:
-              if (canValues.Ready != 1) { BTReconnectCounter = 0 ; } // Reset BT Reconnect tries when car becomes ready to fore recoennection
-              canValues.Ready = 1; // Ready
-              break;
-            case 0b11:
-              canValues.Ready = 0; // Not ready
-              break;
-            default:
-              canValues.Ready = -1; // Default case for safety
-              break;
-          }
-          canValues.ReadyUp = true;
-          //Log("- CAN Value Ready: " + String(canMsg.data[2], BIN)); //ready 0b101  not 0b11
-          }
-          break;
+void CanStatsPrint() {
+  // Values are read while the CAN receive task updates them - good enough for diagnostics
+  Log("CAN Statistics - est. load: " + String(CanStats.loadPermille() / 10.0, 1) + "% peak: " + String(CanStats.loadPeakPermille() / 10.0, 1) + "% (accepted frames only)");
+  Log(" - Ring overflows: " + String(CanRing.overflowCount()) + " High water: " + String(CanRing.highWater()) + "/" + String(CanRing.size()));
+  const CanHealthMetrics &health = CanHealth.metrics();
+  Log(" - MCP2515 state: " + String(CanHealthStateNames[health.state]) + " TEC: " + String(health.tec) + " REC: " + String(health.rec) + " EFLG: 0x" + String(health.eflg, HEX) + " RX overflows: " + String(health.rxOverflows));
+  Log(" - MCP2515 warning: " + String(health.warnings) + " error passive: " + String(health.errorPassives) + " bus off: " + String(health.busOffs) + " silent: " + String(health.silents));
+  Log(" - MCP2515 init failures: " + String(health.initFailures) + " recovery attempts: " + String(health.recoveryAttempts) + " recovered: " + String(health.recoveries) + " backoff: " + String(health.backoffMs / 1000) + " s");
+  Log(" - Wrong length: " + String(CanFramesBadLength) + " Discarded: " + String(CanFramesDiscarded));
+  for (size_t i = 0; i < CanStatistics::SlotCount; i++) {
+    const CanIdStats &stats = CanStats.slot(i);
+    String id = (i == CanStatistics::OtherSlot) ? String("other") : "0x" + String(CanStats.slotId(i), HEX);
+    Log(" - " + id + " frames: " + String(stats.frames) +
+        " interval min/mean/max: " + String(stats.intervalMin / 1000.0, 1) + "/" + String(stats.intervalMean() / 1000.0, 1) + "/" + String(stats.intervalMax / 1000.0, 1) + " ms" +
+        " jitter: " + String(stats.jitterUs() / 1000.0, 2) + " ms" +
+        " gaps: " + String(stats.gaps) + (stats.gaps ? " (last " + String(stats.lastGap / 1000) + " ms)" : String("")));
+  }
+}
 
-        // Handbreak
-        case 0x714: {
-          DataToSend = true;
-          //Log("CAN:  Handbreak");
-          if (!canMsg.len == 2) {Log("CAN: Wrong Lenght"); break;}
-
-          // Brake
-          if (canMsg.data[0] == 0x01) {
-            canValues.Handbrake = 1;
-            }
-          else if (canMsg.data[0] == 0x00) {
-            canValues.Handbrake = 0;
-            }
-          else {
-            canValues.Handbrake = -1;
-            }
-          }
-          canValues.HandbrakeUp = true;
-          //Log("- CAN Value Brake: " + String(canMsg.data[0], HEX));
+void CanSnifferStart(bool start) {
+  // The CAN receive task opens/restores the acceptance filters
+  CanSnifferRequested = start;
+  xTaskNotifyGive(CanReceiveTaskHandle);
+  Log(start ? "CAN sniffer started - acceptance filters open" : "CAN sniffer stopped - acceptance filters restored", true);
+}
 
-          break;
-        }
-        if (DataToSend == true) {StatusIndicatorTx = TFT_YELLOW; } // knonw CAN message has changed values
-      }
-    else {
-      // unknow CAN Message
-      StatusIndicatorCAN = TFT_BROWN;
+void CanSnifferPrint() {
+  // Slots are read while the CAN receive task updates them - good enough for diagnostics
+  uint8_t order[CAN_SNIFFER_SLOTS];
+  size_t count = CanSniff.count();
+  for (size_t i = 0; i < count; i++) {
+    size_t j = i;
+    for (; j > 0 && CanSniff.slot(order[j - 1]).id > CanSniff.slot(i).id; j--) { order[j] = order[j - 1]; }
+    order[j] = i;
+  }
+
+  Log("CAN Sniffer " + String(CanSnifferActive ? "running" : "stopped") + " - IDs: " + String(count) + "/" + String(CAN_SNIFFER_SLOTS) + " (" + String(sizeof(CanSnifferSlot) * CAN_SNIFFER_SLOTS) + " bytes) frames of other IDs: " + String(CanSniff.otherFrames()) +
+      " ring overflows: " + String(CanRing.overflowCount()) + " MCP2515 RX overflows: " + String(CanHealth.metrics().rxOverflows));
+  Log(" - ID (* = decoded) DLC frames rate | changed bits | min | max");
+  for (size_t i = 0; i < count; i++) {
+    const CanSnifferSlot &slot = CanSniff.slot(order[i]);
+    String dlc = "";
+    for (int n = 0; n <= 8; n++) { if (slot.dlcMask & (1 << n)) { dlc += String(n); } }
+    uint8_t len = 0;
+    for (int n = 8; n > 0; n--) { if (slot.dlcMask & (1 << n)) { len = n; break; } }
+    String changed = "", min = "", max = "";
+    for (uint8_t b = 0; b < len; b++) {
+      changed += (slot.changed[b] < 0x10 ? " 0" : " ") + String(slot.changed[b], HEX);
+      min += (slot.min[b] < 0x10 ? " 0" : " ") + String(slot.min[b], HEX);
+      max += (slot.max[b] < 0x10 ? " 0" : " ") + String(slot.max[b], HEX);
     }
-    
+    Log(" - 0x" + String(slot.id, HEX) + (CanFrameIndex(slot.id) >= 0 ? "*" : " ") + " " + dlc + " " + String(slot.frames) + " " + String(slot.rateX10() / 10.0, 1) + "/s |" + changed + " |" + min + " |" + max);
+  }
+}
+
+void DisplayStatsPrint() {
+  Log("Display - frames: " + String(DisplayStats.frames) + " with changes: " + String(DisplayStats.framesChanged) + " screen clears: " + String(DisplayStats.clears));
+  if (ALLOCATION_COUNTER) {
+    Log(" - Heap allocations while drawing, last frame: " + String(DisplayStats.allocationsLast) + " total: " + String(DisplayStats.allocationsTotal) + " frames allocating: " + String(DisplayStats.framesAllocating) + " (ring tables are built on first use)");
+  }
+  Log(" - Screen: " + String(ScreenConfigTable[Screens.current()].name) + " for " + String((millis() - Screens.since()) / 1000) + " s" + (Screens.held(millis()) ? " (held)" : "") + " transitions: " + String(Screens.transitions()));
+  Log(" - Pixels pushed last frame: " + String(DisplayStats.pixelsLastFrame) + " max: " + String(DisplayStats.pixelsMaxFrame) + " total: " + String((uint32_t)(DisplayStats.pixelsTotal / 1000)) + "k");
+  const FrameBufferStatistics &fb = FrameBufferStats;
+  Log(" - Ring coverage tables: " + String(WidgetRingBytes()) + " bytes");
+  Log(" - Boot image draw time us: " + String(fb.imageUsLast));
+  for (uint8_t i = 0; i < FrameStateCount; i++) {
+    const FrameStateConfig &config = FrameStateConfigTable[i];
+    FrameStateStats stats = DisplayScheduler.stats(config.state, millis());
+    Log(" - " + String(config.name) + (DisplayScheduler.state() == config.state ? "*" : "") + " frames/min: " + String(stats.framesPerMinute()) + " (" + String(stats.frames) + " in " + String((uint32_t)(stats.timeMs / 1000)) + " s," +
+        " on change: " + String(stats.changeFrames) + ") change to model posted ms last/mean/max: " +
+        String(stats.latencyUsLast / 1000.0, 1) + "/" + String(stats.latencyUsMean() / 1000.0, 1) + "/" + String(stats.latencyUsMax / 1000.0, 1));
+  }
+  const RenderStatistics &render = RenderStats;
+  Log(" - Render task (core " + String(RENDER_TASK_CORE) + ") models: " + String(render.models) + " drawn: " + String(render.rendered) + " gauge tween frames: " + String(render.tweenFrames) + " skipped for newer: " + String(render.coalesced) +
+      " queue depth max: " + String(render.queueDepthMax) + "/" + String(RENDER_QUEUE_LENGTH) + " full: " + String(render.queueFull));
+  Log(" - Posted to drawn ms last: " + String(render.latencyUsLast / 1000.0, 1) + " max: " + String(render.latencyUsMax / 1000.0, 1) +
+      " render ms last: " + String(render.renderUsLast / 1000.0, 1) + " max: " + String(render.renderUsMax / 1000.0, 1));
+
+  // Utilisation since the last call, of the firmware's own tasks
+  static uint64_t lastUs = 0, lastLoop = 0, lastCan = 0, lastRender = 0;
+  uint64_t nowUs = esp_timer_get_time();
+  float interval = (nowUs - lastUs) / 100.0; // -> percent
+  float loopLoad = (LoopLoad.busyUs() - lastLoop) / interval, canLoad = (CanTaskLoad.busyUs() - lastCan) / interval, renderLoad = (RenderLoad.busyUs() - lastRender) / interval;
+  Log(" - Task load: CAN receive (core " + String(CAN_TASK_CORE) + ") " + String(canLoad, 1) + "% render (core " + String(RENDER_TASK_CORE) + ") " + String(renderLoad, 1) + "% loop (core " + String(ARDUINO_RUNNING_CORE) + ") " + String(loopLoad, 1) +
+      "% over " + String((uint32_t)((nowUs - lastUs) / 1000000)) + " s, WiFi/BT stacks not included");
+  lastUs = nowUs;
+  lastLoop = LoopLoad.busyUs();
+  lastCan = CanTaskLoad.busyUs();
+  lastRender = RenderLoad.busyUs();
+
+  const RoundClipStatistics &clip = DisplayClipStats;
+  Log(" - Round clipping " + String(DISPLAY_ROUND_CLIP ? "on" : "off") + ", clears/images: " + String(clip.count) + " last sent " + String(clip.lastSentBytes) + " of " + String(clip.lastSquareBytes) +
+      " bytes, saved total: " + String((uint32_t)((clip.squareBytes - clip.sentBytes) / 1024)) + " KB");
+  Log(" - Frame time us last: " + String(fb.drawUsLast) + " max: " + String(fb.drawUsMax) + " push last: " + String(fb.pushUsLast) + " max: " + String(fb.pushUsMax) + " DMA wait max: " + String(fb.syncUsMax));
+  if (fb.bpp) {
+    Log(" - Framebuffer " + String(fb.bpp) + " bpp: " + String(fb.bytes) + " bytes, heap free before: " + String(fb.heapFreeBefore) + " after: " + String(fb.heapFreeAfter) + " largest block: " + String(fb.heapLargestAfter));
+    Log(" - Rows sent last frame: " + String(fb.rowsLast) + " total: " + String((uint32_t)(fb.bytesPushed / 1024)) + " KB, outside the glass: " + String((uint32_t)(fb.bytesClipped / 1024)) + " KB");
+  }
+  else {
+    Log(" - Framebuffer off (DISPLAY_FRAMEBUFFER_BPP " + String(DISPLAY_FRAMEBUFFER_BPP) + "), free heap: " + String(fb.heapFreeAfter));
+  }
+}
+
+void DisplayPowerPrint() {
+  const PanelStatistics &panel = DisplayPanelStats;
+  static const char *modes[] = { "on", "asleep", "off" };
+  Log("Display power - state: " + String(DisplayPowerConfigTable[PanelPower.state()].name) + " panel: " + String(modes[panel.mode]) + " backlight: " +
+      (DISPLAY_BACKLIGHT_PIN >= 0 ? String(panel.brightness) + "/255" : String("no PWM pin")));
+  Log(" - Panel sleeps: " + String(panel.sleeps) + " wakes: " + String(panel.wakes) + " CAN frame to display on ms last: " + String(panel.wakeUsLast / 1000.0, 1) + " max: " + String(panel.wakeUsMax / 1000.0, 1));
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < PowerStateCount; i++) {
+    const DisplayPowerConfig &config = DisplayPowerConfigTable[i];
+    DisplayPowerStats stats = PanelPower.stats(config.state, millis());
+    total += stats.mAh(config.state);
+    Log(" - " + String(config.name) + (PanelPower.state() == config.state ? "*" : "") + " entered: " + String(stats.entries) + " time: " + String((uint32_t)(stats.timeMs / 1000)) + " s" +
+        " estimated: " + String(config.deviceMa) + " mA, " + String(stats.mAh(config.state)) + " mAh");
   }
+  Log(" - Estimated total: " + String(total) + " mAh since boot (no current sensor, see displaypower.h)");
+}
+
+// Render benchmark (DISPLAY_BENCHMARK, see renderbench.h): every screen in turn with new fake
+// values per frame. One model waits in the queue while the render task draws, so it never idles.
+void DisplayBenchStep(unsigned long currentMillis) {
+#if DISPLAY_BENCHMARK
+  static const Screen screens[] = { ScreenDrive, ScreenCharging, ScreenTripResult, ScreenChargeResult, ScreenSleeping, ScreenBTConnecting };
+  static const unsigned long indicatorColors[] = { TFT_DARKGREY, TFT_GREEN, TFT_YELLOW, COLOR_LIGHTRED };
+  static uint8_t current = 0;
+  static unsigned long started = 0;
+  if (started == 0 || currentMillis - started >= DISPLAY_BENCHMARK_SCREEN_MS) {
+    xSemaphoreTake(RenderLock, portMAX_DELAY);
+    if (started) {
+      DisplayBenchReport(screens[current], currentMillis);
+      current = (current + 1) % (sizeof(screens) / sizeof(screens[0]));
+    }
+    DisplayBench.reset(currentMillis);
+    xSemaphoreGive(RenderLock);
+    started = currentMillis;
+  }
+  if (uxQueueMessagesWaiting(RenderQueue)) { return; }
+
+  DebugFakeValues();
+  StatusIndicatorStatus = indicatorColors[random(0, 4)];
+  StatusIndicatorWIFI = indicatorColors[random(0, 4)];
+  StatusIndicatorBT = indicatorColors[random(0, 4)];
+  StatusIndicatorCAN = indicatorColors[random(0, 4)];
+  StatusIndicatorTx = indicatorColors[random(0, 4)];
+  SleepPhase = SleepPhase == SleepSending ? SleepAsleep : SleepSending;
+  PowerHistory.add(canValues.Current * canValues.Volt * -1, canValues.Speed); // a new chart column every frame
+  PowerHistory.sample(currentMillis);
+  BTConnectTimeout = random(0, 30000);
+  Screen screen = screens[current];
+  if (screen != ScreenDrive && screen != ScreenCharging) { Screens.invalidate(); } // static screens: entered every frame
+  Screens.show(screen, currentMillis);
+  DisplayPost();
+#endif
+}
+
+// Results of one screen, call with RenderLock taken
+void DisplayBenchReport(Screen screen, unsigned long currentMillis) {
+#if DISPLAY_BENCHMARK
+  const RenderBench &bench = DisplayBench;
+  const BenchCounter &frames = bench.frames();
+  float mhz = ESP.getCpuFreqMHz();
+  uint32_t fps = bench.fpsX10(currentMillis);
+  Log("Render benchmark " + String(ScreenConfigTable[screen].name) + " - frames: " + String(frames.count) + " fps: " + String(fps / 10) + "." + String(fps % 10) +
+      " framebuffer: " + String(FrameBufferStats.bpp) + " bpp, round clipping " + String(DISPLAY_ROUND_CLIP ? "on" : "off"));
+  Log(" - Frame us mean: " + String(frames.mean() / mhz, 0) + " max: " + String(frames.max / mhz, 0) +
+      " SPI bytes per frame mean: " + String(bench.spiBytes().mean()) + " max: " + String(bench.spiBytes().max) + (FrameBufferStats.bpp ? "" : " (direct drawing: widget estimate)"));
+  for (uint8_t i = 0; i < BenchSectionCount; i++) {
+    const BenchCounter &section = bench.section(BenchSectionTable[i].section);
+    if (section.count == 0 || frames.count == 0) { continue; }
+    Log(" - " + String(BenchSectionTable[i].name) + " us per frame: " + String(section.sum / frames.count / mhz, 1) + " max per draw: " + String(section.max / mhz, 1) +
+        " (" + String(frames.sum ? (uint32_t)(section.sum * 100 / frames.sum) : 0) + "%)");
+  }
+#endif
+}
+
+void CanTraceStart() {
+  if (CanTrace.active()) { Log("CAN trace already running"); return; }
+  CanTracePartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "cantrace");
+  if (CanTracePartition == NULL) {
+    Log("ERROR: CAN trace partition not found");
+    return;
+  }
+  esp_partition_erase_range(CanTracePartition, 0, CAN_TRACE_SECTOR); // header + first records
+  CanTraceErased = CAN_TRACE_SECTOR;
+  CanTraceLength = 0;
+  CanTrace.start();
+  Log("CAN trace started - partition size: " + String(CanTracePartition->size / 1024) + " KB", true);
+}
+
+void CanTraceStop() {
+  if (!CanTrace.active()) { return; }
+  CanTrace.stop();
+  CanTraceFlush(true);
+
+  CanTraceHeader header = { CAN_TRACE_MAGIC, CanTraceLength, CanTrace.records(), CanTrace.dropped() };
+  esp_partition_write(CanTracePartition, 0, &header, sizeof(header));
+  Log("CAN trace stopped - records: " + String(header.records) + " bytes: " + String(header.length) + " dropped: " + String(header.dropped), true);
+}
+
+void CanTraceFlush(bool all) {
+  // Moves records from the RAM ring to flash, erasing sectors just ahead of the write position
+  if (CanTracePartition == NULL) { return; }
+  if (!all && CanTrace.pending() < CAN_TRACE_FLUSH_BYTES) { return; }
+
+  uint8_t buffer[CAN_TRACE_FLUSH_BYTES];
+  size_t length;
+  while ((length = CanTrace.read(buffer, sizeof(buffer))) > 0) {
+    uint32_t address = sizeof(CanTraceHeader) + CanTraceLength;
+    if (address + length > CanTracePartition->size) {
+      Log("CAN trace partition full");
+      if (CanTrace.active()) { CanTraceStop(); }
+      return;
+    }
+    while (CanTraceErased < address + length) {
+      esp_partition_erase_range(CanTracePartition, CanTraceErased, CAN_TRACE_SECTOR);
+      CanTraceErased += CAN_TRACE_SECTOR;
+    }
+    esp_partition_write(CanTracePartition, address, buffer, length);
+    CanTraceLength += length;
+    if (!all) { break; }
+  }
+}
+
+void ConsoleCheckInput() {
+  static String serialLine;
+  static String telnetLine;
+  ConsoleReadLine(Serial, serialLine);
+  ConsoleReadLine(TelnetStream, telnetLine);
+}
+
+void ConsoleReadLine(Stream &stream, String &line) {
+  while (stream.available()) {
+    char c = stream.read();
+    if (c == '\n' || c == '\r') {
+      if (line.length() > 0) { ConsoleCommand(line); }
+      line = "";
+    }
+    else if (line.length() < 40) { line += c; }
+  }
+}
+
+void ConsoleCommand(String command) {
+  command.trim();
+  if (command == "stats") { CanStatsPrint(); }
+  else if (command == "stats reset") { CanStatsResetRequested = true; Log("CAN Statistics reset"); }
+  else if (command == "values") { SerialPrintValues(); }
+  else if (command == "display") { DisplayStatsPrint(); }
+  else if (command == "power") { DisplayPowerPrint(); }
+  else if (command == "display bench") {
+    xSemaphoreTake(RenderLock, portMAX_DELAY); // the render task is between frames
+    DisplayBenchmark();
+    Screens.invalidate(); // drawn over, the next frame enters the screen again
+    xSemaphoreGive(RenderLock);
+  }
+  else if (command == "sniff start") { CanSnifferStart(true); }
+  else if (command == "sniff stop") { CanSnifferStart(false); }
+  else if (command == "sniff") { CanSnifferPrint(); }
+  else if (command == "trace start") { CanTraceStart(); }
+  else if (command == "trace stop") { CanTraceStop(); }
+  else if (command == "trace") { Log("CAN trace " + String(CanTrace.active() ? "running" : "stopped") + " - records: " + String(CanTrace.records()) + " bytes: " + String(CanTraceLength) + " dropped: " + String(CanTrace.dropped())); }
+  else { Log("Unknown command: " + command + " - Commands: stats, stats reset, values, display, power, display bench, sniff, sniff start, sniff stop, trace, trace start, trace stop"); }
 }
 
 bool WIFIConnect(){
@@ -774,326 +982,117 @@ void WIFIDisconnect(){
   StatusIndicatorWIFI = TFT_DARKGREY;
 }
 
-void DisplayBoot() {
-  tft.setSwapBytes(true);
-  tft.pushImage(0, 0, img1_width, img1_height, img1);
-  delay(500);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(3);
-  tft.drawCentreString("Topolino",120, 32, 1);
-  tft.setTextColor(TFT_BLACK, COLOR_TOPOLINO, true);
-  delay(500);
-  tft.drawString("Info",40,100);
-  delay(500);
-  tft.drawString("Display",70,130);
-  delay(500);
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_ALMOSTBLACK);
-  tft.drawCentreString("Version: " + String(VERSION), 120, 185, 1);
-  #ifdef DEBUG
-    tft.drawCentreString("DEBUG", 120, 220, 1);
-  #endif
+// Switches to screen: the render task clears it once and draws what doesn't change. Returns
+// false if it is shown already.
+bool DisplayScreen(Screen screen) {
+  if (!Screens.show(screen, millis())) { return false; }
+  DisplayScheduler.invalidate(micros());
+  DisplayPost();
+  return true;
 }
 
-void DisplayMainUI() {
-  int valuecolor;
-  
-  //Consumption Background
-  //tft.drawSmoothArc(120,120, 121, 105, 150, 240, COLOR_BG_RED, COLOR_BACKGROUND, true);
-  //tft.drawSmoothArc(120,120, 121, 105, 120, 150, COLOR_BG_GREEN, COLOR_BACKGROUND, true);
-  tft.drawSmoothArc(120, 120, 121, 105, 120, 240, TFT_DARKGREY, COLOR_BACKGROUND, true);
-
-  //Consumption Arc
-  if (canValues.Current < -2) {
-    //Consumption negative = driving
-    int arcLenght = map(canValues.Current, -150, 0, 240, 150);
-    if (arcLenght > 240) {arcLenght = 240;}
-    if (arcLenght < 151) {arcLenght = 151;}
-    if (canValues.Current < -75) {valuecolor = COLOR_LIGHTRED;} else {valuecolor = TFT_YELLOW;}
-    tft.drawSmoothArc(120,120, 120, 105, 150, arcLenght, valuecolor, COLOR_BACKGROUND, true);
-  }
-  else if (canValues.Current >02) {
-    //Consumption positive  = charging
-    int arcLenght = map(canValues.Current, 0, 75, 0, 30);
-    if (arcLenght > 30) {arcLenght = 30;}
-    if (arcLenght < 1) {arcLenght = 1;}
-    tft.drawSmoothArc(120,120, 120, 105, 150 - arcLenght, 150, TFT_GREEN, COLOR_BACKGROUND, true);
-  }
-  else {
-    // No Consumption (Dead zone 0 bis -2)
-    tft.drawSpot(61, 24, 6, COLOR_TOPOLINO, COLOR_BACKGROUND);
-  }
-  
-  // Consumption value  
-  tft.setTextColor(TFT_WHITE, COLOR_ALMOSTBLACK, true);
-  tft.setTextSize(3);
-  String consumptionString;
-  float currentConsumption = 0;
-  if (ShowConsumptionAsKW) {
-    currentConsumption = (float)(canValues.Current * canValues.Volt / 1000) * -1;         // -#.##
-    consumptionString = String(currentConsumption, 2) + " kW";
-  }
-  else {
-    currentConsumption = canValues.Current * -1;
-    consumptionString = String(currentConsumption, 1) + " A";
-  }
-  tft.fillSmoothRoundRect(40, 65, 160, 60, 10, COLOR_ALMOSTBLACK, COLOR_BACKGROUND); // Reset backgroubnd
-  tft.drawRightString(consumptionString, 185, 85, 1);
-
-  // Battery Temperature
-  float tempAverage = (canValues.Temp1 + canValues.Temp2) / 2.0;
-  int arcLenght = map(tempAverage, -10, 50, 45, 90);
-  if (arcLenght < 46) { arcLenght = 46;}
-  if (arcLenght > 90) { arcLenght = 90;}
-  if (tempAverage > 40) { valuecolor = COLOR_LIGHTRED; }
-  else if (tempAverage > 25) { valuecolor = TFT_ORANGE; }
-  else if (tempAverage < 5) { valuecolor = TFT_BLUE; }
-  else if (tempAverage < 10) { valuecolor = TFT_CYAN; }
-  else if (tempAverage < 20) { valuecolor = TFT_YELLOW; }
-  else { valuecolor = 0x2520; }
-  tft.setTextSize(1);
-  tft.setTextColor(COLOR_GREY);
-  tft.drawSmoothArc(120,120, 121, 110, 45, 90, COLOR_GREY, COLOR_BACKGROUND,true);
-  tft.drawSmoothArc(120,120, 121, 110, 45, arcLenght, valuecolor, COLOR_BACKGROUND, true);
-  tft.fillRect(24, 142, 45, 20, COLOR_BACKGROUND); // Reset background
-  tft.drawString(String(tempAverage,1)+ "C", 25, 143, 2); 
-
-  // Right Arc (12V Battery or Trip avg Consumption)
-  String rightArcString;
-  if ( TripActive ) {
-    // consumption per 100km
-    rightArcString = String(avgkWh, 1) + "kW";
-    arcLenght = map(avgkWh, 6, 15, 0, 45);
-    if ( avgkWh > 13) { valuecolor = COLOR_LIGHTRED; }
-    else if ( avgkWh > 11) { valuecolor = TFT_ORANGE; }
-    else if ( avgkWh > 9) { valuecolor = TFT_YELLOW; }
-    else if ( avgkWh < 7.5) { valuecolor = TFT_CYAN; }
-    else { valuecolor = 0x2520; }
-  }
-  else {
-  // 12Volt Battery
-    rightArcString = String(canValues.Battery, 1) + "V";
-    arcLenght = map(canValues.Battery, 11.5, 14.5, 0, 45); 
-    if (canValues.Battery < 11.5) { valuecolor = COLOR_LIGHTRED; }
-    else if (canValues.Battery < 12.0) { valuecolor = TFT_YELLOW; }
-    else { valuecolor = 0x2520; }
-  }
-  if (arcLenght < 1) {arcLenght = 1;}
-  if (arcLenght > 45) {arcLenght = 45;}
-  tft.setTextSize(1);
-  tft.setTextColor(COLOR_GREY);
-  tft.drawSmoothArc(120,120, 121, 110, 270, 315, COLOR_GREY, COLOR_BACKGROUND, true); // reset
-  tft.drawSmoothArc(120,120, 121, 110, 315 - arcLenght, 315, valuecolor, COLOR_BACKGROUND, true); // value
-  tft.fillRect(172, 142, 50, 18, COLOR_BACKGROUND); //Reset text background
-  tft.drawRightString(rightArcString, 220, 143, 2); 
-
-  //Akku Voltage
-  tft.fillSmoothRoundRect(85, 130, 70, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
-  tft.setTextSize(2);
-  if (canValues.Volt < 51.2 || canValues.Volt > 58) { tft.setTextColor(TFT_ORANGE); } 
-  else {tft.setTextColor(TFT_WHITE);}
-  tft.drawCentreString(String(canValues.Volt, 1) + "V", 120, 143, 1);
-
-  // SoC
-  tft.setTextSize(2);
-  if (canValues.SoC < 15) { tft.setTextColor(COLOR_LIGHTRED); }
-  else if (canValues.SoC < 30) { tft.setTextColor(TFT_YELLOW); }
-  else if (canValues.SoC > 90) { tft.setTextColor(TFT_DARKCYAN); }
-  else { tft.setTextColor(COLOR_GREY); }
-  tft.fillRect(90, 39, 70, 20, COLOR_BACKGROUND); // Reset text background
-  tft.drawCentreString(String(canValues.SoC) + "%", 120, 40, 1);
-
-  // Status Indicator
-  tft.fillRoundRect(63, 188, 55, 20, 8, StatusIndicatorStatus);
-  tft.setTextColor(COLOR_ALMOSTBLACK);
-  tft.setTextSize(1);
-  tft.drawString("Status", 73, 195);
-
-  // WIFI Indicator
-  tft.drawRoundRect(122, 188, 55, 20, 8, COLOR_ALMOSTBLACK);
-  tft.setTextColor(StatusIndicatorWIFI); 
-  tft.setTextSize(1);
-  tft.drawString("WIFI", 139, 195);
-
-  // BT Indicator
-  if (StatusIndicatorBT == TFT_YELLOW) {
-    tft.setTextColor(TFT_BLACK);
-    tft.fillRoundRect(76, 213, 25, 20, 8, TFT_YELLOW);
-  }
-  else {
-    tft.setTextColor(StatusIndicatorBT);
-    tft.fillRoundRect(76, 213, 25, 20, 8, COLOR_BACKGROUND);
-    tft.drawRoundRect(76, 213, 25, 20, 8, COLOR_ALMOSTBLACK);
-  }
-  tft.setTextSize(1);
-  tft.drawString("BT", 83, 219);
-
-  // CAN Indicator
-  tft.drawRoundRect(105, 213, 30, 20, 8, COLOR_ALMOSTBLACK);
-  tft.setTextColor(StatusIndicatorCAN);
-  tft.setTextSize(1);
-  tft.drawString("CAN", 111, 219);
-
-  // Tx Indicator
-  tft.drawRoundRect(139, 213, 25, 20, 8, COLOR_ALMOSTBLACK);
-  tft.setTextColor(StatusIndicatorTx);
-  tft.setTextSize(1);
-  tft.drawString("Tx", 146, 219);
-
+// Posts a view model of the current screen to the render task. If the queue is full the
+// oldest model is dropped, the render task only draws the newest one anyway.
+void DisplayPost() {
+  DisplayModel m;
+  m.screen = Screens.current();
+  m.screenEntry = Screens.entries();
+  m.timeMs = millis();
+  m.values = VehicleSnapshot();
+  m.tripActive = TripActive;
+  m.avgkWh = avgkWh;
+  m.history = PowerHistory.last();
+  m.historySamples = PowerHistory.count();
 #ifdef DEBUG
-  // Debug
-  //Gear (for testing)
-  /*
-  tft.setTextColor(COLOR_ALMOSTBLACK, COLOR_BACKGROUND, true);
-  tft.setTextSize(2);
-  tft.drawString(canValues.Gear, 210, 90);
-  */
-
-  // Saved trips counter (for testing)
-  tft.setTextColor(COLOR_ALMOSTBLACK, COLOR_BACKGROUND, true);
-  tft.setTextSize(2);
-  int savedTrips = 0;
-  if (thisTrip.toSend) { savedTrips++; }
-  if (lastTrip1.toSend) { savedTrips++; }
-  if (lastTrip2.toSend) { savedTrips++; }
-  if (lastTrip3.toSend) { savedTrips++; } 
-  if (lastTrip4.toSend) { savedTrips++; }
-  if (lastTrip5.toSend) { savedTrips++; }
-  tft.drawString(String(savedTrips) + "T", 210, 90);
+  m.savedTrips = thisTrip.toSend + lastTrip1.toSend + lastTrip2.toSend + lastTrip3.toSend + lastTrip4.toSend + lastTrip5.toSend;
 #endif
-  
+  m.statusColor = StatusIndicatorStatus;
+  m.wifiColor = StatusIndicatorWIFI;
+  m.btColor = StatusIndicatorBT;
+  m.canColor = StatusIndicatorCAN;
+  m.txColor = StatusIndicatorTx;
+  m.lastTrip = thisTrip;
+  m.charge = thisCharge;
+  m.sleepPhase = SleepPhase;
+  m.btTimeout = BTConnectTimeout;
+  m.power = PanelPower.state();
+  m.wakeUs = PanelWakeUs;
+  m.postedUs = micros();
+  RenderStats.models++;
+  if (xQueueSend(RenderQueue, &m, 0) != pdTRUE) {
+    DisplayModel oldest;
+    xQueueReceive(RenderQueue, &oldest, 0);
+    xQueueSend(RenderQueue, &m, 0);
+    RenderStats.queueFull++;
+  }
 }
 
-void DisplayTripResults() {
-  float drivenKM = (thisTrip.endKM - thisTrip.startKM) / 10;
-  int drivenMin = (thisTrip.endTime - thisTrip.startTime) / 1000 / 60;
-  int drivenSoC = thisTrip.startSoC - thisTrip.endSoC;
-
-  tft.fillScreen(COLOR_BACKGROUND);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(2);
-  tft.drawString("Diese Fahrt:",50, 23, 2);
-  int positionX = 25;
-  int positionY = 55;
-  // Dauer: Min / KM
-  tft.fillSmoothRoundRect(positionX, positionY, 190, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(1);
-  tft.drawString("Dauer", positionX +10 , positionY +2, 2);
-  tft.setTextColor(TFT_WHITE);
-  tft.setTextSize(2);
-  if (drivenMin >= 10) {
-    tft.drawString(String(drivenMin) + " Min | " + String(drivenKM, 1) + "km", positionX +10, positionY +19);
-  }
-  else {
-    tft.drawString(" " + String(drivenMin) + " Min | " + String(drivenKM, 1) + "km", positionX +10, positionY +19);
-  }
-  // Geschiwndigkeit: Durchschnitt / Max
-  positionY += 43;
-  tft.fillSmoothRoundRect(positionX, positionY, 190, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(1);
-  tft.drawString("km/h", positionX +10 , positionY +1, 2);
-  tft.setTextColor(TFT_WHITE);
-  tft.setTextSize(2);
-  tft.drawString(String((drivenKM / drivenMin) * 60, 1) + "   | " + String(thisTrip.maxSpeed), positionX +10, positionY +19);
-  tft.drawSmoothCircle(positionX +75, positionY +25, 7, TFT_WHITE, COLOR_BACKGROUND);
-  tft.drawLine(positionX +67, positionY +32, positionX +83, positionY +18, TFT_WHITE);
-  tft.fillTriangle(positionX +155, positionY +33, positionX +175, positionY +33, positionX +175, positionY +22, TFT_WHITE);
-  // Energieverbrauch: Gesammt / je 100 km
-  positionY += 43;
-  tft.fillSmoothRoundRect(positionX, positionY, 190, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(1);
-  tft.drawString("kWh", positionX +10 , positionY +0, 2);
-  tft.setTextColor(TFT_WHITE);
-  tft.setTextSize(2);
-  tft.drawString("  " + String(drivenSoC * 0.06, 1) + "  | " + String((drivenSoC * 0.06) / drivenKM * 100,1), positionX +10, positionY +19);
-  tft.drawSmoothCircle(positionX +175, positionY +25, 7, TFT_WHITE, COLOR_BACKGROUND);
-  tft.drawLine(positionX +167, positionY +33, positionX +183, positionY +18, TFT_WHITE);
-  // Akkuverbrauch
-  positionY += 43;
-  tft.fillSmoothRoundRect(60, positionY, 120, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.drawString("Akku:", 67, positionY +13);
-  tft.setTextColor(TFT_WHITE);
-  tft.drawString(String(drivenSoC * -1) + "%", 127, positionY +13);
+void DisplayRenderTask(void *parameter) {
+  // Draws the newest view model, see displaymodel.h. While a gauge glides (tween.h) the last
+  // model is drawn again every DISPLAY_TWEEN_FRAME_MS until a new one arrives.
+  // RenderLock is kept while the framebuffer's DMA transfer runs: if the next model is already
+  // waiting it is drawn right away (DisplayFrameBegin() waits for the transfer), otherwise the
+  // transfer is finished here before the lock is given. Only loop() takes the lock, and it also
+  // posts the models, so the queue runs empty as soon as it waits for the lock.
+  DisplayModel m;
+  for (;;) {
+    bool locked = FrameBufferBusy();
+    RenderLoad.end(micros());
+    bool received = xQueueReceive(RenderQueue, &m, locked ? 0 : DisplayAnimating() ? pdMS_TO_TICKS(DISPLAY_TWEEN_FRAME_MS) : portMAX_DELAY) == pdTRUE;
+    RenderLoad.begin(micros());
+    if (locked && !received) {
+      FrameBufferSync(tft); // no SPI transaction may stay open across the lock (console benchmark)
+      xSemaphoreGive(RenderLock);
+      continue;
+    }
+    if (received) {
+      uint32_t depth = uxQueueMessagesWaiting(RenderQueue) + 1;
+      if (depth > RenderStats.queueDepthMax) { RenderStats.queueDepthMax = depth; }
+      while (xQueueReceive(RenderQueue, &m, 0) == pdTRUE) { RenderStats.coalesced++; }
+    }
+    else {
+      RenderStats.tweenFrames++;
+    }
 
+    if (!locked) { xSemaphoreTake(RenderLock, portMAX_DELAY); }
+    uint32_t start = micros();
+    uint32_t allocations = AllocationCount;
+    DisplayRender(m);
+    DisplayStats.allocationsLast = AllocationCount - allocations;
+    DisplayStats.allocationsTotal += DisplayStats.allocationsLast;
+    if (DisplayStats.allocationsLast) { DisplayStats.framesAllocating++; }
+    uint32_t now = micros();
+    if (!FrameBufferBusy()) { xSemaphoreGive(RenderLock); }
+
+    RenderStats.rendered++;
+    RenderStats.renderUsLast = now - start;
+    if (RenderStats.renderUsLast > RenderStats.renderUsMax) { RenderStats.renderUsMax = RenderStats.renderUsLast; }
+    if (!received) { continue; }
+    RenderStats.latencyUsLast = now - m.postedUs;
+    if (RenderStats.latencyUsLast > RenderStats.latencyUsMax) { RenderStats.latencyUsMax = RenderStats.latencyUsLast; }
   }
+}
 
-void DisplayCharging() {
-  tft.setTextColor(COLOR_TOPOLINO, COLOR_BACKGROUND, true);
-  tft.setTextSize(2);
-  tft.drawString("Ladevorgang:", 42, 50, 2);
-  // Ladestrom
-  String chargingString;
-  float currentcharge = 0;
-  if (ShowChargeAsKW) {
-    currentcharge = (float)(canValues.Current * canValues.Volt / 1000) * -1;         // -#.##
-    chargingString = String(currentcharge, 2) + " kW";
-  }
-  else {
-    currentcharge = canValues.Current * -1;
-    chargingString = String(currentcharge, 1) + " A";
-  }
-  tft.setTextSize(3);
-  tft.drawString(chargingString, 70, 90);
-  // SoC
-  tft.setTextSize(4);
-  tft.setTextColor(TFT_WHITE, COLOR_BACKGROUND, true);
-  tft.drawString(String(canValues.SoC) + "%", 140, 125);
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_GREY, COLOR_BACKGROUND, true);
-  tft.drawString(String(thisCharge.startSoC) + "% >", 30, 130);  
-  // Ladedauer
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_TOPOLINO, COLOR_BACKGROUND, true);
-  tft.drawString(String((millis() - thisCharge.startTime) / 1000 / 60) + " Min.", 60, 165);
-  
-  // Temperatur Akku
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_GREY, COLOR_BACKGROUND, true);
-  tft.drawString(String((float)(canValues.Temp1 + canValues.Temp2) / 2, 1) + " C", 90, 200);
-
-  // Animation
-  tft.drawSmoothArc(120, 120, 121, 105, 0, 360, COLOR_BACKGROUND, COLOR_BACKGROUND);
-  int arcLenght = 45;
-  if (thisCharge.helperCircal > 360) {thisCharge.helperCircal = 0;}
-  int arcStart = thisCharge.helperCircal;
-  int arcEnd = arcStart + arcLenght;
-  if (arcEnd > 360) {arcEnd = arcEnd - 360;}
-  tft.drawSmoothArc(120, 120, 121, 105, arcStart, arcEnd, COLOR_TOPOLINO, COLOR_BACKGROUND, true);
-  thisCharge.helperCircal += 5;
+FrameState DisplayFrameState() {
+  if (IsCharging) { return FrameStateCharging; }
+  if (canValues.Ready != 1) { return FrameStateParked; }
+  return canValues.Speed >= 1 ? FrameStateDriving : FrameStateReady;
 }
 
-void DisplayChargingResult() {
-  tft.fillScreen(COLOR_BACKGROUND);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(2);
-  tft.drawString("Ladevorgang:", 42, 50, 2);
-  // Lademenge
-  tft.setTextSize(3);
-  tft.drawString(String((thisCharge.endSoC - thisCharge.startSoC) * 0.06, 1) + " kWh", 70, 90);
-  // SoC
-  tft.setTextSize(4);
-  tft.setTextColor(TFT_WHITE);
-  tft.drawString(String(thisCharge.endSoC) + "%", 140, 125);
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_GREY);
-  tft.drawString(String(thisCharge.startSoC) + "% >", 30, 130);  
-  // Ladedauer
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.drawString(String((thisCharge.endTime - thisCharge.startTime) / 1000 / 60) + " Min.", 60, 165);
-  // Temperatur Akku
-  tft.setTextSize(2);
-  tft.setTextColor(COLOR_GREY, COLOR_BACKGROUND, true);
-  tft.drawString(String((float)(canValues.Temp1 + canValues.Temp2) / 2, 1) + " C", 90, 200);
-
-
-  // Charge
-  tft.drawSmoothArc(120, 120, 121, 105, 0, map(thisCharge.endSoC, 0, 100, 1, 360), COLOR_TOPOLINO, COLOR_BACKGROUND, true);
+// Panel power by vehicle state, see displaypower.h
+DisplayPowerState DisplayPowerStateNow() {
+  if (IsSleeping) { return SleepPhase == SleepAsleep ? PowerSleeping : PowerParked; }
+  if (IsCharging) { return PowerCharging; }
+  return canValues.Ready == 1 ? PowerDriving : PowerParked;
+}
+
+// Indicator colors are set all over the place - compared once per loop instead
+bool DisplayIndicatorsChanged() {
+  static unsigned long shown[5] = { 0 };
+  const unsigned long current[5] = { StatusIndicatorStatus, StatusIndicatorWIFI, StatusIndicatorBT, StatusIndicatorCAN, StatusIndicatorTx };
+  if (memcmp(shown, current, sizeof(current)) == 0) { return false; }
+  memcpy(shown, current, sizeof(current));
+  return true;
 }
 
 void ConnectWIFIAndSendData() {
@@ -1119,6 +1118,16 @@ void ConnectWIFIAndSendData() {
   }
 }
 
+String SimpleAPIValue(const CANValues &v, CanSignal signal) {
+  switch (signal) {
+    case SignalODO: return String(v.ODO / 10);
+    case SignalGear: return String(GearNames[v.Gear]);
+    case SignalRemainingDistance: return String(v.SoC * 0.75);
+    case SignalVolt: case SignalBattery: case SignalCurrent: return String(Signals.value(signal));
+    default: return String((int)Signals.value(signal));
+  }
+}
+
 bool SendDataSimpleAPI() {
   Log("Send Data via REST");
   StatusIndicatorTx = TFT_BLUE;
@@ -1128,19 +1137,11 @@ bool SendDataSimpleAPI() {
   String URL = "http://" + String(YourSimpleAPI_IP) + ":" + String(YourSimpleAPI_Port) + "/setBulk?user=" + String(YourSimpleAPI_User) + "&pass=" + YourSimpleAPI_Password;
 
   String DataURLEncoded = "";
-  if (canValues.SoCUp) {DataURLEncoded += "&0_userdata.0.topolino.SoC=" + String(canValues.SoC); }
-  if (canValues.BatteryUp) {DataURLEncoded += "&0_userdata.0.topolino.12VBatt=" + String(canValues.Battery); }
-  if (canValues.CurrentUp) { DataURLEncoded += "&0_userdata.0.topolino.BattA=" + String(canValues.Current); }
-  if (canValues.Temp1Up) { DataURLEncoded += "&0_userdata.0.topolino.BattTemp1=" + String(canValues.Temp1); }
-  if (canValues.Temp2Up) { DataURLEncoded += "&0_userdata.0.topolino.BattTemp2=" + String(canValues.Temp2); }
-  if (canValues.VoltUp) { DataURLEncoded += "&0_userdata.0.topolino.BattV=" + String(canValues.Volt); }
-  if (canValues.HandbrakeUp) { DataURLEncoded += "&0_userdata.0.topolino.Handbreake=" + String(canValues.Handbrake); }
-  if (canValues.ODOUp) { DataURLEncoded += "&0_userdata.0.topolino.ODO=" + String(canValues.ODO / 10); }
-  if (canValues.OBCRemainingMinutesUp) { DataURLEncoded += "&0_userdata.0.topolino.OnBoardChargerRemaining=" + String(canValues.OBCRemainingMinutes); }
-  if (canValues.ReadyUp) { DataURLEncoded += "&0_userdata.0.topolino.Ready=" + String(canValues.Ready); }
-  if (canValues.RemainingDistanceUp) { DataURLEncoded += "&0_userdata.0.topolino.RemainingKM=" + String(canValues.SoC * 0.75); }
-  if (canValues.GearUp) { DataURLEncoded += "&0_userdata.0.topolino.gear=" + String(canValues.Gear); }
-  if (canValues.SpeedUp) { DataURLEncoded += "&0_userdata.0.topolino.speed=" + String(canValues.Speed); }
+  const CANValues v = VehicleSnapshot();
+  uint32_t sent = Signals.dirty();
+  Signals.forEachDirty([&](CanSignal signal) {
+    DataURLEncoded += "&0_userdata.0.topolino." + String(SimpleAPIStates[signal]) + "=" + SimpleAPIValue(v, signal);
+  });
   
   if (DataURLEncoded == "") {
     Log("No new can data to send", true);
@@ -1160,19 +1161,7 @@ bool SendDataSimpleAPI() {
   if (httpResponseCode >= 200 && httpResponseCode <= 299) {
     StatusIndicatorTx = TFT_GREEN;
 
-    canValues.SoCUp = false;
-    canValues.BatteryUp = false;
-    canValues.CurrentUp = false;
-    canValues.Temp1Up = false;
-    canValues.Temp2Up = false;
-    canValues.VoltUp = false;
-    canValues.HandbrakeUp = false;
-    canValues.ODOUp = false;
-    canValues.OBCRemainingMinutesUp = false;
-    canValues.ReadyUp = false;
-    canValues.RemainingDistanceUp = false;
-    canValues.GearUp = false;
-    canValues.SpeedUp = false;
+    Signals.clear(sent);
 
     http.end();
     Log("SendDataSimpleAPI OK", true);
@@ -1212,7 +1201,7 @@ bool SendChargeInfoSimpleAPI() {
   String URL = "http://" + String(YourSimpleAPI_IP) + ":" + String(YourSimpleAPI_Port) + "/setBulk?user=" + String(YourSimpleAPI_User) + "&pass=" + YourSimpleAPI_Password;
   String DataURLEncoded = "";
   DataURLEncoded += "&0_userdata.0.topolino.charge.dauer=" + String((thisCharge.endTime - thisCharge.startTime) / 1000 / 60);
-  DataURLEncoded += "&0_userdata.0.topolino.charge.ladung=" + String((thisCharge.endSoC - thisCharge.startSoC) * 0.06, 1);
+  DataURLEncoded += "&0_userdata.0.topolino.charge.ladung=" + String(thisCharge.chargedWh / 1000.0, 1);
   DataURLEncoded += "&0_userdata.0.topolino.charge.startSoC=" + String(thisCharge.startSoC);
   DataURLEncoded += "&0_userdata.0.topolino.charge.endSoC=" + String(thisCharge.endSoC);
   DataURLEncoded += "&ack=true";
@@ -1242,16 +1231,17 @@ bool SendTripInfosSimpleAPI(trip tripToSend) {
 
   float drivenKM = (tripToSend.endKM - tripToSend.startKM) / 10;
   int drivenMin = (tripToSend.endTime - tripToSend.startTime) / 1000 / 60;
-  int drivenSoC = tripToSend.startSoC - tripToSend.endSoC;
+  float drivenKWh = (tripToSend.consumedWh - tripToSend.recuperatedWh) / 1000.0;
   // SimpleAPI set values bulk
   String URL = "http://" + String(YourSimpleAPI_IP) + ":" + String(YourSimpleAPI_Port) + "/setBulk?user=" + String(YourSimpleAPI_User) + "&pass=" + YourSimpleAPI_Password;
   String DataURLEncoded = "";
-  DataURLEncoded += "&0_userdata.0.topolino.trip.consumption=" + String((float)((tripToSend.endSoC - tripToSend.startSoC) * 0.06) * -1, 1);
+  DataURLEncoded += "&0_userdata.0.topolino.trip.consumption=" + String(drivenKWh, 1);
+  DataURLEncoded += "&0_userdata.0.topolino.trip.recuperation=" + String(tripToSend.recuperatedWh / 1000.0, 1);
   DataURLEncoded += "&0_userdata.0.topolino.trip.dauer=" + String((tripToSend.endTime - tripToSend.startTime) / 1000 / 60);
   DataURLEncoded += "&0_userdata.0.topolino.trip.km=" + String((tripToSend.endKM - tripToSend.startKM) / 10, 1);
   DataURLEncoded += "&0_userdata.0.topolino.trip.maxSpeed=" + String(tripToSend.maxSpeed);
   DataURLEncoded += "&0_userdata.0.topolino.trip.SpeedAvg=" + String((drivenKM / drivenMin) * 60, 1);
-  DataURLEncoded += "&0_userdata.0.topolino.trip.consumptionAvg=" + String((drivenSoC * 0.06) / drivenKM * 100,1);
+  DataURLEncoded += "&0_userdata.0.topolino.trip.consumptionAvg=" + String(drivenKWh / drivenKM * 100,1);
   DataURLEncoded += "&ack=true";
 
   Log(" URL: " + String(URL) + String(DataURLEncoded)); 
@@ -1274,43 +1264,44 @@ bool SendTripInfosSimpleAPI(trip tripToSend) {
 }
 
 void SerialPrintValues() {
+  const CANValues v = VehicleSnapshot();
   Log("Topolino Info Display - Values");
   Log("Can Messages Processed: " + String(CanMessagesProcessed));
-  Log(" - ECU ODO: " + String(canValues.ODO / 10) + " km");
-  Log(" - ECU Speed: " + String(canValues.Speed) + " km/h");
-  Log(" - OBC Remaining Time: " + String(canValues.OBCRemainingMinutes) + " minutes");
-  Log(" - 12V Battery: " + String(canValues.Battery) + " V");
-  Log(" - Battery Temp1: " + String(canValues.Temp1) + " °C");
-  Log(" - Battery Temp2: " + String(canValues.Temp2) + " °C");
-  Log(" - Battery Volt: " + String(canValues.Volt) + " V");
-  Log(" - Battery Current: " + String(canValues.Current) + " A");
-  Log(" - Battery SoC: " + String(canValues.SoC) + " %");
-  Log(" - Display Gear: " + String(canValues.Gear) );
-  Log(" - Display Remaining Distance: " + String(canValues.RemainingDistance) + " km");
-  Log(" - Display Ready: " + String(canValues.Ready) + " (1=Ready, 0=Not Ready, -1=Unknown)");
-  Log(" - Status Handreake: " + String(canValues.Handbrake) + " (1=On, 0=Off, -1=Unknown)");
+  Log("CAN Frames wrong length: " + String(CanFramesBadLength) + " discarded: " + String(CanFramesDiscarded));
+  Log("CAN Ring: " + String(CanRing.count()) + "/" + String(CanRing.size()) + " High water: " + String(CanRing.highWater()) + " Overflows: " + String(CanRing.overflowCount()));
+  Log(" - ECU ODO: " + String(v.ODO / 10) + " km");
+  Log(" - ECU Speed: " + String(v.Speed) + " km/h");
+  Log(" - OBC Remaining Time: " + String(v.OBCRemainingMinutes) + " minutes");
+  Log(" - 12V Battery: " + String(v.Battery) + " V");
+  Log(" - Battery Temp1: " + String(v.Temp1) + " °C");
+  Log(" - Battery Temp2: " + String(v.Temp2) + " °C");
+  Log(" - Battery Volt: " + String(v.Volt) + " V");
+  Log(" - Battery Current: " + String(v.Current) + " A");
+  Log(" - Battery SoC: " + String(v.SoC) + " %");
+  Log(" - Display Gear: " + String(GearNames[v.Gear]) );
+  Log(" - Display Remaining Distance: " + String(v.RemainingDistance) + " km");
+  Log(" - Display Ready: " + String(v.Ready) + " (1=Ready, 0=Not Ready, -1=Unknown)");
+  Log(" - Status Handreake: " + String(v.Handbrake) + " (1=On, 0=Off, -1=Unknown)");
+  Log(" - Battery Power: " + String(Energy.powerW()) + " W - consumed: " + String(Energy.total.consumedWh()) + " Wh recuperated/charged: " + String(Energy.total.recuperatedWh()) + " Wh (samples: " + String(Energy.samples()) + " gaps: " + String(Energy.gaps()) + ")");
+  Log(" - Trip: consumed " + String(Energy.trip.consumedWh()) + " Wh recuperated " + String(Energy.trip.recuperatedWh()) + " Wh - Charge: " + String(Energy.charge.recuperatedWh()) + " Wh");
+  Log(" - Not sent: " + SignalNames(Signals.dirty()));
+  Log(" - Stale: " + SignalNames(Signals.staleMask(millis())));
+  Log(" - Snapshot version: " + String(VehicleState.version()) + " reader retries: " + String(VehicleState.retries()));
+  for (int i = 0; i < SignalCount; i++) {
+    CanSignal signal = (CanSignal)i;
+    if (!(Signals.seen() & CanSignalBit(signal))) { continue; }
+    Log(" - " + String(SignalConfigTable[i].name) + " age: " + String(millis() - Signals.lastUpdate(signal)) + " ms");
+  }
   Log("=============================");
 }
 
-void TripRecording() {
-  if ( thisTrip.maxSpeed < canValues.Speed) { thisTrip.maxSpeed = canValues.Speed; }
-  if (thisTrip.startTime == 0) {
-    thisTrip.startTime = millis();
-    thisTrip.startKM = canValues.ODO;
-  }
-  thisTrip.endTime = millis();
-  thisTrip.endKM = canValues.ODO;  
-  if (thisTrip.endSoC == 0 || thisTrip.endSoC > canValues.SoC) { thisTrip.endSoC = canValues.SoC; }
-
-  if (SoCchangeDetection != thisTrip.endSoC) {
-    SoCchangeDetection = thisTrip.endSoC;
-    float drivenKM = (thisTrip.endKM - thisTrip.startKM) / 10;
-    if (drivenKM < 0.1) { drivenKM = 0.1; } // avoid division by zero
-    int drivenSoC = thisTrip.startSoC - thisTrip.endSoC;
-    if (drivenSoC < 1) { drivenSoC = 1; } // avoid division by zero
-    avgkWh = (drivenSoC * 0.06) / drivenKM * 100;
-    Log("New average Consumption calculated: " + String(avgkWh, 1) + " kWh/100km");
+String SignalNames(uint32_t mask) {
+  String names = "";
+  for (uint32_t m = mask; m; m &= m - 1) {
+    if (names != "") { names += ", "; }
+    names += SignalConfigTable[__builtin_ctz(m)].name;
   }
+  return names == "" ? String("-") : names;
 }
 
 void SleepLightStart() {
@@ -1324,64 +1315,20 @@ void SleepLightStart() {
   // Disable revers light
   BTSetRelais(1, false);
 
+  SleepPhase = SleepSending;
+  DisplayScreen(ScreenSleeping);
+
   int i = 0;
   do {
     i++;
     WIFIConnect();
-    
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextSize(3);
-    tft.setTextColor(COLOR_TOPOLINO);
-    tft.drawString("Sleeping...", 30, 110);
-    tft.setTextSize(1);
-    tft.setTextColor(TFT_WHITE);
-    tft.drawString("Sending data", 30, 160);
-    
-    // Status Indicator
-    tft.drawRoundRect(63, 190, 55, 20, 8, COLOR_ALMOSTBLACK);
-    tft.setTextColor(StatusIndicatorStatus);
-    tft.setTextSize(1);
-    tft.drawString("Status", 73, 197);
-
-    // CAN Indicator
-    tft.drawRoundRect(80, 215, 38, 20, 8, COLOR_ALMOSTBLACK);
-    tft.setTextColor(StatusIndicatorCAN);
-    tft.setTextSize(1);
-    tft.drawString("CAN", 90, 222);
-
-    // WIFI Indicator
-    tft.drawRoundRect(122, 190, 55, 20, 8, COLOR_ALMOSTBLACK);
-    tft.setTextColor(StatusIndicatorWIFI); 
-    tft.setTextSize(1);
-    tft.drawString("WIFI", 138, 197);
-
-    // Tx Indicator
-    tft.drawRoundRect(122, 215, 38, 20, 8, COLOR_ALMOSTBLACK);
-    tft.setTextColor(StatusIndicatorTx);
-    tft.setTextSize(1);
-    tft.drawString("Tx", 135, 222);
-
+    DisplayPost(); // indicators
     delay(1000);
   }
   while ( SendDataSimpleAPI() == false && i < 5);
 
-  tft.fillScreen(TFT_BLACK);
-  tft.setTextSize(3);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.drawCentreString("Topolino is", 120, 100, 1);
-  tft.drawCentreString("sleeping...", 120, 125, 1);
-
-  // WIFI Indicator
-  tft.fillRoundRect(122, 188, 55, 20, 8, StatusIndicatorWIFI);
-  tft.setTextColor(TFT_BLACK); 
-  tft.setTextSize(1);
-  tft.drawString("WIFI", 139, 195);
-
-  // Tx Indicator
-  tft.fillRoundRect(139, 213, 25, 20, 8, StatusIndicatorTx);
-  tft.setTextColor(TFT_BLACK);
-  tft.setTextSize(1);
-  tft.drawString("Tx", 146, 219);
+  SleepPhase = SleepAsleep;
+  DisplayPost();
   
   Log("Light Sleep", true);
 }
@@ -1389,11 +1336,21 @@ void SleepLightStart() {
 void SleepDeepStart() {
 
   Log("Going to Deep sleep...");
+  PanelPower.set(PowerDeepSleep, millis());
+  DisplayPost(); // panel to sleep before its power is cut
+  DisplayPowerPrint();
   Log("Deep Sleep", true);
   TelnetStream.stop();
   BTDisconnect();
   
-  // Turn off display power
+  // Turn off display power once the render task has sent SLPIN (DisplaySleep() can wait up to
+  // DISPLAY_SLEEP_MS for it). The lock is kept, nothing is drawn to the unpowered panel.
+  for (;;) {
+    xSemaphoreTake(RenderLock, portMAX_DELAY);
+    if (DisplayPanelStats.mode != PanelOn) { break; }
+    xSemaphoreGive(RenderLock);
+    delay(10);
+  }
   digitalWrite(DISPLAY_POWER_PIN, LOW);
 
   delay(1000);
@@ -1401,18 +1358,10 @@ void SleepDeepStart() {
   esp_deep_sleep_start();
 }
 
-float average( float newvalue, float &buffer, float factor) {
-  float avg ;
-  buffer = buffer - (buffer / factor);
-  buffer = buffer + newvalue;
-  avg = buffer / factor;
-  return avg;
-}
-
 void DebugFakeValues() {
   canValues.Battery = random(0, 150) / 10;
   canValues.SoC = random(0, 100);
-  canValues.Gear = "D";
+  canValues.Gear = GearD;
   canValues.Temp1 = random(-90, 450) / 10;
   canValues.Temp2 = random(-90, 450) / 10;
   canValues.Volt = random(410, 580) / 10;
@@ -1423,6 +1372,23 @@ void DebugFakeValues() {
   canValues.RemainingDistance = random(0, 80); // km
   canValues.Ready = 1;
   canValues.Handbrake = 1;
+  VehiclePublish();
+
+  // Result screens
+  thisTrip.startTime = 0;
+  thisTrip.endTime = random(1, 90) * 60000UL;
+  thisTrip.startKM = canValues.ODO;
+  thisTrip.endKM = canValues.ODO + random(1, 600); // 1/10 km
+  thisTrip.maxSpeed = random(20, 50);
+  thisTrip.startSoC = random(50, 100);
+  thisTrip.endSoC = thisTrip.startSoC - random(0, 40);
+  thisTrip.consumedWh = random(100, 3000);
+  thisTrip.recuperatedWh = random(0, 500);
+  thisCharge.startTime = millis() - random(1, 300) * 60000UL;
+  thisCharge.endTime = millis();
+  thisCharge.startSoC = random(0, 60);
+  thisCharge.endSoC = thisCharge.startSoC + random(1, 40);
+  thisCharge.chargedWh = random(100, 6000);
 }
 
 void Log(String message, bool RemoteLog) {
@@ -1439,16 +1405,9 @@ void Log(String message) { Log(message, false); }
 #ifdef BTClassic
 bool BTConnect(int timeout) {
   Log("Bluetooth started - Timeout: " + String(timeout) + " ms", true);
-  // BT Connection message
-  tft.fillScreen(COLOR_BACKGROUND);
-  tft.fillSmoothRoundRect(20, 100, 200, 40, 5, COLOR_ALMOSTBLACK, COLOR_BACKGROUND);
-  tft.setTextColor(COLOR_TOPOLINO);
-  tft.setTextSize(2);
-  tft.drawCentreString("BT Connecting...", 120, 112, 1);
-  #ifdef DEBUGBT
-    tft.setTextSize(2);
-    tft.drawCentreString(String(timeout) + "sek.", 120, 140, 1);
-  #endif
+  // BT Connection message, the previous screen returns with the next loop()
+  BTConnectTimeout = timeout;
+  DisplayScreen(ScreenBTConnecting);
   delay(1000);
 
   BTisStarted = false;
@@ -1470,13 +1429,11 @@ bool BTConnect(int timeout) {
   {
     Log("Bluetooth connect OK", true);
     StatusIndicatorBT = TFT_GREEN;
-    tft.fillScreen(COLOR_BACKGROUND);
     return true;
   }
   else {
     Log("Bluetooth connect FAILED!", true);
     StatusIndicatorBT = COLOR_LIGHTRED;
-    tft.fillScreen(COLOR_BACKGROUND);
     return false;
   }
 }
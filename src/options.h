@@ -0,0 +1,14 @@
+// Compiling options
+// Shared by main.cpp and the screens (display.cpp), the host tools set them with -D.
+
+#pragma once
+
+//#define DEBUG
+//#define DEBUGBT
+#define BTClassic
+//#define BTLowEnergy
+
+const char VERSION[] = "1.1c";
+
+#define ShowConsumptionAsKW true
+#define ShowChargeAsKW true
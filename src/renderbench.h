@@ -0,0 +1,117 @@
+// Render benchmark
+// With DISPLAY_BENCHMARK (build flag) loop() stops the normal operation and feeds
+// DebugFakeValues() through every screen, each for DISPLAY_BENCHMARK_SCREEN_MS, as fast as
+// the render task takes the view models. The screens mark the end of every section they draw
+// (DisplayLap), the time since the previous mark is counted for that section in CPU cycles.
+// After each screen the results go to Serial and Telnet: frames per second, cycles per frame
+// and section, and the SPI bytes per frame (framebuffer pushes and clears; with direct
+// drawing the widgets' pixel estimate).
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef DISPLAY_BENCHMARK
+#define DISPLAY_BENCHMARK 0
+#endif
+#define DISPLAY_BENCHMARK_SCREEN_MS 10000
+
+enum BenchSection : uint8_t {
+  BenchEnter,             // clear plus the static content of result and status screens
+  BenchConsumptionGauge,
+  BenchConsumptionLabel,
+  BenchTemperatureGauge,
+  BenchTemperatureLabel,
+  BenchRightGauge,
+  BenchRightLabel,
+  BenchVoltLabel,
+  BenchSoCLabel,
+  BenchHistoryChart,
+  BenchIndicators,
+  BenchChargingText,
+  BenchChargingReadouts,
+  BenchChargingAnimation,
+  BenchSleeping,
+  BenchPush,              // DisplayFrameEnd(): framebuffer rows to DMA
+  BenchSectionCount
+};
+
+struct BenchSectionConfig {
+  BenchSection section;
+  const char *name;
+};
+
+constexpr BenchSectionConfig BenchSectionTable[] = {
+  { BenchEnter,             "enter" },
+  { BenchConsumptionGauge,  "consumption gauge" },
+  { BenchConsumptionLabel,  "consumption label" },
+  { BenchTemperatureGauge,  "temperature gauge" },
+  { BenchTemperatureLabel,  "temperature label" },
+  { BenchRightGauge,        "right gauge" },
+  { BenchRightLabel,        "right label" },
+  { BenchVoltLabel,         "volt label" },
+  { BenchSoCLabel,          "SoC label" },
+  { BenchHistoryChart,      "history chart" },
+  { BenchIndicators,        "indicators" },
+  { BenchChargingText,      "charging text" },
+  { BenchChargingReadouts,  "charging readouts" },
+  { BenchChargingAnimation, "charging animation" },
+  { BenchSleeping,          "sleeping" },
+  { BenchPush,              "framebuffer push" },
+};
+static_assert(sizeof(BenchSectionTable) / sizeof(BenchSectionTable[0]) == BenchSectionCount, "BenchSectionTable: one row per BenchSection");
+
+struct BenchCounter {
+  uint32_t count = 0;
+  uint32_t last = 0;
+  uint32_t max = 0;
+  uint64_t sum = 0;
+
+  void add(uint32_t value) {
+    count++;
+    last = value;
+    if (value > max) { max = value; }
+    sum += value;
+  }
+  uint32_t mean() const { return count ? (uint32_t)(sum / count) : 0; }
+};
+
+class RenderBench {
+  public:
+    void frameBegin(uint32_t cycles) {
+      mFrameStart = cycles;
+      mLapStart = cycles;
+    }
+
+    // The section drawn since the last lap (or frameBegin) ended at cycles
+    void lap(BenchSection section, uint32_t cycles) {
+      mSections[section].add(cycles - mLapStart);
+      mLapStart = cycles;
+    }
+
+    void frameEnd(uint32_t cycles, uint32_t spiBytes) {
+      mFrames.add(cycles - mFrameStart);
+      mSpiBytes.add(spiBytes);
+    }
+
+    void reset(uint32_t nowMs) {
+      *this = RenderBench();
+      mSinceMs = nowMs;
+    }
+
+    const BenchCounter &frames() const { return mFrames; }
+    const BenchCounter &spiBytes() const { return mSpiBytes; }
+    const BenchCounter &section(BenchSection section) const { return mSections[section]; }
+    // Frames per second x10 since reset()
+    uint32_t fpsX10(uint32_t nowMs) const { return nowMs != mSinceMs ? (uint32_t)((uint64_t)mFrames.count * 10000 / (nowMs - mSinceMs)) : 0; }
+
+  private:
+    BenchCounter mFrames;      // cycles per frame
+    BenchCounter mSpiBytes;    // per frame
+    BenchCounter mSections[BenchSectionCount];
+    uint32_t mFrameStart = 0;
+    uint32_t mLapStart = 0;
+    uint32_t mSinceMs = 0;
+};
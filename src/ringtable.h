@@ -0,0 +1,228 @@
+// Precomputed anti-aliased ring coverage
+// drawSmoothArc() recomputes the coverage of every pixel on each call. A RingTable keeps it
+// for one radius pair: per row of the quarter ring the solid span and the alpha of the
+// partially covered pixels at the inner and outer edge. The other quarters are the same
+// table rotated by 90 degrees (exact on the pixel grid), drawn as columns. The columns
+// where a degree starts come from a shared tangent table, so drawing a segment is a
+// table walk: one line per row plus a blend for the edge pixels.
+// Same geometry as TFT_eSPI: angles in degrees, 0 = bottom, clockwise, round ends are
+// spots drawn first and overdrawn by the ring.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+// RGB565 blend, alpha 0 = bg .. 255 = fg (as TFT_eSPI::alphaBlend)
+inline uint16_t RingBlend(uint8_t alpha, uint16_t fg, uint16_t bg) {
+  uint32_t rxb = bg & 0xF81F;
+  rxb += ((fg & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+  uint32_t xgx = bg & 0x07E0;
+  xgx += ((fg & 0x07E0) - xgx) * alpha >> 8;
+  return (rxb & 0xF81F) | (xgx & 0x07E0);
+}
+
+class RingTable {
+  public:
+    struct Row {
+      uint8_t first;      // first pixel with coverage
+      uint8_t solid;      // first fully covered pixel
+      uint8_t solidEnd;   // after the last fully covered pixel
+      uint8_t end;        // after the last pixel with coverage
+      uint16_t alpha;     // offset into mAlpha: first..solid, then solidEnd..end
+    };
+
+    RingTable() {}
+    RingTable(const RingTable &) = delete;
+    RingTable &operator=(const RingTable &) = delete;
+    ~RingTable() { free(mRows); free(mAlpha); }
+
+    // radius <= 127, returns false if out of memory
+    bool build(int16_t radius, int16_t innerRadius) {
+      free(mRows);
+      free(mAlpha);
+      mRows = NULL;
+      mAlpha = NULL;
+      if (radius <= innerRadius || radius > 127 || innerRadius < 0) { return false; }
+      mRadius = radius;
+      mInnerRadius = innerRadius;
+      buildTangents();
+
+      // Quarter 0: rows v = 1..radius below the centre, columns u >= 0 to the left
+      uint16_t edges = 0;
+      for (int pass = 0; pass < 2; pass++) {
+        uint16_t next = 0;
+        for (int16_t v = 1; v <= radius; v++) {
+          // Distance grows along the row: pixels with coverage are one run
+          Row row = { 0, 0, 0, 0, next };
+          int16_t u = 0;
+          while (u <= radius && !coverage(u, v)) { u++; }
+          row.first = u;
+          while (u <= radius && coverage(u, v)) { u++; }
+          row.end = u;
+          classify(v, row);
+          row.alpha = next;
+          if (pass == 1) {
+            mRows[v - 1] = row;
+            uint8_t *out = mAlpha + next;
+            for (uint8_t c = row.first; c < row.solid; c++) { *out++ = coverage(c, v); }
+            for (uint8_t c = row.solidEnd; c < row.end; c++) { *out++ = coverage(c, v); }
+          }
+          next += (row.solid - row.first) + (row.end - row.solidEnd);
+        }
+        if (pass == 0) {
+          edges = next;
+          mRows = (Row*)malloc(radius * sizeof(Row));
+          mAlpha = (uint8_t*)malloc(edges ? edges : 1);
+          if (mRows == NULL || mAlpha == NULL) {
+            free(mRows);
+            free(mAlpha);
+            mRows = NULL;
+            mAlpha = NULL;
+            return false;
+          }
+        }
+      }
+      mBytes = radius * sizeof(Row) + edges;
+      return true;
+    }
+
+    bool valid() const { return mRows != NULL; }
+    int16_t radius() const { return mRadius; }
+    int16_t innerRadius() const { return mInnerRadius; }
+    uint32_t bytes() const { return mBytes; }
+
+    // Same arguments as TFT_eSPI::drawSmoothArc(): end < start wraps over 0, 0..360 is the full ring.
+    // T needs drawPixel, drawFastHLine, drawFastVLine and drawSpot (TFT_eSPI or a sprite).
+    template <class T>
+    void draw(T &tft, int16_t x, int16_t y, uint16_t start, uint16_t end, uint16_t fg, uint16_t bg, bool roundEnds = false) const {
+      if (!valid() || start == end) { return; }
+      if (start > 360) { start = 360; }
+      if (end > 360) { end = 360; }
+      bool full = (start == 0 && end == 360);
+      if (roundEnds && !full) {
+        float mid = (mRadius + mInnerRadius) / 2.0f, width = (mRadius - mInnerRadius) / 2.0f;
+        tft.drawSpot(x - sinf(start * Deg) * mid, y + cosf(start * Deg) * mid, width, fg, bg);
+        tft.drawSpot(x - sinf(end * Deg) * mid, y + cosf(end * Deg) * mid, width, fg, bg);
+      }
+      if (end < start) {
+        segment(tft, x, y, start, 360, fg, bg);
+        segment(tft, x, y, 0, end, fg, bg);
+      }
+      else {
+        segment(tft, x, y, start, end, fg, bg);
+      }
+    }
+
+  private:
+    static constexpr float Deg = 0.017453292519943295f;
+    static constexpr uint32_t TanInfinite = 0xFFFFFFFF;
+
+    // Pixels (u, v) with v * tan(d) <= u belong to degree d or later (Q16, shared by all rings)
+    static uint32_t *tangents() {
+      static uint32_t table[91];
+      return table;
+    }
+
+    static void buildTangents() {
+      uint32_t *table = tangents();
+      if (table[90] == TanInfinite) { return; }
+      for (int d = 0; d < 90; d++) { table[d] = (uint32_t)lround(tan(d * 0.017453292519943295) * 65536.0); }
+      table[90] = TanInfinite;
+    }
+
+    // First column of a row that lies at or after local degree d (0..90)
+    static uint8_t column(int16_t v, uint16_t d) {
+      uint32_t t = tangents()[d];
+      if (t == TanInfinite) { return 255; }
+      uint64_t u = ((uint64_t)v * t + 0xFFFF) >> 16;
+      return u > 255 ? 255 : (uint8_t)u;
+    }
+
+    uint8_t coverage(int16_t u, int16_t v) const {
+      float d = sqrtf((float)(u * u + v * v));
+      float outer = mRadius + 0.5f - d;
+      float inner = d - mInnerRadius + 0.5f;
+      float c = (outer < inner ? outer : inner);
+      if (c <= 0) { return 0; }
+      if (c >= 1) { return 255; }
+      return (uint8_t)(c * 255 + 0.5f);
+    }
+
+    // Coverage rises to 255 at the inner edge and falls at the outer edge along each row
+    void classify(int16_t v, Row &row) const {
+      row.solid = row.end;
+      row.solidEnd = row.end;
+      for (int16_t u = row.first; u < row.end; u++) {
+        if (coverage(u, v) == 255) {
+          row.solid = u;
+          while (u < row.end && coverage(u, v) == 255) { u++; }
+          row.solidEnd = u;
+          break;
+        }
+      }
+      // no solid pixel: solid = solidEnd = end, all edge pixels are stored as the rising part
+    }
+
+    // Local degrees [start, end) of quarter q, q = 0..3
+    template <class T>
+    void quarter(T &tft, int16_t x, int16_t y, uint8_t q, uint16_t start, uint16_t end, uint16_t fg, uint16_t bg) const {
+      for (int16_t v = 1; v <= mRadius; v++) {
+        const Row &row = mRows[v - 1];
+        if (row.end == row.first) { continue; }
+        uint8_t from = column(v, start), to = column(v, end);
+        if (from < row.first) { from = row.first; }
+        if (to > row.end) { to = row.end; }
+        if (from >= to) { continue; }
+
+        const uint8_t *alpha = mAlpha + row.alpha;
+        for (uint8_t u = from; u < to && u < row.solid; u++) { pixel(tft, x, y, q, u, v, RingBlend(alpha[u - row.first], fg, bg)); }
+        uint8_t s0 = from > row.solid ? from : row.solid;
+        uint8_t s1 = to < row.solidEnd ? to : row.solidEnd;
+        if (s0 < s1) { line(tft, x, y, q, s0, s1 - s0, v, fg); }
+        alpha += row.solid - row.first;
+        uint8_t e0 = from > row.solidEnd ? from : row.solidEnd;
+        for (uint8_t u = e0; u < to; u++) { pixel(tft, x, y, q, u, v, RingBlend(alpha[u - row.solidEnd], fg, bg)); }
+      }
+    }
+
+    template <class T>
+    void segment(T &tft, int16_t x, int16_t y, uint16_t start, uint16_t end, uint16_t fg, uint16_t bg) const {
+      for (uint8_t q = 0; q < 4; q++) {
+        uint16_t q0 = q * 90, q1 = q0 + 90;
+        uint16_t s = start > q0 ? start : q0;
+        uint16_t e = end < q1 ? end : q1;
+        if (s < e) { quarter(tft, x, y, q, s - q0, e - q0, fg, bg); }
+      }
+    }
+
+    // Local (u, v) -> screen, rotated by q x 90 degrees clockwise: (dx, dy) -> (-dy, dx)
+    template <class T>
+    static void pixel(T &tft, int16_t x, int16_t y, uint8_t q, int16_t u, int16_t v, uint16_t color) {
+      switch (q) {
+        case 0: tft.drawPixel(x - u, y + v, color); break;
+        case 1: tft.drawPixel(x - v, y - u, color); break;
+        case 2: tft.drawPixel(x + u, y - v, color); break;
+        default: tft.drawPixel(x + v, y + u, color); break;
+      }
+    }
+
+    template <class T>
+    static void line(T &tft, int16_t x, int16_t y, uint8_t q, int16_t u, int16_t length, int16_t v, uint16_t color) {
+      switch (q) {
+        case 0: tft.drawFastHLine(x - u - length + 1, y + v, length, color); break;
+        case 1: tft.drawFastVLine(x - v, y - u - length + 1, length, color); break;
+        case 2: tft.drawFastHLine(x + u, y - v, length, color); break;
+        default: tft.drawFastVLine(x + v, y + u, length, color); break;
+      }
+    }
+
+    Row *mRows = NULL;        // mRadius rows, v = 1..mRadius
+    uint8_t *mAlpha = NULL;
+    int16_t mRadius = 0;
+    int16_t mInnerRadius = 0;
+    uint32_t mBytes = 0;
+};
@@ -0,0 +1,73 @@
+// Round panel clipping
+// The GC9A01 glass is a circle inside the 240x240 controller memory, about 21% of the
+// square is never visible. RoundSpans holds the visible columns of every row (computed at
+// compile time); full screen operations send bands of rows clipped to the widest span in
+// the band instead of the whole square.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+#define ROUND_CLIP_SIZE 240
+#define ROUND_CLIP_MARGIN 1        // pixels kept outside the circle, the glass edge isn't exact
+#define ROUND_CLIP_BAND 4          // rows per clipped fill block (fewest bytes incl. window commands)
+#define ROUND_CLIP_WINDOW_BYTES 11 // CASET + RASET + RAMWR per block
+
+struct RoundSpan {
+  uint8_t x;
+  uint8_t width;
+};
+
+struct RoundSpanTable {
+  RoundSpan rows[ROUND_CLIP_SIZE];
+
+  // Pixel centres in doubled coordinates, relative to the panel centre
+  constexpr RoundSpanTable() : rows() {
+    constexpr int32_t diameter = ROUND_CLIP_SIZE + 2 * ROUND_CLIP_MARGIN;
+    for (int32_t y = 0; y < ROUND_CLIP_SIZE; y++) {
+      int32_t dy = 2 * y + 1 - ROUND_CLIP_SIZE;
+      int32_t x = 0;
+      while (x < ROUND_CLIP_SIZE / 2 && (2 * x + 1 - ROUND_CLIP_SIZE) * (2 * x + 1 - ROUND_CLIP_SIZE) + dy * dy > diameter * diameter) { x++; }
+      rows[y].x = (uint8_t)x;
+      rows[y].width = (uint8_t)(ROUND_CLIP_SIZE - 2 * x);
+    }
+  }
+};
+
+constexpr RoundSpanTable RoundSpans;
+
+// Clips the columns x .. x + w - 1 of rows y .. y + lines - 1 to the widest visible span
+// among those rows. Returns false if nothing is visible.
+inline bool RoundClip(int16_t &x, int16_t &w, int16_t y, int16_t lines) {
+  int16_t first = y < 0 ? 0 : y;
+  int16_t last = y + lines > ROUND_CLIP_SIZE ? ROUND_CLIP_SIZE : y + lines;
+  if (first >= last) { return false; }
+  // Spans widen towards the centre: the row closest to it has the widest one
+  int16_t widest = (first >= ROUND_CLIP_SIZE / 2) ? first : (last <= ROUND_CLIP_SIZE / 2) ? last - 1 : ROUND_CLIP_SIZE / 2;
+  int16_t left = RoundSpans.rows[widest].x;
+  int16_t right = left + RoundSpans.rows[widest].width;
+  int16_t from = x > left ? x : left;
+  int16_t to = x + w < right ? x + w : right;
+  if (from >= to) { return false; }
+  x = from;
+  w = to - from;
+  return true;
+}
+
+struct RoundClipStatistics {
+  uint32_t count = 0;
+  uint32_t lastSquareBytes = 0;   // what the unclipped operation would have sent
+  uint32_t lastSentBytes = 0;     // pixels plus window commands actually sent
+  uint64_t squareBytes = 0;
+  uint64_t sentBytes = 0;
+
+  void add(uint32_t square, uint32_t sent) {
+    count++;
+    lastSquareBytes = square;
+    lastSentBytes = sent;
+    squareBytes += square;
+    sentBytes += sent;
+  }
+};
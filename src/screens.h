@@ -0,0 +1,88 @@
+// Screen manager
+// Which screen is shown: the vehicle state picks the base screen (drive, charging,
+// sleeping), result screens stay up for their hold time, boot and BT connecting last
+// while setup() / BTConnect() run. The screen is cleared once when it is entered (show()
+// returns true), after that it only redraws incrementally.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+enum Screen : uint8_t {
+  ScreenBoot,
+  ScreenDrive,
+  ScreenTripResult,
+  ScreenCharging,
+  ScreenChargeResult,
+  ScreenSleeping,
+  ScreenBTConnecting,
+  ScreenCount
+};
+
+struct ScreenConfig {
+  Screen screen;
+  const char *name;
+  uint32_t holdMs;    // shown at least this long before the base screen returns, 0 = not held
+};
+
+constexpr ScreenConfig ScreenConfigTable[] = {
+  //  screen               name              hold
+  { ScreenBoot,            "boot",           0 },
+  { ScreenDrive,           "drive",          0 },
+  { ScreenTripResult,      "trip result",    30000 },
+  { ScreenCharging,        "charging",       0 },
+  { ScreenChargeResult,    "charge result",  60000 },
+  { ScreenSleeping,        "sleeping",       0 },
+  { ScreenBTConnecting,    "BT connecting",  0 },
+};
+
+constexpr bool ScreenConfigTableIsValid() {
+  if (sizeof(ScreenConfigTable) / sizeof(ScreenConfigTable[0]) != ScreenCount) { return false; }
+  for (size_t i = 0; i < ScreenCount; i++) {
+    if (ScreenConfigTable[i].screen != i) { return false; }
+  }
+  return true;
+}
+static_assert(ScreenConfigTableIsValid(), "ScreenConfigTable: one row per Screen in enum order");
+
+class ScreenManager {
+  public:
+    // Returns true if the screen has to be entered: cleared and drawn completely
+    bool show(Screen screen, uint32_t now) {
+      if (screen == mScreen && mEntered) { return false; }
+      if (screen != mScreen) {
+        mScreen = screen;
+        mSince = now;
+        mTransitions++;
+      }
+      mEntered = true;
+      mEntries++;
+      return true;
+    }
+
+    // The screen to show now: the current one while it is held, otherwise the base screen
+    Screen next(uint32_t now, Screen base) const {
+      return held(now) ? mScreen : base;
+    }
+
+    bool held(uint32_t now) const {
+      return now - mSince < ScreenConfigTable[mScreen].holdMs; // unsigned: safe across the millis() wrap
+    }
+
+    // The screen was drawn over (e.g. console benchmark), the next show() enters it again
+    void invalidate() { mEntered = false; }
+
+    Screen current() const { return mScreen; }
+    uint32_t since() const { return mSince; }
+    uint32_t transitions() const { return mTransitions; }
+    uint32_t entries() const { return mEntries; }  // show() calls that returned true
+
+  private:
+    Screen mScreen = ScreenBoot;
+    uint32_t mSince = 0;
+    uint32_t mTransitions = 0;
+    uint32_t mEntries = 0;
+    bool mEntered = false;
+};
@@ -0,0 +1,58 @@
+// Sequence lock for one writer and any number of readers on either core
+// The writer never waits; readers copy the value and retry if a write overlapped the copy.
+// The value is stored as 32 bit atomic words, so the racing copy is well defined and on
+// the ESP32 compiles to plain loads/stores plus memory barriers.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock value must be trivially copyable");
+
+  public:
+    // Writer side, only ever called from one context
+    void write(const T &value) {
+      uint32_t words[WordCount] = {};
+      memcpy(words, &value, sizeof(T));
+      uint32_t seq = mSeq.load(std::memory_order_relaxed);
+      mSeq.store(seq + 1, std::memory_order_relaxed); // odd: write in progress
+      std::atomic_thread_fence(std::memory_order_release);
+      for (size_t i = 0; i < WordCount; i++) { mWords[i].store(words[i], std::memory_order_relaxed); }
+      mSeq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Reader side, returns a consistent copy
+    T read() const {
+      uint32_t words[WordCount];
+      uint32_t seq;
+      for (;;) {
+        seq = mSeq.load(std::memory_order_acquire);
+        if (seq & 1) { continue; }
+        for (size_t i = 0; i < WordCount; i++) { words[i] = mWords[i].load(std::memory_order_relaxed); }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (mSeq.load(std::memory_order_relaxed) == seq) { break; }
+        mRetries.fetch_add(1, std::memory_order_relaxed);
+      }
+      T value;
+      memcpy(&value, words, sizeof(T));
+      return value;
+    }
+
+    // Number of completed writes, lets readers skip work if nothing changed
+    uint32_t version() const { return mSeq.load(std::memory_order_acquire) >> 1; }
+    uint32_t retries() const { return mRetries.load(std::memory_order_relaxed); }
+
+  private:
+    static constexpr size_t WordCount = (sizeof(T) + 3) / 4;
+    std::atomic<uint32_t> mWords[WordCount] = {};
+    std::atomic<uint32_t> mSeq{0};
+    mutable std::atomic<uint32_t> mRetries{0};
+};
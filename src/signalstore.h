@@ -0,0 +1,101 @@
+// Signal store
+// Last published value and update time for every CanSignal, plus one dirty bit per signal.
+// A signal only becomes dirty if it moved more than its deadband away from the value that
+// was last reported (uploaded), so "changed" means changed. Dirty signals are walked with
+// count trailing zeros; signals not updated within their max age are stale.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <math.h>
+#include <candecoder.h>
+
+struct SignalConfig {
+  CanSignal signal;
+  const char *name;
+  float deadband;      // change needed before the signal is dirty again, 0 = any change
+  uint32_t maxAgeMs;   // older values are stale, 0 = never stale
+};
+
+constexpr SignalConfig SignalConfigTable[] = {
+  //  signal                     name                   deadband  max age
+  { SignalCurrent,               "Current",             1.0f,     3000 },   // A
+  { SignalVolt,                  "Volt",                0.2f,     3000 },   // V
+  { SignalSoC,                   "SoC",                 0.0f,     3000 },   // %
+  { SignalODO,                   "ODO",                 9.5f,     5000 },   // 1/10 km, report full km
+  { SignalSpeed,                 "Speed",               2.0f,     5000 },   // km/h
+  { SignalOBCRemainingMinutes,   "OBCRemainingMinutes", 0.0f,     5000 },
+  { SignalBattery,               "Battery",             0.05f,    5000 },   // V
+  { SignalTemp1,                 "Temp1",               0.0f,     10000 },  // C
+  { SignalTemp2,                 "Temp2",               0.0f,     10000 },
+  { SignalGear,                  "Gear",                0.0f,     5000 },   // CanGear
+  { SignalRemainingDistance,     "RemainingDistance",   0.0f,     5000 },
+  { SignalReady,                 "Ready",               0.0f,     5000 },
+  { SignalHandbrake,             "Handbrake",           0.0f,     5000 },
+};
+
+constexpr bool SignalConfigTableIsValid() {
+  if (sizeof(SignalConfigTable) / sizeof(SignalConfigTable[0]) != SignalCount) { return false; }
+  for (size_t i = 0; i < SignalCount; i++) {
+    if (SignalConfigTable[i].signal != i) { return false; }
+  }
+  return true;
+}
+static_assert(SignalConfigTableIsValid(), "SignalConfigTable: one row per CanSignal in enum order");
+
+class SignalStore {
+  public:
+    // Returns true if the signal became dirty
+    bool update(CanSignal signal, float value, uint32_t now) {
+      uint32_t bit = 1u << signal;
+      mValue[signal] = value;
+      mLastUpdate[signal] = now;
+      mSeen |= bit;
+      if ((mReported & bit) && fabsf(value - mReference[signal]) <= SignalConfigTable[signal].deadband) { return false; }
+      bool wasDirty = mDirty & bit;
+      mDirty |= bit;
+      return !wasDirty;
+    }
+
+    // Marks signals as reported: their current value becomes the deadband reference
+    void clear(uint32_t mask) {
+      for (uint32_t m = mask & mDirty; m; m &= m - 1) {
+        int signal = __builtin_ctz(m);
+        mReference[signal] = mValue[signal];
+      }
+      mReported |= mask & mDirty;
+      mDirty &= ~mask;
+    }
+
+    // Calls f(CanSignal) for every dirty signal
+    template <typename F>
+    void forEachDirty(F f) const {
+      for (uint32_t m = mDirty; m; m &= m - 1) { f((CanSignal)__builtin_ctz(m)); }
+    }
+
+    // Signals received at least once but not within their max age
+    uint32_t staleMask(uint32_t now) const {
+      uint32_t stale = 0;
+      for (uint32_t m = mSeen; m; m &= m - 1) {
+        int signal = __builtin_ctz(m);
+        uint32_t maxAge = SignalConfigTable[signal].maxAgeMs;
+        if (maxAge && now - mLastUpdate[signal] > maxAge) { stale |= 1u << signal; }
+      }
+      return stale;
+    }
+
+    float value(CanSignal signal) const { return mValue[signal]; }
+    uint32_t lastUpdate(CanSignal signal) const { return mLastUpdate[signal]; }
+    uint32_t dirty() const { return mDirty; }
+    uint32_t seen() const { return mSeen; }
+
+  private:
+    float mValue[SignalCount] = {};
+    float mReference[SignalCount] = {};   // value at last report
+    uint32_t mLastUpdate[SignalCount] = {};
+    uint32_t mDirty = 0;
+    uint32_t mSeen = 0;
+    uint32_t mReported = 0;
+};
@@ -0,0 +1,22 @@
+// Task load
+// Busy time of a task: begin() when it wakes up, end() before it blocks again. The display
+// statistics turn the busy time per interval into a per core utilisation of the firmware's
+// own tasks (the WiFi and Bluetooth stacks are not included).
+//
+// No Arduino dependencies
+
+#pragma once
+
+#include <stdint.h>
+
+class TaskLoad {
+  public:
+    void begin(uint32_t nowUs) { mStartUs = nowUs; }
+    void end(uint32_t nowUs) { mBusyUs += nowUs - mStartUs; }
+
+    uint64_t busyUs() const { return mBusyUs; }
+
+  private:
+    uint64_t mBusyUs = 0;
+    uint32_t mStartUs = 0;
+};
@@ -0,0 +1,76 @@
+// Allocation free text formatting for the screens
+// Values are formatted as fixed point integers into a TextBuffer on the stack instead of
+// Arduino Strings, so drawing a frame doesn't touch the heap:
+//   TextBuffer<12> text;
+//   text.fixed(-1234, 2).add(" kW");     // "-12.34 kW"
+//   text.number(v.Volt, 1).add('V');     // float rounded to 1 decimal
+// Text that doesn't fit is cut off, the buffer is always terminated.
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+template <size_t N>
+class TextBuffer {
+  public:
+    TextBuffer() { mText[0] = '\0'; }
+
+    TextBuffer &clear() {
+      mLength = 0;
+      mText[0] = '\0';
+      return *this;
+    }
+
+    TextBuffer &add(const char *text) {
+      while (*text && mLength < N - 1) { mText[mLength++] = *text++; }
+      mText[mLength] = '\0';
+      return *this;
+    }
+
+    TextBuffer &add(char c) {
+      if (mLength < N - 1) { mText[mLength++] = c; }
+      mText[mLength] = '\0';
+      return *this;
+    }
+
+    TextBuffer &integer(int32_t value) { return fixed(value, 0); }
+
+    // value / 10^decimals, e.g. fixed(-5, 2) -> "-0.05"
+    TextBuffer &fixed(int32_t value, uint8_t decimals) {
+      char digits[12];
+      uint8_t count = 0;
+      uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+      do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+      } while (magnitude || count <= decimals);
+      if (value < 0) { add('-'); }
+      while (count) {
+        if (count == decimals) { add('.'); }
+        add(digits[--count]);
+      }
+      return *this;
+    }
+
+    // Rounded to the given decimals (half away from zero, like String(float, decimals))
+    TextBuffer &number(float value, uint8_t decimals) {
+      static const float scale[] = { 1.0f, 10.0f, 100.0f, 1000.0f };
+      if (decimals > 3) { decimals = 3; }
+      float scaled = value * scale[decimals];
+      if (isnan(scaled)) { return add("nan"); }
+      if (isinf(scaled)) { return add("inf"); }
+      if (fabsf(scaled) >= 2e9f) { return add("ovf"); }
+      return fixed((int32_t)lroundf(scaled), decimals);
+    }
+
+    const char *c_str() const { return mText; }
+    size_t length() const { return mLength; }
+
+  private:
+    char mText[N];
+    size_t mLength = 0;
+};
@@ -0,0 +1,47 @@
+// Gauge tweening
+// The CAN signals behind the gauges arrive every 250 ms or so, drawn as they come the arcs jump.
+// A Tween glides one value (the moving end of an arc, in degrees) from where it is shown to the
+// new target within DISPLAY_TWEEN_MS, easing out. While a gauge tweens the render task draws
+// the last view model again every DISPLAY_TWEEN_FRAME_MS, each frame only adds or removes the
+// few degrees the arc moved (ArcGauge, widgets.h).
+//
+// No Arduino dependencies - also used by the host tools in ../tools
+
+#pragma once
+
+#include <stdint.h>
+
+#define DISPLAY_TWEEN_MS 250        // about one signal interval
+#define DISPLAY_TWEEN_FRAME_MS 33   // render task frame budget while a gauge moves
+
+class Tween {
+  public:
+    // Shows target right away
+    void jump(int16_t target) {
+      mFrom = target;
+      mTo = target;
+    }
+
+    // Glides from current (what is shown now) to target, starting at nowMs
+    void retarget(int16_t current, int16_t target, uint32_t nowMs) {
+      mFrom = current;
+      mTo = target;
+      mStartMs = nowMs;
+    }
+
+    int16_t value(uint32_t nowMs) const {
+      uint32_t elapsed = nowMs - mStartMs;
+      if (mFrom == mTo || elapsed >= DISPLAY_TWEEN_MS) { return mTo; }
+      int32_t t = 256 - (int32_t)(elapsed * 256 / DISPLAY_TWEEN_MS); // remaining, 256 = start
+      int32_t eased = 65536 - t * t;                                 // ease out (quadratic), 0..65536
+      return mFrom + (int16_t)(((int32_t)(mTo - mFrom) * eased) / 65536);
+    }
+
+    bool active(uint32_t nowMs) const { return mFrom != mTo && nowMs - mStartMs < DISPLAY_TWEEN_MS; }
+    int16_t target() const { return mTo; }
+
+  private:
+    int16_t mFrom = 0;
+    int16_t mTo = 0;
+    uint32_t mStartMs = 0;
+};
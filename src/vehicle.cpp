@@ -0,0 +1,172 @@
+#include <vehicle.h>
+
+const unsigned int TripRecordInterval = 1 * 1000;
+unsigned long TripRecordingLastRun = 0;
+
+float CanSignalValues[SignalCount] = {}; // last decoded physical values, see CanSignalTable
+const char* const GearNames[] = {"R", "N", "D", "-", "?"}; // indexed by CanGear
+float Value_Battery_Current_Buffer = 0;
+trip thisTrip; // Trip data structure
+trip RTC_DATA_ATTR lastTrip1; // Last Trip data structure
+trip RTC_DATA_ATTR lastTrip2; // Last Trip data structure
+trip RTC_DATA_ATTR lastTrip3; // Last Trip data structure
+trip RTC_DATA_ATTR lastTrip4; // Last Trip data structure
+trip RTC_DATA_ATTR lastTrip5; // Last Trip data structure
+CANValues canValues; // CAN values structure
+SeqLock<CANValues> VehicleState;
+SignalStore Signals;
+Charge thisCharge;
+bool TripActive = false;
+bool IsCharging = false;
+bool ChargeDataToSend = false;
+float avgkWh = 10;
+EnergyIntegrator Energy;
+
+uint8_t CANApplySignals(uint32_t updated) {
+  // Copy decoded signals into canValues
+  const float *value = CanSignalValues;
+  uint32_t now = millis();
+  uint8_t events = 0;
+
+  if (updated & CanSignalBit(SignalCurrent)) {
+    canValues.Current = average(value[SignalCurrent], Value_Battery_Current_Buffer, 3); // Average over 3 values
+    Signals.update(SignalCurrent, canValues.Current, now);
+  }
+  if (updated & CanSignalBit(SignalVolt)) { canValues.Volt = value[SignalVolt]; Signals.update(SignalVolt, canValues.Volt, now); }
+  if (updated & CanSignalBit(SignalSoC)) { canValues.SoC = value[SignalSoC]; Signals.update(SignalSoC, canValues.SoC, now); }
+  if (updated & CanSignalBit(SignalODO)) { canValues.ODO = value[SignalODO]; Signals.update(SignalODO, canValues.ODO, now); }
+  if (updated & CanSignalBit(SignalSpeed)) { canValues.Speed = value[SignalSpeed]; Signals.update(SignalSpeed, canValues.Speed, now); }
+  if (updated & CanSignalBit(SignalOBCRemainingMinutes)) { canValues.OBCRemainingMinutes = value[SignalOBCRemainingMinutes]; Signals.update(SignalOBCRemainingMinutes, canValues.OBCRemainingMinutes, now); }
+  if (updated & CanSignalBit(SignalBattery)) { canValues.Battery = value[SignalBattery]; Signals.update(SignalBattery, canValues.Battery, now); }
+  if (updated & CanSignalBit(SignalTemp1)) { canValues.Temp1 = value[SignalTemp1]; Signals.update(SignalTemp1, canValues.Temp1, now); }
+  if (updated & CanSignalBit(SignalTemp2)) { canValues.Temp2 = value[SignalTemp2]; Signals.update(SignalTemp2, canValues.Temp2, now); }
+  if (updated & CanSignalBit(SignalGear)) { canValues.Gear = (CanGear)((int)value[SignalGear] & 0x03); Signals.update(SignalGear, value[SignalGear], now); }
+  if (updated & CanSignalBit(SignalRemainingDistance)) { canValues.RemainingDistance = value[SignalRemainingDistance]; Signals.update(SignalRemainingDistance, canValues.RemainingDistance, now); }
+  if (updated & CanSignalBit(SignalReady)) {
+    if (value[SignalReady] == 1 && canValues.Ready != 1) { events |= VEHICLE_EVENT_READY; }
+    canValues.Ready = value[SignalReady];
+    Signals.update(SignalReady, canValues.Ready, now);
+  }
+  if (updated & CanSignalBit(SignalHandbrake)) { canValues.Handbrake = value[SignalHandbrake]; Signals.update(SignalHandbrake, canValues.Handbrake, now); }
+
+  // Publish once per frame, so Current and Volt of 0x580 are always seen together
+  VehiclePublish();
+  return events;
+}
+
+void VehiclePublish() {
+  VehicleState.write(canValues);
+}
+
+CANValues VehicleSnapshot() {
+  return VehicleState.read();
+}
+
+void VehicleEnergySample(int64_t timestamp, const uint8_t *data) {
+  // Every 0x580 frame (us timestamp of the CAN receive task)
+  Energy.sampleFrame(timestamp, data);
+
+  // Net Wh per 1/10 km (ODO unit) equals kWh/100km
+  if (TripActive && thisTrip.startTime != 0) {
+    int drivenODO = canValues.ODO - (int)thisTrip.startKM;
+    if (drivenODO >= 5) { avgkWh = (float)Energy.trip.netWh() / drivenODO; } // from 500 m on
+  }
+}
+
+uint8_t VehicleUpdate(unsigned long currentMillis, unsigned long canMessagesLastRecived) {
+  const CANValues v = VehicleSnapshot();
+  uint8_t events = 0;
+
+  // Check for new trip recording
+  if (v.Speed > 0 && v.Ready == 1 && !TripActive && (currentMillis - canMessagesLastRecived) < (5000)) {
+    TripActive = true;
+    events |= VEHICLE_EVENT_TRIP_STARTED;
+    Log("Trip started at " + String(thisTrip.startTime) + " with ODO: " + String(thisTrip.startKM));
+
+    if (thisTrip.toSend == true) {
+      lastTrip5 = lastTrip4;
+      lastTrip4 = lastTrip3;
+      lastTrip3 = lastTrip2;
+      lastTrip2 = lastTrip1;
+      lastTrip1 = thisTrip;  // Save last trip for sending
+      Log("Last Trip saved for later transmition", true);
+    }
+    // Reset Trip data
+    thisTrip.startTime = 0;
+    thisTrip.endTime = 0;
+    thisTrip.startKM = 0;
+    thisTrip.endKM = 0;
+    thisTrip.maxSpeed = 0;
+    thisTrip.startSoC = v.SoC;
+    thisTrip.endSoC = v.SoC;
+    thisTrip.consumedWh = 0;
+    thisTrip.recuperatedWh = 0;
+    thisTrip.toSend = false;
+    Energy.trip = EnergyAccumulator();
+  }
+  if (currentMillis - TripRecordingLastRun >= TripRecordInterval && TripActive) {
+    TripRecordingLastRun = currentMillis;
+    TripRecording();
+  }
+
+  // Check current Trip has ended
+  if ((v.Ready == 0 || v.Gear == GearNone || v.Gear == GearUnknown || (currentMillis - canMessagesLastRecived) > (10000))  && TripActive) { //was: || (canValues.Gear == "N" && canValues.Handbrake && canValues.Speed == 0)
+    TripActive = false;
+    events |= VEHICLE_EVENT_TRIP_ENDED;
+    Log("Trip ended - consumed: " + String(thisTrip.consumedWh) + " Wh recuperated: " + String(thisTrip.recuperatedWh) + " Wh");
+
+    // Only trips longer than 100 meter will be transmitted
+    if ( (float)((thisTrip.endKM - thisTrip.startKM) / 10) > 0.1) {
+      thisTrip.toSend = true;
+    }
+  }
+
+  // Check if new charge
+  if (v.OBCRemainingMinutes >= 0 && v.Current > 0 && !IsCharging) {
+    IsCharging = true;
+    events |= VEHICLE_EVENT_CHARGE_STARTED;
+    thisCharge.startSoC = v.SoC;
+    thisCharge.startTime = currentMillis;
+    thisCharge.chargedWh = 0;
+    Energy.charge = EnergyAccumulator();
+
+    Log("Charging started", true);
+  }
+  // Check if chareging has ended
+  if (IsCharging && v.OBCRemainingMinutes == -1) {
+    IsCharging = false;
+    events |= VEHICLE_EVENT_CHARGE_ENDED;
+    thisCharge.endSoC = v.SoC;
+    thisCharge.endTime = currentMillis;
+    thisCharge.chargedWh = Energy.charge.recuperatedWh();
+    if (((thisCharge.endTime - thisCharge.startTime) / 1000 / 60 ) > 5) { //only charges longer than 5 minutes will be transmitted
+      ChargeDataToSend = true;
+    }
+
+    Log("Charging has ended", true);
+  }
+
+  return events;
+}
+
+void TripRecording() {
+  const CANValues v = VehicleSnapshot();
+  if ( thisTrip.maxSpeed < v.Speed) { thisTrip.maxSpeed = v.Speed; }
+  if (thisTrip.startTime == 0) {
+    thisTrip.startTime = millis();
+    thisTrip.startKM = v.ODO;
+  }
+  thisTrip.endTime = millis();
+  thisTrip.endKM = v.ODO;
+  if (thisTrip.endSoC == 0 || thisTrip.endSoC > v.SoC) { thisTrip.endSoC = v.SoC; }
+  thisTrip.consumedWh = Energy.trip.consumedWh();
+  thisTrip.recuperatedWh = Energy.trip.recuperatedWh();
+}
+
+float average( float newvalue, float &buffer, float factor) {
+  float avg ;
+  buffer = buffer - (buffer / factor);
+  buffer = buffer + newvalue;
+  avg = buffer / factor;
+  return avg;
+}
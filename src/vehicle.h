@@ -0,0 +1,84 @@
+// Vehicle state: decoded CAN values, trip and charge detection
+// Kept free of display, network and CAN hardware so the same code runs in the
+// host replay tool (../tools/replay.cpp).
+
+#pragma once
+
+#include <Arduino.h>
+#include <candecoder.h>
+#include <signalstore.h>
+#include <seqlock.h>
+#include <energy.h>
+
+struct trip {
+  unsigned long startTime;
+  unsigned long endTime;
+  float startKM;
+  float endKM;
+  int maxSpeed;
+  int startSoC;
+  int endSoC;
+  int consumedWh;     // battery energy, see energy.h
+  int recuperatedWh;
+  bool toSend;
+};
+struct CANValues {
+  int ODO = 0;
+  int Speed = 0;
+  int OBCRemainingMinutes = -1;
+  float Battery = 0.0;
+  int Temp1 = -99;
+  int Temp2 = -99;
+  float Volt = 0;
+  int SoC = 101;
+  CanGear Gear = GearUnknown;
+  int RemainingDistance = 0;
+  int Ready = -1; // 1=Ready, 0=Not Ready, -1=Unknown
+  float Current = 0;
+  int Handbrake = -1; // 1=On, 0=Off, -1=Unknown
+};
+static_assert(std::is_trivially_copyable<CANValues>::value, "CANValues is published through a SeqLock");
+struct Charge {
+  unsigned long startTime = 0;
+  unsigned long endTime;
+  int startSoC = 0;
+  int endSoC = 0;
+  int chargedWh = 0;  // battery energy, see energy.h
+};
+
+// Events returned by CANApplySignals() and VehicleUpdate()
+#define VEHICLE_EVENT_READY 0x01          // car became ready
+#define VEHICLE_EVENT_TRIP_STARTED 0x02
+#define VEHICLE_EVENT_TRIP_ENDED 0x04
+#define VEHICLE_EVENT_CHARGE_STARTED 0x08
+#define VEHICLE_EVENT_CHARGE_ENDED 0x10
+
+extern CANValues canValues; // working copy, only written and read by the CAN handling context
+extern SeqLock<CANValues> VehicleState; // published canValues for all other readers
+extern SignalStore Signals; // published canValues: dirty bits, deadbands, update times
+extern float CanSignalValues[SignalCount];
+extern const char* const GearNames[];
+extern trip thisTrip;
+extern trip lastTrip1;
+extern trip lastTrip2;
+extern trip lastTrip3;
+extern trip lastTrip4;
+extern trip lastTrip5;
+extern Charge thisCharge;
+extern bool TripActive;
+extern bool IsCharging;
+extern bool ChargeDataToSend;
+extern float avgkWh;
+extern EnergyIntegrator Energy;
+
+uint8_t CANApplySignals(uint32_t updated);
+void VehicleEnergySample(int64_t timestamp, const uint8_t *data);
+void VehiclePublish();
+CANValues VehicleSnapshot();
+uint8_t VehicleUpdate(unsigned long currentMillis, unsigned long canMessagesLastRecived);
+void TripRecording();
+float average(float newvalue, float &buffer, float factor);
+
+// Provided by the application (main.cpp / host tools)
+void Log(String message, bool RemoteLog);
+void Log(String message);
@@ -0,0 +1,388 @@
+#include <widgets.h>
+#include <framebuffer.h>
+
+DisplayStatistics DisplayStats;
+uint32_t DisplayEpoch = 0;
+uint32_t WidgetPixels = 0;
+int16_t WidgetRowFirst = 0;
+int16_t WidgetRowLast = -1;
+
+static RingTable WidgetRings[WIDGET_RINGS];
+
+const RingTable *WidgetRing(int16_t radius, int16_t innerRadius) {
+  for (RingTable &ring : WidgetRings) {
+    if (ring.valid() && ring.radius() == radius && ring.innerRadius() == innerRadius) { return &ring; }
+  }
+  for (RingTable &ring : WidgetRings) {
+    if (!ring.valid()) { return ring.build(radius, innerRadius) ? &ring : NULL; }
+  }
+  return NULL;
+}
+
+uint32_t WidgetRingBytes() {
+  uint32_t bytes = 0;
+  for (const RingTable &ring : WidgetRings) { bytes += ring.bytes(); }
+  return bytes;
+}
+
+void DisplayArc(TFT_eSPI &tft, int16_t x, int16_t y, int16_t radius, int16_t innerRadius, uint16_t start, uint16_t end,
+                uint16_t color, uint16_t background, bool roundEnds) {
+  const RingTable *ring = WidgetRing(radius, innerRadius);
+  if (ring) { ring->draw(tft, x, y, start, end, color, background, roundEnds); }
+  else { tft.drawSmoothArc(x, y, radius, innerRadius, start, end, color, background, roundEnds); }
+}
+
+static uint16_t TextBand[WIDGET_TEXT_BAND];
+
+int16_t DisplayTextX(const GlyphAtlas &atlas, const char *text, int16_t x, uint8_t align) {
+  switch (align) {
+    case AlignCentre: return x - GlyphTextWidth(atlas, text) / 2;
+    case AlignRight: return x - GlyphTextWidth(atlas, text);
+    default: return x;
+  }
+}
+
+void DisplayText(TFT_eSPI &tft, const GlyphAtlas &atlas, const char *text, int16_t x, int16_t y,
+                 int16_t clipX, int16_t clipWidth, uint16_t color, uint16_t background) {
+  if (clipWidth <= 0 || clipWidth > WIDGET_TEXT_BAND) { return; }
+  uint16_t ramp[16];
+  GlyphRamp(color, background, ramp);
+  int bandLines = max(WIDGET_TEXT_BAND / (int)clipWidth, 1);
+  for (int row = 0; row < atlas.height; row += bandLines) {
+    int lines = min(bandLines, atlas.height - row);
+    for (int i = 0; i < lines; i++) {
+      uint16_t *line = TextBand + i * clipWidth;
+      for (int16_t c = 0; c < clipWidth; c++) { line[c] = ramp[0]; }
+      GlyphRenderRow(atlas, text, x, row + i, ramp, line, clipX, clipWidth);
+    }
+    DisplayPushImage(tft, clipX, y + row, clipWidth, lines, TextBand);
+  }
+}
+
+static void WidgetRows(int16_t y, int16_t h) {
+  if (y < WidgetRowFirst || WidgetRowLast < WidgetRowFirst) { WidgetRowFirst = y; }
+  if (y + h - 1 > WidgetRowLast) { WidgetRowLast = y + h - 1; }
+}
+
+// Rows covered by a ring segment, angles as in drawSmoothArc (0 = bottom, clockwise)
+static void ArcRows(int16_t y, int16_t radius, int16_t innerRadius, uint16_t start, uint16_t end) {
+  uint16_t sweep = end > start ? end - start : 360 - start + end;
+  float top = 1e6, bottom = -1e6;
+  for (uint16_t angle : { start, end }) {
+    float c = cosf(angle * DEG_TO_RAD);
+    for (int16_t r : { radius, innerRadius }) {
+      top = min(top, y + r * c);
+      bottom = max(bottom, y + r * c);
+    }
+  }
+  if ((180 + 360 - start) % 360 <= sweep) { top = y - radius; }  // passes the top
+  if ((360 - start) % 360 <= sweep) { bottom = y + radius; }     // passes the bottom
+  WidgetRows((int16_t)top - 1, (int16_t)(bottom - top) + 3);    // anti-aliased edge
+}
+
+static uint32_t ArcPixels(int16_t radius, int16_t innerRadius, uint16_t degrees) {
+  // Ring area share, including the anti-aliased edges
+  return (uint32_t)((radius + 1) * (radius + 1) - innerRadius * innerRadius) * 355 * degrees / (113 * 360);
+}
+
+void DisplayClear(TFT_eSPI &tft, uint32_t color) {
+  FrameBufferSync(tft);
+  DisplayFill(tft, color);
+  FrameBufferClear(color);
+  DisplayEpoch++;
+  DisplayStats.clears++;
+  DisplayStats.pixelsTotal += DisplayClipStats.lastSentBytes / 2;
+}
+
+void WidgetFrameBegin() {
+  WidgetPixels = 0;
+  WidgetRowFirst = 0;
+  WidgetRowLast = -1;
+}
+
+void WidgetFrameEnd() {
+  DisplayStats.frames++;
+  if (WidgetPixels) { DisplayStats.framesChanged++; }
+  DisplayStats.pixelsLastFrame = WidgetPixels;
+  if (WidgetPixels > DisplayStats.pixelsMaxFrame) { DisplayStats.pixelsMaxFrame = WidgetPixels; }
+  DisplayStats.pixelsTotal += WidgetPixels;
+}
+
+// ArcGauge ============================================================================================
+
+ArcGauge::ArcGauge(int16_t x, int16_t y, int16_t trackRadius, int16_t valueRadius, int16_t innerRadius,
+                   uint16_t trackStart, uint16_t trackEnd, uint16_t trackColor, uint16_t background)
+  : mX(x), mY(y), mTrackRadius(trackRadius), mValueRadius(valueRadius), mInnerRadius(innerRadius),
+    mTrackStart(trackStart), mTrackEnd(trackEnd), mTrackColor(trackColor), mBackground(background),
+    mCapDegrees((uint8_t)ceilf(atan2f((valueRadius - innerRadius) / 2.0f + 1, (valueRadius + innerRadius) / 2.0f) / DEG_TO_RAD)) {}
+
+void ArcGauge::setMarker(int16_t x, int16_t y, int16_t radius, uint16_t color) {
+  mMarkerX = x;
+  mMarkerY = y;
+  mMarkerRadius = radius;
+  mMarkerColor = color;
+}
+
+bool ArcGauge::draw(TFT_eSPI &tft, uint16_t start, uint16_t end, uint16_t color) {
+  if (start == end) { color = 0; }
+  if (valid() && start == mStart && end == mEnd && color == mColor) { return false; }
+  if (valid() && color == mColor && drawDelta(tft, start, end)) {
+    mStart = start;
+    mEnd = end;
+    return true;
+  }
+
+  DisplayArc(tft, mX, mY, mTrackRadius, mInnerRadius, mTrackStart, mTrackEnd, mTrackColor, mBackground, true);
+  WidgetPixels += ArcPixels(mTrackRadius, mInnerRadius, mTrackEnd - mTrackStart);
+  ArcRows(mY, mTrackRadius, mInnerRadius, mTrackStart, mTrackEnd);
+  if (start != end) {
+    DisplayArc(tft, mX, mY, mValueRadius, mInnerRadius, start, end, color, mBackground, true);
+    WidgetPixels += ArcPixels(mValueRadius, mInnerRadius, end > start ? end - start : 360 - start + end);
+    ArcRows(mY, mValueRadius, mInnerRadius, start, end);
+  }
+  else if (mMarkerRadius) {
+    tft.drawSpot(mMarkerX, mMarkerY, mMarkerRadius, mMarkerColor, mBackground);
+    WidgetPixels += (2 * mMarkerRadius + 1) * (2 * mMarkerRadius + 1);
+    WidgetRows(mMarkerY - mMarkerRadius - 1, 2 * mMarkerRadius + 3);
+  }
+
+  mStart = start;
+  mEnd = end;
+  mColor = color;
+  drawn();
+  return true;
+}
+
+bool ArcGauge::animate(TFT_eSPI &tft, uint16_t start, uint16_t end, uint16_t color, uint32_t nowMs) {
+  if (start == end) { color = 0; }
+  if (!valid() || start != mTargetStart || end != mTargetEnd || color != mTargetColor) {
+    // Glide if one end of a shown value moves, else jump
+    bool glide = valid() && color == mTargetColor && start != end && mTargetStart != mTargetEnd && (start == mTargetStart) != (end == mTargetEnd);
+    if (glide) {
+      mTweenStart = end == mTargetEnd;
+      mTween.retarget(mTweenStart ? mStart : mEnd, mTweenStart ? start : end, nowMs);
+    }
+    else {
+      mTween.jump(end);
+      mTweenStart = false;
+    }
+    mTargetStart = start;
+    mTargetEnd = end;
+    mTargetColor = color;
+  }
+  uint16_t angle = mTween.value(nowMs);
+  return mTweenStart ? draw(tft, angle, end, color) : draw(tft, start, angle, color);
+}
+
+void ArcGauge::drawSegment(TFT_eSPI &tft, int16_t radius, uint16_t start, uint16_t end, uint16_t color) {
+  if (start >= end) { return; }
+  DisplayArc(tft, mX, mY, radius, mInnerRadius, start, end, color, mBackground);
+  WidgetPixels += ArcPixels(radius, mInnerRadius, end - start);
+  ArcRows(mY, radius, mInnerRadius, start, end);
+}
+
+// Round end of the value segment, as RingTable draws it
+void ArcGauge::drawCap(TFT_eSPI &tft, uint16_t angle, uint16_t color) {
+  float mid = (mValueRadius + mInnerRadius) / 2.0f, width = (mValueRadius - mInnerRadius) / 2.0f;
+  float x = mX - sinf(angle * DEG_TO_RAD) * mid, y = mY + cosf(angle * DEG_TO_RAD) * mid;
+  tft.drawSpot(x, y, width, color, mBackground);
+  int16_t r = (int16_t)width + 1;
+  WidgetPixels += (2 * r + 1) * (2 * r + 1);
+  WidgetRows((int16_t)y - r - 1, 2 * r + 3);
+}
+
+// Only one end moved: draws the degrees in between, in the order of a full draw (track, round
+// end, value) so the result is the same. The track is restored from a round end width before
+// to one after the moved range, which erases the old round end. False if the whole gauge has to
+// be drawn (value appears or disappears, both ends moved, round ends would meet).
+bool ArcGauge::drawDelta(TFT_eSPI &tft, uint16_t start, uint16_t end) {
+  if (start == end || mStart == mEnd || start > end || mStart > mEnd) { return false; }
+  bool endMoves = start == mStart;
+  if (!endMoves && end != mEnd) { return false; }
+  uint16_t from = endMoves ? mEnd : mStart, to = endMoves ? end : start;
+  uint16_t low = min(from, to) - mCapDegrees, high = max(from, to) + mCapDegrees;
+  if (min(from, to) <= mTrackStart + 2 * mCapDegrees || high + mCapDegrees >= mTrackEnd) { return false; } // track ends
+  if (endMoves ? low < start + mCapDegrees : high + mCapDegrees > end) { return false; }                  // fixed end
+
+  drawSegment(tft, mTrackRadius, low, high, mTrackColor);
+  drawCap(tft, to, mColor);
+  if (endMoves) { drawSegment(tft, mValueRadius, low, to, mColor); }
+  else { drawSegment(tft, mValueRadius, to, high, mColor); }
+  drawn();
+  return true;
+}
+
+// ValueLabel ==========================================================================================
+
+ValueLabel::ValueLabel(int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, int16_t boxRadius, uint16_t boxColor, uint16_t background,
+                       int16_t textX, int16_t textY, LabelAlign align, uint8_t font, uint8_t size)
+  : mBoxX(boxX), mBoxY(boxY), mBoxW(boxW), mBoxH(boxH), mBoxRadius(boxRadius), mBoxColor(boxColor), mBackground(background),
+    mTextX(textX), mTextY(textY), mAlign(align), mFont(font), mSize(size) {}
+
+ValueLabel::ValueLabel(int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, int16_t boxRadius, uint16_t boxColor, uint16_t background,
+                       int16_t textX, int16_t textY, LabelAlign align, const GlyphAtlas &atlas)
+  : mBoxX(boxX), mBoxY(boxY), mBoxW(boxW), mBoxH(boxH), mBoxRadius(boxRadius), mBoxColor(boxColor), mBackground(background),
+    mTextX(textX), mTextY(textY), mAlign(align), mFont(0), mSize(0), mAtlas(&atlas) {}
+
+bool ValueLabel::draw(TFT_eSPI &tft, const char *text, uint16_t color) {
+  if (valid() && color == mColor && strncmp(text, mText, WIDGET_TEXT_MAX - 1) == 0) { return false; }
+
+  if (mAtlas) {
+    if (!valid()) {
+      if (mBoxRadius) { tft.fillSmoothRoundRect(mBoxX, mBoxY, mBoxW, mBoxH, mBoxRadius, mBoxColor, mBackground); }
+      else { tft.fillRect(mBoxX, mBoxY, mBoxW, mBoxH, mBoxColor); }
+      WidgetPixels += mBoxW * mBoxH;
+      WidgetRows(mBoxY, mBoxH);
+    }
+    // Rows clear of the rounded corners span the whole box
+    bool corners = mTextY < mBoxY + mBoxRadius || mTextY + mAtlas->height > mBoxY + mBoxH - mBoxRadius;
+    int16_t inset = corners ? mBoxRadius : 0;
+    DisplayText(tft, *mAtlas, text, DisplayTextX(*mAtlas, text, mTextX, mAlign), mTextY, mBoxX + inset, mBoxW - 2 * inset, color, mBoxColor);
+    WidgetPixels += (mBoxW - 2 * inset) * mAtlas->height;
+    WidgetRows(mTextY, mAtlas->height);
+  }
+  else {
+    drawFont(tft, text, color);
+  }
+
+  strncpy(mText, text, WIDGET_TEXT_MAX - 1);
+  mText[WIDGET_TEXT_MAX - 1] = 0;
+  mColor = color;
+  drawn();
+  return true;
+}
+
+void ValueLabel::drawFont(TFT_eSPI &tft, const char *text, uint16_t color) {
+
+  if (mBoxRadius) { tft.fillSmoothRoundRect(mBoxX, mBoxY, mBoxW, mBoxH, mBoxRadius, mBoxColor, mBackground); }
+  else { tft.fillRect(mBoxX, mBoxY, mBoxW, mBoxH, mBoxColor); }
+  WidgetPixels += mBoxW * mBoxH;
+  WidgetRows(mBoxY, mBoxH);
+
+  tft.setTextSize(mSize);
+  tft.setTextColor(color);
+  switch (mAlign) {
+    case AlignLeft: tft.drawString(text, mTextX, mTextY, mFont); break;
+    case AlignCentre: tft.drawCentreString(text, mTextX, mTextY, mFont); break;
+    case AlignRight: tft.drawRightString(text, mTextX, mTextY, mFont); break;
+  }
+  WidgetPixels += tft.textWidth(text, mFont) * tft.fontHeight(mFont);
+  WidgetRows(mTextY, tft.fontHeight(mFont));
+}
+
+// IndicatorPill =======================================================================================
+
+IndicatorPill::IndicatorPill(int16_t x, int16_t y, int16_t w, int16_t h, int16_t radius, const char *label, int16_t textX, int16_t textY,
+                             PillStyle style, uint16_t frameColor, uint16_t background, uint16_t highlightColor)
+  : mX(x), mY(y), mW(w), mH(h), mRadius(radius), mLabel(label), mTextX(textX), mTextY(textY),
+    mStyle(style), mFrameColor(frameColor), mBackground(background), mHighlightColor(highlightColor) {}
+
+bool IndicatorPill::draw(TFT_eSPI &tft, uint16_t color) {
+  if (valid() && color == mColor) { return false; }
+
+  uint16_t textColor = color;
+  switch (mStyle) {
+    case PillFilled:
+      tft.fillRoundRect(mX, mY, mW, mH, mRadius, color);
+      textColor = mFrameColor;
+      break;
+    case PillOutline:
+      tft.drawRoundRect(mX, mY, mW, mH, mRadius, mFrameColor);
+      break;
+    case PillOutlineHighlight:
+      if (color == mHighlightColor) {
+        tft.fillRoundRect(mX, mY, mW, mH, mRadius, color);
+        textColor = TFT_BLACK;
+      }
+      else {
+        tft.fillRoundRect(mX, mY, mW, mH, mRadius, mBackground);
+        tft.drawRoundRect(mX, mY, mW, mH, mRadius, mFrameColor);
+      }
+      break;
+  }
+  WidgetPixels += (mStyle == PillOutline) ? 2 * (mW + mH) : mW * mH;
+  WidgetRows(mY, mH);
+
+  tft.setTextSize(1);
+  tft.setTextColor(textColor);
+  tft.drawString(mLabel, mTextX, mTextY, 1);
+  WidgetPixels += tft.textWidth(mLabel, 1) * tft.fontHeight(1);
+  WidgetRows(mTextY, tft.fontHeight(1));
+
+  mColor = color;
+  drawn();
+  return true;
+}
+
+// HistoryChart ========================================================================================
+
+static const int16_t ChartAxis = WIDGET_CHART_HEIGHT - 4;  // zero power row: 10 rows consumption, 3 recuperation
+
+static uint16_t ChartColor(uint16_t color) { return color >> 8 | color << 8; }
+
+HistoryChart::HistoryChart(int16_t x, int16_t y, const HistoryChartColors &colors)
+  : mX(x), mY(y),
+    mColors{ ChartColor(colors.background), ChartColor(colors.axis), ChartColor(colors.power), ChartColor(colors.powerHigh),
+             ChartColor(colors.regen), ChartColor(colors.speed) } {}
+
+void HistoryChart::add(const HistorySample &sample, uint32_t sequence) {
+  if (sequence == mSequence) { return; }
+  uint32_t samples = mSequence ? sequence - mSequence : 1;
+  if (samples > HISTORY_SAMPLES) { samples = HISTORY_SAMPLES; }
+  HistorySample gap;
+  gap.gap = true;
+  for (uint32_t i = 1; i < samples; i++) { mSamples.push(gap); } // missed samples: empty columns
+  mSamples.push(sample);
+  mPending = min((uint32_t)(mPending + samples), (uint32_t)HISTORY_SAMPLES);
+  mSequence = sequence;
+}
+
+void HistoryChart::renderColumn(int16_t column, const HistorySample &sample) {
+  uint16_t *pixel = mPixels + column;
+  for (int16_t row = 0; row < WIDGET_CHART_HEIGHT; row++) { pixel[row * HISTORY_SAMPLES] = mColors.background; }
+  if (sample.gap) { return; } // no axis either, the gap stays visible
+  pixel[ChartAxis * HISTORY_SAMPLES] = mColors.axis;
+
+  if (sample.power > 0) {
+    int16_t bar = min((int32_t)((sample.power * ChartAxis + HISTORY_POWER_MAX / 2) / HISTORY_POWER_MAX), (int32_t)ChartAxis);
+    int16_t high = ChartAxis - HISTORY_POWER_HIGH * ChartAxis / HISTORY_POWER_MAX; // rows above are in the warning color
+    for (int16_t row = ChartAxis - bar; row < ChartAxis; row++) { pixel[row * HISTORY_SAMPLES] = row < high ? mColors.powerHigh : mColors.power; }
+  }
+  else if (sample.power < 0) {
+    const int16_t rows = WIDGET_CHART_HEIGHT - 1 - ChartAxis;
+    int16_t bar = min((int32_t)((-sample.power * rows + HISTORY_REGEN_MAX / 2) / HISTORY_REGEN_MAX), (int32_t)rows);
+    for (int16_t row = ChartAxis + 1; row <= ChartAxis + bar; row++) { pixel[row * HISTORY_SAMPLES] = mColors.regen; }
+  }
+
+  if (sample.speed) {
+    int16_t row = WIDGET_CHART_HEIGHT - 1 - min(sample.speed * (WIDGET_CHART_HEIGHT - 1) / HISTORY_SPEED_MAX, WIDGET_CHART_HEIGHT - 1);
+    pixel[row * HISTORY_SAMPLES] = mColors.speed;
+  }
+}
+
+bool HistoryChart::draw(TFT_eSPI &tft) {
+  static const HistorySample empty;
+  uint16_t columns;
+  if (!valid()) {
+    columns = HISTORY_SAMPLES;
+  }
+  else {
+    if (mPending == 0) { return false; }
+    columns = mPending;
+    for (int16_t row = 0; row < WIDGET_CHART_HEIGHT; row++) {
+      uint16_t *line = mPixels + row * HISTORY_SAMPLES;
+      memmove(line, line + columns, (HISTORY_SAMPLES - columns) * sizeof(uint16_t));
+    }
+  }
+  for (uint16_t age = 0; age < columns; age++) {
+    renderColumn(HISTORY_SAMPLES - 1 - age, age < mSamples.count() ? mSamples.recent(age) : empty);
+  }
+
+  DisplayPushImage(tft, mX, mY, HISTORY_SAMPLES, WIDGET_CHART_HEIGHT, mPixels);
+  WidgetPixels += HISTORY_SAMPLES * WIDGET_CHART_HEIGHT;
+  WidgetRows(mY, WIDGET_CHART_HEIGHT);
+
+  mPending = 0;
+  drawn();
+  return true;
+}
@@ -0,0 +1,178 @@
+// Retained mode widgets for the round display
+// Every widget remembers what it drew last (quantized: whole degrees, formatted text,
+// colors) and only talks to the panel if that changes or the screen was cleared since.
+// Draw all widgets of a frame between WidgetFrameBegin() and WidgetFrameEnd(), which
+// count the pixels pushed and the rows touched (the rows a framebuffer has to send).
+
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <ringtable.h>
+#include <glyphs.h>
+#include <history.h>
+#include <tween.h>
+
+#define WIDGET_TEXT_MAX 16
+#define WIDGET_RINGS 4 // distinct radius pairs with a coverage table
+#define WIDGET_TEXT_BAND 2048 // pixels of the DisplayText() line buffer
+#define WIDGET_CHART_HEIGHT 14 // HistoryChart rows, one column per sample (HISTORY_SAMPLES)
+
+struct DisplayStatistics {
+  uint32_t frames = 0;          // WidgetFrameBegin/End pairs
+  uint32_t framesChanged = 0;   // frames that pushed pixels
+  uint32_t pixelsLastFrame = 0; // estimate from the bounding boxes drawn
+  uint32_t pixelsMaxFrame = 0;
+  uint64_t pixelsTotal = 0;
+  uint32_t clears = 0;          // DisplayClear() calls
+  uint32_t allocationsLast = 0; // heap allocations while drawing the last frame (ALLOCATION_COUNTER)
+  uint32_t allocationsTotal = 0;
+  uint32_t framesAllocating = 0;
+};
+
+extern DisplayStatistics DisplayStats;
+extern uint32_t DisplayEpoch;   // incremented by every DisplayClear(), invalidates all widgets
+extern uint32_t WidgetPixels;   // pixels pushed in the current frame
+extern int16_t WidgetRowFirst;  // rows drawn in the current frame, none if WidgetRowLast < WidgetRowFirst
+extern int16_t WidgetRowLast;
+
+// Clears the whole screen (and the framebuffer), all widgets redraw on their next draw()
+void DisplayClear(TFT_eSPI &tft, uint32_t color);
+
+// Coverage table for a radius pair, built on first use; NULL if all slots are taken (draw with drawSmoothArc then)
+const RingTable *WidgetRing(int16_t radius, int16_t innerRadius);
+uint32_t WidgetRingBytes();
+
+// drawSmoothArc() replacement using the coverage tables (falls back to drawSmoothArc)
+void DisplayArc(TFT_eSPI &tft, int16_t x, int16_t y, int16_t radius, int16_t innerRadius, uint16_t start, uint16_t end,
+                uint16_t color, uint16_t background, bool roundEnds = false);
+
+// Anti-aliased atlas text, rendered row by row into a line buffer on the background color and
+// pushed as one block: columns clipX .. clipX + clipWidth - 1 of the atlas height are rewritten
+// (old text is erased in the same pass).
+void DisplayText(TFT_eSPI &tft, const GlyphAtlas &atlas, const char *text, int16_t x, int16_t y,
+                 int16_t clipX, int16_t clipWidth, uint16_t color, uint16_t background);
+int16_t DisplayTextX(const GlyphAtlas &atlas, const char *text, int16_t x, uint8_t align);
+
+void WidgetFrameBegin();
+void WidgetFrameEnd();
+
+class Widget {
+  protected:
+    bool valid() const { return mEpoch == DisplayEpoch; }
+    void drawn() { mEpoch = DisplayEpoch; }
+
+  private:
+    uint32_t mEpoch = 0xFFFFFFFF;
+};
+
+// Ring segment around (x, y): a track over [trackStart, trackEnd] and a value segment
+// on top of it. An optional marker spot is shown while the value segment is empty.
+// If only one end of the value moves and the color stays, only the degrees in between are
+// drawn: the value grows over the track, or the track is restored where it shrank.
+class ArcGauge : public Widget {
+  public:
+    ArcGauge(int16_t x, int16_t y, int16_t trackRadius, int16_t valueRadius, int16_t innerRadius,
+             uint16_t trackStart, uint16_t trackEnd, uint16_t trackColor, uint16_t background);
+    void setMarker(int16_t x, int16_t y, int16_t radius, uint16_t color);
+
+    // Angles in degrees (TFT_eSPI: 0 = bottom, clockwise), start == end = empty. Returns true if drawn.
+    bool draw(TFT_eSPI &tft, uint16_t start, uint16_t end, uint16_t color);
+    // As draw(), but a moving end glides to its new angle (tween.h); call again every frame
+    // while animating(). Color changes and a value appearing or disappearing are shown at once.
+    bool animate(TFT_eSPI &tft, uint16_t start, uint16_t end, uint16_t color, uint32_t nowMs);
+    bool animating(uint32_t nowMs) const { return mTween.active(nowMs); }
+
+  private:
+    bool drawDelta(TFT_eSPI &tft, uint16_t start, uint16_t end);
+    void drawSegment(TFT_eSPI &tft, int16_t radius, uint16_t start, uint16_t end, uint16_t color);
+    void drawCap(TFT_eSPI &tft, uint16_t angle, uint16_t color);
+
+    int16_t mX, mY, mTrackRadius, mValueRadius, mInnerRadius;
+    uint16_t mTrackStart, mTrackEnd, mTrackColor, mBackground;
+    uint8_t mCapDegrees;              // a round end reaches this far past its angle
+    int16_t mMarkerX = 0, mMarkerY = 0, mMarkerRadius = 0;
+    uint16_t mMarkerColor = 0;
+    uint16_t mStart = 0, mEnd = 0, mColor = 0;
+    Tween mTween;                     // angle of the moving end
+    bool mTweenStart = false;         // the start moves, not the end
+    uint16_t mTargetStart = 0, mTargetEnd = 0, mTargetColor = 0;
+};
+
+enum LabelAlign : uint8_t { AlignLeft, AlignCentre, AlignRight };
+
+// Text on a background box (radius 0 = plain rectangle), in a TFT_eSPI font or from a glyph atlas.
+// Atlas text rewrites its rows across the box, the box itself is only drawn after a clear.
+class ValueLabel : public Widget {
+  public:
+    ValueLabel(int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, int16_t boxRadius, uint16_t boxColor, uint16_t background,
+               int16_t textX, int16_t textY, LabelAlign align, uint8_t font, uint8_t size);
+    ValueLabel(int16_t boxX, int16_t boxY, int16_t boxW, int16_t boxH, int16_t boxRadius, uint16_t boxColor, uint16_t background,
+               int16_t textX, int16_t textY, LabelAlign align, const GlyphAtlas &atlas);
+
+    bool draw(TFT_eSPI &tft, const char *text, uint16_t color);
+
+  private:
+    void drawFont(TFT_eSPI &tft, const char *text, uint16_t color);
+
+    int16_t mBoxX, mBoxY, mBoxW, mBoxH, mBoxRadius;
+    uint16_t mBoxColor, mBackground;
+    int16_t mTextX, mTextY;
+    LabelAlign mAlign;
+    uint8_t mFont, mSize;
+    const GlyphAtlas *mAtlas = NULL;
+    char mText[WIDGET_TEXT_MAX] = "";
+    uint16_t mColor = 0;
+};
+
+enum PillStyle : uint8_t {
+  PillFilled,            // pill in the state color, label in the frame color
+  PillOutline,           // frame outline, label in the state color
+  PillOutlineHighlight,  // like PillOutline, filled with black label while the state is the highlight color
+};
+
+// Status indicator: rounded pill with a fixed label, colored by state
+class IndicatorPill : public Widget {
+  public:
+    IndicatorPill(int16_t x, int16_t y, int16_t w, int16_t h, int16_t radius, const char *label, int16_t textX, int16_t textY,
+                  PillStyle style, uint16_t frameColor, uint16_t background, uint16_t highlightColor = 0);
+
+    bool draw(TFT_eSPI &tft, uint16_t color);
+
+  private:
+    int16_t mX, mY, mW, mH, mRadius;
+    const char *mLabel;
+    int16_t mTextX, mTextY;
+    PillStyle mStyle;
+    uint16_t mFrameColor, mBackground, mHighlightColor;
+    uint16_t mColor = 0;
+};
+
+struct HistoryChartColors {
+  uint16_t background, axis, power, powerHigh, regen, speed;
+};
+
+// Rolling power/speed chart, newest sample on the right: power as bars from the zero axis
+// (consumption up, recuperation down), speed as a line of dots. The chart keeps its own
+// pixels; a new sample shifts them left by a column and renders the new column only, then
+// the strip is sent as one block - the same SPI cost per sample however busy the drive.
+// All columns are rendered after a clear. Missed samples are left empty, without the axis.
+class HistoryChart : public Widget {
+  public:
+    HistoryChart(int16_t x, int16_t y, const HistoryChartColors &colors);
+
+    // Newest sample of the view model, sequence = HistorySampler::count(). Call for every model,
+    // also while another screen is shown.
+    void add(const HistorySample &sample, uint32_t sequence);
+    bool draw(TFT_eSPI &tft);
+
+  private:
+    void renderColumn(int16_t column, const HistorySample &sample);
+
+    int16_t mX, mY;
+    HistoryChartColors mColors;       // high byte first (DisplayPushImage)
+    HistoryRing<HISTORY_SAMPLES> mSamples;
+    uint32_t mSequence = 0;
+    uint16_t mPending = 0;            // samples not drawn yet
+    uint16_t mPixels[HISTORY_SAMPLES * WIDGET_CHART_HEIGHT];
+};
@@ -0,0 +1,172 @@
+// Host benchmark: table driven CAN decoder (src/candecoder.h) vs. the former CANCheckMessage() switch
+//
+// Build & run:
+//   g++ -std=c++17 -O2 -I src tools/bench_candecoder.cpp -o bench_candecoder && ./bench_candecoder
+
+#include <candecoder.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+struct Frame {
+  uint32_t id;
+  uint8_t len;
+  uint8_t data[8];
+};
+
+#pragma GCC diagnostic ignored "-Wlogical-not-parentheses"
+#pragma GCC diagnostic ignored "-Wbool-compare"
+
+// Former switch, ported 1:1 (including the DLC checks that never trigger)
+struct LegacyValues {
+  int ODO = 0;
+  int Speed = 0;
+  int OBCRemainingMinutes = -1;
+  float Battery = 0.0;
+  int Temp1 = -99;
+  int Temp2 = -99;
+  float Volt = 0;
+  int SoC = 101;
+  const char *Gear = "?";
+  int RemainingDistance = 0;
+  int Ready = -1;
+  float Current = 0;
+  int Handbrake = -1;
+};
+
+static void LegacyDecode(const Frame &canMsg, LegacyValues &canValues) {
+  switch (canMsg.id) {
+    case 0x581: {
+      if (!canMsg.len == 8) { break; }
+      unsigned int value1 = canMsg.data[6] << 16 | canMsg.data[5] << 8 | canMsg.data[4];
+      canValues.ODO = (float)value1;
+      canValues.Speed = canMsg.data[7];
+      }
+      break;
+    case 0x582: {
+      if (!canMsg.len == 8) { break; }
+      unsigned int value = canMsg.data[1] << 8 | canMsg.data[0];
+      canValues.OBCRemainingMinutes = value / 60;
+      if (canValues.OBCRemainingMinutes > 600) { canValues.OBCRemainingMinutes = -1; }
+      }
+      break;
+    case 0x593: {
+      if (!canMsg.len == 8) { break; }
+      unsigned int value = (canMsg.data[1] << 8) | canMsg.data[0];
+      canValues.Battery = (float)value / 100;
+      }
+      break;
+    case 0x594: {
+      if (!canMsg.len == 8) { break; }
+      int value1 = canMsg.data[0];
+      if (value1 >= 128) { value1 = value1 - 256; }
+      canValues.Temp1 = value1;
+      int value2 = canMsg.data[3];
+      if (value2 >= 128) { value2 = value2 - 256; }
+      canValues.Temp2 = value2;
+      }
+      break;
+    case 0x580: {
+      if (!canMsg.len == 8) { break; }
+      int value1 = (canMsg.data[1] << 8 | canMsg.data[0]);
+      if (value1 > 32767) { value1 = value1 - 65536; }
+      canValues.Current = (float)value1 / 10;
+      int value2 = (canMsg.data[3] << 8) | canMsg.data[2];
+      if (value2 > 4200 && value2 < 6500) { canValues.Volt = (float)value2 / 100; }
+      canValues.SoC = canMsg.data[5];
+      }
+      break;
+    case 0x713: {
+      if (!canMsg.len == 7) { break; }
+      int value1 = ((canMsg.data[1] & 0x01) << 1) | ((canMsg.data[0] >> 7) & 0x01);
+      switch (value1) {
+        case 0b00: canValues.Gear = "R"; break;
+        case 0b01: canValues.Gear = "N"; break;
+        case 0b10: canValues.Gear = "D"; break;
+        case 0b11: canValues.Gear = "-"; break;
+        default: canValues.Gear = "?"; break;
+      }
+      canValues.RemainingDistance = canMsg.data[0] & 0x3F;
+      switch ((canMsg.data[2] & 0b00000111)) {
+        case 0b101: canValues.Ready = 1; break;
+        case 0b11: canValues.Ready = 0; break;
+        default: canValues.Ready = -1; break;
+      }
+      }
+      break;
+    case 0x714: {
+      if (!canMsg.len == 2) { break; }
+      if (canMsg.data[0] == 0x01) { canValues.Handbrake = 1; }
+      else if (canMsg.data[0] == 0x00) { canValues.Handbrake = 0; }
+      else { canValues.Handbrake = -1; }
+      }
+      break;
+  }
+}
+
+int main(int argc, char **argv) {
+  const size_t frameCount = 1 << 16;
+  const int rounds = argc > 1 ? atoi(argv[1]) : 200;
+  const uint32_t ids[] = { 0x580, 0x581, 0x582, 0x593, 0x594, 0x713, 0x714 };
+
+  // Random payloads, mix of decoded IDs as seen on the bus (0x580 most frequent)
+  std::vector<Frame> frames(frameCount);
+  srand(1);
+  for (Frame &frame : frames) {
+    int r = rand() % 10;
+    frame.id = r < 4 ? 0x580 : ids[r % 7];
+    frame.len = 8;
+    for (uint8_t &b : frame.data) { b = rand(); }
+  }
+
+  // Cross check both decoders on every frame
+  LegacyValues legacy;
+  float values[SignalCount] = {};
+  values[SignalOBCRemainingMinutes] = -1;
+  size_t mismatches = 0;
+  for (size_t i = 0; i < frameCount; i++) {
+    const Frame &frame = frames[i];
+    uint32_t updated;
+    LegacyDecode(frame, legacy);
+    CanDecodeFrame(frame.id, frame.len, frame.data, values, updated);
+    if (i < 256) { continue; } // until every ID has been seen once the start values differ
+    static const char *gearNames[] = { "R", "N", "D", "-" };
+    if (legacy.ODO != (int)values[SignalODO] || legacy.Speed != (int)values[SignalSpeed] ||
+        legacy.OBCRemainingMinutes != (int)values[SignalOBCRemainingMinutes] || legacy.Temp1 != (int)values[SignalTemp1] ||
+        legacy.Temp2 != (int)values[SignalTemp2] || legacy.SoC != (int)values[SignalSoC] ||
+        legacy.Gear[0] != gearNames[(int)values[SignalGear]][0] || legacy.RemainingDistance != (int)values[SignalRemainingDistance] ||
+        legacy.Ready != (int)values[SignalReady] || legacy.Handbrake != (int)values[SignalHandbrake]) {
+      mismatches++;
+    }
+  }
+
+  using Clock = std::chrono::steady_clock;
+  volatile float sink = 0;
+
+  auto t0 = Clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (const Frame &frame : frames) { LegacyDecode(frame, legacy); }
+    sink = sink + legacy.Current;
+  }
+  auto t1 = Clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (const Frame &frame : frames) {
+      uint32_t updated;
+      CanDecodeFrame(frame.id, frame.len, frame.data, values, updated);
+    }
+    sink = sink + values[SignalCurrent];
+  }
+  auto t2 = Clock::now();
+
+  double total = (double)frameCount * rounds;
+  double legacyNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / total;
+  double tableNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / total;
+  printf("frames:             %.0f\n", total);
+  printf("switch decoder:     %.2f ns/frame\n", legacyNs);
+  printf("table decoder:      %.2f ns/frame\n", tableNs);
+  printf("integer mismatches: %zu (expected 0)\n", mismatches);
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,316 @@
+// Glyph atlas generator for the firmware: TrueType font -> anti-aliased 4 bit atlases (format: src/glyphs.h)
+//
+// Renders the given characters at the given digit heights with 16x16 supersampling. Digits
+// share one advance (tabular, numbers don't jump while they change), other characters get
+// their ink width plus the gap.
+//
+// Build & run:
+//   g++ -std=c++17 -O2 -I src tools/glyphpack.cpp -o glyphpack
+//   ./glyphpack SourceCodePro-Bold.ttf "0123456789.-%VAkWC>" GlyphsMedium:14 GlyphsLarge:21 GlyphsHuge:28 > src/glyphatlas.h
+// (sizes match the GLCD font at text size 2, 3 and 4: 7 px digits x size)
+
+#include <glyphs.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define SUPERSAMPLING 16
+
+struct Font {
+  std::vector<uint8_t> data;
+  uint32_t glyf = 0, loca = 0, cmap = 0;
+  bool longLoca = false;
+
+  uint16_t u16(uint32_t at) const { return data[at] << 8 | data[at + 1]; }
+  int16_t s16(uint32_t at) const { return (int16_t)u16(at); }
+  uint32_t u32(uint32_t at) const { return (uint32_t)u16(at) << 16 | u16(at + 2); }
+
+  bool load(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) { return false; }
+    uint8_t buffer[65536];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) { data.insert(data.end(), buffer, buffer + n); }
+    fclose(f);
+    if (data.size() < 12) { return false; }
+    uint32_t head = 0;
+    for (uint16_t i = 0; i < u16(4); i++) {
+      uint32_t entry = 12 + 16 * i;
+      std::string tag((const char*)&data[entry], 4);
+      uint32_t offset = u32(entry + 8);
+      if (tag == "glyf") { glyf = offset; }
+      else if (tag == "loca") { loca = offset; }
+      else if (tag == "cmap") { cmap = offset; }
+      else if (tag == "head") { head = offset; }
+    }
+    if (!glyf || !loca || !cmap || !head) { return false; }
+    longLoca = s16(head + 50) != 0;
+    return true;
+  }
+
+  // cmap format 4 (Unicode BMP)
+  uint16_t glyphIndex(uint16_t code) const {
+    for (uint16_t i = 0; i < u16(cmap + 2); i++) {
+      uint32_t table = cmap + u32(cmap + 4 + 8 * i + 4);
+      if (u16(table) != 4) { continue; }
+      uint16_t segments = u16(table + 6) / 2;
+      uint32_t ends = table + 14, starts = ends + 2 * segments + 2, deltas = starts + 2 * segments, ranges = deltas + 2 * segments;
+      for (uint16_t s = 0; s < segments; s++) {
+        if (code > u16(ends + 2 * s) || code < u16(starts + 2 * s)) { continue; }
+        uint16_t rangeOffset = u16(ranges + 2 * s);
+        if (rangeOffset == 0) { return code + u16(deltas + 2 * s); }
+        uint16_t glyph = u16(ranges + 2 * s + rangeOffset + 2 * (code - u16(starts + 2 * s)));
+        return glyph ? glyph + u16(deltas + 2 * s) : 0;
+      }
+    }
+    return 0;
+  }
+
+  uint32_t glyphOffset(uint16_t index) const {
+    return glyf + (longLoca ? u32(loca + 4 * index) : 2u * u16(loca + 2 * index));
+  }
+};
+
+struct Point { float x, y; };
+typedef std::vector<Point> Contour;
+
+// Outline as closed polygons (quadratic curves flattened), font units, y up
+static void Outline(const Font &font, uint16_t index, float dx, float dy, std::vector<Contour> &contours) {
+  uint32_t at = font.glyphOffset(index);
+  if (font.glyphOffset(index + 1) == at) { return; } // empty (space)
+  int16_t count = font.s16(at);
+
+  if (count < 0) { // composite: offsets only
+    uint32_t p = at + 10;
+    uint16_t flags;
+    do {
+      flags = font.u16(p);
+      uint16_t component = font.u16(p + 2);
+      p += 4;
+      float ox, oy;
+      if (flags & 0x0001) { ox = font.s16(p); oy = font.s16(p + 2); p += 4; }
+      else { ox = (int8_t)font.data[p]; oy = (int8_t)font.data[p + 1]; p += 2; }
+      if (flags & 0x0008) { p += 2; } else if (flags & 0x0040) { p += 4; } else if (flags & 0x0080) { p += 8; }
+      Outline(font, component, dx + ox, dy + oy, contours);
+    } while (flags & 0x0020);
+    return;
+  }
+
+  std::vector<uint16_t> ends;
+  for (int16_t i = 0; i < count; i++) { ends.push_back(font.u16(at + 10 + 2 * i)); }
+  uint16_t points = ends.empty() ? 0 : ends.back() + 1;
+  uint32_t p = at + 10 + 2 * count;
+  p += 2 + font.u16(p); // instructions
+
+  std::vector<uint8_t> flags;
+  while (flags.size() < points) {
+    uint8_t flag = font.data[p++];
+    flags.push_back(flag);
+    if (flag & 0x08) { for (uint8_t r = font.data[p++]; r; r--) { flags.push_back(flag); } }
+  }
+  std::vector<Point> xy(points);
+  int32_t value = 0;
+  for (uint16_t i = 0; i < points; i++) {
+    if (flags[i] & 0x02) { value += (flags[i] & 0x10) ? font.data[p] : -font.data[p]; p++; }
+    else if (!(flags[i] & 0x10)) { value += font.s16(p); p += 2; }
+    xy[i].x = value + dx;
+  }
+  value = 0;
+  for (uint16_t i = 0; i < points; i++) {
+    if (flags[i] & 0x04) { value += (flags[i] & 0x20) ? font.data[p] : -font.data[p]; p++; }
+    else if (!(flags[i] & 0x20)) { value += font.s16(p); p += 2; }
+    xy[i].y = value + dy;
+  }
+
+  uint16_t first = 0;
+  for (uint16_t end : ends) {
+    // Walk from an on curve point, implied on curve points between two off curve points
+    std::vector<std::pair<Point, bool>> ring;
+    for (uint16_t i = first; i <= end; i++) { ring.push_back({ xy[i], (flags[i] & 0x01) != 0 }); }
+    first = end + 1;
+    size_t n = ring.size();
+    size_t start = 0;
+    while (start < n && !ring[start].second) { start++; }
+    Point origin;
+    if (start == n) { // all off curve
+      origin = { (ring[0].first.x + ring[1 % n].first.x) / 2, (ring[0].first.y + ring[1 % n].first.y) / 2 };
+      start = 0;
+    }
+    else { origin = ring[start].first; }
+
+    Contour contour = { origin };
+    Point current = origin;
+    for (size_t k = 1; k <= n; k++) {
+      const auto &point = ring[(start + k) % n];
+      if (point.second) { contour.push_back(point.first); current = point.first; continue; }
+      const auto &next = ring[(start + k + 1) % n];
+      Point to = next.second ? next.first : Point{ (point.first.x + next.first.x) / 2, (point.first.y + next.first.y) / 2 };
+      for (int s = 1; s <= 8; s++) {
+        float t = s / 8.0f, u = 1 - t;
+        contour.push_back({ u * u * current.x + 2 * u * t * point.first.x + t * t * to.x, u * u * current.y + 2 * u * t * point.first.y + t * t * to.y });
+      }
+      current = to;
+      if (next.second) { k++; }
+    }
+    contours.push_back(contour);
+  }
+}
+
+struct Bitmap {
+  int width = 0, height = 0;
+  std::vector<float> coverage;
+};
+
+// Nonzero winding, pixel (0,0) top left of the cell; the cell spans font y top .. top - height / scale
+static Bitmap Rasterize(const std::vector<Contour> &contours, float scale, float top, int width, int height) {
+  Bitmap bitmap;
+  bitmap.width = width;
+  bitmap.height = height;
+  bitmap.coverage.assign(width * height, 0);
+  const float weight = 1.0f / (SUPERSAMPLING * SUPERSAMPLING);
+  for (int sy = 0; sy < height * SUPERSAMPLING; sy++) {
+    float y = top - (sy + 0.5f) / SUPERSAMPLING / scale;
+    std::vector<std::pair<float, int>> crossings;
+    for (const Contour &c : contours) {
+      for (size_t i = 0; i < c.size(); i++) {
+        Point a = c[i], b = c[(i + 1) % c.size()];
+        if ((a.y <= y) == (b.y <= y)) { continue; }
+        float x = a.x + (y - a.y) / (b.y - a.y) * (b.x - a.x);
+        crossings.push_back({ x * scale * SUPERSAMPLING, b.y > a.y ? 1 : -1 });
+      }
+    }
+    std::sort(crossings.begin(), crossings.end());
+    int winding = 0;
+    for (size_t i = 0; i + 1 < crossings.size(); i++) {
+      winding += crossings[i].second;
+      if (winding == 0) { continue; }
+      int from = std::max(0, (int)ceilf(crossings[i].first - 0.5f));
+      int to = std::min(width * SUPERSAMPLING, (int)ceilf(crossings[i + 1].first - 0.5f));
+      for (int sx = from; sx < to; sx++) { bitmap.coverage[(sy / SUPERSAMPLING) * width + sx / SUPERSAMPLING] += weight; }
+    }
+  }
+  return bitmap;
+}
+
+struct Glyph {
+  char code;
+  std::vector<Contour> contours;
+  float xMin = 0, xMax = 0, yMin = 0, yMax = 0; // font units
+  bool empty = true;
+};
+
+int main(int argc, char **argv) {
+  if (argc < 4) {
+    fprintf(stderr, "usage: glyphpack <font.ttf> <characters> <Name:digit height px>...   header to stdout\n");
+    return 1;
+  }
+  Font font;
+  if (!font.load(argv[1])) { fprintf(stderr, "can't read %s (TrueType outlines expected)\n", argv[1]); return 1; }
+
+  std::vector<Glyph> glyphs;
+  for (const char *c = argv[2]; *c; c++) {
+    Glyph glyph;
+    glyph.code = *c;
+    uint16_t index = font.glyphIndex((uint8_t)*c);
+    if (index == 0) { fprintf(stderr, "no glyph for '%c'\n", *c); return 1; }
+    Outline(font, index, 0, 0, glyph.contours);
+    for (const Contour &contour : glyph.contours) {
+      for (const Point &p : contour) {
+        if (glyph.empty) { glyph.xMin = glyph.xMax = p.x; glyph.yMin = glyph.yMax = p.y; glyph.empty = false; }
+        glyph.xMin = std::min(glyph.xMin, p.x);
+        glyph.xMax = std::max(glyph.xMax, p.x);
+        glyph.yMin = std::min(glyph.yMin, p.y);
+        glyph.yMax = std::max(glyph.yMax, p.y);
+      }
+    }
+    glyphs.push_back(glyph);
+  }
+  Outline(font, font.glyphIndex('0'), 0, 0, glyphs.emplace_back().contours); // reference for the digit height
+  Glyph zero = glyphs.back();
+  glyphs.pop_back();
+  float zeroTop = -1e9, zeroBottom = 1e9;
+  for (const Contour &contour : zero.contours) {
+    for (const Point &p : contour) { zeroTop = std::max(zeroTop, p.y); zeroBottom = std::min(zeroBottom, p.y); }
+  }
+
+  const char *file = strrchr(argv[1], '/') ? strrchr(argv[1], '/') + 1 : argv[1];
+  printf("// Generated by tools/glyphpack.cpp from %s - do not edit\n", file);
+  printf("// Characters: %s\n\n", argv[2]);
+  printf("#pragma once\n\n#include <pgmspace.h>\n#include <glyphs.h>\n");
+
+  for (int a = 3; a < argc; a++) {
+    std::string name = argv[a];
+    size_t colon = name.find(':');
+    if (colon == std::string::npos) { fprintf(stderr, "size expected: %s\n", argv[a]); return 1; }
+    float digitHeight = atof(name.c_str() + colon + 1);
+    name.resize(colon);
+    float scale = digitHeight / (zeroTop - zeroBottom);
+
+    // Cell: top of the highest glyph to the bottom of the lowest, whole pixels
+    float top = -1e9, bottom = 1e9;
+    for (const Glyph &g : glyphs) { if (!g.empty) { top = std::max(top, g.yMax); bottom = std::min(bottom, g.yMin); } }
+    int height = (int)ceilf((top - bottom) * scale);
+    float gap = roundf(digitHeight * 0.15f);
+
+    std::vector<Bitmap> bitmaps;
+    std::vector<int> lefts, widths;
+    int digitWidth = 0;
+    for (const Glyph &g : glyphs) {
+      int width = g.empty ? 0 : (int)ceilf((g.xMax - g.xMin) * scale) + 1;
+      // Shift the ink to start at column 0
+      std::vector<Contour> shifted = g.contours;
+      for (Contour &c : shifted) { for (Point &p : c) { p.x -= g.xMin; } }
+      Bitmap bitmap = Rasterize(shifted, scale, top, width, height);
+      // Trim empty columns
+      int first = 0, last = width - 1;
+      auto columnEmpty = [&](int x) { for (int y = 0; y < height; y++) { if (bitmap.coverage[y * width + x] >= 0.5f / 15) { return false; } } return true; };
+      while (first <= last && columnEmpty(first)) { first++; }
+      while (last >= first && columnEmpty(last)) { last--; }
+      Bitmap trimmed;
+      trimmed.width = last >= first ? last - first + 1 : 0;
+      trimmed.height = height;
+      for (int y = 0; y < height; y++) { for (int x = first; x <= last; x++) { trimmed.coverage.push_back(bitmap.coverage[y * width + x]); } }
+      bitmaps.push_back(trimmed);
+      if (g.code >= '0' && g.code <= '9') { digitWidth = std::max(digitWidth, trimmed.width); }
+    }
+
+    printf("\n// %s: digits %.0f px, cell height %d px\n", name.c_str(), digitHeight, height);
+    printf("const uint8_t %sBitmap[] PROGMEM = {", name.c_str());
+    std::vector<GlyphInfo> infos;
+    uint32_t offset = 0;
+    for (size_t i = 0; i < glyphs.size(); i++) {
+      const Bitmap &b = bitmaps[i];
+      bool digit = glyphs[i].code >= '0' && glyphs[i].code <= '9';
+      int advance = (digit ? digitWidth : (b.width ? b.width : (int)(digitHeight / 3))) + (int)gap;
+      GlyphInfo info = { glyphs[i].code, (uint8_t)advance, (uint8_t)((advance - b.width) / 2), (uint8_t)b.width, (uint16_t)offset };
+      infos.push_back(info);
+      printf("\n  // '%c'", glyphs[i].code);
+      for (int y = 0; y < b.height; y++) {
+        printf("\n ");
+        for (int x = 0; x < b.width; x += 2) {
+          int hi = (int)lroundf(std::min(1.0f, b.coverage[y * b.width + x]) * 15);
+          int lo = x + 1 < b.width ? (int)lroundf(std::min(1.0f, b.coverage[y * b.width + x + 1]) * 15) : 0;
+          printf(" 0x%X%X,", hi, lo);
+          offset++;
+        }
+      }
+    }
+    printf("\n};\n");
+    if (offset > 0xFFFF) { fprintf(stderr, "%s: bitmap too large\n", name.c_str()); return 1; }
+
+    printf("const GlyphInfo %sGlyphs[] PROGMEM = {\n", name.c_str());
+    for (const GlyphInfo &info : infos) {
+      printf("  { '%s%c', %u, %u, %u, %u },\n", info.code == '\'' || info.code == '\\' ? "\\" : "", info.code, info.advance, info.left, info.width, info.offset);
+    }
+    printf("};\n");
+    printf("const GlyphAtlas %s = { %d, %zu, %sGlyphs, %sBitmap };\n", name.c_str(), height, infos.size(), name.c_str(), name.c_str());
+    fprintf(stderr, "%s: cell height %d, %u bytes\n", name.c_str(), height, (unsigned)(offset + infos.size() * sizeof(GlyphInfo)));
+  }
+  return 0;
+}
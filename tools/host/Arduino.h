@@ -0,0 +1,77 @@
+// Minimal Arduino core for host builds of the firmware logic (tools/*)
+// Only what src/vehicle.cpp, the screens and friends use; time is driven by the host tool.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include <type_traits>
+#include <chrono>
+
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+#define PROGMEM
+#define HEX 16
+#define DEC 10
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+
+class String {
+  public:
+    String() {}
+    String(const char *value) : mValue(value ? value : "") {}
+    String(const std::string &value) : mValue(value) {}
+    String(char value) : mValue(1, value) {}
+    String(int value, unsigned char base = 10) : mValue(format(base == 16 ? "%x" : "%d", value)) {}
+    String(unsigned int value, unsigned char base = 10) : mValue(format(base == 16 ? "%x" : "%u", value)) {}
+    String(long value, unsigned char base = 10) : mValue(format(base == 16 ? "%lx" : "%ld", value)) {}
+    String(unsigned long value, unsigned char base = 10) : mValue(format(base == 16 ? "%lx" : "%lu", value)) {}
+    String(float value, unsigned int decimals = 2) : mValue(format("%.*f", decimals, (double)value)) {}
+    String(double value, unsigned int decimals = 2) : mValue(format("%.*f", decimals, value)) {}
+
+    String operator+(const String &other) const { return String(mValue + other.mValue); }
+    friend String operator+(const char *left, const String &right) { return String(std::string(left) + right.mValue); }
+    String &operator+=(const String &other) { mValue += other.mValue; return *this; }
+    bool operator==(const String &other) const { return mValue == other.mValue; }
+    bool operator==(const char *other) const { return mValue == other; }
+    bool operator!=(const char *other) const { return mValue != other; }
+    char operator[](unsigned int index) const { return mValue[index]; }
+
+    const char *c_str() const { return mValue.c_str(); }
+    unsigned int length() const { return mValue.size(); }
+
+  private:
+    template <typename... T>
+    static std::string format(const char *fmt, T... args) {
+      char buffer[64];
+      snprintf(buffer, sizeof(buffer), fmt, args...);
+      return buffer;
+    }
+    std::string mValue;
+};
+
+// Host clock, set by the tool (e.g. from trace timestamps)
+extern uint64_t HostMicros;
+inline unsigned long millis() { return HostMicros / 1000; }
+inline unsigned long micros() { return HostMicros; }
+inline void delay(unsigned long) {}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) { return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin; }
+inline long random(long low, long high) { return low + rand() % (high - low); }
+inline long random(long high) { return rand() % high; }
+template <class T> T constrain(T x, T low, T high) { return x < low ? low : (x > high ? high : x); }
+using std::min;
+using std::max;
+
+// Cycle counter of the render benchmark (renderbench.h): nanoseconds of the host, "1000 MHz"
+class EspClass {
+  public:
+    uint32_t getCycleCount() { return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+    uint32_t getCpuFreqMHz() { return 1000; }
+};
+inline EspClass ESP;
@@ -0,0 +1,500 @@
+// Headless TFT_eSPI for host builds of the screens (tools/render.cpp)
+// The panel is an RGB565 array in memory. Implements the TFT_eSPI calls the firmware uses,
+// with the same coordinates, angles (0 = bottom, clockwise), byte order rules (setSwapBytes)
+// and text metrics, so screens render on a workstation and can be compared pixel by pixel
+// between builds. Anti-aliased primitives use their own coverage math: edges are close to,
+// not bit exact with the library.
+//
+// Every object (panel or sprite) counts per primitive the top level calls, the pixels
+// written and the address windows opened (CASET/RASET/RAMWR, what a pixel costs beyond its
+// two bytes on SPI), see HostDrawStatistics. Nested calls (drawRoundRect -> drawFastHLine)
+// count for the primitive the firmware called.
+//
+// Fonts: GLCD (1) and font 2 come from the TFT_eSPI library when its Fonts directory is on
+// the include path (-I .pio/libdeps/<env>/TFT_eSPI), otherwise glyphs are drawn as solid
+// boxes of the same metrics.
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+#if __has_include(<Fonts/glcdfont.c>) && __has_include(<Fonts/Font16.h>)
+#define HOST_TFT_FONTS 1
+#include <Fonts/glcdfont.c>
+#include <Fonts/Font16.h>
+#else
+#define HOST_TFT_FONTS 0
+#endif
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 240
+#endif
+
+enum HostPrimitive : uint8_t {
+  HostFillScreen, HostFillRect, HostDrawPixel, HostDrawFastHLine, HostDrawFastVLine, HostDrawLine, HostFillTriangle,
+  HostDrawRoundRect, HostFillRoundRect, HostFillSmoothRoundRect, HostDrawSmoothCircle, HostDrawSmoothArc, HostDrawSpot,
+  HostPushImage, HostPushImageDMA, HostDrawString, HostPrimitiveCount
+};
+
+constexpr const char *HostPrimitiveNames[HostPrimitiveCount] = {
+  "fillScreen", "fillRect", "drawPixel", "drawFastHLine", "drawFastVLine", "drawLine", "fillTriangle",
+  "drawRoundRect", "fillRoundRect", "fillSmoothRoundRect", "drawSmoothCircle", "drawSmoothArc", "drawSpot",
+  "pushImage", "pushImageDMA", "drawString",
+};
+
+struct HostDrawStatistics {
+  uint32_t calls[HostPrimitiveCount] = {};
+  uint32_t pixels[HostPrimitiveCount] = {};
+  uint32_t windows[HostPrimitiveCount] = {};
+  uint32_t transactions = 0;      // startWrite/endWrite pairs (outermost)
+  uint32_t commands = 0;          // writecommand()
+  int16_t rowFirst = 0;           // rows written, none if rowLast < rowFirst
+  int16_t rowLast = -1;
+
+  uint32_t pixelsTotal() const { uint32_t n = 0; for (uint32_t p : pixels) { n += p; } return n; }
+  uint32_t windowsTotal() const { uint32_t n = 0; for (uint32_t w : windows) { n += w; } return n; }
+  uint32_t callsTotal() const { uint32_t n = 0; for (uint32_t c : calls) { n += c; } return n; }
+  // What the panel would receive: 2 bytes per pixel plus CASET + RASET + RAMWR per window
+  uint32_t spiBytes() const { return pixelsTotal() * 2 + windowsTotal() * 11 + commands; }
+};
+
+class TFT_eSPI {
+  public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT) { resize(w, h, 16); }
+    virtual ~TFT_eSPI() {}
+
+    void init() { std::fill(mMemory.begin(), mMemory.end(), 0); }
+    int16_t width() const { return mWidth; }
+    int16_t height() const { return mHeight; }
+
+    // Host only: statistics since the last reset, pixel read back in RGB565
+    const HostDrawStatistics &hostStats() const { return mStats; }
+    void hostStatsReset() { mStats = HostDrawStatistics(); }
+    uint16_t hostPixel(int32_t x, int32_t y) const {
+      uint32_t i = (uint32_t)y * mWidth + x;
+      if (mDepth == 8) {
+        uint8_t c = mMemory[i];
+        uint16_t r = (c >> 5) & 0x07, g = (c >> 2) & 0x07, b = c & 0x03;
+        return ((r << 2 | r >> 1) << 11) | ((g << 3 | g) << 5) | (b << 3 | b << 1 | b >> 1);
+      }
+      uint16_t c = mMemory[2 * i] | mMemory[2 * i + 1] << 8;
+      return mSwapped ? (uint16_t)(c >> 8 | c << 8) : c;
+    }
+
+    // Host only: false while the panel sleeps (SLPIN) or its display is off (DISPOFF), it shows black then
+    bool hostDisplayOn() const { return mDisplayOn && !mAsleep; }
+
+    // Panel commands: sleep and display on/off are tracked, the memory is kept
+    void writecommand(uint8_t command) {
+      mStats.commands++;
+      switch (command) {
+        case 0x10: mAsleep = true; break;
+        case 0x11: mAsleep = false; break;
+        case 0x28: mDisplayOn = false; break;
+        case 0x29: mDisplayOn = true; break;
+      }
+    }
+    void writedata(uint8_t) { mStats.commands++; }
+
+    // Transactions and DMA: drawing is synchronous, DMA is always available
+    void startWrite() { if (mWriteDepth++ == 0) { mStats.transactions++; } }
+    void endWrite() { if (mWriteDepth) { mWriteDepth--; } }
+    bool initDMA(bool = false) { return true; }
+    void deInitDMA() {}
+    void dmaWait() {}
+    bool dmaBusy() { return false; }
+    void setSwapBytes(bool swap) { mSwapBytes = swap; }
+    bool getSwapBytes() { return mSwapBytes; }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) { return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3; }
+    // alpha 0 = bg .. 255 = fg, same arithmetic as the library
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fg, uint16_t bg) {
+      uint32_t rxb = bg & 0xF81F;
+      rxb += ((fg & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+      uint32_t xgx = bg & 0x07E0;
+      xgx += ((fg & 0x07E0) - xgx) * alpha >> 8;
+      return (rxb & 0xF81F) | (xgx & 0x07E0);
+    }
+
+    // Basic primitives ===================================================================
+
+    void fillScreen(uint32_t color) { Call call(*this, HostFillScreen); block(0, 0, mWidth, mHeight, color); }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) { Call call(*this, HostFillRect); block(x, y, w, h, color); }
+    void drawPixel(int32_t x, int32_t y, uint32_t color) { Call call(*this, HostDrawPixel); block(x, y, 1, 1, color); }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { Call call(*this, HostDrawFastHLine); block(x, y, w, 1, color); }
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { Call call(*this, HostDrawFastVLine); block(x, y, 1, h, color); }
+
+    // Bresenham, straight runs are sent as one line (as TFT_eSPI does)
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+      Call call(*this, HostDrawLine);
+      bool steep = abs(y1 - y0) > abs(x1 - x0);
+      if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+      if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+      int32_t dx = x1 - x0, dy = abs(y1 - y0), error = dx >> 1, step = y0 < y1 ? 1 : -1;
+      int32_t run = x0;
+      for (int32_t x = x0; x <= x1; x++) {
+        error -= dy;
+        if (error < 0 || x == x1) {
+          if (steep) { block(y0, run, 1, x - run + 1, color); } else { block(run, y0, x - run + 1, 1, color); }
+          run = x + 1;
+          if (error < 0) { y0 += step; error += dx; }
+        }
+      }
+    }
+
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color) {
+      Call call(*this, HostFillTriangle);
+      if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+      if (y1 > y2) { std::swap(y2, y1); std::swap(x2, x1); }
+      if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+      if (y0 == y2) {
+        int32_t a = std::min({ x0, x1, x2 }), b = std::max({ x0, x1, x2 });
+        block(a, y0, b - a + 1, 1, color);
+        return;
+      }
+      int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+      int32_t sa = 0, sb = 0, y = y0, last = (y1 == y2) ? y1 : y1 - 1;
+      for (; y <= last; y++) {
+        int32_t a = x0 + sa / dy01, b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b) { std::swap(a, b); }
+        block(a, y, b - a + 1, 1, color);
+      }
+      sa = dx12 * (y - y1);
+      sb = dx02 * (y - y0);
+      for (; y <= y2; y++) {
+        int32_t a = x1 + sa / dy12, b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b) { std::swap(a, b); }
+        block(a, y, b - a + 1, 1, color);
+      }
+    }
+
+    void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+      Call call(*this, HostDrawRoundRect);
+      block(x + r, y, w - 2 * r, 1, color);
+      block(x + r, y + h - 1, w - 2 * r, 1, color);
+      block(x, y + r, 1, h - 2 * r, color);
+      block(x + w - 1, y + r, 1, h - 2 * r, color);
+      circleCorners(x + r, y + r, r, 1, color);
+      circleCorners(x + w - r - 1, y + r, r, 2, color);
+      circleCorners(x + w - r - 1, y + h - r - 1, r, 4, color);
+      circleCorners(x + r, y + h - r - 1, r, 8, color);
+    }
+
+    void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+      Call call(*this, HostFillRoundRect);
+      block(x, y + r, w, h - 2 * r, color);
+      for (int32_t i = 0; i < r; i++) {
+        // Midpoint circle inset of the corner row i above the straight part
+        int32_t dy = r - i, inset = r - (int32_t)floorf(sqrtf((float)(r * r - dy * dy)) + 0.5f);
+        block(x + inset, y + i, w - 2 * inset, 1, color);
+        block(x + inset, y + h - 1 - i, w - 2 * inset, 1, color);
+      }
+    }
+
+    // Anti-aliased primitives ============================================================
+
+    void fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg = 0x00FFFFFF) {
+      Call call(*this, HostFillSmoothRoundRect);
+      float left = x + r, right = x + w - 1 - r, top = y + r, bottom = y + h - 1 - r;
+      smooth(x, y, x + w - 1, y + h - 1, color, bg, [&](float px, float py) {
+        float dx = px < left ? left - px : px > right ? px - right : 0;
+        float dy = py < top ? top - py : py > bottom ? py - bottom : 0;
+        return r + 0.5f - sqrtf(dx * dx + dy * dy);
+      });
+    }
+
+    void drawSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t fg, uint32_t bg) {
+      Call call(*this, HostDrawSmoothCircle);
+      smooth(x - r - 1, y - r - 1, x + r + 1, y + r + 1, fg, bg, [&](float px, float py) {
+        return 1.0f - fabsf(hypotf(px - x, py - y) - r);
+      });
+    }
+
+    void drawSpot(float ax, float ay, float r, uint32_t fg, uint32_t bg = 0x00FFFFFF) {
+      Call call(*this, HostDrawSpot);
+      smooth((int32_t)floorf(ax - r - 1), (int32_t)floorf(ay - r - 1), (int32_t)ceilf(ax + r + 1), (int32_t)ceilf(ay + r + 1), fg, bg,
+             [&](float px, float py) { return r + 0.5f - hypotf(px - ax, py - ay); });
+    }
+
+    // Ring segment between the radii: end < start wraps over 0, 0..360 is the full ring, start == end draws nothing
+    void drawSmoothArc(int32_t x, int32_t y, int32_t r, int32_t ir, uint32_t start, uint32_t end, uint32_t fg, uint32_t bg, bool roundEnds = false) {
+      Call call(*this, HostDrawSmoothArc);
+      const float deg = (float)M_PI / 180.0f;
+      if (start == end) { return; }
+      start = std::min<uint32_t>(start, 360);
+      end = std::min<uint32_t>(end, 360);
+      bool full = start % 360 == end % 360;
+      float mid = (r + ir) / 2.0f, halfWidth = (r - ir) / 2.0f;
+      float capX[2] = { x - sinf(start * deg) * mid, x - sinf(end * deg) * mid };
+      float capY[2] = { y + cosf(start * deg) * mid, y + cosf(end * deg) * mid };
+      smooth(x - r - 1, y - r - 1, x + r + 1, y + r + 1, fg, bg, [&](float px, float py) {
+        float dx = px - x, dy = py - y, d = sqrtf(dx * dx + dy * dy);
+        float coverage = std::min(r + 0.5f - d, d - ir + 0.5f);
+        if (!full) {
+          float angle = atan2f(-dx, dy) / deg;
+          if (angle < 0) { angle += 360; }
+          // Distance (in pixels along the circle) inside the segment, negative outside
+          float fromStart = fmodf(angle - start + 720, 360), toEnd = fmodf(end - angle + 720, 360);
+          float span = fmodf(end - start + 720.0f, 360.0f);
+          float inside = (fromStart <= span) ? std::min(fromStart, toEnd) : -std::min(360 - fromStart, 360 - toEnd);
+          coverage = std::min(coverage, inside * deg * d + 0.5f);
+          if (roundEnds) {
+            for (int i = 0; i < 2; i++) { coverage = std::max(coverage, halfWidth + 0.5f - hypotf(px - capX[i], py - capY[i])); }
+          }
+        }
+        return coverage;
+      });
+    }
+
+    // Images =============================================================================
+
+    // swapBytes false: pixels are high byte first in memory (panel order), true: native RGB565
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) { Call call(*this, HostPushImage); image(x, y, w, h, data); }
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data) { Call call(*this, HostPushImage); image(x, y, w, h, data); }
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t * = nullptr) {
+      Call call(*this, HostPushImageDMA);
+      image(x, y, w, h, data);
+    }
+
+    // Text ===============================================================================
+
+    void setTextColor(uint16_t color) { mTextColor = mTextBackground = color; }
+    void setTextColor(uint16_t color, uint16_t background, bool = false) { mTextColor = color; mTextBackground = background; }
+    void setTextSize(uint8_t size) { mTextSize = size ? size : 1; }
+    void setTextFont(uint8_t font) { mTextFont = font; }
+
+    int16_t drawString(const char *text, int32_t x, int32_t y) { return drawString(text, x, y, mTextFont); }
+    int16_t drawString(const char *text, int32_t x, int32_t y, uint8_t font) {
+      Call call(*this, HostDrawString);
+      int16_t width = textWidth(text, font);
+      for (; *text; text++) { x += drawChar(*text, x, y, font); }
+      return width;
+    }
+    int16_t drawCentreString(const char *text, int32_t x, int32_t y, uint8_t font) { return drawString(text, x - textWidth(text, font) / 2, y, font); }
+    int16_t drawRightString(const char *text, int32_t x, int32_t y, uint8_t font) { return drawString(text, x - textWidth(text, font), y, font); }
+    int16_t drawString(const String &text, int32_t x, int32_t y) { return drawString(text.c_str(), x, y); }
+    int16_t drawString(const String &text, int32_t x, int32_t y, uint8_t font) { return drawString(text.c_str(), x, y, font); }
+    int16_t drawCentreString(const String &text, int32_t x, int32_t y, uint8_t font) { return drawCentreString(text.c_str(), x, y, font); }
+    int16_t drawRightString(const String &text, int32_t x, int32_t y, uint8_t font) { return drawRightString(text.c_str(), x, y, font); }
+
+    int16_t textWidth(const char *text, uint8_t font) {
+      int16_t width = 0;
+      for (; *text; text++) { width += charWidth(*text, font); }
+      return width * mTextSize;
+    }
+    int16_t textWidth(const char *text) { return textWidth(text, mTextFont); }
+    int16_t fontHeight(uint8_t font) { return (font == 2 ? 16 : 8) * mTextSize; }
+    int16_t fontHeight() { return fontHeight(mTextFont); }
+
+  protected:
+    void resize(int16_t w, int16_t h, uint8_t depth) {
+      mWidth = w;
+      mHeight = h;
+      mDepth = depth;
+      mMemory.assign((size_t)w * h * depth / 8, 0);
+    }
+
+    int16_t mWidth = 0, mHeight = 0;
+    uint8_t mDepth = 16;
+    bool mSwapped = false;        // 16 bpp memory high byte first (sprites)
+    std::vector<uint8_t> mMemory;
+
+  private:
+    bool mAsleep = false, mDisplayOn = true;
+
+    // Top level primitive the writes count for
+    struct Call {
+      TFT_eSPI &tft;
+      Call(TFT_eSPI &tft, HostPrimitive primitive) : tft(tft) {
+        if (tft.mCallDepth++ == 0) {
+          tft.mPrimitive = primitive;
+          tft.mStats.calls[primitive]++;
+        }
+      }
+      ~Call() { tft.mCallDepth--; }
+    };
+
+    static uint16_t swap(uint16_t color) { return color >> 8 | color << 8; }
+
+    void store(uint32_t i, uint16_t color) {
+      if (mDepth == 8) {
+        mMemory[i] = ((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3);
+        return;
+      }
+      if (mSwapped) { color = swap(color); }
+      mMemory[2 * i] = color & 0xFF;
+      mMemory[2 * i + 1] = color >> 8;
+    }
+
+    // One address window: clips, counts, calls pixel(column, row) -> color for every visible pixel
+    template <typename F>
+    void window(int32_t x, int32_t y, int32_t w, int32_t h, F pixel) {
+      int32_t x0 = std::max<int32_t>(x, 0), y0 = std::max<int32_t>(y, 0);
+      int32_t x1 = std::min<int32_t>(x + w, mWidth), y1 = std::min<int32_t>(y + h, mHeight);
+      if (x0 >= x1 || y0 >= y1) { return; }
+      mStats.windows[mPrimitive]++;
+      mStats.pixels[mPrimitive] += (x1 - x0) * (y1 - y0);
+      if (mStats.rowLast < mStats.rowFirst || y0 < mStats.rowFirst) { mStats.rowFirst = y0; }
+      if (y1 - 1 > mStats.rowLast) { mStats.rowLast = y1 - 1; }
+      for (int32_t row = y0; row < y1; row++) {
+        for (int32_t column = x0; column < x1; column++) { store((uint32_t)row * mWidth + column, pixel(column - x, row - y)); }
+      }
+    }
+
+    void block(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+      window(x, y, w, h, [color](int32_t, int32_t) { return (uint16_t)color; });
+    }
+
+    // Like the library: the panel and 16 bpp sprites take the data high byte first unless
+    // setSwapBytes(true), 8 bpp sprites read it as RGB565 unless setSwapBytes(true)
+    void image(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+      bool native = mSwapBytes != (mDepth == 8);
+      window(x, y, w, h, [=](int32_t column, int32_t row) {
+        uint16_t color = data[row * w + column];
+        return native ? color : swap(color);
+      });
+    }
+
+    // Rows of the box x0..x1, y0..y1: coverage(x, y) >= 1 is fg (runs sent as one line),
+    // 0 < coverage < 1 fg blended over bg (bg 0x00FFFFFF = over the pixel already there)
+    template <typename F>
+    void smooth(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t fg, uint32_t bg, F coverage) {
+      for (int32_t y = y0; y <= y1; y++) {
+        int32_t run = -1;
+        for (int32_t x = x0; x <= x1 + 1; x++) {
+          float alpha = x <= x1 ? coverage((float)x, (float)y) : 0;
+          if (alpha >= 1.0f) {
+            if (run < 0) { run = x; }
+            continue;
+          }
+          if (run >= 0) {
+            block(run, y, x - run, 1, fg);
+            run = -1;
+          }
+          if (alpha > 0 && x >= 0 && y >= 0 && x < mWidth && y < mHeight) {
+            uint16_t under = bg > 0xFFFF ? hostPixel(x, y) : (uint16_t)bg;
+            block(x, y, 1, 1, alphaBlend((uint8_t)(alpha * 255 + 0.5f), fg, under));
+          }
+        }
+      }
+    }
+
+    // Quarter circle outlines of drawRoundRect: 1 = top left, 2 = top right, 4 = bottom right, 8 = bottom left
+    void circleCorners(int32_t x0, int32_t y0, int32_t r, uint8_t corners, uint32_t color) {
+      int32_t f = 1 - r, ddx = 1, ddy = -2 * r, x = 0, y = r;
+      while (x < y) {
+        if (f >= 0) { y--; ddy += 2; f += ddy; }
+        x++;
+        ddx += 2;
+        f += ddx;
+        if (corners & 4) { block(x0 + x, y0 + y, 1, 1, color); block(x0 + y, y0 + x, 1, 1, color); }
+        if (corners & 2) { block(x0 + x, y0 - y, 1, 1, color); block(x0 + y, y0 - x, 1, 1, color); }
+        if (corners & 8) { block(x0 - y, y0 + x, 1, 1, color); block(x0 - x, y0 + y, 1, 1, color); }
+        if (corners & 1) { block(x0 - y, y0 - x, 1, 1, color); block(x0 - x, y0 - y, 1, 1, color); }
+      }
+    }
+
+    uint8_t charWidth(char c, uint8_t font) {
+      if (font != 2) { return 6; }
+      if ((uint8_t)c < 32 || (uint8_t)c > 127) { return 0; }
+#if HOST_TFT_FONTS
+      return widtbl_f16[c - 32];
+#else
+      return c == ' ' ? 4 : 8;
+#endif
+    }
+
+    // Bit (column, row) of the glyph, column < charWidth
+    bool charBit(char c, uint8_t font, int32_t column, int32_t row) {
+#if HOST_TFT_FONTS
+      if (font != 2) { return column < 5 && (::font[(uint8_t)c * 5 + column] >> row) & 1; }
+      const uint8_t *bits = chrtbl_f16[c - 32];
+      int32_t bytes = (widtbl_f16[c - 32] + 6) / 8;
+      return (bits[row * bytes + column / 8] << (column % 8)) & 0x80;
+#else
+      if (c == ' ') { return false; }
+      return font != 2 ? column < 5 && row < 7 : column >= 1 && column < charWidth(c, font) - 1 && row >= 3 && row < 13;
+#endif
+    }
+
+    // As TFT_eSPI: an opaque size 1 glyph is one window, otherwise every ink pixel (and
+    // background pixel) is a pixel or size x size rectangle
+    int16_t drawChar(char c, int32_t x, int32_t y, uint8_t font) {
+      int32_t width = charWidth(c, font), height = font == 2 ? 16 : 8;
+      if (width == 0) { return 0; }
+      bool opaque = mTextColor != mTextBackground;
+      if (opaque && mTextSize == 1) {
+        window(x, y, width, height, [&](int32_t column, int32_t row) { return charBit(c, font, column, row) ? mTextColor : mTextBackground; });
+        return width;
+      }
+      for (int32_t row = 0; row < height; row++) {
+        for (int32_t column = 0; column < width; column++) {
+          bool ink = charBit(c, font, column, row);
+          if (ink || opaque) { block(x + column * mTextSize, y + row * mTextSize, mTextSize, mTextSize, ink ? mTextColor : mTextBackground); }
+        }
+      }
+      return width * mTextSize;
+    }
+
+    HostDrawStatistics mStats;
+    HostPrimitive mPrimitive = HostFillRect;
+    uint8_t mCallDepth = 0;
+    uint8_t mWriteDepth = 0;
+    bool mSwapBytes = false;
+    uint16_t mTextColor = TFT_WHITE, mTextBackground = TFT_WHITE;
+    uint8_t mTextSize = 1, mTextFont = 1;
+};
+
+// Sprite: same primitives into its own memory, 16 bpp high byte first or 8 bpp RGB332 like
+// TFT_eSprite, so getPointer() can be copied to the panel as the firmware does
+class TFT_eSprite : public TFT_eSPI {
+  public:
+    explicit TFT_eSprite(TFT_eSPI *) : TFT_eSPI(0, 0) { mSwapped = true; }
+
+    void *setColorDepth(int8_t bpp) { mSpriteDepth = bpp == 8 ? 8 : 16; return created() ? createSprite(mWidth, mHeight) : nullptr; }
+    void *createSprite(int16_t w, int16_t h, uint8_t = 1) {
+      resize(w, h, mSpriteDepth);
+      return mMemory.data();
+    }
+    void deleteSprite() { resize(0, 0, mSpriteDepth); }
+    bool created() { return !mMemory.empty(); }
+    void *getPointer() { return mMemory.data(); }
+    void fillSprite(uint32_t color) { fillRect(0, 0, mWidth, mHeight, color); }
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint8_t = 0) { TFT_eSPI::pushImage(x, y, w, h, data); }
+
+  private:
+    uint8_t mSpriteDepth = 16;
+};
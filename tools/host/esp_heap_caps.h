@@ -0,0 +1,13 @@
+// ESP-IDF heap on the host: plain malloc, always enough memory
+
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT 0x04
+#define MALLOC_CAP_DMA 0x08
+
+inline void *heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline void heap_caps_free(void *pointer) { free(pointer); }
+inline size_t heap_caps_get_free_size(uint32_t) { return 4 * 1024 * 1024; }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 4 * 1024 * 1024; }
@@ -0,0 +1,9 @@
+// Flash access on the host: PROGMEM data is ordinary memory
+
+#pragma once
+
+#include <Arduino.h>
+
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
@@ -0,0 +1,83 @@
+// Minimal PNG writer for the host tools
+// RGB 8 bit, deflate stored blocks (no compression, no zlib): the file only depends on the
+// pixels, so two renders can be compared byte by byte (cmp, diff -r).
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+inline uint32_t PngCrc(const uint8_t *data, size_t length, uint32_t crc = 0) {
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) { c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1; }
+      table[n] = c;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) { crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8); }
+  return ~crc;
+}
+
+inline void PngU32(std::vector<uint8_t> &out, uint32_t value) {
+  for (int shift = 24; shift >= 0; shift -= 8) { out.push_back(value >> shift); }
+}
+
+inline void PngChunk(FILE *file, const char *type, const std::vector<uint8_t> &data) {
+  std::vector<uint8_t> chunk;
+  PngU32(chunk, data.size());
+  chunk.insert(chunk.end(), type, type + 4);
+  chunk.insert(chunk.end(), data.begin(), data.end());
+  PngU32(chunk, PngCrc(chunk.data() + 4, chunk.size() - 4));
+  fwrite(chunk.data(), 1, chunk.size(), file);
+}
+
+// pixel(x, y) returns RGB565
+template <typename F>
+bool PngWrite(const char *path, uint32_t width, uint32_t height, F pixel) {
+  std::vector<uint8_t> raw; // filter byte 0 + RGB per row
+  for (uint32_t y = 0; y < height; y++) {
+    raw.push_back(0);
+    for (uint32_t x = 0; x < width; x++) {
+      uint16_t c = pixel(x, y);
+      uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+      raw.push_back(r << 3 | r >> 2);
+      raw.push_back(g << 2 | g >> 4);
+      raw.push_back(b << 3 | b >> 2);
+    }
+  }
+
+  std::vector<uint8_t> zlib = { 0x78, 0x01 };
+  for (size_t at = 0; at < raw.size(); ) {
+    uint16_t length = raw.size() - at > 65535 ? 65535 : raw.size() - at;
+    zlib.push_back(at + length == raw.size() ? 1 : 0); // BFINAL, BTYPE 00 stored
+    zlib.push_back(length & 0xFF);
+    zlib.push_back(length >> 8);
+    zlib.push_back(~length & 0xFF);
+    zlib.push_back((uint16_t)~length >> 8);
+    zlib.insert(zlib.end(), raw.begin() + at, raw.begin() + at + length);
+    at += length;
+  }
+  uint32_t a = 1, b = 0;
+  for (uint8_t byte : raw) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  PngU32(zlib, b << 16 | a);
+
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) { return false; }
+  static const uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  fwrite(signature, 1, sizeof(signature), file);
+  std::vector<uint8_t> header;
+  PngU32(header, width);
+  PngU32(header, height);
+  header.insert(header.end(), { 8, 2, 0, 0, 0 }); // 8 bit, RGB, deflate, adaptive filters, no interlace
+  PngChunk(file, "IHDR", header);
+  PngChunk(file, "IDAT", zlib);
+  PngChunk(file, "IEND", {});
+  return fclose(file) == 0;
+}
@@ -0,0 +1,175 @@
+// Image converter for the firmware: RGB565 -> compressed header (format: src/image.h)
+//
+// Input: binary PPM (P6, any tool exports it, converted to RGB565) or a C array of RGB565
+// values as written by ConvertImageToColor565 (0xABCD, ... with <name>_width/_height).
+// Every image is decoded again with the firmware decoder and compared before it is written.
+//
+// Build & run:
+//   g++ -std=c++17 -O2 -I src tools/imgpack.cpp -o imgpack
+//   ./imgpack boot.ppm img1 > src/img.h            compress, symbol img1 (+ img1_width, img1_height)
+//   ./imgpack -u src/img.h > boot.ppm               decompress back to PPM (lossless)
+
+#include <image.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+struct Image {
+  uint16_t width = 0;
+  uint16_t height = 0;
+  std::vector<uint16_t> pixels;
+};
+
+static bool ReadFile(const char *path, std::string &text) {
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) { return false; }
+  char buffer[65536];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) { text.append(buffer, n); }
+  fclose(f);
+  return true;
+}
+
+// "<name>_width=240" style constants
+static int ReadConstant(const std::string &text, const char *suffix) {
+  size_t pos = text.find(suffix);
+  if (pos == std::string::npos) { return 0; }
+  pos = text.find('=', pos);
+  return pos == std::string::npos ? 0 : atoi(text.c_str() + pos + 1);
+}
+
+static std::vector<unsigned> ReadArray(const std::string &text) {
+  std::vector<unsigned> values;
+  size_t pos = text.find('{');
+  size_t end = text.find('}', pos);
+  while (pos != std::string::npos && (pos = text.find("0x", pos)) < end) {
+    values.push_back(strtoul(text.c_str() + pos, NULL, 16));
+    pos += 2;
+  }
+  return values;
+}
+
+static bool ReadPpm(const std::string &text, Image &image) {
+  unsigned width, height, max;
+  int offset = 0;
+  if (sscanf(text.c_str(), "P6 %u %u %u%n", &width, &height, &max, &offset) != 3 || max != 255) { return false; }
+  offset++; // single whitespace after maxval
+  if (text.size() < offset + (size_t)width * height * 3) { return false; }
+  const uint8_t *rgb = (const uint8_t*)text.data() + offset;
+  image.width = width;
+  image.height = height;
+  for (size_t i = 0; i < (size_t)width * height; i++, rgb += 3) {
+    image.pixels.push_back((rgb[0] & 0xF8) << 8 | (rgb[1] & 0xFC) << 3 | rgb[2] >> 3);
+  }
+  return true;
+}
+
+static bool ReadRaw(const std::string &text, Image &image) {
+  image.width = ReadConstant(text, "_width");
+  image.height = ReadConstant(text, "_height");
+  for (unsigned value : ReadArray(text)) { image.pixels.push_back(value); }
+  return image.width && image.pixels.size() == (size_t)image.width * image.height;
+}
+
+static std::vector<uint8_t> Encode(const Image &image) {
+  std::vector<uint8_t> out = { (uint8_t)image.width, (uint8_t)(image.width >> 8), (uint8_t)image.height, (uint8_t)(image.height >> 8) };
+  uint16_t index[64] = { 0 };
+  uint16_t previous = 0;
+  int run = 0;
+  for (size_t i = 0; i < image.pixels.size(); i++) {
+    uint16_t pixel = image.pixels[i];
+    if (pixel == previous) {
+      if (++run == IMAGE_RUN_MAX) { out.push_back(IMAGE_OP_RUN | (run - 1)); run = 0; }
+      continue;
+    }
+    if (run) { out.push_back(IMAGE_OP_RUN | (run - 1)); run = 0; }
+
+    uint8_t hash = ImageHash(pixel);
+    if (index[hash] == pixel) {
+      out.push_back(IMAGE_OP_INDEX | hash);
+    }
+    else {
+      index[hash] = pixel;
+      int dr = (((pixel >> 11) - (previous >> 11) + 16) & 0x1F) - 16;
+      int dg = ((((pixel >> 5) & 0x3F) - ((previous >> 5) & 0x3F) + 32) & 0x3F) - 32;
+      int db = (((pixel & 0x1F) - (previous & 0x1F) + 16) & 0x1F) - 16;
+      int drg = dr - dg / 2, dbg = db - dg / 2;
+      if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+        out.push_back(IMAGE_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+      }
+      else if (drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7) {
+        out.push_back(IMAGE_OP_LUMA | (dg + 32));
+        out.push_back((drg + 8) << 4 | (dbg + 8));
+      }
+      else {
+        out.push_back(IMAGE_OP_LITERAL);
+        out.push_back(pixel >> 8);
+        out.push_back(pixel & 0xFF);
+      }
+    }
+    previous = pixel;
+  }
+  if (run) { out.push_back(IMAGE_OP_RUN | (run - 1)); }
+  return out;
+}
+
+static Image Decode(const std::vector<uint8_t> &data) {
+  Image image;
+  image.width = ImageWidth(data.data());
+  image.height = ImageHeight(data.data());
+  image.pixels.resize((size_t)image.width * image.height);
+  ImageDecoder decoder(data.data());
+  for (uint16_t y = 0; y < image.height; y++) { decoder.decode(&image.pixels[(size_t)y * image.width], image.width, false); }
+  return image;
+}
+
+static int Usage() {
+  fprintf(stderr, "usage: imgpack <image.ppm|raw array.h> <name>   compressed header to stdout\n"
+                  "       imgpack -u <compressed.h>                 PPM to stdout\n");
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3) { return Usage(); }
+  std::string text;
+
+  if (strcmp(argv[1], "-u") == 0) {
+    if (!ReadFile(argv[2], text)) { fprintf(stderr, "can't read %s\n", argv[2]); return 1; }
+    std::vector<uint8_t> data;
+    for (unsigned value : ReadArray(text)) { data.push_back(value); }
+    if (data.size() < IMAGE_HEADER_SIZE) { fprintf(stderr, "no image data in %s\n", argv[2]); return 1; }
+    Image image = Decode(data);
+    printf("P6\n%u %u\n255\n", image.width, image.height);
+    for (uint16_t pixel : image.pixels) {
+      uint8_t r = pixel >> 11, g = (pixel >> 5) & 0x3F, b = pixel & 0x1F;
+      uint8_t rgb[3] = { (uint8_t)(r << 3 | r >> 2), (uint8_t)(g << 2 | g >> 4), (uint8_t)(b << 3 | b >> 2) };
+      fwrite(rgb, 1, 3, stdout);
+    }
+    return 0;
+  }
+
+  const char *input = argv[1], *name = argv[2];
+  Image image;
+  if (!ReadFile(input, text) || !(ReadPpm(text, image) || ReadRaw(text, image))) {
+    fprintf(stderr, "can't read %s (binary PPM or RGB565 C array expected)\n", input);
+    return 1;
+  }
+  std::vector<uint8_t> data = Encode(image);
+  if (Decode(data).pixels != image.pixels) { fprintf(stderr, "round trip failed\n"); return 1; }
+
+  const char *file = strrchr(input, '/') ? strrchr(input, '/') + 1 : input;
+  printf("// Generated by tools/imgpack.cpp from %s - do not edit\n", file);
+  printf("// Width x Height: %ux%u pixels, RGB565 compressed %zu -> %zu bytes (format: image.h)\n\n",
+         image.width, image.height, image.pixels.size() * 2, data.size());
+  printf("#include <pgmspace.h>\n\n");
+  printf("const int %s_width=%u;\nconst int %s_height=%u;\n\n", name, image.width, name, image.height);
+  printf("const uint8_t %s[] PROGMEM = {", name);
+  for (size_t i = 0; i < data.size(); i++) { printf("%s0x%02X,", i % 24 ? " " : "\n", data[i]); }
+  printf("\n};\n");
+  fprintf(stderr, "%s: %ux%u, %zu -> %zu bytes\n", name, image.width, image.height, image.pixels.size() * 2, data.size());
+  return 0;
+}
@@ -0,0 +1,189 @@
+// Host render of the screens: the firmware drawing code (src/display.cpp, widgets, framebuffer)
+// against the in-memory panel of tools/host/TFT_eSPI.h. A fixed sequence of view models
+// goes through DisplayRender() like on the device (boot, drive, trip result, charging, charge
+// result, sleeping, BT connecting, panel asleep and woken), one PNG per frame plus what it cost: primitive calls,
+// pixels and address windows sent to the panel, the resulting SPI bytes and the rows touched.
+// Frames that only update widgets show how much the incremental drawing saves, the gauge glide
+// frames what a tween step costs.
+//
+// Build & run:
+//   g++ -std=c++17 -O2 -I tools/host -I src -I .pio/libdeps/HWv2viaOTA/TFT_eSPI tools/render.cpp src/display.cpp src/widgets.cpp src/framebuffer.cpp -o render
+//   ./render out [golden]    PNGs into out/ (must exist), compared with golden/ if given: exit code 1 on differences
+// Without the TFT_eSPI include path text is drawn as boxes (see tools/host/TFT_eSPI.h). Render
+// as the device build does with -DGC9A01_DRIVER -DDISPLAY_FRAMEBUFFER_BPP=8 (round clipping,
+// drive and charging screens through the framebuffer); only compare PNGs made with the same flags.
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <png.h>
+#include <display.h>
+#include <widgets.h>
+#include <framebuffer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+uint64_t HostMicros = 0;
+TFT_eSPI tft;
+
+void Log(String message, bool /*RemoteLog*/) { printf("> %s\n", message.c_str()); }
+void Log(String message) { Log(message, false); }
+
+struct Frame {
+  std::string name;
+  std::function<void()> draw;
+};
+
+static std::vector<uint8_t> ReadFile(const std::string &path) {
+  std::vector<uint8_t> data;
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == NULL) { return data; }
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) { data.insert(data.end(), chunk, chunk + n); }
+  fclose(file);
+  return data;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s outdir [goldendir]\n", argv[0]);
+    return 2;
+  }
+  std::string out = argv[1], golden = argc > 2 ? argv[2] : "";
+
+  // View models in the order loop() would post them, entries as ScreenManager counts them
+  DisplayModel m;
+  uint32_t entries = 0;
+  auto enter = [&](Screen screen) {
+    m.screen = screen;
+    m.screenEntry = ++entries;
+  };
+  auto render = [&]() {
+    HostMicros = (uint64_t)m.timeMs * 1000; // render time: gauge tweens
+    DisplayRender(m);
+  };
+
+  m.values.Temp1 = 21;
+  m.values.Temp2 = 23;
+  m.values.Volt = 54.3f;
+  m.values.SoC = 78;
+  m.values.Battery = 12.9f;
+  m.values.Ready = 1;
+  m.values.Gear = GearD;
+  m.statusColor = TFT_GREEN;
+  m.wifiColor = TFT_DARKGREY;
+  m.btColor = TFT_YELLOW;
+  m.canColor = TFT_GREEN;
+  m.txColor = TFT_DARKGREY;
+  m.savedTrips = 2;
+
+  std::vector<Frame> frames = {
+    { "boot", [&]() { DisplayClear(tft, TFT_BLACK); DisplayBoot(); } },
+    { "drive-enter", [&]() { enter(ScreenDrive); render(); } },
+    { "drive-unchanged", [&]() { m.timeMs += 1000; render(); } },
+    { "drive-accelerating", [&]() { m.timeMs += 30; m.values.Current = -60; m.values.Speed = 32; m.values.Volt = 53.1f; render(); } },
+    { "drive-full-power", [&]() { m.timeMs += 30; m.values.Current = -120; m.values.Speed = 45; m.values.Volt = 51.0f; render(); } },
+    { "drive-recuperating", [&]() { m.timeMs += 30; m.values.Current = 25; m.values.Speed = 38; m.values.Volt = 55.2f; render(); } },
+    { "drive-coasting", [&]() { m.timeMs += 30; m.values.Current = -1; m.values.Speed = 36; render(); } },
+    { "drive-history-fill", [&]() { // 5 minutes of samples, one model each (the statistics add up)
+        for (int i = 0; i < HISTORY_SAMPLES; i++) {
+          m.timeMs += HISTORY_SAMPLE_MS;
+          m.history.speed = (uint8_t)(i < 10 ? i * 4 : 40 + 5 * sinf(i * 0.2f));
+          m.history.power = (int16_t)(i < 10 ? 6000 : i % 23 < 4 ? -1500 : 2500 + 1500 * sinf(i * 0.35f));
+          m.historySamples++;
+          render();
+        }
+      } },
+    { "drive-history-sample", [&]() { m.timeMs += HISTORY_SAMPLE_MS; m.history = { 5200, 44 }; m.historySamples++; render(); } },
+    { "drive-trip", [&]() {
+        m.timeMs += 30; m.tripActive = true; m.avgkWh = 9.6f; m.values.SoC = 76; m.wifiColor = TFT_GREEN; m.btColor = TFT_DARKGREY;
+        render();
+      } },
+    { "trip-result", [&]() {
+        m.lastTrip = { 0, 23 * 60000, 12345, 12467, 45, 78, 70, 1310, 180, true };
+        enter(ScreenTripResult); render();
+      } },
+    { "charging-enter", [&]() {
+        m.timeMs = 600000; m.values.Current = -14; m.values.Volt = 53.8f; m.values.SoC = 71; m.charge.startTime = 540000; m.charge.startSoC = 70;
+        enter(ScreenCharging); render();
+      } },
+    { "charging-step", [&]() { m.timeMs += 250; render(); } },
+    { "charging-minute", [&]() { m.timeMs += 60000; m.values.SoC = 72; m.values.Current = -15; render(); } },
+    { "charge-result", [&]() {
+        m.charge.endTime = m.timeMs; m.charge.endSoC = 72; m.charge.chargedWh = 1840;
+        enter(ScreenChargeResult); render();
+      } },
+    { "sleeping-sending", [&]() { m.sleepPhase = SleepSending; m.txColor = TFT_YELLOW; enter(ScreenSleeping); render(); } },
+    { "sleeping-sending-sent", [&]() { m.txColor = TFT_GREEN; render(); } },
+    { "sleeping-asleep", [&]() { m.sleepPhase = SleepAsleep; render(); } },
+    { "bt-connecting", [&]() { m.btTimeout = 5000; enter(ScreenBTConnecting); render(); } },
+    { "sleeping-panel-asleep", [&]() { m.sleepPhase = SleepAsleep; m.power = PowerSleeping; enter(ScreenSleeping); render(); } },
+    { "drive-wake", [&]() { m.timeMs += 60000; m.power = PowerDriving; m.wakeUs = HostMicros; enter(ScreenDrive); render(); } },
+    { "drive-parked-dimmed", [&]() { m.timeMs += 1000; m.values.Ready = 0; m.power = PowerParked; render(); } },
+  };
+
+  // Gauge glides (tween.h): the render task draws the last model again every DISPLAY_TWEEN_FRAME_MS,
+  // each frame only sends the degrees the arc moved. Inserted before the history chart.
+  std::vector<Frame> glides = { { "drive-glide-settled", [&]() { m.timeMs += 1000; m.values.Current = -20; render(); m.timeMs += 1000; render(); } } };
+  for (int current : { -70, -30 }) {
+    std::string name = current == -70 ? "drive-glide-up-" : "drive-glide-down-";
+    glides.push_back({ name + "0", [&, current]() { m.values.Current = current; render(); } });
+    for (int i = 1; i * DISPLAY_TWEEN_FRAME_MS <= DISPLAY_TWEEN_MS + DISPLAY_TWEEN_FRAME_MS; i++) {
+      glides.push_back({ name + std::to_string(i), [&]() { m.timeMs += DISPLAY_TWEEN_FRAME_MS; render(); } });
+    }
+  }
+  auto history = std::find_if(frames.begin(), frames.end(), [](const Frame &frame) { return frame.name == "drive-history-fill"; });
+  frames.insert(history, glides.begin(), glides.end());
+
+  DisplayBegin();
+  printf("fonts: %s, framebuffer: %u bpp, round clipping: %s\n\n", HOST_TFT_FONTS ? "TFT_eSPI" : "boxes (library not on the include path)",
+         FrameBufferStats.bpp, DISPLAY_ROUND_CLIP ? "on" : "off");
+  printf("%-3s %-22s %6s %8s %8s %9s %9s %8s %8s\n", "#", "frame", "calls", "pixels", "windows", "SPI bytes", "rows", "estimate", "host us");
+
+  int differences = 0;
+  for (size_t i = 0; i < frames.size(); i++) {
+    Frame &frame = frames[i];
+    HostMicros = (uint64_t)m.timeMs * 1000;
+    tft.hostStatsReset();
+    auto start = std::chrono::steady_clock::now();
+    frame.draw();
+    FrameBufferSync(tft);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    // Panel side: with the framebuffer the screens draw into the sprite, the panel only gets the pushed rows
+    const HostDrawStatistics &stats = tft.hostStats();
+    char rows[16] = "-";
+    if (stats.rowLast >= stats.rowFirst) { snprintf(rows, sizeof(rows), "%d..%d", stats.rowFirst, stats.rowLast); }
+    printf("%-3zu %-22s %6u %8u %8u %9u %9s %8u %8.0f%s\n", i, frame.name.c_str(), stats.callsTotal(), stats.pixelsTotal(), stats.windowsTotal(),
+           stats.spiBytes(), rows, DisplayStats.pixelsLastFrame, us, tft.hostDisplayOn() ? "" : "  (display off)");
+    std::string breakdown;
+    for (uint8_t p = 0; p < HostPrimitiveCount; p++) {
+      if (stats.calls[p] == 0 && stats.pixels[p] == 0) { continue; }
+      breakdown += std::string("  ") + HostPrimitiveNames[p] + " " + std::to_string(stats.calls[p]) + "/" + std::to_string(stats.pixels[p]) + "/" + std::to_string(stats.windows[p]);
+    }
+    if (!breakdown.empty()) { printf("    calls/pixels/windows:%s\n", breakdown.c_str()); }
+    DisplayStats.pixelsLastFrame = 0; // only set by frames with widgets
+
+    char name[64];
+    snprintf(name, sizeof(name), "%02zu-%s.png", i, frame.name.c_str());
+    std::string path = out + "/" + name;
+    if (!PngWrite(path.c_str(), tft.width(), tft.height(), [](uint32_t x, uint32_t y) { return tft.hostDisplayOn() ? tft.hostPixel(x, y) : (uint16_t)0; })) {
+      perror(path.c_str());
+      return 1;
+    }
+    if (!golden.empty()) {
+      std::vector<uint8_t> expected = ReadFile(golden + "/" + name);
+      if (expected != ReadFile(path)) {
+        printf("    DIFFERS from %s/%s%s\n", golden.c_str(), name, expected.empty() ? " (missing)" : "");
+        differences++;
+      }
+    }
+  }
+
+  if (!golden.empty()) { printf("\n%d of %zu frames differ from %s\n", differences, frames.size(), golden.c_str()); }
+  return differences ? 1 : 0;
+}
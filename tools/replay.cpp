@@ -0,0 +1,137 @@
+// Host replay of a CAN trace through the firmware ingest path:
+// CanDecodeFrame() -> VehicleEnergySample() / CANApplySignals() -> VehicleUpdate() / TripRecording(), the same code loop() runs.
+//
+// Get a trace from the device (Telnet console "trace start" ... "trace stop"), then via USB:
+//   esptool.py read_flash 0x3D0000 0x20000 trace.bin
+// Build & run:
+//   g++ -std=c++17 -O2 -I tools/host -I src tools/replay.cpp src/vehicle.cpp -o replay
+//   ./replay trace.bin [speed] [-q]      speed: 0 = as fast as possible (default), 1 = real time, 10 = 10x
+
+#include <Arduino.h>
+#include <candecoder.h>
+#include <canstats.h>
+#include <cantrace.h>
+#include <vehicle.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define LOOP_INTERVAL_US 25000 // loop() delay on the device
+
+uint64_t HostMicros = 0;
+bool Quiet = false;
+
+void Log(String message, bool RemoteLog) {
+  if (!Quiet) { printf("%10.3f > %s%s\n", HostMicros / 1000000.0, message.c_str(), RemoteLog ? " [remote]" : ""); }
+}
+void Log(String message) { Log(message, false); }
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s trace.bin [speed] [-q]\n", argv[0]);
+    return 2;
+  }
+  double speed = 0;
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "-q") == 0) { Quiet = true; }
+    else { speed = atof(argv[i]); }
+  }
+
+  FILE *file = fopen(argv[1], "rb");
+  if (file == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> trace;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) { trace.insert(trace.end(), chunk, chunk + n); }
+  fclose(file);
+  if (trace.size() < sizeof(CanTraceHeader)) {
+    fprintf(stderr, "%s: too short for a trace\n", argv[1]);
+    return 1;
+  }
+
+  // Header is only written on "trace stop", otherwise read until erased flash
+  CanTraceHeader header;
+  memcpy(&header, trace.data(), sizeof(header));
+  size_t length = trace.size() - sizeof(header);
+  if (header.magic == CAN_TRACE_MAGIC && header.length <= length) {
+    length = header.length;
+    printf("trace: %u records, %u bytes, %u dropped while recording\n", header.records, header.length, header.dropped);
+  }
+  else {
+    printf("trace: no header (recording not stopped), reading until end of data\n");
+  }
+
+  CanTraceReader reader(trace.data() + sizeof(header), length);
+  CanStatistics stats;
+  CanTraceRecord record;
+  unsigned long frames = 0, badLength = 0, unknown = 0, trips = 0, charges = 0;
+  unsigned long canMessagesLastRecived = 0;
+  uint64_t nextLoop = 0;
+  uint64_t lastTimestamp = 0;
+
+  auto wallStart = std::chrono::steady_clock::now();
+  while (reader.next(record)) {
+    // Run loop() iterations that were due before this frame
+    while (nextLoop <= record.timestamp) {
+      HostMicros = nextLoop;
+      uint8_t events = VehicleUpdate(millis(), canMessagesLastRecived);
+      if (events & VEHICLE_EVENT_TRIP_ENDED) { trips++; }
+      if (events & VEHICLE_EVENT_CHARGE_ENDED) { charges++; }
+      nextLoop += LOOP_INTERVAL_US;
+    }
+
+    if (speed > 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)((record.timestamp - lastTimestamp) / speed)));
+    }
+    lastTimestamp = record.timestamp;
+    HostMicros = record.timestamp;
+    frames++;
+    stats.record(record.id, record.len, record.timestamp);
+    if (record.rtr) { continue; }
+
+    canMessagesLastRecived = millis();
+    uint32_t updated = 0;
+    switch (CanDecodeFrame(record.id, record.len, record.data, CanSignalValues, updated)) {
+      case DecodeOK:
+        if (record.id == CanSignalTable[SignalCurrent].id) { VehicleEnergySample(record.timestamp, record.data); }
+        CANApplySignals(updated);
+        break;
+      case DecodeBadLength: badLength++; break;
+      case DecodeUnknownId: unknown++; break;
+    }
+  }
+
+  // Let pending trips/charges time out like on the device
+  for (int i = 0; i < 12000000 / LOOP_INTERVAL_US; i++) {
+    HostMicros = nextLoop;
+    uint8_t events = VehicleUpdate(millis(), canMessagesLastRecived);
+    if (events & VEHICLE_EVENT_TRIP_ENDED) { trips++; }
+    if (events & VEHICLE_EVENT_CHARGE_ENDED) { charges++; }
+    nextLoop += LOOP_INTERVAL_US;
+  }
+  double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  printf("\nframes: %lu  wrong length: %lu  not decoded: %lu\n", frames, badLength, unknown);
+  printf("trace duration: %.1f s  replay: %.3f s  (%.0fx real time, %.0f ns/frame)\n",
+         lastTimestamp / 1000000.0, wallSeconds, wallSeconds > 0 ? lastTimestamp / 1000000.0 / wallSeconds : 0,
+         frames ? wallSeconds * 1e9 / frames : 0);
+  printf("bus load (est.): %.1f%%  peak: %.1f%%\n", stats.loadPermille() / 10.0, stats.loadPeakPermille() / 10.0);
+  for (size_t i = 0; i < CanStatistics::SlotCount; i++) {
+    const CanIdStats &s = stats.slot(i);
+    if (s.frames == 0) { continue; }
+    printf("  %-6s frames %7u  interval min/mean/max %.1f/%.1f/%.1f ms  jitter %.2f ms  gaps %u\n",
+           i == CanStatistics::OtherSlot ? "other" : String(stats.slotId(i), HEX).c_str(), s.frames,
+           s.intervalMin / 1000.0, s.intervalMean() / 1000.0, s.intervalMax / 1000.0, s.jitterUs() / 1000.0, s.gaps);
+  }
+  printf("trips ended: %lu  charges ended: %lu\n", trips, charges);
+  printf("last trip: %.1f km, %d%% SoC, max %d km/h  avg consumption: %.1f kWh/100km\n",
+         (thisTrip.endKM - thisTrip.startKM) / 10, thisTrip.startSoC - thisTrip.endSoC, thisTrip.maxSpeed, avgkWh);
+  printf("last trip energy: consumed %d Wh, recuperated %d Wh  total: consumed %d Wh, recuperated/charged %d Wh (%u samples, %u gaps)\n",
+         thisTrip.consumedWh, thisTrip.recuperatedWh, Energy.total.consumedWh(), Energy.total.recuperatedWh(), Energy.samples(), Energy.gaps());
+  printf("last charge: %d%% -> %d%% in %lu min\n", thisCharge.startSoC, thisCharge.endSoC, (thisCharge.endTime - thisCharge.startTime) / 60000);
+  return 0;
+}